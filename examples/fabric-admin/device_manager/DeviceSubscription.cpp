@@ -70,35 +70,33 @@ void DeviceSubscription::OnAttributeData(const ConcreteDataAttributePath & path,
         VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(NotSpecified, "Failed to read WindowStatus"));
         VerifyOrReturn(windowStatus != Clusters::AdministratorCommissioning::CommissioningWindowStatusEnum::kUnknownEnumValue);
 #if defined(PW_RPC_ENABLED)
+        mChangeDetected |= (mCurrentAdministratorCommissioningAttributes.window_status != static_cast<uint32_t>(windowStatus));
         mCurrentAdministratorCommissioningAttributes.window_status = static_cast<uint32_t>(windowStatus);
 #endif
-        mChangeDetected = true;
         break;
     }
     case Clusters::AdministratorCommissioning::Attributes::AdminFabricIndex::Id: {
 #if defined(PW_RPC_ENABLED)
         FabricIndex fabricIndex;
-        CHIP_ERROR err                                                       = data->Get(fabricIndex);
-        mCurrentAdministratorCommissioningAttributes.has_opener_fabric_index = err == CHIP_NO_ERROR;
-        if (mCurrentAdministratorCommissioningAttributes.has_opener_fabric_index)
-        {
-            mCurrentAdministratorCommissioningAttributes.opener_fabric_index = static_cast<uint32_t>(fabricIndex);
-        }
+        bool hasFabricIndex        = data->Get(fabricIndex) == CHIP_NO_ERROR;
+        uint32_t openerFabricIndex = hasFabricIndex ? static_cast<uint32_t>(fabricIndex) : 0;
+        mChangeDetected |= (hasFabricIndex != mCurrentAdministratorCommissioningAttributes.has_opener_fabric_index) ||
+            (openerFabricIndex != mCurrentAdministratorCommissioningAttributes.opener_fabric_index);
+        mCurrentAdministratorCommissioningAttributes.has_opener_fabric_index = hasFabricIndex;
+        mCurrentAdministratorCommissioningAttributes.opener_fabric_index     = openerFabricIndex;
 #endif
-        mChangeDetected = true;
         break;
     }
     case Clusters::AdministratorCommissioning::Attributes::AdminVendorId::Id: {
 #if defined(PW_RPC_ENABLED)
         VendorId vendorId;
-        CHIP_ERROR err                                                    = data->Get(vendorId);
-        mCurrentAdministratorCommissioningAttributes.has_opener_vendor_id = err == CHIP_NO_ERROR;
-        if (mCurrentAdministratorCommissioningAttributes.has_opener_vendor_id)
-        {
-            mCurrentAdministratorCommissioningAttributes.opener_vendor_id = static_cast<uint32_t>(vendorId);
-        }
+        bool hasVendorId        = data->Get(vendorId) == CHIP_NO_ERROR;
+        uint32_t openerVendorId = hasVendorId ? static_cast<uint32_t>(vendorId) : 0;
+        mChangeDetected |= (hasVendorId != mCurrentAdministratorCommissioningAttributes.has_opener_vendor_id) ||
+            (openerVendorId != mCurrentAdministratorCommissioningAttributes.opener_vendor_id);
+        mCurrentAdministratorCommissioningAttributes.has_opener_vendor_id = hasVendorId;
+        mCurrentAdministratorCommissioningAttributes.opener_vendor_id     = openerVendorId;
 #endif
-        mChangeDetected = true;
         break;
     }
     default:
@@ -108,11 +106,19 @@ void DeviceSubscription::OnAttributeData(const ConcreteDataAttributePath & path,
 
 void DeviceSubscription::OnReportEnd()
 {
-    // Report end is at the end of all attributes (success)
+    // Report end is at the end of all attributes (success). Only forward the attributes when they
+    // changed, so that reports repeating the same values do not cost an RPC to the fabric bridge.
     if (mChangeDetected)
     {
 #if defined(PW_RPC_ENABLED)
-        AdminCommissioningAttributeChanged(mCurrentAdministratorCommissioningAttributes);
+        CHIP_ERROR err = AdminCommissioningAttributeChanged(mCurrentAdministratorCommissioningAttributes);
+        if (err != CHIP_NO_ERROR)
+        {
+            // Keep mChangeDetected set so that the next report end retries the forward.
+            ChipLogError(NotSpecified, "Cannot forward Administrator Commissioning Attribute to fabric bridge %" CHIP_ERROR_FORMAT,
+                         err.Format());
+            return;
+        }
 #else
         ChipLogError(NotSpecified, "Cannot forward Administrator Commissioning Attribute to fabric bridge: RPC not enabled");
 #endif
@@ -249,6 +255,8 @@ CHIP_ERROR DeviceSubscription::StartSubscription(OnDoneCallback onDoneCallback,
     mCurrentAdministratorCommissioningAttributes.window_status =
         static_cast<uint32_t>(Clusters::AdministratorCommissioning::CommissioningWindowStatusEnum::kWindowNotOpen);
 #endif
+    // The priming report is always forwarded
+    mChangeDetected = true;
 
     mOnDoneCallback = onDoneCallback;
     MoveToState(State::Connecting);
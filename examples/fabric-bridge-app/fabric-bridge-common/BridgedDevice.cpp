@@ -98,6 +98,9 @@ void BridgedDevice::SetAdminCommissioningAttributes(const AdminCommissioningAttr
     bool fabricIndexChanged = (aAdminCommissioningAttributes.openerFabricIndex != mAdminCommissioningAttributes.openerFabricIndex);
     bool vendorChanged      = (aAdminCommissioningAttributes.openerVendorId != mAdminCommissioningAttributes.openerVendorId);
 
+    // Nothing to report, avoid scheduling work on the event loop
+    VerifyOrReturn(windowChanged || fabricIndexChanged || vendorChanged);
+
     mAdminCommissioningAttributes = aAdminCommissioningAttributes;
 
     DeviceLayer::SystemLayer().ScheduleLambda([endpointId, windowChanged, fabricIndexChanged, vendorChanged]() {
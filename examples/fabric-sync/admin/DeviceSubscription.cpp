@@ -64,38 +64,32 @@ void DeviceSubscription::OnAttributeData(const ConcreteDataAttributePath & path,
         CHIP_ERROR err = data->Get(windowStatus);
         VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(NotSpecified, "Failed to read WindowStatus"));
         VerifyOrReturn(windowStatus != Clusters::AdministratorCommissioning::CommissioningWindowStatusEnum::kUnknownEnumValue);
+        mChangeDetected |= (windowStatus != mCurrentAdministratorCommissioningAttributes.windowStatus);
         mCurrentAdministratorCommissioningAttributes.windowStatus = windowStatus;
-        mChangeDetected                                           = true;
         break;
     }
     case Clusters::AdministratorCommissioning::Attributes::AdminFabricIndex::Id: {
         FabricIndex fabricIndex;
-        CHIP_ERROR err = data->Get(fabricIndex);
-        if (err == CHIP_NO_ERROR)
+        std::optional<FabricIndex> openerFabricIndex;
+        if (data->Get(fabricIndex) == CHIP_NO_ERROR)
         {
-            mCurrentAdministratorCommissioningAttributes.openerFabricIndex = fabricIndex;
-        }
-        else
-        {
-            mCurrentAdministratorCommissioningAttributes.openerFabricIndex.reset();
+            openerFabricIndex = fabricIndex;
         }
 
-        mChangeDetected = true;
+        mChangeDetected |= (openerFabricIndex != mCurrentAdministratorCommissioningAttributes.openerFabricIndex);
+        mCurrentAdministratorCommissioningAttributes.openerFabricIndex = openerFabricIndex;
         break;
     }
     case Clusters::AdministratorCommissioning::Attributes::AdminVendorId::Id: {
         VendorId vendorId;
-        CHIP_ERROR err = data->Get(vendorId);
-        if (err == CHIP_NO_ERROR)
-        {
-            mCurrentAdministratorCommissioningAttributes.openerVendorId = vendorId;
-        }
-        else
+        std::optional<VendorId> openerVendorId;
+        if (data->Get(vendorId) == CHIP_NO_ERROR)
         {
-            mCurrentAdministratorCommissioningAttributes.openerVendorId.reset();
+            openerVendorId = vendorId;
         }
 
-        mChangeDetected = true;
+        mChangeDetected |= (openerVendorId != mCurrentAdministratorCommissioningAttributes.openerVendorId);
+        mCurrentAdministratorCommissioningAttributes.openerVendorId = openerVendorId;
         break;
     }
     default:
@@ -105,15 +99,18 @@ void DeviceSubscription::OnAttributeData(const ConcreteDataAttributePath & path,
 
 void DeviceSubscription::OnReportEnd()
 {
-    // Report end is at the end of all attributes (success)
+    // Report end is at the end of all attributes (success). Only forward the attributes when they
+    // changed, so that reports repeating the same values do not mark the bridged attributes dirty.
     if (mChangeDetected)
     {
         CHIP_ERROR err =
             bridge::FabricBridge::Instance().AdminCommissioningAttributeChanged(mCurrentAdministratorCommissioningAttributes);
         if (err != CHIP_NO_ERROR)
         {
+            // Keep mChangeDetected set so that the next report end retries the forward.
             ChipLogError(NotSpecified, "Cannot forward Administrator Commissioning Attribute to fabric bridge %" CHIP_ERROR_FORMAT,
                          err.Format());
+            return;
         }
         mChangeDetected = false;
     }
@@ -242,6 +239,8 @@ CHIP_ERROR DeviceSubscription::StartSubscription(OnDoneCallback onDoneCallback,
     mCurrentAdministratorCommissioningAttributes.id = scopedNodeId;
     mCurrentAdministratorCommissioningAttributes.windowStatus =
         Clusters::AdministratorCommissioning::CommissioningWindowStatusEnum::kWindowNotOpen;
+    // The priming report is always forwarded
+    mChangeDetected = true;
 
     mOnDoneCallback = onDoneCallback;
     MoveToState(State::Connecting);
@@ -22,6 +22,7 @@
 #include <platform/PlatformManager.h>
 
 #include <app/InteractionModelEngine.h>
+#include <app/reporting/CostAwareReportSchedulerImpl.h>
 #include <app/clusters/network-commissioning/network-commissioning.h>
 #include <app/server/Dnssd.h>
 #include <app/server/Server.h>
@@ -913,6 +914,13 @@ void ChipLinuxAppMainLoop(AppMainLoopImplementation * impl)
     chip::app::RuntimeOptionsProvider::Instance().SetSimulateNoInternalTime(
         LinuxDeviceOptions::GetInstance().mSimulateNoInternalTime);
 
+    if (LinuxDeviceOptions::GetInstance().mCostAwareReportScheduler)
+    {
+        static app::DefaultTimerDelegate sCostAwareTimerDelegate;
+        static app::reporting::CostAwareReportSchedulerImpl sCostAwareReportScheduler(&sCostAwareTimerDelegate);
+        initParams.reportScheduler = &sCostAwareReportScheduler;
+    }
+
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     initParams.accessRestrictionProvider = exampleAccessRestrictionProvider.get();
 #endif
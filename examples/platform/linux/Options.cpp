@@ -110,6 +110,7 @@ enum
     kDeviceOption_TestEventTriggerEnableKey,
     kTraceTo,
     kOptionSimulateNoInternalTime,
+    kOptionCostAwareReportScheduler,
 #if defined(PW_RPC_ENABLED)
     kOptionRpcServerPort,
 #endif
@@ -214,6 +215,7 @@ OptionDef sDeviceOptionDefs[] = {
     { "trace-to", kArgumentRequired, kTraceTo },
 #endif
     { "simulate-no-internal-time", kNoArgument, kOptionSimulateNoInternalTime },
+    { "cost-aware-report-scheduler", kNoArgument, kOptionCostAwareReportScheduler },
 #if defined(PW_RPC_ENABLED)
     { "rpc-server-port", kArgumentRequired, kOptionRpcServerPort },
 #endif
@@ -392,6 +394,9 @@ const char * sDeviceOptionHelp =
 #endif
     "  --simulate-no-internal-time\n"
     "       Time cluster does not use internal platform time\n"
+    "  --cost-aware-report-scheduler\n"
+    "       Spread the reports of the subscriptions over time based on how expensive they are to generate.\n"
+    "       Meant for mains-powered devices serving many subscribers.\n"
 #if defined(PW_RPC_ENABLED)
     "  --rpc-server-port\n"
     "       Start RPC server on specified port\n"
@@ -779,6 +784,9 @@ bool HandleOption(const char * aProgram, OptionSet * aOptions, int aIdentifier,
     case kOptionSimulateNoInternalTime:
         LinuxDeviceOptions::GetInstance().mSimulateNoInternalTime = true;
         break;
+    case kOptionCostAwareReportScheduler:
+        LinuxDeviceOptions::GetInstance().mCostAwareReportScheduler = true;
+        break;
 #if defined(PW_RPC_ENABLED)
     case kOptionRpcServerPort:
         LinuxDeviceOptions::GetInstance().rpcServerPort = static_cast<uint16_t>(atoi(aValue));
@@ -85,7 +85,8 @@ struct LinuxDeviceOptions
     chip::CSRResponseOptions mCSRResponseOptions;
     uint8_t testEventTriggerEnableKey[16] = { 0 };
     std::vector<std::string> traceTo;
-    bool mSimulateNoInternalTime = false;
+    bool mSimulateNoInternalTime   = false;
+    bool mCostAwareReportScheduler = false;
 #if defined(PW_RPC_ENABLED)
     uint16_t rpcServerPort = 33000;
 #endif
@@ -144,7 +144,7 @@ ALLOW: Dict[str, Set[str]] = {
     'src/app/clusters/camera-av-stream-management-server/camera-av-stream-management-server.cpp': {'set'},
     'src/app/clusters/camera-av-settings-user-level-management-server/camera-av-settings-user-level-management-server.h': {'string', 'vector'},
     'src/app/clusters/webrtc-transport-requestor-server/webrtc-transport-requestor-server.h': {'string', 'vector'},
-    'src/credentials/attestation_verifier/FileAttestationTrustStore.h': {'vector'},
+    'src/credentials/attestation_verifier/FileAttestationTrustStore.h': {'string', 'vector'},
     'src/credentials/attestation_verifier/FileAttestationTrustStore.cpp': {'string'},
     'src/credentials/attestation_verifier/TestDACRevocationDelegateImpl.cpp': {'fstream'},
 
@@ -191,6 +191,7 @@ ALLOW: Dict[str, Set[str]] = {
     'src/lib/support/jsontlv/JsonToTlv.cpp': {'sstream', 'string', 'vector'},
     'src/lib/support/jsontlv/JsonToTlv.h': {'string'},
     'src/lib/support/jsontlv/TlvToJson.h': {'string'},
+    'src/lib/support/jsontlv/TlvToJson.cpp': {'vector'},
     'src/lib/support/jsontlv/TextFormat.h': {'string'},
     'src/lib/support/TemporaryFileStream.h': {'ostream', 'streambuf', 'string'},
     'src/app/icd/client/DefaultICDClientStorage.cpp': {'vector'},
@@ -19,6 +19,7 @@
 #include "system/SystemPacketBuffer.h"
 #include <app/ClusterStateCache.h>
 #include <app/InteractionModelEngine.h>
+#include <lib/support/MemoryAccounting.h>
 #include <tuple>
 
 namespace chip {
@@ -69,6 +70,8 @@ template <bool CanEnableDataCaching>
 CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
                                                                  const StatusIB & aStatus)
 {
+    CHIP_MEMORY_TAG_SCOPE(kClusterStateCache);
+
     AttributeState state;
     bool endpointIsNew = false;
 
@@ -529,15 +532,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std:
                     else
                     {
                         VerifyOrDie(attributeIter.second.template Is<AttributeData>());
-                        TLV::TLVReader bufReader;
-                        bufReader.Init(attributeIter.second.template Get<AttributeData>().Get(),
-                                       attributeIter.second.template Get<AttributeData>().AllocatedSize());
-                        ReturnOnFailure(bufReader.Next());
-                        // Skip to the end of the element.
-                        ReturnOnFailure(bufReader.Skip());
-
-                        // Compute the amount of value data
-                        clusterSize += bufReader.GetLengthRead();
+                        // UpdateCache sizes the buffer to the exact TLV element, so there is no need to parse it again.
+                        clusterSize += attributeIter.second.template Get<AttributeData>().AllocatedSize();
                     }
                 }
                 else
@@ -570,8 +566,8 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::OnUpdateDataVersionFilterLi
     DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder, const Span<AttributePathParams> & aAttributePaths,
     bool & aEncodedDataVersionList)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
     TLV::TLVWriter backup;
+    size_t skippedFilterCount = 0;
 
     // Only put paths into mRequestPathSet if they cover clusters in their entirety and no other path in our path list
     // points to a specific attribute from any of those clusters.
@@ -626,18 +622,25 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::OnUpdateDataVersionFilterLi
             continue;
         }
 
-        SuccessOrExit(err = aDataVersionFilterIBsBuilder.EncodeDataVersionFilterIB(filter.first));
+        CHIP_ERROR err = aDataVersionFilterIBsBuilder.EncodeDataVersionFilterIB(filter.first);
+        if (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL)
+        {
+            // Filter encodings differ in size with their ids and version, so a later one
+            // may still fit: keep going to fill the request as much as possible.
+            aDataVersionFilterIBsBuilder.Rollback(backup);
+            skippedFilterCount++;
+            continue;
+        }
+        ReturnErrorOnFailure(err);
         aEncodedDataVersionList = true;
     }
 
-exit:
-    if (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL)
+    if (skippedFilterCount > 0)
     {
-        ChipLogProgress(DataManagement, "OnUpdateDataVersionFilterList out of space; rolling back");
-        aDataVersionFilterIBsBuilder.Rollback(backup);
-        err = CHIP_NO_ERROR;
+        ChipLogProgress(DataManagement, "OnUpdateDataVersionFilterList out of space; %lu filters skipped",
+                        static_cast<unsigned long>(skippedFilterCount));
     }
-    return err;
+    return CHIP_NO_ERROR;
 }
 
 template <bool CanEnableDataCaching>
@@ -49,6 +49,7 @@
 #include <lib/support/CHIPFaultInjection.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/FibonacciUtils.h>
+#include <lib/support/MemoryAccounting.h>
 #include <lib/support/ReadOnlyBuffer.h>
 #include <protocols/interaction_model/StatusCode.h>
 
@@ -180,7 +181,11 @@ using Protocols::InteractionModel::Status;
 
 Global<InteractionModelEngine> sInteractionModelEngine;
 
-InteractionModelEngine::InteractionModelEngine() : mReportingEngine(this) {}
+InteractionModelEngine::InteractionModelEngine() : mReportingEngine(this)
+{
+    mCommandResponderObjs.SetMemoryTag(Platform::MemoryTag::kCommandHandler);
+    mReadHandlers.SetMemoryTag(Platform::MemoryTag::kReadHandler);
+}
 
 InteractionModelEngine * InteractionModelEngine::GetInstance()
 {
@@ -582,6 +587,8 @@ Status InteractionModelEngine::OnInvokeCommandRequest(Messaging::ExchangeContext
                                                       const PayloadHeader & aPayloadHeader, System::PacketBufferHandle && aPayload,
                                                       bool aIsTimedInvoke)
 {
+    CHIP_MEMORY_TAG_SCOPE(kCommandHandler);
+
     // TODO(#30453): Refactor CommandResponseSender's constructor to accept an exchange context parameter.
     CommandResponseSender * commandResponder = mCommandResponderObjs.CreateObject(this, this);
     if (commandResponder == nullptr)
@@ -724,6 +731,8 @@ Protocols::InteractionModel::Status InteractionModelEngine::OnReadInitialRequest
                                                                                  System::PacketBufferHandle && aPayload,
                                                                                  ReadHandler::InteractionType aInteractionType)
 {
+    CHIP_MEMORY_TAG_SCOPE(kReadHandler);
+
     ChipLogDetail(InteractionModel, "Received %s request",
                   aInteractionType == ReadHandler::InteractionType::Subscribe ? "Subscribe" : "Read");
 
@@ -942,6 +951,8 @@ Protocols::InteractionModel::Status InteractionModelEngine::OnWriteRequest(Messa
                                                                            System::PacketBufferHandle && aPayload,
                                                                            bool aIsTimedWrite)
 {
+    CHIP_MEMORY_TAG_SCOPE(kWriteHandler);
+
     ChipLogDetail(InteractionModel, "Received Write request");
 
     for (auto & writeHandler : mWriteHandlers)
@@ -1648,7 +1659,70 @@ std::optional<DataModel::AttributeEntry> InteractionModelEngine::FindAttributeEn
     return finder.Find(path);
 }
 
-void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths)
+#if CHIP_IM_READ_HANDLER_ARENA
+InteractionModelEngine::FabricArenaUsage * InteractionModelEngine::FindFabricArenaUsage(FabricIndex aFabricIndex)
+{
+    FabricArenaUsage * freeEntry = nullptr;
+    for (auto & entry : mFabricArenaUsage)
+    {
+        if (entry.bytes == 0 && freeEntry == nullptr)
+        {
+            freeEntry = &entry;
+        }
+        else if (entry.bytes != 0 && entry.fabricIndex == aFabricIndex)
+        {
+            return &entry;
+        }
+    }
+    if (freeEntry != nullptr)
+    {
+        freeEntry->fabricIndex = aFabricIndex;
+    }
+    return freeEntry;
+}
+
+size_t InteractionModelEngine::GetFabricArenaUsage(FabricIndex aFabricIndex)
+{
+    FabricArenaUsage * usage = FindFabricArenaUsage(aFabricIndex);
+    return usage == nullptr ? 0 : usage->bytes;
+}
+
+bool InteractionModelEngine::ReserveFabricArenaMemory(FabricIndex aFabricIndex, size_t aBytes)
+{
+    FabricArenaUsage * usage = FindFabricArenaUsage(aFabricIndex);
+    // All the entries are taken by other fabrics, which can only last while the handlers of a removed fabric go away
+    VerifyOrReturnValue(usage != nullptr, false);
+    VerifyOrReturnValue(aBytes <= SIZE_MAX - usage->bytes, false);
+    VerifyOrReturnValue(mFabricArenaBudget == 0 || usage->bytes + aBytes <= mFabricArenaBudget, false);
+
+    usage->bytes += aBytes;
+    return true;
+}
+
+void InteractionModelEngine::ReleaseFabricArenaMemory(FabricIndex aFabricIndex, size_t aBytes)
+{
+    FabricArenaUsage * usage = FindFabricArenaUsage(aFabricIndex);
+    VerifyOrDie(usage != nullptr && usage->bytes >= aBytes);
+    usage->bytes -= aBytes;
+}
+#endif // CHIP_IM_READ_HANDLER_ARENA
+
+bool InteractionModelEngine::HasEventPaths()
+{
+#if CHIP_IM_READ_HANDLER_ARENA
+    bool hasEventPaths = false;
+    mReadHandlers.ForEachActiveObject([&hasEventPaths](ReadHandler * handler) {
+        hasEventPaths = handler->GetEventPathList() != nullptr;
+        return hasEventPaths ? Loop::Break : Loop::Continue;
+    });
+    return hasEventPaths;
+#else
+    return mEventPathPool.Allocated() != 0;
+#endif // CHIP_IM_READ_HANDLER_ARENA
+}
+
+void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths,
+                                                                  PathListStorage aStorage)
 {
     SingleLinkedListNode<AttributePathParams> * prev = nullptr;
     auto * path1                                     = aAttributePaths;
@@ -1691,17 +1765,20 @@ void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedLi
             continue;
         }
 
+        auto * duplicatePath = path1;
         if (path1 == aAttributePaths)
         {
             aAttributePaths = path1->mpNext;
-            mAttributePathPool.ReleaseObject(path1);
-            path1 = aAttributePaths;
+            path1           = aAttributePaths;
         }
         else
         {
             prev->mpNext = path1->mpNext;
-            mAttributePathPool.ReleaseObject(path1);
-            path1 = prev->mpNext;
+            path1        = prev->mpNext;
+        }
+        if (aStorage == PathListStorage::kPathPool)
+        {
+            mAttributePathPool.ReleaseObject(duplicatePath);
         }
     }
 }
@@ -206,9 +206,44 @@ public:
     CHIP_ERROR PushFrontAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePathList,
                                           AttributePathParams & aAttributePath);
 
+    // Where the nodes of a path list were allocated from.
+    enum class PathListStorage : uint8_t
+    {
+        kPathPool, // The path pools of the engine
+        kArena,    // The arena of a ReadHandler, which reclaims the nodes all at once
+    };
+
     // If a concrete path indicates an attribute that is also referenced by a wildcard path in the request,
-    // the path SHALL be removed from the list.
-    void RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths);
+    // the path SHALL be removed from the list. Removed nodes are released to the path pool, or only unlinked
+    // for lists allocated from an arena.
+    void RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths,
+                                              PathListStorage aStorage = PathListStorage::kPathPool);
+
+#if CHIP_IM_READ_HANDLER_ARENA
+    /**
+     * Limit the arena memory that the ReadHandlers of each fabric can hold, in bytes. 0 means no limit. Defaults to
+     * CHIP_IM_READ_HANDLER_ARENA_FABRIC_BUDGET. Reads and subscriptions that would exceed the budget of their fabric
+     * fail with PathsExhausted.
+     */
+    void SetFabricArenaBudget(size_t aBytes) { mFabricArenaBudget = aBytes; }
+
+    /**
+     * Returns the arena memory currently held by the ReadHandlers of a fabric.
+     */
+    size_t GetFabricArenaUsage(FabricIndex aFabricIndex);
+
+    /**
+     * Charge aBytes of arena memory to a fabric, if that fits within its budget.
+     *
+     * @return false if the budget of the fabric does not allow it.
+     */
+    bool ReserveFabricArenaMemory(FabricIndex aFabricIndex, size_t aBytes);
+
+    /**
+     * Give back arena memory charged to a fabric with ReserveFabricArenaMemory.
+     */
+    void ReleaseFabricArenaMemory(FabricIndex aFabricIndex, size_t aBytes);
+#endif // CHIP_IM_READ_HANDLER_ARENA
 
     void ReleaseEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList);
 
@@ -640,6 +675,11 @@ private:
 
     static void ResumeSubscriptionsTimerCallback(System::Layer * apSystemLayer, void * apAppState);
 
+    /**
+     * Returns whether any ReadHandler is interested in events.
+     */
+    bool HasEventPaths();
+
     template <typename T, size_t N>
     void ReleasePool(SingleLinkedListNode<T> *& aObjectList, ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool);
     template <typename T, size_t N>
@@ -685,6 +725,21 @@ private:
 
     ObjectPool<ReadHandler, CHIP_IM_MAX_NUM_READS + CHIP_IM_MAX_NUM_SUBSCRIPTIONS> mReadHandlers;
 
+#if CHIP_IM_READ_HANDLER_ARENA
+    // Arena memory held by the ReadHandlers of a fabric. An entry is free when it holds no memory.
+    struct FabricArenaUsage
+    {
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        size_t bytes            = 0;
+    };
+
+    FabricArenaUsage * FindFabricArenaUsage(FabricIndex aFabricIndex);
+
+    size_t mFabricArenaBudget = CHIP_IM_READ_HANDLER_ARENA_FABRIC_BUDGET;
+    // One more than the fabrics, for the handlers on PASE sessions
+    FabricArenaUsage mFabricArenaUsage[CHIP_CONFIG_MAX_FABRICS + 1];
+#endif // CHIP_IM_READ_HANDLER_ARENA
+
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
     ReadClient * mpActiveReadClientList = nullptr;
 #endif
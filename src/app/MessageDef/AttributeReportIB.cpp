@@ -100,6 +100,113 @@ CHIP_ERROR AttributeReportIB::Parser::GetAttributeData(AttributeDataIB::Parser *
     return apAttributeData->Init(reader);
 }
 
+namespace {
+CHIP_ERROR FastParseAttributePath(TLV::TLVReader & aReader, ConcreteDataAttributePath & aAttributePath)
+{
+    CHIP_ERROR err;
+    TLV::TLVType containerType;
+    uint32_t previousTagNum = 0;
+    bool first              = true;
+    bool hasEndpoint        = false;
+    bool hasCluster         = false;
+    bool hasAttribute       = false;
+
+    aAttributePath.mListOp = ConcreteDataAttributePath::ListOperation::NotList;
+
+    ReturnErrorOnFailure(aReader.EnterContainer(containerType));
+    while (CHIP_NO_ERROR == (err = aReader.Next()))
+    {
+        // Unique tags in increasing order guarantee that the values read here are the ones
+        // AttributePathIB::Parser would find.
+        VerifyOrReturnError(TLV::IsContextTag(aReader.GetTag()), CHIP_ERROR_INVALID_TLV_TAG);
+        uint32_t tagNum = TLV::TagNumFromTag(aReader.GetTag());
+        VerifyOrReturnError(first || previousTagNum < tagNum, CHIP_ERROR_INVALID_TLV_TAG);
+        previousTagNum = tagNum;
+        first          = false;
+
+        switch (tagNum)
+        {
+        case to_underlying(AttributePathIB::Tag::kEndpoint):
+            VerifyOrReturnError(aReader.GetType() == TLV::kTLVType_UnsignedInteger, CHIP_ERROR_WRONG_TLV_TYPE);
+            ReturnErrorOnFailure(aReader.Get(aAttributePath.mEndpointId));
+            hasEndpoint = true;
+            break;
+        case to_underlying(AttributePathIB::Tag::kCluster):
+            VerifyOrReturnError(aReader.GetType() == TLV::kTLVType_UnsignedInteger, CHIP_ERROR_WRONG_TLV_TYPE);
+            ReturnErrorOnFailure(aReader.Get(aAttributePath.mClusterId));
+            hasCluster = true;
+            break;
+        case to_underlying(AttributePathIB::Tag::kAttribute):
+            VerifyOrReturnError(aReader.GetType() == TLV::kTLVType_UnsignedInteger, CHIP_ERROR_WRONG_TLV_TYPE);
+            ReturnErrorOnFailure(aReader.Get(aAttributePath.mAttributeId));
+            hasAttribute = true;
+            break;
+        case to_underlying(AttributePathIB::Tag::kListIndex):
+            // Only list appends are valid in a concrete path
+            VerifyOrReturnError(aReader.GetType() == TLV::kTLVType_Null, CHIP_ERROR_IM_MALFORMED_ATTRIBUTE_PATH_IB);
+            aAttributePath.mListOp = ConcreteDataAttributePath::ListOperation::AppendItem;
+            break;
+        default:
+            // Not part of a concrete path, ignored like AttributePathIB::Parser does
+            break;
+        }
+    }
+    VerifyOrReturnError(CHIP_END_OF_TLV == err, err);
+    VerifyOrReturnError(hasEndpoint && hasCluster && hasAttribute, CHIP_ERROR_IM_MALFORMED_ATTRIBUTE_PATH_IB);
+    return aReader.ExitContainer(containerType);
+}
+
+CHIP_ERROR FastParseAttributeDataIB(TLV::TLVReader & aReader, ConcreteDataAttributePath & aAttributePath,
+                                    TLV::TLVReader & aDataReader)
+{
+    TLV::TLVType containerType;
+    DataVersion version = 0;
+
+    ReturnErrorOnFailure(aReader.EnterContainer(containerType));
+
+    ReturnErrorOnFailure(
+        aReader.Next(TLV::kTLVType_UnsignedInteger, TLV::ContextTag(to_underlying(AttributeDataIB::Tag::kDataVersion))));
+    ReturnErrorOnFailure(aReader.Get(version));
+
+    ReturnErrorOnFailure(aReader.Next(TLV::kTLVType_List, TLV::ContextTag(to_underlying(AttributeDataIB::Tag::kPath))));
+    ReturnErrorOnFailure(FastParseAttributePath(aReader, aAttributePath));
+    VerifyOrReturnError(aAttributePath.IsValid(), CHIP_IM_GLOBAL_STATUS(InvalidAction));
+    aAttributePath.mDataVersion.SetValue(version);
+
+    ReturnErrorOnFailure(aReader.Next(TLV::ContextTag(to_underlying(AttributeDataIB::Tag::kData))));
+    aDataReader.Init(aReader);
+
+    VerifyOrReturnError(CHIP_END_OF_TLV == aReader.Next(), CHIP_ERROR_UNEXPECTED_TLV_ELEMENT);
+    return aReader.ExitContainer(containerType);
+}
+} // namespace
+
+bool AttributeReportIB::FastParseAttributeData(const TLV::TLVReader & aReader, ConcreteDataAttributePath & aAttributePath,
+                                               TLV::TLVReader & aDataReader)
+{
+    TLV::TLVReader reader;
+    TLV::TLVReader dataReader;
+    TLV::TLVType containerType;
+    ConcreteDataAttributePath attributePath;
+
+    reader.Init(aReader);
+    VerifyOrReturnValue(TLV::kTLVType_Structure == reader.GetType(), false);
+    VerifyOrReturnValue(CHIP_NO_ERROR == reader.EnterContainer(containerType), false);
+
+    VerifyOrReturnValue(CHIP_NO_ERROR ==
+                            reader.Next(TLV::kTLVType_Structure, TLV::ContextTag(to_underlying(Tag::kAttributeData))),
+                        false);
+    VerifyOrReturnValue(CHIP_NO_ERROR == FastParseAttributeDataIB(reader, attributePath, dataReader), false);
+
+    VerifyOrReturnValue(CHIP_END_OF_TLV == reader.Next(), false);
+    VerifyOrReturnValue(CHIP_NO_ERROR == reader.ExitContainer(containerType), false);
+
+    // Outputs are only updated on success, as the caller falls back to the generic parsers otherwise
+    aAttributePath = attributePath;
+    aDataReader.Init(dataReader);
+    return true;
+}
+
 AttributeStatusIB::Builder & AttributeReportIB::Builder::CreateAttributeStatus()
 {
     if (mError == CHIP_NO_ERROR)
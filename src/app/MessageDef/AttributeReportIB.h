@@ -97,6 +97,24 @@ private:
     AttributeStatusIB::Builder mAttributeStatus;
     AttributeDataIB::Builder mAttributeData;
 };
+
+/**
+ *  @brief Decode an AttributeReportIB carrying AttributeData in a single pass over the TLV.
+ *
+ *  Only the encoding generated by servers for attribute data is handled: an AttributeDataIB containing the
+ *  data version, a path with endpoint, cluster, attribute and optionally a null list index, followed by the
+ *  data, with context tags in increasing order.  Anything else (attribute status, unknown fields,
+ *  out-of-range ids, malformed TLV...) is not decoded and must be processed with AttributeReportIB::Parser,
+ *  which returns the same path, version and data for all reports accepted here.
+ *
+ *  @param [in]  aReader         A TLVReader positioned on the AttributeReportIB
+ *  @param [out] aAttributePath  The concrete path of the data, including its data version and list operation
+ *  @param [out] aDataReader     A TLVReader positioned on the attribute data
+ *
+ *  @return true if the report was decoded, false if it must be processed with AttributeReportIB::Parser
+ */
+bool FastParseAttributeData(const TLV::TLVReader & aReader, ConcreteDataAttributePath & aAttributePath,
+                            TLV::TLVReader & aDataReader);
 } // namespace AttributeReportIB
 } // namespace app
 } // namespace chip
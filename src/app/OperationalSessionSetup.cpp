@@ -448,6 +448,12 @@ void OperationalSessionSetup::OnSessionEstablishmentError(CHIP_ERROR error, Sess
         ReliableMessageProtocolConfig remoteMprConfig = mCASEClient->GetRemoteMRPIntervals();
 #endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
 
+        if (CHIP_ERROR_TIMEOUT == error)
+        {
+            // The peer did not answer at the resolved address, which may be stale.
+            InvalidateCachedPeerAddress();
+        }
+
         // Move to the ResolvingAddress state, in case we have more results,
         // since we expect to receive results in that state.
         MoveToState(State::ResolvingAddress);
@@ -612,6 +618,14 @@ CHIP_ERROR OperationalSessionSetup::LookupPeerAddress()
     return Resolver::Instance().LookupNode(request, mAddressLookupHandle);
 }
 
+void OperationalSessionSetup::InvalidateCachedPeerAddress()
+{
+    auto const * fabricInfo = mInitParams.fabricTable->FindFabricWithIndex(mPeerId.GetFabricIndex());
+    VerifyOrReturn(fabricInfo != nullptr);
+
+    Resolver::Instance().InvalidateCachedResult(PeerId(fabricInfo->GetCompressedFabricId(), mPeerId.GetNodeId()));
+}
+
 void OperationalSessionSetup::PerformAddressUpdate()
 {
     if (mPerformingAddressUpdate)
@@ -626,6 +640,8 @@ void OperationalSessionSetup::PerformAddressUpdate()
     VerifyOrDie(mState == State::NeedsAddress);
 
     // We are doing an address lookup whether we have an active session for this peer or not.
+    // The peer is not reachable at its last known address, so do not reuse it.
+    InvalidateCachedPeerAddress();
     mPerformingAddressUpdate = true;
     MoveToState(State::ResolvingAddress);
     CHIP_ERROR err = LookupPeerAddress();
@@ -675,6 +691,8 @@ void OperationalSessionSetup::OnNodeAddressResolutionFailed(const PeerId & peerI
 
         MATTER_LOG_METRIC(kMetricDeviceOperationalDiscoveryAttemptCount, mAttemptsDone);
 
+        // A retry is meant to query the network again, not to hit a cached failure.
+        InvalidateCachedPeerAddress();
         CHIP_ERROR err = LookupPeerAddress();
         if (err == CHIP_NO_ERROR)
         {
@@ -416,6 +416,12 @@ private:
      */
     CHIP_ERROR LookupPeerAddress();
 
+    /**
+     * Drops any cached address of the peer, so that the next lookup queries
+     * DNSSD again. Used when the previously resolved address did not work.
+     */
+    void InvalidateCachedPeerAddress();
+
     /**
      * This function will set new IP address, port and MRP retransmission intervals of the device.
      */
@@ -443,13 +443,11 @@ CHIP_ERROR ReadClient::BuildDataVersionFilterList(DataVersionFilterIBs::Builder
         }
         else if (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL)
         {
-            // Packet is full, ignore the rest of the list
+            // Packet is full for this filter, but a later one with a shorter encoding may still fit
             aDataVersionFilterIBsBuilder.Rollback(backup);
 #if CHIP_PROGRESS_LOGGING
-            ssize_t nonSkippedFilterCount = &filter - aDataVersionFilters.data();
-            skippedFilterCount            = aDataVersionFilters.size() - static_cast<size_t>(nonSkippedFilterCount);
+            ++skippedFilterCount;
 #endif // CHIP_PROGRESS_LOGGING
-            break;
         }
         else
         {
@@ -790,6 +788,39 @@ void ReadClient::NoteReportingData()
     }
 }
 
+void ReadClient::ProcessAttributeData(ConcreteDataAttributePath & aAttributePath, TLV::TLVReader & aDataReader)
+{
+    // The element in an array may be another array -- so we should only set the list operation when we are handling the
+    // whole list.
+    if (!aAttributePath.IsListOperation() && aDataReader.GetType() == TLV::kTLVType_Array)
+    {
+        aAttributePath.mListOp = ConcreteDataAttributePath::ListOperation::ReplaceAll;
+    }
+
+    if (aAttributePath.MatchesConcreteAttributePath(ConcreteAttributePath(
+            kRootEndpointId, Clusters::IcdManagement::Id, Clusters::IcdManagement::Attributes::OperatingMode::Id)))
+    {
+        PeerType peerType;
+        TLV::TLVReader operatingModeTlvReader;
+        operatingModeTlvReader.Init(aDataReader);
+        CHIP_ERROR err = ReadICDOperatingModeFromAttributeDataIB(std::move(operatingModeTlvReader), peerType);
+        if (CHIP_NO_ERROR == err)
+        {
+            // It is safe to call `OnPeerTypeChange` since we are in the middle of parsing the attribute data, And
+            // the subscription should be active so `OnActiveModeNotification` is a no-op in this case.
+            InteractionModelEngine::GetInstance()->OnPeerTypeChange(mPeer, peerType);
+        }
+        else
+        {
+            ChipLogError(DataManagement, "Failed to get ICD state from attribute data with error'%" CHIP_ERROR_FORMAT "'",
+                         err.Format());
+        }
+    }
+
+    NoteReportingData();
+    mpCallback.OnAttributeData(aAttributePath, &aDataReader, StatusIB());
+}
+
 CHIP_ERROR ReadClient::ProcessAttributeReportIBs(TLV::TLVReader & aAttributeReportIBsReader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -803,6 +834,19 @@ CHIP_ERROR ReadClient::ProcessAttributeReportIBs(TLV::TLVReader & aAttributeRepo
         ConcreteDataAttributePath attributePath;
         StatusIB statusIB;
 
+        // Most reports are attribute data encoded exactly as servers generate them, which can be decoded
+        // in a single pass. Everything else goes through the generic parsers below.
+        if (AttributeReportIB::FastParseAttributeData(aAttributeReportIBsReader, attributePath, dataReader))
+        {
+            if (mReadPrepareParams.mpDataVersionFilterList != nullptr)
+            {
+                UpdateDataVersionFilters(attributePath);
+            }
+
+            ProcessAttributeData(attributePath, dataReader);
+            continue;
+        }
+
         TLV::TLVReader reader = aAttributeReportIBsReader;
         ReturnErrorOnFailure(report.Init(reader));
 
@@ -854,35 +898,7 @@ CHIP_ERROR ReadClient::ProcessAttributeReportIBs(TLV::TLVReader & aAttributeRepo
             }
 
             ReturnErrorOnFailure(data.GetData(&dataReader));
-
-            // The element in an array may be another array -- so we should only set the list operation when we are handling the
-            // whole list.
-            if (!attributePath.IsListOperation() && dataReader.GetType() == TLV::kTLVType_Array)
-            {
-                attributePath.mListOp = ConcreteDataAttributePath::ListOperation::ReplaceAll;
-            }
-
-            if (attributePath.MatchesConcreteAttributePath(ConcreteAttributePath(
-                    kRootEndpointId, Clusters::IcdManagement::Id, Clusters::IcdManagement::Attributes::OperatingMode::Id)))
-            {
-                PeerType peerType;
-                TLV::TLVReader operatingModeTlvReader;
-                operatingModeTlvReader.Init(dataReader);
-                if (CHIP_NO_ERROR == ReadICDOperatingModeFromAttributeDataIB(std::move(operatingModeTlvReader), peerType))
-                {
-                    // It is safe to call `OnPeerTypeChange` since we are in the middle of parsing the attribute data, And
-                    // the subscription should be active so `OnActiveModeNotification` is a no-op in this case.
-                    InteractionModelEngine::GetInstance()->OnPeerTypeChange(mPeer, peerType);
-                }
-                else
-                {
-                    ChipLogError(DataManagement, "Failed to get ICD state from attribute data with error'%" CHIP_ERROR_FORMAT "'",
-                                 err.Format());
-                }
-            }
-
-            NoteReportingData();
-            mpCallback.OnAttributeData(attributePath, &dataReader, statusIB);
+            ProcessAttributeData(attributePath, dataReader);
         }
     }
 
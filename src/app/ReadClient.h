@@ -574,6 +574,7 @@ private:
                                           const Span<DataVersionFilter> & aDataVersionFilters, bool & aEncodedDataVersionList);
     CHIP_ERROR ReadICDOperatingModeFromAttributeDataIB(TLV::TLVReader && aReader, PeerType & aType);
     CHIP_ERROR ProcessAttributeReportIBs(TLV::TLVReader & aAttributeDataIBsReader);
+    void ProcessAttributeData(ConcreteDataAttributePath & aAttributePath, TLV::TLVReader & aDataReader);
     CHIP_ERROR ProcessEventReportIBs(TLV::TLVReader & aEventReportIBsReader);
 
     static void OnLivenessTimeoutCallback(System::Layer * apSystemLayer, void * apAppState);
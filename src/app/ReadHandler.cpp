@@ -93,12 +93,15 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
     mMaxInterval             = resumptionSessionEstablisher.mSubscriptionInfo.mMaxInterval;
     SetStateFlag(ReadHandlerFlags::FabricFiltered, resumptionSessionEstablisher.mSubscriptionInfo.mFabricFiltered);
 
+    // Hold the session first, so that the paths are accounted to its fabric
+    mSessionHandle.Grab(sessionHandle);
+
     // Move dynamically allocated attributes and events from the SubscriptionInfo struct into
-    // the object pool managed by the IM engine
+    // the storage of this handler
     for (size_t i = 0; i < resumptionSessionEstablisher.mSubscriptionInfo.mAttributePaths.AllocatedSize(); i++)
     {
         AttributePathParams params = resumptionSessionEstablisher.mSubscriptionInfo.mAttributePaths[i].GetParams();
-        CHIP_ERROR err = mManagementCallback.GetInteractionModelEngine()->PushFrontAttributePathList(mpAttributePathList, params);
+        CHIP_ERROR err             = AddAttributePath(params);
         if (err != CHIP_NO_ERROR)
         {
             Close();
@@ -108,7 +111,7 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
     for (size_t i = 0; i < resumptionSessionEstablisher.mSubscriptionInfo.mEventPaths.AllocatedSize(); i++)
     {
         EventPathParams params = resumptionSessionEstablisher.mSubscriptionInfo.mEventPaths[i].GetParams();
-        CHIP_ERROR err = mManagementCallback.GetInteractionModelEngine()->PushFrontEventPathParamsList(mpEventPathList, params);
+        CHIP_ERROR err         = AddEventPath(params);
         if (err != CHIP_NO_ERROR)
         {
             Close();
@@ -116,8 +119,6 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
         }
     }
 
-    mSessionHandle.Grab(sessionHandle);
-
     SetStateFlag(ReadHandlerFlags::ActiveSubscription);
 
     auto * appCallback = mManagementCallback.GetAppCallback();
@@ -155,9 +156,11 @@ ReadHandler::~ReadHandler()
     {
         mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().OnReportConfirm();
     }
+#if !CHIP_IM_READ_HANDLER_ARENA
     mManagementCallback.GetInteractionModelEngine()->ReleaseAttributePathList(mpAttributePathList);
     mManagementCallback.GetInteractionModelEngine()->ReleaseEventPathList(mpEventPathList);
     mManagementCallback.GetInteractionModelEngine()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
+#endif // !CHIP_IM_READ_HANDLER_ARENA
 }
 
 void ReadHandler::Close(CloseOptions options)
@@ -363,7 +366,7 @@ CHIP_ERROR ReadHandler::SendReportData(System::PacketBufferHandle && aPayload, b
     {
         mPreviousReportsBeginGeneration = mCurrentReportsBeginGeneration;
         ClearForceDirtyFlag();
-        mManagementCallback.GetInteractionModelEngine()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
+        ReleaseDataVersionFilters();
     }
 
     return err;
@@ -492,6 +495,9 @@ CHIP_ERROR ReadHandler::ProcessAttributePaths(AttributePathIBs::Parser & aAttrib
     CHIP_ERROR err = CHIP_NO_ERROR;
     TLV::TLVReader reader;
     aAttributePathListParser.GetReader(&reader);
+#if CHIP_IM_READ_HANDLER_ARENA
+    ReserveArenaNodes(mPathArena, reader, sizeof(SingleLinkedListNode<AttributePathParams>));
+#endif // CHIP_IM_READ_HANDLER_ARENA
     while (CHIP_NO_ERROR == (err = reader.Next()))
     {
         VerifyOrReturnError(TLV::AnonymousTag() == reader.GetTag(), CHIP_ERROR_INVALID_TLV_TAG);
@@ -499,13 +505,17 @@ CHIP_ERROR ReadHandler::ProcessAttributePaths(AttributePathIBs::Parser & aAttrib
         AttributePathIB::Parser path;
         ReturnErrorOnFailure(path.Init(reader));
         ReturnErrorOnFailure(path.ParsePath(attribute));
-        ReturnErrorOnFailure(
-            mManagementCallback.GetInteractionModelEngine()->PushFrontAttributePathList(mpAttributePathList, attribute));
+        ReturnErrorOnFailure(AddAttributePath(attribute));
     }
     // if we have exhausted this container
     if (CHIP_END_OF_TLV == err)
     {
+#if CHIP_IM_READ_HANDLER_ARENA
+        mManagementCallback.GetInteractionModelEngine()->RemoveDuplicateConcreteAttributePath(
+            mpAttributePathList, InteractionModelEngine::PathListStorage::kArena);
+#else
         mManagementCallback.GetInteractionModelEngine()->RemoveDuplicateConcreteAttributePath(mpAttributePathList);
+#endif // CHIP_IM_READ_HANDLER_ARENA
         mAttributePathExpandPosition = AttributePathExpandIterator::Position::StartIterating(mpAttributePathList);
         err                          = CHIP_NO_ERROR;
     }
@@ -518,6 +528,9 @@ CHIP_ERROR ReadHandler::ProcessDataVersionFilterList(DataVersionFilterIBs::Parse
     TLV::TLVReader reader;
 
     aDataVersionFilterListParser.GetReader(&reader);
+#if CHIP_IM_READ_HANDLER_ARENA
+    ReserveArenaNodes(mDataVersionFilterArena, reader, sizeof(SingleLinkedListNode<DataVersionFilter>));
+#endif // CHIP_IM_READ_HANDLER_ARENA
     while (CHIP_NO_ERROR == (err = reader.Next()))
     {
         VerifyOrReturnError(TLV::AnonymousTag() == reader.GetTag(), CHIP_ERROR_INVALID_TLV_TAG);
@@ -532,8 +545,7 @@ CHIP_ERROR ReadHandler::ProcessDataVersionFilterList(DataVersionFilterIBs::Parse
         ReturnErrorOnFailure(path.GetEndpoint(&(versionFilter.mEndpointId)));
         ReturnErrorOnFailure(path.GetCluster(&(versionFilter.mClusterId)));
         VerifyOrReturnError(versionFilter.IsValidDataVersionFilter(), CHIP_ERROR_IM_MALFORMED_DATA_VERSION_FILTER_IB);
-        ReturnErrorOnFailure(mManagementCallback.GetInteractionModelEngine()->PushFrontDataVersionFilterList(
-            mpDataVersionFilterList, versionFilter));
+        ReturnErrorOnFailure(AddDataVersionFilter(versionFilter));
     }
 
     if (CHIP_END_OF_TLV == err)
@@ -548,6 +560,9 @@ CHIP_ERROR ReadHandler::ProcessEventPaths(EventPathIBs::Parser & aEventPathsPars
     CHIP_ERROR err = CHIP_NO_ERROR;
     TLV::TLVReader reader;
     aEventPathsParser.GetReader(&reader);
+#if CHIP_IM_READ_HANDLER_ARENA
+    ReserveArenaNodes(mPathArena, reader, sizeof(SingleLinkedListNode<EventPathParams>));
+#endif // CHIP_IM_READ_HANDLER_ARENA
     while (CHIP_NO_ERROR == (err = reader.Next()))
     {
         VerifyOrReturnError(TLV::AnonymousTag() == reader.GetTag(), CHIP_ERROR_INVALID_TLV_TAG);
@@ -555,7 +570,7 @@ CHIP_ERROR ReadHandler::ProcessEventPaths(EventPathIBs::Parser & aEventPathsPars
         EventPathIB::Parser path;
         ReturnErrorOnFailure(path.Init(reader));
         ReturnErrorOnFailure(path.ParsePath(event));
-        ReturnErrorOnFailure(mManagementCallback.GetInteractionModelEngine()->PushFrontEventPathParamsList(mpEventPathList, event));
+        ReturnErrorOnFailure(AddEventPath(event));
     }
 
     // if we have exhausted this container
@@ -566,6 +581,115 @@ CHIP_ERROR ReadHandler::ProcessEventPaths(EventPathIBs::Parser & aEventPathsPars
     return err;
 }
 
+#if CHIP_IM_READ_HANDLER_ARENA
+
+namespace {
+
+template <typename T>
+CHIP_ERROR PushFront(SingleLinkedListNode<T> *& aList, T & aData, BumpArena & aArena)
+{
+    auto * node = aArena.New<SingleLinkedListNode<T>>();
+    VerifyOrReturnError(node != nullptr, CHIP_ERROR_NO_MEMORY);
+    node->mValue = aData;
+    node->mpNext = aList;
+    aList        = node;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+void ReadHandler::ReserveArenaNodes(BumpArena & aArena, const TLV::TLVReader & aListReader, size_t aNodeSize)
+{
+    // Size the next chunk for the list, so that requests with a few paths do not hold a full chunk. A failure here is not
+    // an error: the nodes are then allocated one by one, and running out of memory is reported by the allocation.
+    size_t count = 0;
+    VerifyOrReturn(TLV::Utilities::Count(aListReader, count, false /* recurse */) == CHIP_NO_ERROR);
+    VerifyOrReturn(count <= SIZE_MAX / aNodeSize);
+    aArena.Reserve(count * aNodeSize);
+}
+
+bool ReadHandler::ArenaBudget::ReserveArenaMemory(size_t bytes)
+{
+    if (mBytesReserved == 0)
+    {
+        mFabricIndex = mHandler.GetAccessingFabricIndex();
+    }
+    VerifyOrReturnValue(mHandler.mManagementCallback.GetInteractionModelEngine()->ReserveFabricArenaMemory(mFabricIndex, bytes),
+                        false);
+    mBytesReserved += bytes;
+    return true;
+}
+
+void ReadHandler::ArenaBudget::ReleaseArenaMemory(size_t bytes)
+{
+    mHandler.mManagementCallback.GetInteractionModelEngine()->ReleaseFabricArenaMemory(mFabricIndex, bytes);
+    mBytesReserved -= bytes;
+}
+
+CHIP_ERROR ReadHandler::AddAttributePath(AttributePathParams & aAttributePath)
+{
+    CHIP_ERROR err = PushFront(mpAttributePathList, aAttributePath, mPathArena);
+    if (err == CHIP_ERROR_NO_MEMORY)
+    {
+        ChipLogError(InteractionModel, "No memory for AttributePath");
+        return CHIP_IM_GLOBAL_STATUS(PathsExhausted);
+    }
+    return err;
+}
+
+CHIP_ERROR ReadHandler::AddEventPath(EventPathParams & aEventPath)
+{
+    CHIP_ERROR err = PushFront(mpEventPathList, aEventPath, mPathArena);
+    if (err == CHIP_ERROR_NO_MEMORY)
+    {
+        ChipLogError(InteractionModel, "No memory for EventPath");
+        return CHIP_IM_GLOBAL_STATUS(PathsExhausted);
+    }
+    return err;
+}
+
+CHIP_ERROR ReadHandler::AddDataVersionFilter(DataVersionFilter & aDataVersionFilter)
+{
+    CHIP_ERROR err = PushFront(mpDataVersionFilterList, aDataVersionFilter, mDataVersionFilterArena);
+    if (err == CHIP_ERROR_NO_MEMORY)
+    {
+        ChipLogError(InteractionModel, "No memory for DataVersionFilter, ignore this filter");
+        err = CHIP_NO_ERROR;
+    }
+    return err;
+}
+
+void ReadHandler::ReleaseDataVersionFilters()
+{
+    mpDataVersionFilterList = nullptr;
+    mDataVersionFilterArena.Release();
+}
+
+#else // CHIP_IM_READ_HANDLER_ARENA
+
+CHIP_ERROR ReadHandler::AddAttributePath(AttributePathParams & aAttributePath)
+{
+    return mManagementCallback.GetInteractionModelEngine()->PushFrontAttributePathList(mpAttributePathList, aAttributePath);
+}
+
+CHIP_ERROR ReadHandler::AddEventPath(EventPathParams & aEventPath)
+{
+    return mManagementCallback.GetInteractionModelEngine()->PushFrontEventPathParamsList(mpEventPathList, aEventPath);
+}
+
+CHIP_ERROR ReadHandler::AddDataVersionFilter(DataVersionFilter & aDataVersionFilter)
+{
+    return mManagementCallback.GetInteractionModelEngine()->PushFrontDataVersionFilterList(mpDataVersionFilterList,
+                                                                                           aDataVersionFilter);
+}
+
+void ReadHandler::ReleaseDataVersionFilters()
+{
+    mManagementCallback.GetInteractionModelEngine()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
+}
+
+#endif // CHIP_IM_READ_HANDLER_ARENA
+
 CHIP_ERROR ReadHandler::ProcessEventFilters(EventFilterIBs::Parser & aEventFiltersParser)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -853,7 +977,7 @@ void ReadHandler::ResetPathIterator()
     mAttributeEncoderState.Reset();
 }
 
-void ReadHandler::AttributePathIsDirty(DataModel::Provider * apDataModel, const AttributePathParams & aAttributeChanged)
+void ReadHandler::AttributePathsAreDirty(DataModel::Provider * apDataModel, Span<const AttributePathParams> aAttributesChanged)
 {
     mDirtyGeneration = mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().GetDirtySetGeneration();
 
@@ -861,18 +985,30 @@ void ReadHandler::AttributePathIsDirty(DataModel::Provider * apDataModel, const
     AttributePathExpandIterator::Position tempPosition = mAttributePathExpandPosition;
     ConcreteAttributePath path;
 
-    // We won't reset the path iterator for every AttributePathIsDirty call to reduce the number of full data reports.
+    // We won't reset the path iterator for every AttributePathsAreDirty call to reduce the number of full data reports.
     // The iterator will be reset after finishing each report session.
     //
-    // Here we just reset the iterator to the beginning of the current cluster, if the dirty path affects it.
+    // Here we just reset the iterator to the beginning of the current cluster, if one of the dirty paths affects it.
     // This will ensure the reports are consistent within a single cluster generated from a single path in the request.
 
     // TODO (#16699): Currently we can only guarantee the reports generated from a single path in the request are consistent. The
     // data might be inconsistent if the user send a request with two paths from the same cluster. We need to clearify the behavior
     // or make it consistent.
-    if (AttributePathExpandIterator(apDataModel, tempPosition).Next(path) &&
-        (aAttributeChanged.HasWildcardEndpointId() || aAttributeChanged.mEndpointId == path.mEndpointId) &&
-        (aAttributeChanged.HasWildcardClusterId() || aAttributeChanged.mClusterId == path.mClusterId))
+    bool currentClusterDirty = false;
+    if (AttributePathExpandIterator(apDataModel, tempPosition).Next(path))
+    {
+        for (const auto & attributeChanged : aAttributesChanged)
+        {
+            if ((attributeChanged.HasWildcardEndpointId() || attributeChanged.mEndpointId == path.mEndpointId) &&
+                (attributeChanged.HasWildcardClusterId() || attributeChanged.mClusterId == path.mClusterId))
+            {
+                currentClusterDirty = true;
+                break;
+            }
+        }
+    }
+
+    if (currentClusterDirty)
     {
         ChipLogDetail(DataManagement,
                       "The dirty path intersects the cluster we are currently reporting; reset the iterator to the beginning of "
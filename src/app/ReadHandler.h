@@ -42,9 +42,11 @@
 #include <lib/core/CHIPCallback.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/TLVDebug.h>
+#include <lib/support/BumpArena.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/LinkedList.h>
+#include <lib/support/Span.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeHolder.h>
 #include <messaging/ExchangeMgr.h>
@@ -410,9 +412,15 @@ private:
     AttributePathExpandIterator::Position & AttributeIterationPosition() { return mAttributePathExpandPosition; }
 
     /// @brief Notifies the read handler that a set of attribute paths has been marked dirty. This will schedule a reporting engine
-    /// run if the change to the attribute path makes the ReadHandler reportable.
-    /// @param aAttributeChanged Path to the attribute that was changed.
-    void AttributePathIsDirty(DataModel::Provider * apDataModel, const AttributePathParams & aAttributeChanged);
+    /// run if the change to the attribute paths makes the ReadHandler reportable.
+    /// @param aAttributesChanged Paths to the attributes that were changed.
+    void AttributePathsAreDirty(DataModel::Provider * apDataModel, Span<const AttributePathParams> aAttributesChanged);
+
+    /// @brief Same as AttributePathsAreDirty, for a single attribute path.
+    void AttributePathIsDirty(DataModel::Provider * apDataModel, const AttributePathParams & aAttributeChanged)
+    {
+        AttributePathsAreDirty(apDataModel, Span<const AttributePathParams>(&aAttributeChanged, 1));
+    }
     bool IsDirty() const
     {
         return (mDirtyGeneration > mPreviousReportsBeginGeneration) || mFlags.Has(ReadHandlerFlags::ForceDirty);
@@ -449,6 +457,11 @@ private:
     size_t GetEventPathCount() const { return mpEventPathList == nullptr ? 0 : mpEventPathList->Count(); };
     size_t GetDataVersionFilterCount() const { return mpDataVersionFilterList == nullptr ? 0 : mpDataVersionFilterList->Count(); };
 
+#if CHIP_IM_READ_HANDLER_ARENA
+    // Returns the memory held by the arenas of this handler, counted against the budget of its fabric.
+    size_t GetArenaBytesReserved() const { return mPathArena.GetBytesReserved() + mDataVersionFilterArena.GetBytesReserved(); }
+#endif // CHIP_IM_READ_HANDLER_ARENA
+
     CHIP_ERROR SendStatusReport(Protocols::InteractionModel::Status aStatus);
 
     friend class TestReadInteraction;
@@ -496,6 +509,13 @@ private:
     CHIP_ERROR ProcessReadRequest(System::PacketBufferHandle && aPayload);
     CHIP_ERROR ProcessAttributePaths(AttributePathIBs::Parser & aAttributePathListParser);
     CHIP_ERROR ProcessEventPaths(EventPathIBs::Parser & aEventPathsParser);
+#if CHIP_IM_READ_HANDLER_ARENA
+    static void ReserveArenaNodes(BumpArena & aArena, const TLV::TLVReader & aListReader, size_t aNodeSize);
+#endif // CHIP_IM_READ_HANDLER_ARENA
+    CHIP_ERROR AddAttributePath(AttributePathParams & aAttributePath);
+    CHIP_ERROR AddEventPath(EventPathParams & aEventPath);
+    CHIP_ERROR AddDataVersionFilter(DataVersionFilter & aDataVersionFilter);
+    void ReleaseDataVersionFilters();
     CHIP_ERROR ProcessEventFilters(EventFilterIBs::Parser & aEventFiltersParser);
     CHIP_ERROR OnStatusResponse(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle && aPayload,
                                 bool & aSendStatusResponse);
@@ -582,6 +602,30 @@ private:
 
     ManagementCallback & mManagementCallback;
 
+#if CHIP_IM_READ_HANDLER_ARENA
+    // Charges the chunks of the arenas to the budget of the accessing fabric.
+    class ArenaBudget : public BumpArena::Budget
+    {
+    public:
+        explicit ArenaBudget(ReadHandler & handler) : mHandler(handler) {}
+
+        bool ReserveArenaMemory(size_t bytes) override;
+        void ReleaseArenaMemory(size_t bytes) override;
+
+    private:
+        ReadHandler & mHandler;
+        // The fabric the chunks are charged to, kept since the session may be gone when they are released
+        FabricIndex mFabricIndex = kUndefinedFabricIndex;
+        size_t mBytesReserved    = 0;
+    };
+
+    // The path lists live as long as the handler. Data version filters only matter until the end of the
+    // first report, so they have their own arena, released once that report is sent.
+    ArenaBudget mArenaBudget{ *this };
+    BumpArena mPathArena{ CHIP_IM_READ_HANDLER_ARENA_CHUNK_SIZE, &mArenaBudget };
+    BumpArena mDataVersionFilterArena{ CHIP_IM_READ_HANDLER_ARENA_CHUNK_SIZE, &mArenaBudget };
+#endif // CHIP_IM_READ_HANDLER_ARENA
+
     // TODO (#27675): Merge all observers into one and that one will dispatch the callbacks to the right place.
     Observer * mObserver = nullptr;
 
@@ -149,6 +149,7 @@ function(chip_configure_data_model APP_TARGET)
         ${CHIP_APP_BASE_DIR}/util/ember-io-storage.cpp
         ${CHIP_APP_BASE_DIR}/util/generic-callback-stubs.cpp
         ${CHIP_APP_BASE_DIR}/util/privilege-storage.cpp
+        ${CHIP_APP_BASE_DIR}/util/TransitionScheduler.cpp
         ${CHIP_APP_BASE_DIR}/util/util.cpp
         ${CHIP_APP_BASE_DIR}/util/persistence/AttributePersistenceProvider.cpp
         ${CHIP_APP_BASE_DIR}/util/persistence/DefaultAttributePersistenceProvider.cpp
@@ -105,7 +105,7 @@ private:
 
     CHIP_ERROR ReadAcl(AttributeValueEncoder & aEncoder);
     CHIP_ERROR WriteAcl(const ConcreteDataAttributePath & aPath, AttributeValueDecoder & aDecoder);
-    CHIP_ERROR IsValidAclEntryList(const DataModel::DecodableList<AclStorage::DecodableEntry> & list);
+    CHIP_ERROR CheckAclEntryList(const DataModel::DecodableList<AclStorage::DecodableEntry> & list, size_t & count, bool & valid);
 
 #if CHIP_CONFIG_ENABLE_ACL_EXTENSIONS
     CHIP_ERROR ReadExtension(AttributeValueEncoder & aEncoder);
@@ -380,12 +380,17 @@ CHIP_ERROR AccessControlAttribute::WriteImpl(const ConcreteDataAttributePath & a
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR AccessControlAttribute::IsValidAclEntryList(const DataModel::DecodableList<AclStorage::DecodableEntry> & list)
+CHIP_ERROR AccessControlAttribute::CheckAclEntryList(const DataModel::DecodableList<AclStorage::DecodableEntry> & list,
+                                                     size_t & count, bool & valid)
 {
+    // Entries are counted in the same pass, so that the list is decoded only once before being applied
+    count                   = 0;
+    valid                   = true;
     auto validationIterator = list.begin();
     while (validationIterator.Next())
     {
-        VerifyOrReturnError(validationIterator.GetValue().GetEntry().IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
+        valid = valid && validationIterator.GetValue().GetEntry().IsValid();
+        count++;
     }
     ReturnErrorOnFailure(validationIterator.GetStatus());
 
@@ -406,14 +411,14 @@ CHIP_ERROR AccessControlAttribute::WriteAcl(const ConcreteDataAttributePath & aP
         DataModel::DecodableList<AclStorage::DecodableEntry> list;
         ReturnErrorOnFailure(aDecoder.Decode(list));
 
+        // Validating all ACL entries in the ReplaceAll list before Updating or Deleting any entries. If any of the entries has an
+        // invalid field, the whole "ReplaceAll" list will be rejected.
         size_t newCount;
-        ReturnErrorOnFailure(list.ComputeSize(&newCount));
+        bool valid;
+        ReturnErrorOnFailure(CheckAclEntryList(list, newCount, valid));
 
         VerifyOrReturnError(newCount <= maxCount, CHIP_IM_GLOBAL_STATUS(ResourceExhausted));
-
-        // Validating all ACL entries in the ReplaceAll list before Updating or Deleting any entries. If any of the entries has an
-        // invalid field, the whole "ReplaceAll" list will be rejected.
-        ReturnErrorOnFailure(IsValidAclEntryList(list));
+        VerifyOrReturnError(valid, CHIP_ERROR_INVALID_ARGUMENT);
 
         auto iterator = list.begin();
         size_t i      = 0;
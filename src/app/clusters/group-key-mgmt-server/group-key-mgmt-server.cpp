@@ -25,6 +25,7 @@
 #include <app/util/attribute-storage.h>
 #include <credentials/GroupDataProvider.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
 
 using namespace chip;
 using namespace chip::app;
@@ -207,29 +208,37 @@ private:
         if (!aPath.IsListItemOperation())
         {
             Attributes::GroupKeyMap::TypeInfo::DecodableType list;
-            size_t new_count;
+            Platform::ScopedMemoryBufferWithSize<Structs::GroupKeyMapStruct::DecodableType> entries;
 
             VerifyOrReturnError(nullptr != provider, CHIP_ERROR_INTERNAL);
             ReturnErrorOnFailure(aDecoder.Decode(list));
-            ReturnErrorOnFailure(list.ComputeSize(&new_count));
 
-            // Remove existing keys, ignore errors
-            provider->RemoveGroupKeys(fabric_index);
+            // The provider rejects more keys than its per-fabric limit, so a longer list is invalid anyway
+            const uint16_t maxEntries = provider->GetMaxGroupsPerFabric();
+            VerifyOrReturnError(entries.Calloc(maxEntries) || maxEntries == 0, CHIP_ERROR_NO_MEMORY);
+            Span<Structs::GroupKeyMapStruct::DecodableType> values = entries.Span();
 
-            // Add the new keys
-            auto iter = list.begin();
-            size_t i  = 0;
-            while (iter.Next())
+            // Decode and validate the whole list before replacing the existing keys
+            CHIP_ERROR err = list.DecodeAll(values);
+            VerifyOrReturnError(err != CHIP_ERROR_BUFFER_TOO_SMALL, CHIP_ERROR_INVALID_LIST_LENGTH);
+            ReturnErrorOnFailure(err);
+            for (const auto & value : values)
             {
-                const auto & value = iter.GetValue();
                 VerifyOrReturnError(fabric_index == value.fabricIndex, CHIP_ERROR_INVALID_FABRIC_INDEX);
                 // Cannot map to IPK, see `GroupKeyMapStruct` in Group Key Management cluster spec
                 VerifyOrReturnError(value.groupKeySetID != 0, CHIP_IM_GLOBAL_STATUS(ConstraintError));
+            }
 
+            // Remove existing keys, ignore errors
+            provider->RemoveGroupKeys(fabric_index);
+
+            // Add the new keys
+            size_t i = 0;
+            for (const auto & value : values)
+            {
                 ReturnErrorOnFailure(provider->SetGroupKeyAt(value.fabricIndex, i++,
                                                              GroupDataProvider::GroupKey(value.groupId, value.groupKeySetID)));
             }
-            ReturnErrorOnFailure(iter.GetStatus());
         }
         else if (aPath.mListOp == ConcreteDataAttributePath::ListOperation::AppendItem)
         {
@@ -134,6 +134,10 @@ protected:
 template <bool IsFabricScoped>
 class FabricIndexListMemberMixin
 {
+protected:
+    template <typename T>
+    void ApplyFabricIndex(T & value) const
+    {}
 };
 
 template <>
@@ -143,6 +147,15 @@ public:
     void SetFabricIndex(FabricIndex fabricIndex) { mFabricIndex.SetValue(fabricIndex); }
 
 protected:
+    template <typename T>
+    void ApplyFabricIndex(T & value) const
+    {
+        if (mFabricIndex.HasValue())
+        {
+            value.SetFabricIndex(mFabricIndex.Value());
+        }
+    }
+
     Optional<FabricIndex> mFabricIndex;
 };
 
@@ -202,6 +215,10 @@ protected:
  *    // If err is failure, decoding failed somewhere along the way.  Some valid
  *    // entries may have been processed already.
  *
+ * Every iteration decodes the entries again. Consumers that go over the list
+ * several times (e.g. to validate it before applying it) can instead decode it
+ * once with DecodeAll() into storage they provide.
+ *
  */
 template <typename T>
 class DecodableList : public detail::DecodableMaybeFabricScopedList<DataModel::IsFabricScoped<T>::value>
@@ -306,6 +323,43 @@ public:
     {
         return Iterator(this->mReader);
     }
+
+    /*
+     * Decodes every entry of the list in a single pass into the storage
+     * provided by the caller, which can then be iterated over any number of
+     * times. On success, `entries` is reduced to the decoded entries.
+     *
+     * Fails with CHIP_ERROR_BUFFER_TOO_SMALL if the list has more entries than
+     * fit in `entries`. Decoded entries can point into the TLV buffer the list
+     * was decoded from (e.g. for strings and nested lists), which must outlive them.
+     */
+    CHIP_ERROR DecodeAll(Span<T> & entries) const
+    {
+        size_t count = 0;
+
+        if (this->mReader.GetContainerType() != TLV::kTLVType_NotSpecified)
+        {
+            TLV::TLVReader reader;
+            reader.Init(this->mReader);
+
+            CHIP_ERROR err;
+            while ((err = reader.Next()) == CHIP_NO_ERROR)
+            {
+                VerifyOrReturnError(count < entries.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+                // Reset to the cluster object defaults, see Iterator::DecodeValue()
+                T & entry = entries[count];
+                entry     = T();
+                ReturnErrorOnFailure(DataModel::Decode(reader, entry));
+                this->ApplyFabricIndex(entry);
+                count++;
+            }
+            VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        }
+
+        entries.reduce_size(count);
+        return CHIP_NO_ERROR;
+    }
 };
 
 } // namespace DataModel
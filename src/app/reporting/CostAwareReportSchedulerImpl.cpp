@@ -0,0 +1,199 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/CostAwareReportSchedulerImpl.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+using namespace System::Clock;
+using ReadHandlerNode = ReportScheduler::ReadHandlerNode;
+
+void CostAwareReportSchedulerImpl::OnReportChunkGenerated(ReadHandler * aReadHandler, Microseconds32 aEncodeTime, uint32_t aBytes,
+                                                          bool aMoreChunks)
+{
+    ReadHandlerNode * node = FindReadHandlerNode(aReadHandler);
+    // Priming reports are generated before the node is registered
+    VerifyOrReturn(nullptr != node);
+
+    // The ReadHandler only flags the report as chunked once its first chunk is sent
+    if (!node->IsChunkedReport())
+    {
+        Timestamp now = mTimerDelegate->GetCurrentMonotonicTimestamp();
+
+        mStatistics.reportsGenerated++;
+        if (now > node->GetScheduledTimestamp())
+        {
+            Milliseconds32 lateness   = std::chrono::duration_cast<Milliseconds32>(now - node->GetScheduledTimestamp());
+            mStatistics.maxLateness   = std::max(mStatistics.maxLateness, lateness);
+            mStatistics.totalLateness = mStatistics.totalLateness + lateness;
+        }
+        if (now > node->GetMaxTimestamp())
+        {
+            mStatistics.maxIntervalOverruns++;
+        }
+    }
+
+    node->AddReportChunkCost(aEncodeTime, aBytes);
+    if (!aMoreChunks)
+    {
+        node->CommitReportCost();
+    }
+}
+
+void CostAwareReportSchedulerImpl::ReportTimerCallback()
+{
+    Timestamp now = mTimerDelegate->GetCurrentMonotonicTimestamp();
+    size_t depth  = 0;
+
+    mNodesPool.ForEachActiveObject([&depth, now](ReadHandlerNode * node) {
+        if (node->IsReportableNow(now))
+        {
+            depth++;
+        }
+
+        return Loop::Continue;
+    });
+
+    mStatistics.queueDepth     = depth;
+    mStatistics.peakQueueDepth = std::max(mStatistics.peakQueueDepth, depth);
+
+    ReportSchedulerImpl::ReportTimerCallback();
+}
+
+CHIP_ERROR CostAwareReportSchedulerImpl::ScheduleReport(Timeout timeout, ReadHandlerNode * node, const Timestamp & now)
+{
+    const Timestamp target    = now + timeout;
+    const Timestamp timestamp = FindReportTimestamp(node, target, now);
+
+    if (timestamp > target)
+    {
+        // Hold the report back, otherwise the engine runs triggered by other subscriptions would generate it right away
+        node->DeferMinTimestamp(timestamp);
+        mStatistics.reportsDeferred++;
+    }
+    else if (timestamp < target)
+    {
+        mStatistics.reportsAdvanced++;
+    }
+
+    node->SetScheduledTimestamp(timestamp);
+    return ReportSchedulerImpl::ScheduleReport(std::chrono::duration_cast<Timeout>(timestamp - now), node, now);
+}
+
+System::Clock::Timestamp CostAwareReportSchedulerImpl::FindReportTimestamp(ReadHandlerNode * aNode, const Timestamp & aTarget,
+                                                                          const Timestamp & now)
+{
+    const Timestamp earliest = std::max(now, aNode->GetMinTimestamp());
+    const Timestamp latest   = aNode->GetMaxTimestamp();
+
+    // Reports already handed over to the engine, or with no room left in their reporting window, are not moved
+    VerifyOrReturnValue(!aNode->IsEngineRunScheduled() && earliest <= aTarget && earliest < latest, aTarget);
+
+    const uint64_t tickMs     = std::max<uint64_t>(mParams.tickDuration.count(), 1);
+    const uint64_t maxShift   = std::min(mParams.maxShiftTicks, kMaxShiftTicks);
+    const uint64_t targetTick = aTarget.count() / tickMs;
+    const uint64_t firstTick  = targetTick - std::min(targetTick, maxShift);
+    const size_t targetIndex  = static_cast<size_t>(targetTick - firstTick);
+    const size_t numTicks     = static_cast<size_t>(targetIndex + maxShift + 1);
+
+    // Tally the estimated cost of the reports already scheduled around the target, per tick
+    uint64_t load[2 * kMaxShiftTicks + 1] = {};
+    mNodesPool.ForEachActiveObject([&, this](ReadHandlerNode * node) {
+        VerifyOrReturnValue(node != aNode, Loop::Continue);
+
+        // Reports whose timer already fired are generated in the current tick
+        const Timestamp scheduled = node->IsEngineRunScheduled() ? now : node->GetScheduledTimestamp();
+        const uint64_t tick       = scheduled.count() / tickMs;
+        if (scheduled >= now && tick >= firstTick && tick - firstTick < numTicks)
+        {
+            load[tick - firstTick] += this->GetReportCost(node).count();
+        }
+
+        return Loop::Continue;
+    });
+
+    const uint64_t cost   = GetReportCost(aNode).count();
+    const uint64_t budget = mParams.tickBudget.count();
+    auto tickStart        = [&](size_t index) { return Timestamp((firstTick + index) * tickMs); };
+
+    size_t chosenIndex        = targetIndex;
+    Timestamp chosenTimestamp = aTarget;
+    size_t leastLoadedIndex   = targetIndex;
+    Timestamp leastLoadedTime = aTarget;
+    auto tryTick              = [&](size_t index, const Timestamp & timestamp) {
+        if (load[index] == 0 || load[index] + cost <= budget)
+        {
+            chosenIndex     = index;
+            chosenTimestamp = timestamp;
+            return true;
+        }
+        if (load[index] < load[leastLoadedIndex])
+        {
+            leastLoadedIndex = index;
+            leastLoadedTime  = timestamp;
+        }
+        return false;
+    };
+
+    // Prefer the target, then later ticks up to the max timestamp, then earlier ticks down to the min timestamp. Reports that
+    // became reportable have their target on the earliest timestamp and can only move later, while reports on their max interval
+    // can only move earlier.
+    bool found = tryTick(targetIndex, aTarget);
+    for (size_t i = targetIndex + 1; !found && i < numTicks && tickStart(i) <= latest; i++)
+    {
+        found = tryTick(i, tickStart(i));
+    }
+    for (size_t i = targetIndex; !found && i > 0 && tickStart(i) > earliest; i--)
+    {
+        found = tryTick(i - 1, std::max(tickStart(i - 1), earliest));
+    }
+
+    if (!found)
+    {
+        chosenIndex     = leastLoadedIndex;
+        chosenTimestamp = leastLoadedTime;
+        mStatistics.reportsOverBudget++;
+    }
+
+    const uint64_t tickCost  = std::min<uint64_t>(load[chosenIndex] + cost, UINT32_MAX);
+    mStatistics.peakTickCost = std::max(mStatistics.peakTickCost, Microseconds32(static_cast<uint32_t>(tickCost)));
+
+    return chosenTimestamp;
+}
+
+void CostAwareReportSchedulerImpl::LogStatistics() const
+{
+    ChipLogProgress(DataManagement,
+                    "Report scheduler: %" PRIu32 " reports, %" PRIu32 " deferred, %" PRIu32 " advanced, %" PRIu32
+                    " over budget, %" PRIu32 " past max interval",
+                    mStatistics.reportsGenerated, mStatistics.reportsDeferred, mStatistics.reportsAdvanced,
+                    mStatistics.reportsOverBudget, mStatistics.maxIntervalOverruns);
+    ChipLogProgress(DataManagement,
+                    "Report scheduler: queue depth %u (peak %u), peak tick cost %" PRIu32 "us, max lateness %" PRIu32
+                    "ms, total lateness %" PRIu64 "ms",
+                    static_cast<unsigned>(mStatistics.queueDepth), static_cast<unsigned>(mStatistics.peakQueueDepth),
+                    mStatistics.peakTickCost.count(), mStatistics.maxLateness.count(), mStatistics.totalLateness.count());
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
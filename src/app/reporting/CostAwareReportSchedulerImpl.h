@@ -0,0 +1,131 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/reporting/ReportSchedulerImpl.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * @class CostAwareReportSchedulerImpl
+ *
+ * @brief This class extends ReportSchedulerImpl to spread the reports of many subscriptions over time, based on how expensive
+ * they are to generate.
+ *
+ * It is meant for mains-powered devices serving many subscribers, where reports that become due at the same time would otherwise
+ * be generated in the same engine run and stall the event loop.
+ *
+ * ## Scheduling Logic
+ *
+ * The reporting engine notifies the scheduler of the encode time and size of every report chunk it generates. Each
+ * ReadHandlerNode keeps an estimate of the cost of its reports, updated whenever a report completes.
+ *
+ * Time is divided in ticks of a configurable duration. Whenever the base logic of ReportSchedulerImpl picks the time of the next
+ * report of a node, the estimated cost of the reports already scheduled around that time is tallied per tick, and the report is
+ * moved to the closest tick where it fits within the tick budget:
+ * - Reports that became reportable are moved later, up to the max interval of the subscription. The min timestamp of the node is
+ *   deferred so that engine runs triggered by other subscriptions do not generate the report early.
+ * - Reports on the max interval are moved earlier, down to the min interval of the subscription.
+ * - If no tick within reach fits, the least loaded one is used.
+ *
+ * Reports are never moved past the max interval of their subscription, nor by more than Parameters::maxShiftTicks ticks.
+ *
+ * @note Engine runs still generate every report that is due, so the tick budget caps the work the scheduler adds to a tick, not
+ * the total work of an engine run.
+ */
+class CostAwareReportSchedulerImpl : public ReportSchedulerImpl
+{
+public:
+    /// @brief Upper bound of Parameters::maxShiftTicks, which sets the size of the per-tick tally
+    static constexpr uint8_t kMaxShiftTicks = 32;
+
+    struct Parameters
+    {
+        /// Duration of a tick, the granularity at which reports are spread
+        System::Clock::Milliseconds32 tickDuration{ 100 };
+        /// Estimated encode time of the reports scheduled in a single tick before reports are moved to other ticks
+        System::Clock::Microseconds32 tickBudget{ 20000 };
+        /// Encode time assumed for subscriptions that did not complete a report yet
+        System::Clock::Microseconds32 defaultReportCost{ 1000 };
+        /// Number of ticks a report can be moved away from the time picked by the base logic
+        uint8_t maxShiftTicks = 16;
+    };
+
+    struct Statistics
+    {
+        uint32_t reportsGenerated    = 0;
+        uint32_t reportsDeferred     = 0; ///< Moved later than they became reportable
+        uint32_t reportsAdvanced     = 0; ///< Moved earlier than their max interval
+        uint32_t reportsOverBudget   = 0; ///< Scheduled in a tick where they did not fit
+        uint32_t maxIntervalOverruns = 0; ///< Generated after the max interval of their subscription
+        size_t queueDepth            = 0; ///< Subscriptions reportable when the last report timer fired
+        size_t peakQueueDepth        = 0;
+        System::Clock::Microseconds32 peakTickCost{ 0 }; ///< Highest estimated encode time scheduled in a tick
+        System::Clock::Milliseconds32 maxLateness{ 0 };  ///< Longest delay from the scheduled time of a report to its generation
+        System::Clock::Milliseconds64 totalLateness{ 0 };
+    };
+
+    CostAwareReportSchedulerImpl(TimerDelegate * aTimerDelegate) : ReportSchedulerImpl(aTimerDelegate) {}
+    CostAwareReportSchedulerImpl(TimerDelegate * aTimerDelegate, const Parameters & aParams) :
+        ReportSchedulerImpl(aTimerDelegate), mParams(aParams)
+    {}
+
+    void OnReportChunkGenerated(ReadHandler * aReadHandler, System::Clock::Microseconds32 aEncodeTime, uint32_t aBytes,
+                                bool aMoreChunks) override;
+
+    /// @brief Records the depth of the report queue before scheduling an engine run
+    void ReportTimerCallback() override;
+
+    const Parameters & GetParameters() const { return mParams; }
+    const Statistics & GetStatistics() const { return mStatistics; }
+    void ResetStatistics() { mStatistics = Statistics(); }
+    void LogStatistics() const;
+
+protected:
+    /**
+     * @brief Move the report of the node to the closest tick that fits within the tick budget before scheduling it.
+     *
+     * @param[in] timeout The delay before the report, as calculated by the base logic.
+     * @param[in] node The node associated with the ReadHandler.
+     * @param[in] now The current system timestamp.
+     *
+     * @return CHIP_ERROR CHIP_NO_ERROR on success, timer-related error code otherwise
+     */
+    CHIP_ERROR ScheduleReport(Timeout timeout, ReadHandlerNode * node, const Timestamp & now) override;
+
+private:
+    friend class chip::app::reporting::TestReportScheduler;
+
+    System::Clock::Microseconds32 GetReportCost(const ReadHandlerNode * node) const
+    {
+        return node->HasReportCost() ? node->GetEstimatedEncodeTime() : mParams.defaultReportCost;
+    }
+
+    /// @brief Find the timestamp closest to aTarget, within the reporting window of the node, whose tick can fit the report
+    Timestamp FindReportTimestamp(ReadHandlerNode * aNode, const Timestamp & aTarget, const Timestamp & now);
+
+    Parameters mParams;
+    Statistics mStatistics;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
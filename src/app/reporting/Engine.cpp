@@ -60,8 +60,8 @@ using Protocols::InteractionModel::Status;
 ///
 ///   If the returned value is std::nullopt, that means the ACL check passed and the
 ///   read should proceed.
-std::optional<CHIP_ERROR> ValidateReadAttributeACL(DataModel::Provider * dataModel, const SubjectDescriptor & subjectDescriptor,
-                                                   const ConcreteReadAttributePath & path)
+std::optional<CHIP_ERROR> ValidateReadAttributeACL(DataModel::AttributeFinder & attributeFinder,
+                                                   const SubjectDescriptor & subjectDescriptor, const ConcreteReadAttributePath & path)
 {
 
     RequestPath requestPath{ .cluster     = path.mClusterId,
@@ -69,9 +69,7 @@ std::optional<CHIP_ERROR> ValidateReadAttributeACL(DataModel::Provider * dataMod
                              .requestType = RequestType::kAttributeReadRequest,
                              .entityId    = path.mAttributeId };
 
-    DataModel::AttributeFinder finder(dataModel);
-
-    std::optional<DataModel::AttributeEntry> info = finder.Find(path);
+    std::optional<DataModel::AttributeEntry> info = attributeFinder.Find(path);
 
     // If the attribute exists, we know whether it is readable (readPrivilege has value)
     // and what the required access privilege is. However for attributes missing from the metatada
@@ -127,8 +125,30 @@ std::optional<CHIP_ERROR> ValidateReadAttributeACL(DataModel::Provider * dataMod
     return err == CHIP_ERROR_ACCESS_DENIED ? CHIP_IM_GLOBAL_STATUS(UnsupportedAccess) : CHIP_IM_GLOBAL_STATUS(AccessRestricted);
 }
 
-DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataModel, const SubjectDescriptor & subjectDescriptor,
-                                                  bool isFabricFiltered, AttributeReportIBs::Builder & reportBuilder,
+/// Metadata lookups shared by all the attribute reads done while building a
+/// single report chunk.
+///
+/// Wildcard reads expand into many consecutive attributes of the same cluster,
+/// so keeping the finders alive fetches the server cluster list once per
+/// endpoint and the attribute list once per cluster, rather than once for
+/// every attribute read.
+struct ReportMetadataLookup
+{
+    ReportMetadataLookup(DataModel::Provider * dataModel) : clusterFinder(dataModel), attributeFinder(dataModel) {}
+
+    DataModel::ServerClusterFinder clusterFinder;
+    DataModel::AttributeFinder attributeFinder;
+
+    /// Data version filter result of the last cluster checked while priming.
+    /// The filter list only needs to be walked once per cluster rather than
+    /// once for every attribute.
+    std::optional<ConcreteClusterPath> versionFilterCluster;
+    bool versionFilterMatch = false;
+};
+
+DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataModel, ReportMetadataLookup & metadataLookup,
+                                                  const SubjectDescriptor & subjectDescriptor, bool isFabricFiltered,
+                                                  AttributeReportIBs::Builder & reportBuilder,
                                                   const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState)
 {
     ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Attribute %" PRIx32 " is dirty", path.mClusterId,
@@ -142,10 +162,8 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     readRequest.subjectDescriptor = &subjectDescriptor;
     readRequest.path              = path;
 
-    DataModel::ServerClusterFinder serverClusterFinder(dataModel);
-
     DataVersion version = 0;
-    if (auto clusterInfo = serverClusterFinder.Find(path); clusterInfo.has_value())
+    if (auto clusterInfo = metadataLookup.clusterFinder.Find(path); clusterInfo.has_value())
     {
         version = clusterInfo->dataVersion;
     }
@@ -166,7 +184,8 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     //
     //       See https://github.com/project-chip/connectedhomeip/issues/37410
 
-    if (auto access_status = ValidateReadAttributeACL(dataModel, subjectDescriptor, path); access_status.has_value())
+    if (auto access_status = ValidateReadAttributeACL(metadataLookup.attributeFinder, subjectDescriptor, path);
+        access_status.has_value())
     {
         status = *access_status;
     }
@@ -215,9 +234,9 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     return status;
 }
 
-bool IsClusterDataVersionEqualTo(DataModel::Provider * dataModel, const ConcreteClusterPath & path, DataVersion dataVersion)
+bool IsClusterDataVersionEqualTo(DataModel::ServerClusterFinder & serverClusterFinder, const ConcreteClusterPath & path,
+                                 DataVersion dataVersion)
 {
-    DataModel::ServerClusterFinder serverClusterFinder(dataModel);
     auto info = serverClusterFinder.Find(path);
 
     return info.has_value() && (info->dataVersion == dataVersion);
@@ -299,6 +318,18 @@ CHIP_ERROR CheckEventValidity(const ConcreteEventPath & path, const SubjectDescr
     return CHIP_NO_ERROR;
 }
 
+bool IntersectsInterestPaths(const ReadHandler * apReadHandler, const AttributePathParams & aAttributePath)
+{
+    for (auto object = apReadHandler->GetAttributePathList(); object != nullptr; object = object->mpNext)
+    {
+        if (object->mValue.Intersects(aAttributePath))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 } // namespace
 
 Engine::Engine(InteractionModelEngine * apImEngine) : mpImEngine(apImEngine) {}
@@ -321,10 +352,13 @@ void Engine::Shutdown()
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
     mGlobalDirtySet.ReleaseAll();
+
+    // Open batches are closed by their owners, possibly after the shutdown: only drop the paths they buffered.
+    mDirtyBatchSize = 0;
 }
 
 bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFilter> * aDataVersionFilterList,
-                                       const ConcreteReadAttributePath & aPath)
+                                       const ConcreteReadAttributePath & aPath, DataModel::ServerClusterFinder & aClusterFinder)
 {
     bool existPathMatch       = false;
     bool existVersionMismatch = false;
@@ -334,7 +368,7 @@ bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFil
         {
             existPathMatch = true;
 
-            if (!IsClusterDataVersionEqualTo(mpImEngine->GetDataModelProvider(),
+            if (!IsClusterDataVersionEqualTo(aClusterFinder,
                                              ConcreteClusterPath(filter->mValue.mEndpointId, filter->mValue.mClusterId),
                                              filter->mValue.mDataVersion.Value()))
             {
@@ -396,6 +430,8 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         uint32_t attributesRead = 0;
 #endif
 
+        ReportMetadataLookup metadataLookup(mpImEngine->GetDataModelProvider());
+
         // For each path included in the interested path of the read handler...
         for (RollbackAttributePathExpandIterator iterator(mpImEngine->GetDataModelProvider(),
                                                           apReadHandler->AttributeIterationPosition());
@@ -425,9 +461,16 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
                     continue;
                 }
             }
-            else
+            else if (apReadHandler->GetDataVersionFilterList() != nullptr)
             {
-                if (IsClusterDataVersionMatch(apReadHandler->GetDataVersionFilterList(), readPath))
+                ConcreteClusterPath clusterPath(readPath.mEndpointId, readPath.mClusterId);
+                if (metadataLookup.versionFilterCluster != clusterPath)
+                {
+                    metadataLookup.versionFilterCluster = clusterPath;
+                    metadataLookup.versionFilterMatch =
+                        IsClusterDataVersionMatch(apReadHandler->GetDataVersionFilterList(), readPath, metadataLookup.clusterFinder);
+                }
+                if (metadataLookup.versionFilterMatch)
                 {
                     continue;
                 }
@@ -449,7 +492,7 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             // Load the saved state from previous encoding session for chunking of one single attribute (list chunking).
             AttributeEncodeState encodeState = apReadHandler->GetAttributeEncodeState();
             DataModel::ActionReturnStatus status =
-                RetrieveClusterData(mpImEngine->GetDataModelProvider(), apReadHandler->GetSubjectDescriptor(),
+                RetrieveClusterData(mpImEngine->GetDataModelProvider(), metadataLookup, apReadHandler->GetSubjectDescriptor(),
                                     apReadHandler->IsFabricFiltered(), attributeReportIBs, pathForRetrieval, &encodeState);
             if (status.IsError())
             {
@@ -734,6 +777,7 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     bool hasMoreChunks                   = false;
     bool needCloseReadHandler            = false;
     size_t reportBufferMaxSize           = 0;
+    const auto encodeStart               = System::SystemClock().GetMonotonicMicroseconds64();
 
     // Reserved size for the MoreChunks boolean flag, which takes up 1 byte for the control tag and 1 byte for the context tag.
     const uint32_t kReservedSizeForMoreChunksFlag = 1 + 1;
@@ -844,6 +888,15 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     err = reportDataWriter.Finalize(&bufHandle);
     SuccessOrExit(err);
 
+    if (apReadHandler->IsType(ReadHandler::InteractionType::Subscribe))
+    {
+        // Let the scheduler learn how expensive the reports of this subscription are
+        const auto encodeTime = std::chrono::duration_cast<System::Clock::Microseconds32>(
+            System::SystemClock().GetMonotonicMicroseconds64() - encodeStart);
+        mpImEngine->GetReportScheduler()->OnReportChunkGenerated(apReadHandler, encodeTime, reportDataWriter.GetLengthWritten(),
+                                                                 hasMoreChunks);
+    }
+
     ChipLogDetail(DataManagement, "<RE> Sending report (payload has %" PRIu32 " bytes)...", reportDataWriter.GetLengthWritten());
     err = SendReport(apReadHandler, std::move(bufHandle), hasMoreChunks);
     VerifyOrExit(err == CHIP_NO_ERROR,
@@ -1100,39 +1153,92 @@ CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttribute
 
 CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
 {
+    return SetDirty(Span<const AttributePathParams>(&aAttributePath, 1));
+}
+
+CHIP_ERROR Engine::SetDirty(Span<const AttributePathParams> aAttributePaths)
+{
+    // The paths are matched against the read handlers in batches of bounded size.
+    while (aAttributePaths.size() > kMaxDirtyBatchPaths)
+    {
+        ReturnErrorOnFailure(SetDirtyBatch(aAttributePaths.SubSpan(0, kMaxDirtyBatchPaths)));
+        aAttributePaths = aAttributePaths.SubSpan(kMaxDirtyBatchPaths);
+    }
+    return SetDirtyBatch(aAttributePaths);
+}
+
+CHIP_ERROR Engine::SetDirtyBatch(Span<const AttributePathParams> aAttributePaths)
+{
+    VerifyOrReturnError(!aAttributePaths.empty(), CHIP_NO_ERROR);
+    VerifyOrDie(aAttributePaths.size() <= kMaxDirtyBatchPaths);
+
     BumpDirtySetGeneration();
 
-    bool intersectsInterestPath     = false;
+    // Whether some read handler is interested in each path. Only those paths are kept in the dirty set.
+    bool pathIsInteresting[kMaxDirtyBatchPaths] = {};
+
+    // We call AttributePathsAreDirty for both read interactions and subscribe interactions, since we may send inconsistent
+    // attribute data between two chunks. AttributePathsAreDirty will not schedule a new run for read handlers which are
+    // waiting for a response to the last message chunk for read interactions.
     DataModel::Provider * dataModel = mpImEngine->GetDataModelProvider();
-    mpImEngine->mReadHandlers.ForEachActiveObject([&dataModel, &aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
-        // We call AttributePathIsDirty for both read interactions and subscribe interactions, since we may send inconsistent
-        // attribute data between two chunks. AttributePathIsDirty will not schedule a new run for read handlers which are
-        // waiting for a response to the last message chunk for read interactions.
-        if (handler->CanStartReporting() || handler->IsAwaitingReportResponse())
+    mpImEngine->mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
+        VerifyOrReturnValue(handler->CanStartReporting() || handler->IsAwaitingReportResponse(), Loop::Continue);
+
+        bool handlerIsDirty = false;
+        for (size_t i = 0; i < aAttributePaths.size(); i++)
         {
-            for (auto object = handler->GetAttributePathList(); object != nullptr; object = object->mpNext)
+            // Once the handler is dirty, only the paths nobody is known to be interested in are left to check
+            if ((!handlerIsDirty || !pathIsInteresting[i]) && IntersectsInterestPaths(handler, aAttributePaths[i]))
             {
-                if (object->mValue.Intersects(aAttributePath))
-                {
-                    handler->AttributePathIsDirty(dataModel, aAttributePath);
-                    intersectsInterestPath = true;
-                    break;
-                }
+                handlerIsDirty       = true;
+                pathIsInteresting[i] = true;
             }
         }
 
+        if (handlerIsDirty)
+        {
+            handler->AttributePathsAreDirty(dataModel, aAttributePaths);
+        }
         return Loop::Continue;
     });
 
-    if (!intersectsInterestPath)
+    for (size_t i = 0; i < aAttributePaths.size(); i++)
     {
-        return CHIP_NO_ERROR;
+        if (pathIsInteresting[i])
+        {
+            ReturnErrorOnFailure(InsertPathIntoDirtySet(aAttributePaths[i]));
+        }
     }
-    ReturnErrorOnFailure(InsertPathIntoDirtySet(aAttributePath));
 
     return CHIP_NO_ERROR;
 }
 
+void Engine::BeginDirtyBatch()
+{
+    mDirtyBatchDepth++;
+}
+
+void Engine::EndDirtyBatch()
+{
+    VerifyOrDie(mDirtyBatchDepth > 0);
+    if (--mDirtyBatchDepth == 0)
+    {
+        FlushDirtyBatch();
+    }
+}
+
+void Engine::FlushDirtyBatch()
+{
+    VerifyOrReturn(mDirtyBatchSize > 0);
+
+    CHIP_ERROR err  = SetDirty(Span<const AttributePathParams>(mDirtyBatch, mDirtyBatchSize));
+    mDirtyBatchSize = 0;
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to set batched paths dirty: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
 CHIP_ERROR Engine::SendReport(ReadHandler * apReadHandler, System::PacketBufferHandle && aPayload, bool aHasMoreChunks)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1198,7 +1304,7 @@ CHIP_ERROR Engine::NewEventGenerated(ConcreteEventPath & aPath, uint32_t aBytesC
     // we don't need to call schedule run for event.
     // If schedule run is called, actually we would not delivery events as well.
     // Just wanna save one schedule run here
-    if (mpImEngine->mEventPathPool.Allocated() == 0)
+    if (!mpImEngine->HasEventPaths())
     {
         return CHIP_NO_ERROR;
     }
@@ -1256,6 +1362,20 @@ void Engine::ScheduleUrgentEventDeliverySync(Optional<FabricIndex> fabricIndex)
 
 void Engine::MarkDirty(const AttributePathParams & path)
 {
+    if (mDirtyBatchDepth > 0)
+    {
+        for (size_t i = 0; i < mDirtyBatchSize; i++)
+        {
+            VerifyOrReturn(!mDirtyBatch[i].IsAttributePathSupersetOf(path));
+        }
+        if (mDirtyBatchSize == MATTER_ARRAY_SIZE(mDirtyBatch))
+        {
+            FlushDirtyBatch();
+        }
+        mDirtyBatch[mDirtyBatchSize++] = path;
+        return;
+    }
+
     CHIP_ERROR err = SetDirty(path);
     if (err != CHIP_NO_ERROR)
     {
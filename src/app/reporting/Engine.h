@@ -28,6 +28,7 @@
 #include <app/EventReporter.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
+#include <app/data-model-provider/MetadataLookup.h>
 #include <app/data-model-provider/ProviderChangeListener.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
@@ -99,6 +100,22 @@ public:
      */
     CHIP_ERROR SetDirty(const AttributePathParams & aAttributePathParams);
 
+    /**
+     * Marks a set of changed paths at once. This is equivalent to calling SetDirty for every path, except that the
+     * dirty set generation is bumped once and every read handler is notified, and has its report scheduled, at most once
+     * for every CHIP_IM_SERVER_MAX_NUM_DIRTY_BATCH_PATHS paths.
+     */
+    CHIP_ERROR SetDirty(Span<const AttributePathParams> aAttributePaths);
+
+    /**
+     * Start batching the paths reported through MarkDirty, typically by MatterReportingAttributeChangeCallback. The
+     * batched paths are passed to SetDirty together when the outermost batch ends, or earlier if more than
+     * CHIP_IM_SERVER_MAX_NUM_DIRTY_BATCH_PATHS distinct paths are reported. Batches can be nested, and every call to
+     * BeginDirtyBatch must be matched by a call to EndDirtyBatch.
+     */
+    void BeginDirtyBatch();
+    void EndDirtyBatch();
+
     /*
      * Resets the tracker that tracks the currently serviced read handler.
      * apReadHandler can be non-null to indicate that the reset is due to a
@@ -184,8 +201,10 @@ private:
     // of those will fail to match.  This function should return false if either nothing in the list matches the given
     // endpoint+cluster in the path or there is an entry in the list that matches the endpoint+cluster in the path but does not
     // match the current data version of that cluster.
+    //
+    // aClusterFinder is reused across calls so that cluster metadata is not fetched again for every attribute.
     bool IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFilter> * aDataVersionFilterList,
-                                   const ConcreteReadAttributePath & aPath);
+                                   const ConcreteReadAttributePath & aPath, DataModel::ServerClusterFinder & aClusterFinder);
 
     /**
      *  EventReporter implementation.
@@ -292,6 +311,21 @@ private:
      */
     uint64_t mDirtyGeneration = 1;
 
+    static constexpr size_t kMaxDirtyBatchPaths = CHIP_IM_SERVER_MAX_NUM_DIRTY_BATCH_PATHS;
+
+    /**
+     * SetDirty for at most kMaxDirtyBatchPaths paths, matching each read handler against all of them in a single pass.
+     */
+    CHIP_ERROR SetDirtyBatch(Span<const AttributePathParams> aAttributePaths);
+
+    /**
+     * Paths reported through MarkDirty while a batch is open, see BeginDirtyBatch.
+     */
+    void FlushDirtyBatch();
+    AttributePathParams mDirtyBatch[kMaxDirtyBatchPaths];
+    size_t mDirtyBatchSize    = 0;
+    uint32_t mDirtyBatchDepth = 0;
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     uint32_t mReservedSize          = 0;
     uint32_t mMaxAttributesPerChunk = UINT32_MAX;
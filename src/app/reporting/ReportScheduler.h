@@ -178,11 +178,62 @@ public:
         System::Clock::Timestamp GetMinTimestamp() const { return mMinTimestamp; }
         System::Clock::Timestamp GetMaxTimestamp() const { return mMaxTimestamp; }
 
+        /// @brief Hold the report back until the given timestamp, which must not be past the max timestamp. Reset on the next
+        /// call to SetIntervalTimeStamps.
+        void DeferMinTimestamp(const Timestamp & aTimestamp)
+        {
+            VerifyOrDie(aTimestamp <= mMaxTimestamp);
+            mMinTimestamp = aTimestamp;
+        }
+
+        /// @brief Timestamp of the next report timer of the node, only kept up to date by schedulers that need it
+        System::Clock::Timestamp GetScheduledTimestamp() const { return mScheduledTimestamp; }
+        void SetScheduledTimestamp(const Timestamp & aTimestamp) { mScheduledTimestamp = aTimestamp; }
+
+        /// @brief Add the cost of a report chunk generated for the ReadHandler. The cost of the chunks is accumulated until the
+        /// report is complete and CommitReportCost is called.
+        void AddReportChunkCost(System::Clock::Microseconds32 aEncodeTime, uint32_t aBytes)
+        {
+            mPendingEncodeTime = mPendingEncodeTime + aEncodeTime;
+            mPendingBytes      = mPendingBytes + aBytes;
+        }
+
+        /// @brief Fold the cost of the completed report into the estimates. Each report weighs a quarter of the estimates, so they
+        /// follow changes in the subscribed data while smoothing out outliers.
+        void CommitReportCost()
+        {
+            VerifyOrReturn(mPendingBytes > 0);
+            if (mReportBytes == 0)
+            {
+                mEncodeTime  = mPendingEncodeTime;
+                mReportBytes = mPendingBytes;
+            }
+            else
+            {
+                mEncodeTime = System::Clock::Microseconds32(
+                    static_cast<uint32_t>((3 * static_cast<uint64_t>(mEncodeTime.count()) + mPendingEncodeTime.count()) / 4));
+                mReportBytes = static_cast<uint32_t>((3 * static_cast<uint64_t>(mReportBytes) + mPendingBytes) / 4);
+            }
+            mPendingEncodeTime = System::Clock::Microseconds32(0);
+            mPendingBytes      = 0;
+        }
+
+        /// @brief Whether CommitReportCost was called at least once, the estimates are zero otherwise
+        bool HasReportCost() const { return mReportBytes > 0; }
+        System::Clock::Microseconds32 GetEstimatedEncodeTime() const { return mEncodeTime; }
+        uint32_t GetEstimatedReportBytes() const { return mReportBytes; }
+
     private:
         ReadHandler * mReadHandler;
         ReportScheduler * mScheduler;
         Timestamp mMinTimestamp;
         Timestamp mMaxTimestamp;
+        Timestamp mScheduledTimestamp = System::Clock::kZero;
+
+        System::Clock::Microseconds32 mEncodeTime        = System::Clock::Microseconds32(0);
+        System::Clock::Microseconds32 mPendingEncodeTime = System::Clock::Microseconds32(0);
+        uint32_t mReportBytes                            = 0;
+        uint32_t mPendingBytes                           = 0;
 
         BitFlags<ReadHandlerNodeFlags> mFlags;
     };
@@ -193,6 +244,13 @@ public:
 
     virtual void ReportTimerCallback() = 0;
 
+    /// @brief Called by the reporting engine for every report chunk it generated for a subscription, with the time it took to
+    /// encode the chunk and its size. Schedulers that balance reports by their cost override this.
+    /// @param aMoreChunks whether more chunks follow to complete the report
+    virtual void OnReportChunkGenerated(ReadHandler * aReadHandler, System::Clock::Microseconds32 aEncodeTime, uint32_t aBytes,
+                                        bool aMoreChunks)
+    {}
+
     /// @brief Check whether a ReadHandler is reportable right now, taking into account its minimum and maximum intervals.
     /// @param aReadHandler read handler to check
     bool IsReportableNow(ReadHandler * aReadHandler)
@@ -60,3 +60,32 @@ void MatterReportingAttributeChangeCallback(EndpointId endpoint)
 
     provider->Temporary_ReportAttributeChanged(AttributePathParams(endpoint));
 }
+
+void MatterReportingAttributeChangeCallback(Span<const ConcreteAttributePath> aPaths)
+{
+    reporting::ScopedAttributeChangeBatch batch;
+    for (const auto & path : aPaths)
+    {
+        MatterReportingAttributeChangeCallback(path);
+    }
+}
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+ScopedAttributeChangeBatch::ScopedAttributeChangeBatch()
+{
+    assertChipStackLockedByCurrentThread();
+    InteractionModelEngine::GetInstance()->GetReportingEngine().BeginDirtyBatch();
+}
+
+ScopedAttributeChangeBatch::~ScopedAttributeChangeBatch()
+{
+    assertChipStackLockedByCurrentThread();
+    InteractionModelEngine::GetInstance()->GetReportingEngine().EndDirtyBatch();
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
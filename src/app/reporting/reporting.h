@@ -18,6 +18,7 @@
 #pragma once
 
 #include <app/ConcreteAttributePath.h>
+#include <lib/support/Span.h>
 
 /** @brief Reporting Attribute Change
  *
@@ -37,3 +38,35 @@ void MatterReportingAttributeChangeCallback(const chip::app::ConcreteAttributePa
  * Same but only with an EndpointId, this is used when adding / enabling an endpoint during runtime.
  */
 void MatterReportingAttributeChangeCallback(chip::EndpointId endpoint);
+
+/*
+ * Same but for a set of attributes, which are handed to the reporting engine as a single batch.
+ */
+void MatterReportingAttributeChangeCallback(chip::Span<const chip::app::ConcreteAttributePath> aPaths);
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * Batches the attribute changes notified through MatterReportingAttributeChangeCallback while in scope.
+ *
+ * Cluster data versions are still updated by every call, but read handlers are matched against the changed
+ * paths, and reports scheduled, once for the whole batch when the outermost batch goes out of scope. Useful
+ * when updating many attributes in one go, e.g. when a bridge synchronizes a device.
+ *
+ * Must be created and destroyed with the Matter stack locked, without returning to the event loop in between.
+ */
+class ScopedAttributeChangeBatch
+{
+public:
+    ScopedAttributeChangeBatch();
+    ~ScopedAttributeChangeBatch();
+
+    ScopedAttributeChangeBatch(const ScopedAttributeChangeBatch &)             = delete;
+    ScopedAttributeChangeBatch & operator=(const ScopedAttributeChangeBatch &) = delete;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
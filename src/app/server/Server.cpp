@@ -39,6 +39,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/PersistedCounter.h>
+#include <lib/support/StringBuilder.h>
 #include <lib/support/TestGroupData.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeMgr.h>
@@ -56,6 +57,7 @@
 #include <sys/param.h>
 #include <system/SystemPacketBuffer.h>
 #include <system/TLVPacketBufferBackingStore.h>
+#include <tracing/metric_event.h>
 #include <transport/SessionManager.h>
 #if CHIP_DEVICE_CONFIG_ENABLE_NFC_BASED_COMMISSIONING
 #include <transport/raw/NFC.h>
@@ -69,6 +71,8 @@
 #include <lib/support/PersistentStorageAudit.h>
 #endif // defined(CHIP_SUPPORT_ENABLE_STORAGE_API_AUDIT) || defined(CHIP_SUPPORT_ENABLE_STORAGE_LOAD_TEST_AUDIT)
 
+#include <algorithm>
+
 using namespace chip::DeviceLayer;
 
 using chip::kMinValidFabricIndex;
@@ -93,6 +97,29 @@ chip::Access::DynamicProviderDeviceTypeResolver sDeviceTypeResolver([] {
     return chip::app::InteractionModelEngine::GetInstance()->GetDataModelProvider();
 });
 
+// Indexed by Server::InitPhase
+constexpr chip::Tracing::MetricKey kInitPhaseMetrics[] = {
+    chip::Tracing::kMetricServerInitStorage,       chip::Tracing::kMetricServerInitFabrics,
+    chip::Tracing::kMetricServerInitAccessControl, chip::Tracing::kMetricServerInitTransports,
+    chip::Tracing::kMetricServerInitSessions,      chip::Tracing::kMetricServerInitEventLogging,
+    chip::Tracing::kMetricServerInitDataModel,     chip::Tracing::kMetricServerInitDnssd,
+    chip::Tracing::kMetricServerInitCASE,          chip::Tracing::kMetricServerInitInteractionModel,
+    chip::Tracing::kMetricServerInitICD,           chip::Tracing::kMetricServerInitCompletion,
+};
+static_assert(sizeof(kInitPhaseMetrics) / sizeof(kInitPhaseMetrics[0]) ==
+                  chip::to_underlying(chip::Server::InitPhase::kCount),
+              "Every init phase needs a metric key");
+
+#if CHIP_PROGRESS_LOGGING
+// Indexed by Server::InitPhase
+constexpr const char * kInitPhaseNames[] = {
+    "storage",    "fabrics", "access control", "transports", "sessions", "event logging",
+    "data model", "DNS-SD",  "CASE",           "IM",         "ICD",      "completion",
+};
+static_assert(sizeof(kInitPhaseNames) / sizeof(kInitPhaseNames[0]) == chip::to_underlying(chip::Server::InitPhase::kCount),
+              "Every init phase needs a name");
+#endif // CHIP_PROGRESS_LOGGING
+
 } // namespace
 
 namespace chip {
@@ -114,6 +141,11 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     assertChipStackLockedByCurrentThread();
 
     mInitTimestamp = System::SystemClock().GetMonotonicMicroseconds64();
+    MATTER_LOG_METRIC_BEGIN(Tracing::kMetricServerInit);
+    for (auto & duration : mInitPhaseDurations)
+    {
+        duration = System::Clock::Microseconds32(0);
+    }
 
     CASESessionManagerConfig caseSessionManagerConfig;
     DeviceLayer::DeviceInfoProvider * deviceInfoprovider = nullptr;
@@ -148,6 +180,8 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
 
     VerifyOrExit(initParams.dataModelProvider != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
 
+    BeginInitPhase(InitPhase::kStorage);
+
     // TODO(16969): Remove Platform::MemoryInit() call from Server class, it belongs to outer code
     Platform::MemoryInit();
 
@@ -181,6 +215,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     SuccessOrExit(err = mAttributePersister.Init(mDeviceStorage));
     SetSafeAttributePersistenceProvider(&mAttributePersister);
 
+    BeginInitPhase(InitPhase::kFabrics);
     {
         FabricTable::InitParams fabricTableInitParams;
         fabricTableInitParams.storage             = mDeviceStorage;
@@ -191,6 +226,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
         SuccessOrExit(err);
     }
 
+    BeginInitPhase(InitPhase::kAccessControl);
     SuccessOrExit(err = mAccessControl.Init(initParams.accessDelegate, sDeviceTypeResolver));
     Access::SetAccessControl(mAccessControl);
 
@@ -221,6 +257,8 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
         deviceInfoprovider->SetStorageDelegate(mDeviceStorage);
     }
 
+    BeginInitPhase(InitPhase::kTransports);
+
     // Init transport before operations with secure session mgr.
     //
     // The logic below expects that the IPv6 transport is at index 0. Keep that logic in sync with
@@ -266,6 +304,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
 #endif
     SuccessOrExit(err);
 
+    BeginInitPhase(InitPhase::kSessions);
     err = mSessions.Init(&DeviceLayer::SystemLayer(), &mTransports, &mMessageCounterManager, mDeviceStorage, &GetFabricTable(),
                          *mSessionKeystore);
     SuccessOrExit(err);
@@ -291,6 +330,8 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     Dnssd::Resolver::Instance().Init(DeviceLayer::UDPEndPointManager());
 
 #if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+    BeginInitPhase(InitPhase::kEventLogging);
+
     // Initialize event logging subsystem
     err = sGlobalEventIdCounter.Init(mDeviceStorage, DefaultStorageKeyAllocator::IMEventNumber(),
                                      CHIP_DEVICE_CONFIG_EVENT_ID_COUNTER_EPOCH);
@@ -312,6 +353,8 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     }
 #endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
 
+    BeginInitPhase(InitPhase::kDataModel);
+
     // SetDataModelProvider() initializes and starts the provider, which in turn
     // triggers the initialization of cluster implementations. This callsite is
     // critical because it ensures that cluster-level initialization occurs only
@@ -334,6 +377,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     SuccessOrExit(err);
 #endif
 
+    BeginInitPhase(InitPhase::kDnssd);
     app::DnssdServer::Instance().SetSecuredIPv6Port(mTransports.GetTransport().GetImplAtIndex<0>().GetBoundPort());
 #if INET_CONFIG_ENABLE_IPV4
     app::DnssdServer::Instance().SetSecuredIPv4Port(mTransports.GetTransport().GetImplAtIndex<1>().GetBoundPort());
@@ -377,6 +421,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     app::DnssdServer::Instance().StartServer();
 #endif
 
+    BeginInitPhase(InitPhase::kCASE);
     caseSessionManagerConfig = {
         .sessionInitParams =  {
             .sessionManager    = &mSessions,
@@ -400,6 +445,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
                                                     &mCertificateValidityPolicy, mGroupsProvider);
     SuccessOrExit(err);
 
+    BeginInitPhase(InitPhase::kInteractionModel);
     err = app::InteractionModelEngine::GetInstance()->Init(&mExchangeMgr, &GetFabricTable(), mReportScheduler, &mCASESessionManager,
                                                            mSubscriptionResumptionStorage);
     SuccessOrExit(err);
@@ -410,6 +456,7 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
 
     // ICD Init needs to be after data model init and InteractionModel Init
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
+    BeginInitPhase(InitPhase::kICD);
 
     // Register the ICDStateObservers.
     // Call register before init so that observers are notified of any state change during the init.
@@ -436,13 +483,18 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
 
 #endif // CHIP_CONFIG_ENABLE_ICD_SERVER
 
+    BeginInitPhase(InitPhase::kCompletion);
+
     // This code is necessary to restart listening to existing groups after a reboot
     // Each manufacturer needs to validate that they can rejoin groups by placing this code at the appropriate location for them
     //
     // Thread LWIP devices using dedicated Inet endpoint implementations are excluded because they call this function from:
     // src/platform/OpenThread/GenericThreadStackManagerImpl_OpenThread_LwIP.cpp
+    //
+    // Joining every group of every fabric is not needed to answer unicast requests, so it is deferred until Init() has
+    // returned and DNS-SD advertising has started.
 #if !CHIP_SYSTEM_CONFIG_USE_OPENTHREAD_ENDPOINT
-    RejoinExistingMulticastGroups();
+    ScheduleStartupWork(StartupWork::kMulticastRejoin);
 #endif // !CHIP_SYSTEM_CONFIG_USE_OPENTHREAD_ENDPOINT
 
     // Handle deferred clean-up of a previously armed fail-safe that occurred during FabricTable commit.
@@ -504,18 +556,88 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     CheckServerReadyEvent();
 
 exit:
+    EndInitPhase(err);
+    MATTER_LOG_METRIC_END(Tracing::kMetricServerInit, err);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(AppServer, "ERROR setting up transport: %" CHIP_ERROR_FORMAT, err.Format());
     }
     else
     {
+        LogInitPhases();
         // NOTE: this log is scraped by the test harness.
         ChipLogProgress(AppServer, "Server Listening...");
     }
     return err;
 }
 
+void Server::BeginInitPhase(InitPhase phase)
+{
+    EndInitPhase(CHIP_NO_ERROR);
+
+    mInitPhase      = phase;
+    mInitPhaseStart = System::SystemClock().GetMonotonicMicroseconds64();
+    MATTER_LOG_METRIC_BEGIN(kInitPhaseMetrics[to_underlying(phase)]);
+}
+
+void Server::EndInitPhase(CHIP_ERROR err)
+{
+    VerifyOrReturn(mInitPhase < InitPhase::kCount);
+
+    const uint64_t elapsed = (System::SystemClock().GetMonotonicMicroseconds64() - mInitPhaseStart).count();
+    mInitPhaseDurations[to_underlying(mInitPhase)] =
+        System::Clock::Microseconds32(static_cast<uint32_t>(std::min<uint64_t>(elapsed, UINT32_MAX)));
+    MATTER_LOG_METRIC_END(kInitPhaseMetrics[to_underlying(mInitPhase)], err);
+    mInitPhase = InitPhase::kCount;
+}
+
+void Server::LogInitPhases() const
+{
+#if CHIP_PROGRESS_LOGGING
+    StringBuilder<256> phases;
+    for (uint8_t i = 0; i < to_underlying(InitPhase::kCount); i++)
+    {
+        phases.AddFormat("%s%s %" PRIu32, (i == 0) ? "" : ", ", kInitPhaseNames[i], mInitPhaseDurations[i].count() / 1000);
+    }
+    ChipLogProgress(AppServer, "Init phases (ms): %s", phases.c_str());
+#endif // CHIP_PROGRESS_LOGGING
+}
+
+void Server::ScheduleStartupWork(StartupWork work)
+{
+    // Work added while the previous one is still pending runs along with it
+    const bool scheduled = mPendingStartupWork.HasAny();
+    mPendingStartupWork.Set(work);
+    VerifyOrReturn(!scheduled);
+
+    CHIP_ERROR err = PlatformMgr().ScheduleWork(HandleStartupWork, reinterpret_cast<intptr_t>(this));
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(AppServer, "Failed to defer startup work, running it now: %" CHIP_ERROR_FORMAT, err.Format());
+        HandleStartupWork(reinterpret_cast<intptr_t>(this));
+    }
+}
+
+void Server::HandleStartupWork(intptr_t context)
+{
+    Server * server = reinterpret_cast<Server *>(context);
+
+    // Shutdown() drops the work that has not run yet
+    const BitFlags<StartupWork> work = server->mPendingStartupWork;
+    server->mPendingStartupWork.ClearAll();
+
+    if (work.Has(StartupWork::kMulticastRejoin))
+    {
+        server->RejoinExistingMulticastGroups();
+    }
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    if (work.Has(StartupWork::kSubscriptionResumption))
+    {
+        server->ResumeSubscriptions();
+    }
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+}
+
 void Server::OnPlatformEvent(const DeviceLayer::ChipDeviceEvent & event)
 {
     switch (event.Type)
@@ -542,7 +664,8 @@ void Server::OnPlatformEvent(const DeviceLayer::ChipDeviceEvent & event)
         }
 #endif // CHIP_CONFIG_ENABLE_ICD_SERVER && CHIP_CONFIG_ENABLE_ICD_CIP
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
-        ResumeSubscriptions();
+        // Resuming reads every persisted subscription, the requests received once the server is ready are handled first
+        ScheduleStartupWork(StartupWork::kSubscriptionResumption);
 #endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
         break;
 #if CHIP_SYSTEM_CONFIG_USE_OPENTHREAD_ENDPOINT
@@ -567,6 +690,9 @@ void Server::CheckServerReadyEvent()
     if (mIsDnssdReady)
     {
         ChipLogProgress(AppServer, "Server initialization complete");
+        MATTER_LOG_METRIC(
+            Tracing::kMetricServerReady,
+            static_cast<uint32_t>(std::chrono::duration_cast<System::Clock::Milliseconds32>(TimeSinceInit()).count()));
 
         ChipDeviceEvent event = { .Type = DeviceEventType::kServerReady };
         PlatformMgr().PostEventOrDie(&event);
@@ -656,6 +782,7 @@ void Server::Shutdown()
 {
     assertChipStackLockedByCurrentThread();
     PlatformMgr().RemoveEventHandler(OnPlatformEventWrapper, 0);
+    mPendingStartupWork.ClearAll();
     mCASEServer.Shutdown();
     mCASESessionManager.Shutdown();
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
@@ -44,7 +44,9 @@
 #include <crypto/PersistentStorageOperationalKeystore.h>
 #include <inet/InetConfig.h>
 #include <lib/core/CHIPConfig.h>
+#include <lib/support/BitFlags.h>
 #include <lib/support/SafeInt.h>
+#include <lib/support/TypeTraits.h>
 #include <messaging/ExchangeMgr.h>
 #include <platform/DeviceInstanceInfoProvider.h>
 #include <platform/KeyValueStoreManager.h>
@@ -90,6 +92,12 @@
 
 namespace chip {
 
+namespace Test {
+// Forward declaration of ServerTestAccess to allow it to be friend with the Server.
+// Used in unit tests
+class ServerTestAccess;
+} // namespace Test
+
 inline constexpr size_t kMaxBlePendingPackets = 1;
 
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
@@ -464,14 +472,60 @@ public:
         return System::SystemClock().GetMonotonicMicroseconds64() - mInitTimestamp;
     }
 
+    /**
+     * Stages of Init(), in the order they run. Each one is reported through the
+     * tracing metrics and its duration is kept for GetInitPhaseDuration().
+     */
+    enum class InitPhase : uint8_t
+    {
+        kStorage,
+        kFabrics,
+        kAccessControl,
+        kTransports,
+        kSessions,
+        kEventLogging,
+        kDataModel,
+        kDnssd,
+        kCASE,
+        kInteractionModel,
+        kICD,
+        kCompletion,
+        kCount,
+    };
+
+    /**
+     * Duration of the given stage of the last Init(), zero if it did not run.
+     */
+    System::Clock::Microseconds32 GetInitPhaseDuration(InitPhase phase) const
+    {
+        return (phase < InitPhase::kCount) ? mInitPhaseDurations[to_underlying(phase)] : System::Clock::Microseconds32(0);
+    }
+
     static Server & GetInstance() { return sServer; }
 
 private:
+    friend class Test::ServerTestAccess;
+
     Server() {}
 
     static Server sServer;
 
+    /**
+     * Work that is not needed to answer unicast requests, run from the event loop once Init() has returned, so that the
+     * messages received meanwhile are handled first.
+     */
+    enum class StartupWork : uint8_t
+    {
+        kMulticastRejoin        = 0x01,
+        kSubscriptionResumption = 0x02,
+    };
+
     void InitFailSafe();
+    void BeginInitPhase(InitPhase phase);
+    void EndInitPhase(CHIP_ERROR err);
+    void LogInitPhases() const;
+    void ScheduleStartupWork(StartupWork work);
+    static void HandleStartupWork(intptr_t context);
     void OnPlatformEvent(const DeviceLayer::ChipDeviceEvent & event);
     void CheckServerReadyEvent();
 
@@ -481,7 +535,7 @@ private:
 
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
     /**
-     * @brief Called at Server::Init time to resume persisted subscriptions if the feature flag is enabled
+     * @brief Called once the server is ready to resume persisted subscriptions if the feature flag is enabled
      */
     void ResumeSubscriptions();
 #endif
@@ -727,6 +781,10 @@ private:
     Inet::InterfaceId mInterfaceId;
 
     System::Clock::Microseconds64 mInitTimestamp;
+    System::Clock::Microseconds64 mInitPhaseStart;
+    InitPhase mInitPhase = InitPhase::kCount; ///< Phase being timed, kCount when none
+    System::Clock::Microseconds32 mInitPhaseDurations[to_underlying(InitPhase::kCount)];
+    BitFlags<StartupWork> mPendingStartupWork; ///< Cleared by Shutdown(), so that work scheduled before it does not run
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
     app::ICDManager mICDManager;
 #endif // CHIP_CONFIG_ENABLE_ICD_SERVER
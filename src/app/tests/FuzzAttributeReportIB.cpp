@@ -0,0 +1,80 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <app/MessageDef/AttributeReportIB.h>
+#include <lib/support/CodeUtils.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+
+/// Decodes an AttributeReportIB with the generic parsers, the same way ReadClient does.
+void GenericParseAttributeData(const TLV::TLVReader & aReader, ConcreteDataAttributePath & aAttributePath,
+                               TLV::TLVReader & aDataReader)
+{
+    AttributeReportIB::Parser report;
+    AttributeStatusIB::Parser status;
+    AttributeDataIB::Parser data;
+    AttributePathIB::Parser path;
+    DataVersion version = 0;
+
+    VerifyOrDie(report.Init(aReader) == CHIP_NO_ERROR);
+    VerifyOrDie(report.GetAttributeStatus(&status) == CHIP_END_OF_TLV);
+    VerifyOrDie(report.GetAttributeData(&data) == CHIP_NO_ERROR);
+    VerifyOrDie(data.GetPath(&path) == CHIP_NO_ERROR);
+    VerifyOrDie(path.GetConcreteAttributePath(aAttributePath, AttributePathIB::ValidateIdRanges::kNo) == CHIP_NO_ERROR);
+    VerifyOrDie(aAttributePath.IsValid());
+    VerifyOrDie(data.GetDataVersion(&version) == CHIP_NO_ERROR);
+    aAttributePath.mDataVersion.SetValue(version);
+    VerifyOrDie(data.GetData(&aDataReader) == CHIP_NO_ERROR);
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t * data, size_t len)
+{
+    TLV::TLVReader reader;
+    reader.Init(data, len);
+    if (reader.Next() != CHIP_NO_ERROR)
+    {
+        return 0;
+    }
+
+    ConcreteDataAttributePath fastPath;
+    TLV::TLVReader fastDataReader;
+    if (!AttributeReportIB::FastParseAttributeData(reader, fastPath, fastDataReader))
+    {
+        return 0;
+    }
+
+    // Every report accepted by the fast parser must be decoded identically by the generic parsers.
+    ConcreteDataAttributePath genericPath;
+    TLV::TLVReader genericDataReader;
+    GenericParseAttributeData(reader, genericPath, genericDataReader);
+
+    VerifyOrDie(fastPath == genericPath);
+    VerifyOrDie(fastDataReader.GetReadPoint() == genericDataReader.GetReadPoint());
+    VerifyOrDie(fastDataReader.GetType() == genericDataReader.GetType());
+    VerifyOrDie(fastDataReader.GetTag() == genericDataReader.GetTag());
+    VerifyOrDie(fastDataReader.GetLength() == genericDataReader.GetLength());
+
+    return 0;
+}
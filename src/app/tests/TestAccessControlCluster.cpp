@@ -0,0 +1,165 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <access/AccessControl.h>
+#include <access/examples/ExampleAccessControlDelegate.h>
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/AttributeAccessInterfaceRegistry.h>
+#include <app/AttributeValueDecoder.h>
+#include <lib/support/CHIPMem.h>
+
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters::AccessControl;
+using chip::Access::GetAccessControl;
+
+// Defined by the cluster, declared by the application's generated PluginApplicationCallbacks.h
+void MatterAccessControlPluginServerInitCallback();
+void MatterAccessControlPluginServerShutdownCallback();
+
+namespace {
+
+constexpr FabricIndex kTestFabricIndex = 1;
+constexpr NodeId kTestAdminNodeId      = 0x0000000000001111;
+constexpr size_t kTestBufferSize       = 2048;
+
+class DeviceTypeResolver : public Access::AccessControl::DeviceTypeResolver
+{
+public:
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+} gDeviceTypeResolver;
+
+class TestAccessControlCluster : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        ASSERT_EQ(GetAccessControl().Init(Access::Examples::GetAccessControlDelegate(), gDeviceTypeResolver), CHIP_NO_ERROR);
+        MatterAccessControlPluginServerInitCallback();
+
+        // The entry every write below tries to replace
+        Access::AccessControl::Entry entry;
+        ASSERT_EQ(GetAccessControl().PrepareEntry(entry), CHIP_NO_ERROR);
+        ASSERT_EQ(entry.SetFabricIndex(kTestFabricIndex), CHIP_NO_ERROR);
+        ASSERT_EQ(entry.SetPrivilege(Access::Privilege::kView), CHIP_NO_ERROR);
+        ASSERT_EQ(entry.SetAuthMode(Access::AuthMode::kCase), CHIP_NO_ERROR);
+        ASSERT_EQ(GetAccessControl().CreateEntry(nullptr, kTestFabricIndex, nullptr, entry), CHIP_NO_ERROR);
+    }
+
+    void TearDown() override
+    {
+        size_t count = 0;
+        EXPECT_EQ(GetAccessControl().GetEntryCount(kTestFabricIndex, count), CHIP_NO_ERROR);
+        while (count > 0)
+        {
+            EXPECT_EQ(GetAccessControl().DeleteEntry(nullptr, kTestFabricIndex, --count), CHIP_NO_ERROR);
+        }
+
+        MatterAccessControlPluginServerShutdownCallback();
+        GetAccessControl().Finish();
+    }
+
+protected:
+    // Writes the whole ACL of the test fabric through the cluster
+    CHIP_ERROR WriteAcl(const std::vector<Structs::AccessControlEntryStruct::Type> & entries)
+    {
+        uint8_t buf[kTestBufferSize];
+        TLV::TLVWriter writer;
+        writer.Init(buf);
+        ReturnErrorOnFailure(DataModel::EncodeForWrite(
+            writer, TLV::AnonymousTag(),
+            DataModel::List<const Structs::AccessControlEntryStruct::Type>(entries.data(), entries.size())));
+        ReturnErrorOnFailure(writer.Finalize());
+
+        TLV::TLVReader reader;
+        reader.Init(buf, writer.GetLengthWritten());
+        ReturnErrorOnFailure(reader.Next());
+
+        AttributeAccessInterface * attrAccess = AttributeAccessInterfaceRegistry::Instance().Get(kRootEndpointId, Id);
+        VerifyOrReturnError(attrAccess != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+        Access::SubjectDescriptor subjectDescriptor = { .fabricIndex = kTestFabricIndex,
+                                                        .authMode    = Access::AuthMode::kCase,
+                                                        .subject     = kTestAdminNodeId };
+        AttributeValueDecoder decoder(reader, subjectDescriptor);
+        return attrAccess->Write(ConcreteDataAttributePath(kRootEndpointId, Id, Attributes::Acl::Id), decoder);
+    }
+
+    // Checks that the fabric still only has the entry added by SetUp()
+    static void ExpectAclUnchanged()
+    {
+        size_t count = 0;
+        EXPECT_EQ(GetAccessControl().GetEntryCount(kTestFabricIndex, count), CHIP_NO_ERROR);
+        EXPECT_EQ(count, 1u);
+
+        Access::AccessControl::Entry entry;
+        Access::Privilege privilege = Access::Privilege::kAdminister;
+        ASSERT_EQ(GetAccessControl().ReadEntry(kTestFabricIndex, 0, entry), CHIP_NO_ERROR);
+        EXPECT_EQ(entry.GetPrivilege(privilege), CHIP_NO_ERROR);
+        EXPECT_EQ(privilege, Access::Privilege::kView);
+    }
+
+    static std::vector<Structs::AccessControlEntryStruct::Type> MakeEntries(size_t count)
+    {
+        std::vector<Structs::AccessControlEntryStruct::Type> entries(count);
+        for (auto & entry : entries)
+        {
+            entry.privilege   = AccessControlEntryPrivilegeEnum::kOperate;
+            entry.authMode    = AccessControlEntryAuthModeEnum::kCase;
+            entry.fabricIndex = kTestFabricIndex;
+        }
+        return entries;
+    }
+
+    static size_t GetMaxEntriesPerFabric()
+    {
+        size_t maxCount = 0;
+        EXPECT_EQ(GetAccessControl().GetMaxEntriesPerFabric(maxCount), CHIP_NO_ERROR);
+        return maxCount;
+    }
+};
+
+TEST_F(TestAccessControlCluster, TestInvalidEntryKeepsAcl)
+{
+    // PASE entries cannot be written
+    auto entries            = MakeEntries(2);
+    entries.back().authMode = AccessControlEntryAuthModeEnum::kPase;
+    EXPECT_EQ(WriteAcl(entries), CHIP_IM_GLOBAL_STATUS(ConstraintError));
+
+    ExpectAclUnchanged();
+}
+
+TEST_F(TestAccessControlCluster, TestTooManyEntriesTakesPrecedence)
+{
+    // A list over the limit is rejected as such, even when it also has invalid entries
+    auto entries             = MakeEntries(GetMaxEntriesPerFabric() + 1);
+    entries.front().authMode = AccessControlEntryAuthModeEnum::kPase;
+    EXPECT_EQ(WriteAcl(entries), CHIP_IM_GLOBAL_STATUS(ResourceExhausted));
+
+    ExpectAclUnchanged();
+}
+
+} // namespace
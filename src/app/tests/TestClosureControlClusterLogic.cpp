@@ -21,10 +21,10 @@
 #include <app/clusters/closure-control-server/closure-control-cluster-delegate.h>
 #include <app/clusters/closure-control-server/closure-control-cluster-logic.h>
 #include <app/clusters/closure-control-server/closure-control-cluster-objects.h>
+#include <app/tests/TimerAndMockClock.h>
 #include <lib/support/CHIPMem.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <system/SystemClock.h>
-#include <system/SystemTimer.h>
 #include <unordered_set>
 
 using namespace chip;
@@ -35,82 +35,11 @@ using namespace chip::System::Clock::Literals;
 
 using Status = chip::Protocols::InteractionModel::Status;
 
-namespace chip {
-namespace System {
-
-// TODO: This might be worthwhile to generalize and put into the system layer, but it too will need unit tests.
-// This was taken from the Valve control cluster rework - what we do there should be done here as well.
-class TimerAndMockClock : public Clock::Internal::MockClock, public Layer
-{
-public:
-    // System Layer overrides
-    CHIP_ERROR Init() override { return CHIP_NO_ERROR; }
-    void Shutdown() override { Clear(); }
-    void Clear()
-    {
-        mTimerList.Clear();
-        mTimerNodes.ReleaseAll();
-    }
-    bool IsInitialized() const override { return true; }
-
-    CHIP_ERROR StartTimer(Clock::Timeout aDelay, TimerCompleteCallback aComplete, void * aAppState) override
-    {
-        Clock::Timestamp awakenTime = GetMonotonicMilliseconds64() + std::chrono::duration_cast<Clock::Milliseconds64>(aDelay);
-        TimerList::Node * node      = mTimerNodes.Create(*this, awakenTime, aComplete, aAppState);
-        mTimerList.Add(node);
-        return CHIP_NO_ERROR;
-    }
-    void CancelTimer(TimerCompleteCallback aComplete, void * aAppState) override
-    {
-        TimerList::Node * cancelled = mTimerList.Remove(aComplete, aAppState);
-        if (cancelled != nullptr)
-        {
-            mTimerNodes.Release(cancelled);
-        }
-    }
-    CHIP_ERROR ExtendTimerTo(Clock::Timeout aDelay, TimerCompleteCallback aComplete, void * aAppState) override
-    {
-        return CHIP_ERROR_NOT_IMPLEMENTED;
-    }
-    bool IsTimerActive(TimerCompleteCallback onComplete, void * appState) override
-    {
-        return mTimerList.GetRemainingTime(onComplete, appState) != Clock::Timeout(0);
-    }
-    Clock::Timeout GetRemainingTime(TimerCompleteCallback onComplete, void * appState) override
-    {
-        return mTimerList.GetRemainingTime(onComplete, appState);
-    }
-    CHIP_ERROR ScheduleWork(TimerCompleteCallback aComplete, void * aAppState) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
-
-    // Clock overrides
-    void SetMonotonic(Clock::Milliseconds64 timestamp)
-    {
-        MockClock::SetMonotonic(timestamp);
-        // Find all the timers that fired at this time or before and invoke the callbacks
-        TimerList::Node * node;
-        while ((node = mTimerList.Earliest()) != nullptr && node->AwakenTime() <= timestamp)
-        {
-            mTimerList.PopEarliest();
-            // Invoke auto-releases
-            mTimerNodes.Invoke(node);
-        }
-    }
-
-    void AdvanceMonotonic(Clock::Milliseconds64 increment) { SetMonotonic(GetMonotonicMilliseconds64() + increment); }
-
-private:
-    TimerPool<> mTimerNodes;
-    TimerList mTimerList;
-};
-
-} // namespace System
-} // namespace chip
-
 namespace {
 
 // These are globals because SetUpTestSuite is static which requires static variables
-System::TimerAndMockClock gSystemLayerAndClock = System::TimerAndMockClock();
-System::Clock::ClockBase * gSavedClock         = nullptr;
+chip::Test::TimerAndMockClock gSystemLayerAndClock;
+System::Clock::ClockBase * gSavedClock = nullptr;
 
 // Simple mock implementation of DelegateBase
 class MockDelegate : public DelegateBase
@@ -769,4 +769,95 @@ TEST_F(TestClusterStateCache, TestCache)
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+class NullCacheCallback : public ClusterStateCache::Callback
+{
+    void OnDone(ReadClient *) override {}
+};
+
+// Returns the encoded size of a single filter in a DataVersionFilterIBs list
+uint32_t EncodedFilterSize(const DataVersionFilter & filter)
+{
+    uint8_t buf[64];
+    TLV::TLVWriter writer;
+    writer.Init(buf);
+    DataVersionFilterIBs::Builder builder;
+    EXPECT_EQ(builder.Init(&writer), CHIP_NO_ERROR);
+    uint32_t emptyLength = writer.GetLengthWritten();
+    EXPECT_EQ(builder.EncodeDataVersionFilterIB(filter), CHIP_NO_ERROR);
+    return writer.GetLengthWritten() - emptyLength;
+}
+
+/*
+ * Filters are encoded largest cluster first. When the filter of a cluster does
+ * not fit anymore, the filters of the smaller clusters that still fit are encoded.
+ */
+TEST_F(TestClusterStateCache, TestDataVersionFiltersFillAvailableSpace)
+{
+    NullCacheCallback callback;
+    ClusterStateCache cache(callback);
+
+    AttributePathParams wildcardPath;
+    const Span<AttributePathParams> pathSpan(&wildcardPath, 1);
+    {
+        uint8_t buf[20];
+        TLV::TLVWriter writer;
+        writer.Init(buf);
+        DataVersionFilterIBs::Builder builder;
+        EXPECT_EQ(builder.Init(&writer), CHIP_NO_ERROR);
+        bool encodedDataVersionList = false;
+        EXPECT_EQ(cache.GetBufferedCallback().OnUpdateDataVersionFilterList(builder, pathSpan, encodedDataVersionList),
+                  CHIP_NO_ERROR);
+    }
+
+    // The largest cluster also has the longest filter encoding
+    const DataVersionFilter largeFilter(1, 0xFFF1FC01, 0x12345678);
+    const DataVersionFilter smallFilter(1, Clusters::UnitTesting::Id, 1);
+
+    uint8_t valueBuf[64];
+    TLV::TLVWriter valueWriter;
+    valueWriter.Init(valueBuf);
+    EXPECT_EQ(valueWriter.PutString(TLV::AnonymousTag(), "a rather long attribute value"), CHIP_NO_ERROR);
+    EXPECT_EQ(valueWriter.Put(TLV::AnonymousTag(), static_cast<uint8_t>(1)), CHIP_NO_ERROR);
+
+    ReadClient::Callback & bufferedCallback = cache.GetBufferedCallback();
+    bufferedCallback.OnReportBegin();
+    for (const auto & filter : { largeFilter, smallFilter })
+    {
+        TLV::TLVReader reader;
+        reader.Init(valueBuf, valueWriter.GetLengthWritten());
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        if (filter.mClusterId == smallFilter.mClusterId)
+        {
+            // Skip to the short value
+            EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        }
+        ConcreteDataAttributePath path(filter.mEndpointId, filter.mClusterId, 0);
+        path.mDataVersion.SetValue(filter.mDataVersion.Value());
+        bufferedCallback.OnAttributeData(path, &reader, StatusIB());
+    }
+    bufferedCallback.OnReportEnd();
+
+    const uint32_t largeFilterSize = EncodedFilterSize(largeFilter);
+    const uint32_t smallFilterSize = EncodedFilterSize(smallFilter);
+    ASSERT_GT(largeFilterSize, smallFilterSize);
+
+    // Room for both, then only for the small filter
+    for (uint32_t filterSpace : { largeFilterSize + smallFilterSize, smallFilterSize })
+    {
+        uint8_t buf[64];
+        TLV::TLVWriter writer;
+        writer.Init(buf);
+        DataVersionFilterIBs::Builder builder;
+        EXPECT_EQ(builder.Init(&writer), CHIP_NO_ERROR);
+        uint32_t emptyLength = writer.GetLengthWritten();
+        EXPECT_EQ(writer.ReserveBuffer(static_cast<uint32_t>(sizeof(buf)) - emptyLength - filterSpace), CHIP_NO_ERROR);
+
+        bool encodedDataVersionList = false;
+        EXPECT_EQ(bufferedCallback.OnUpdateDataVersionFilterList(builder, pathSpan, encodedDataVersionList), CHIP_NO_ERROR);
+        EXPECT_EQ(builder.GetError(), CHIP_NO_ERROR);
+        EXPECT_TRUE(encodedDataVersionList);
+        EXPECT_EQ(writer.GetLengthWritten() - emptyLength, filterSpace);
+    }
+}
+
 } // namespace
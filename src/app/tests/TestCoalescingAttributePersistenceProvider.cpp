@@ -0,0 +1,275 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <app/tests/TimerAndMockClock.h>
+#include <app/util/persistence/CoalescingAttributePersistenceProvider.h>
+#include <lib/support/CHIPMem.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <map>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+using DirtyAttribute = CoalescingAttributePersistenceProvider::DirtyAttribute;
+
+const ConcreteAttributePath kLevelPath(1, 0x0008, 0x0000);
+const ConcreteAttributePath kOnOffPath(1, 0x0006, 0x0000);
+const ConcreteAttributePath kColorPath(1, 0x0300, 0x0007);
+
+// Keeps the values in memory and counts the writes
+class TestPersister : public AttributePersistenceProvider
+{
+public:
+    CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue) override
+    {
+        VerifyOrReturnError(!mFailWrites, CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+        mWrites++;
+        mValues[aPath] = std::vector<uint8_t>(aValue.begin(), aValue.end());
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                         MutableByteSpan & aValue) override
+    {
+        auto value = mValues.find(aPath);
+        VerifyOrReturnError(value != mValues.end(), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+        return CopySpanToMutableSpan(ByteSpan(value->second.data(), value->second.size()), aValue);
+    }
+
+    uint8_t GetValue(const ConcreteAttributePath & aPath) { return mValues.count(aPath) ? mValues[aPath].front() : 0; }
+
+    size_t mWrites    = 0;
+    bool mFailWrites = false;
+
+private:
+    std::map<ConcreteAttributePath, std::vector<uint8_t>> mValues;
+};
+
+class TestCoalescingAttributePersistenceProvider : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        sSavedClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&sLayerAndClock);
+        DeviceLayer::SetSystemLayerForTesting(&sLayerAndClock);
+    }
+
+    static void TearDownTestSuite()
+    {
+        sLayerAndClock.Shutdown();
+        DeviceLayer::SetSystemLayerForTesting(nullptr);
+        System::Clock::Internal::SetSystemClockForTesting(sSavedClock);
+        Platform::MemoryShutdown();
+    }
+
+protected:
+    static CHIP_ERROR Write(AttributePersistenceProvider & provider, const ConcreteAttributePath & path, uint8_t value)
+    {
+        return provider.WriteValue(path, ByteSpan(&value, 1));
+    }
+
+    static uint8_t Read(AttributePersistenceProvider & provider, const ConcreteAttributePath & path)
+    {
+        uint8_t value = 0;
+        MutableByteSpan span(&value, 1);
+        EXPECT_EQ(provider.ReadValue(path, nullptr, span), CHIP_NO_ERROR);
+        return value;
+    }
+
+    static chip::Test::TimerAndMockClock sLayerAndClock;
+    static System::Clock::ClockBase * sSavedClock;
+
+    TestPersister mPersister;
+    DirtyAttribute mDirtyAttributes[2];
+    uint8_t mValueBuffer[4];
+};
+
+chip::Test::TimerAndMockClock TestCoalescingAttributePersistenceProvider::sLayerAndClock;
+System::Clock::ClockBase * TestCoalescingAttributePersistenceProvider::sSavedClock = nullptr;
+
+TEST_F(TestCoalescingAttributePersistenceProvider, TestWritesCoalescedUntilIdle)
+{
+    CoalescingAttributePersistenceProvider provider(mPersister, Span<DirtyAttribute>(mDirtyAttributes),
+                                                    MutableByteSpan(mValueBuffer));
+
+    // A transition writing the level every 100 ms
+    for (uint8_t level = 1; level <= 20; level++)
+    {
+        EXPECT_EQ(Write(provider, kLevelPath, level), CHIP_NO_ERROR);
+        EXPECT_EQ(Read(provider, kLevelPath), level);
+        sLayerAndClock.AdvanceMonotonic(100_ms64);
+    }
+    EXPECT_EQ(Write(provider, kOnOffPath, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(mPersister.mWrites, 0u);
+    EXPECT_EQ(provider.GetDirtyCount(), 2u);
+
+    sLayerAndClock.AdvanceMonotonic(999_ms64);
+    EXPECT_EQ(mPersister.mWrites, 0u);
+
+    // Flushed together once idle, with the last values only
+    sLayerAndClock.AdvanceMonotonic(1_ms64);
+    EXPECT_EQ(mPersister.mWrites, 2u);
+    EXPECT_EQ(mPersister.GetValue(kLevelPath), 20);
+    EXPECT_EQ(mPersister.GetValue(kOnOffPath), 1);
+    EXPECT_EQ(provider.GetDirtyCount(), 0u);
+    EXPECT_EQ(Read(provider, kLevelPath), 20);
+
+    const auto & statistics = provider.GetStatistics();
+    EXPECT_EQ(statistics.writes, 21u);
+    EXPECT_EQ(statistics.coalescedWrites, 19u);
+    EXPECT_EQ(statistics.persistedWrites, 2u);
+    EXPECT_EQ(statistics.flushes, 1u);
+    EXPECT_EQ(statistics.peakDirtyAttributes, 2u);
+}
+
+TEST_F(TestCoalescingAttributePersistenceProvider, TestFlushedOnMaxDelay)
+{
+    CoalescingAttributePersistenceProvider::Parameters params;
+    params.idleDelay = 1000_ms32;
+    params.maxDelay  = 5000_ms32;
+    CoalescingAttributePersistenceProvider provider(mPersister, Span<DirtyAttribute>(mDirtyAttributes),
+                                                    MutableByteSpan(mValueBuffer), params);
+
+    // Never idle, but still persisted every max delay
+    for (uint8_t i = 1; i <= 100; i++)
+    {
+        EXPECT_EQ(Write(provider, kLevelPath, i), CHIP_NO_ERROR);
+        sLayerAndClock.AdvanceMonotonic(100_ms64);
+    }
+
+    EXPECT_EQ(mPersister.mWrites, 2u);
+    EXPECT_EQ(mPersister.GetValue(kLevelPath), 100);
+    EXPECT_EQ(provider.GetDirtyCount(), 0u);
+}
+
+TEST_F(TestCoalescingAttributePersistenceProvider, TestFlushedWhenFull)
+{
+    CoalescingAttributePersistenceProvider provider(mPersister, Span<DirtyAttribute>(mDirtyAttributes),
+                                                    MutableByteSpan(mValueBuffer));
+
+    EXPECT_EQ(Write(provider, kLevelPath, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(Write(provider, kOnOffPath, 2), CHIP_NO_ERROR);
+    EXPECT_EQ(mPersister.mWrites, 0u);
+
+    // No room for a third attribute
+    EXPECT_EQ(Write(provider, kColorPath, 3), CHIP_NO_ERROR);
+    EXPECT_EQ(mPersister.mWrites, 2u);
+    EXPECT_EQ(provider.GetDirtyCount(), 1u);
+    EXPECT_EQ(provider.GetStatistics().capacityFlushes, 1u);
+
+    // No room for a value growing past the buffer either
+    const uint8_t string[] = { 3, 'a', 'b', 'c' };
+    EXPECT_EQ(provider.WriteValue(kLevelPath, ByteSpan(string)), CHIP_NO_ERROR);
+    EXPECT_EQ(mPersister.mWrites, 3u);
+    EXPECT_EQ(provider.GetStatistics().capacityFlushes, 2u);
+
+    // Values larger than the buffer are written through
+    const uint8_t longString[] = { 4, 'a', 'b', 'c', 'd' };
+    EXPECT_EQ(provider.WriteValue(kLevelPath, ByteSpan(longString)), CHIP_NO_ERROR);
+    EXPECT_EQ(mPersister.mWrites, 4u);
+    EXPECT_EQ(provider.GetDirtyCount(), 0u);
+
+    // Flushed right away, e.g. on shutdown
+    EXPECT_EQ(Write(provider, kOnOffPath, 4), CHIP_NO_ERROR);
+    EXPECT_EQ(provider.Flush(), CHIP_NO_ERROR);
+    EXPECT_EQ(mPersister.mWrites, 5u);
+    EXPECT_EQ(mPersister.GetValue(kOnOffPath), 4);
+}
+
+TEST_F(TestCoalescingAttributePersistenceProvider, TestFlushedOnDestruction)
+{
+    {
+        CoalescingAttributePersistenceProvider provider(mPersister, Span<DirtyAttribute>(mDirtyAttributes),
+                                                        MutableByteSpan(mValueBuffer));
+        EXPECT_EQ(Write(provider, kLevelPath, 7), CHIP_NO_ERROR);
+        EXPECT_EQ(mPersister.mWrites, 0u);
+    }
+
+    EXPECT_EQ(mPersister.mWrites, 1u);
+    EXPECT_EQ(mPersister.GetValue(kLevelPath), 7);
+
+    // The flush timer was cancelled along with the provider
+    sLayerAndClock.AdvanceMonotonic(10000_ms64);
+    EXPECT_EQ(mPersister.mWrites, 1u);
+}
+
+TEST_F(TestCoalescingAttributePersistenceProvider, TestFailedWritesStayBuffered)
+{
+    CoalescingAttributePersistenceProvider provider(mPersister, Span<DirtyAttribute>(mDirtyAttributes),
+                                                    MutableByteSpan(mValueBuffer));
+
+    EXPECT_EQ(Write(provider, kLevelPath, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(Write(provider, kOnOffPath, 2), CHIP_NO_ERROR);
+
+    mPersister.mFailWrites = true;
+    EXPECT_EQ(provider.Flush(), CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    EXPECT_EQ(provider.GetDirtyCount(), 2u);
+    EXPECT_EQ(provider.GetStatistics().failedWrites, 2u);
+    EXPECT_EQ(Read(provider, kLevelPath), 1);
+    EXPECT_EQ(Read(provider, kOnOffPath), 2);
+
+    // A write that needs the dirty set to be written out fails too, and the buffered values are kept
+    EXPECT_EQ(Write(provider, kColorPath, 3), CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    EXPECT_EQ(provider.GetDirtyCount(), 2u);
+    EXPECT_EQ(Read(provider, kLevelPath), 1);
+
+    // Retried once the idle delay expired
+    mPersister.mFailWrites = false;
+    sLayerAndClock.AdvanceMonotonic(1000_ms64);
+    EXPECT_EQ(provider.GetDirtyCount(), 0u);
+    EXPECT_EQ(mPersister.mWrites, 2u);
+    EXPECT_EQ(mPersister.GetValue(kLevelPath), 1);
+    EXPECT_EQ(mPersister.GetValue(kOnOffPath), 2);
+}
+
+TEST_F(TestCoalescingAttributePersistenceProvider, TestWriteThroughReclaimsSpace)
+{
+    CoalescingAttributePersistenceProvider provider(mPersister, Span<DirtyAttribute>(mDirtyAttributes),
+                                                    MutableByteSpan(mValueBuffer));
+
+    EXPECT_EQ(Write(provider, kLevelPath, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(Write(provider, kOnOffPath, 2), CHIP_NO_ERROR);
+
+    // Written through, which leaves a hole at the start of the buffer
+    const uint8_t longString[] = { 4, 'a', 'b', 'c', 'd' };
+    EXPECT_EQ(provider.WriteValue(kLevelPath, ByteSpan(longString)), CHIP_NO_ERROR);
+    EXPECT_EQ(mPersister.mWrites, 1u);
+
+    // Fits once the buffer is compacted, without flushing
+    const uint8_t string[] = { 2, 'a', 'b' };
+    EXPECT_EQ(provider.WriteValue(kColorPath, ByteSpan(string)), CHIP_NO_ERROR);
+    EXPECT_EQ(mPersister.mWrites, 1u);
+    EXPECT_EQ(provider.GetStatistics().capacityFlushes, 0u);
+
+    uint8_t buffer[sizeof(string)];
+    MutableByteSpan value(buffer);
+    EXPECT_EQ(provider.ReadValue(kColorPath, nullptr, value), CHIP_NO_ERROR);
+    EXPECT_TRUE(value.data_equal(ByteSpan(string)));
+    EXPECT_EQ(Read(provider, kOnOffPath), 2);
+}
+
+} // namespace
@@ -764,6 +764,67 @@ TEST_F(TestDataModelSerialization, InvalidListType)
     }
 }
 
+TEST_F(TestDataModelSerialization, DecodeAllFabricScopedList)
+{
+    using GroupKeyMapStruct = Clusters::GroupKeyManagement::Structs::GroupKeyMapStruct::Type;
+    SetupBuf();
+
+    //
+    // Encode
+    //
+    {
+        GroupKeyMapStruct entries[3];
+        for (uint16_t i = 0; i < 3; i++)
+        {
+            entries[i].groupId       = static_cast<GroupId>(0x100 + i);
+            entries[i].groupKeySetID = static_cast<uint16_t>(i + 1);
+            entries[i].fabricIndex   = 7;
+        }
+
+        EXPECT_EQ(DataModel::EncodeForWrite(mWriter, TLV::AnonymousTag(), DataModel::List<GroupKeyMapStruct>(entries)),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(mWriter.Finalize(), CHIP_NO_ERROR);
+        DumpBuf();
+    }
+
+    //
+    // Decode
+    //
+    {
+        DataModel::DecodableList<Clusters::GroupKeyManagement::Structs::GroupKeyMapStruct::DecodableType> list;
+
+        SetupReader();
+        EXPECT_EQ(DataModel::Decode(mReader, list), CHIP_NO_ERROR);
+        list.SetFabricIndex(2);
+
+        Clusters::GroupKeyManagement::Structs::GroupKeyMapStruct::DecodableType storage[4];
+        Span<Clusters::GroupKeyManagement::Structs::GroupKeyMapStruct::DecodableType> entries(storage);
+        EXPECT_EQ(list.DecodeAll(entries), CHIP_NO_ERROR);
+        ASSERT_EQ(entries.size(), 3u);
+
+        // Decoded once, iterated as many times as needed
+        for (int pass = 0; pass < 2; pass++)
+        {
+            uint16_t i = 0;
+            for (const auto & entry : entries)
+            {
+                EXPECT_EQ(entry.groupId, 0x100 + i);
+                EXPECT_EQ(entry.groupKeySetID, i + 1);
+                EXPECT_EQ(entry.fabricIndex, 2);
+                i++;
+            }
+        }
+
+        Span<Clusters::GroupKeyManagement::Structs::GroupKeyMapStruct::DecodableType> tooSmall(storage, 2);
+        EXPECT_EQ(list.DecodeAll(tooSmall), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+        DataModel::DecodableList<Clusters::GroupKeyManagement::Structs::GroupKeyMapStruct::DecodableType> noList;
+        Span<Clusters::GroupKeyManagement::Structs::GroupKeyMapStruct::DecodableType> empty(storage);
+        EXPECT_EQ(noList.DecodeAll(empty), CHIP_NO_ERROR);
+        EXPECT_TRUE(empty.empty());
+    }
+}
+
 namespace {
 bool SimpleStructsEqual(const Clusters::UnitTesting::Structs::SimpleStruct::Type & s1,
                         const Clusters::UnitTesting::Structs::SimpleStruct::Type & s2)
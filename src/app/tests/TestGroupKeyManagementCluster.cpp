@@ -0,0 +1,172 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/AttributeAccessInterfaceRegistry.h>
+#include <app/AttributeValueDecoder.h>
+#include <credentials/GroupDataProviderImpl.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters::GroupKeyManagement;
+using chip::Credentials::GroupDataProvider;
+
+// Defined by the cluster, declared by the application's generated PluginApplicationCallbacks.h
+void MatterGroupKeyManagementPluginServerInitCallback();
+void MatterGroupKeyManagementPluginServerShutdownCallback();
+
+namespace {
+
+constexpr FabricIndex kTestFabricIndex = 1;
+constexpr size_t kTestBufferSize       = 1024;
+
+// Above the compile-time default, the handler has to go by the provider's limit
+constexpr uint16_t kMaxGroupsPerFabric    = CHIP_CONFIG_MAX_GROUPS_PER_FABRIC + 2;
+constexpr uint16_t kMaxGroupKeysPerFabric = 3;
+
+class TestGroupKeyManagementCluster : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        mProvider.SetStorageDelegate(&mStorage);
+        mProvider.SetSessionKeystore(&mSessionKeystore);
+        ASSERT_EQ(mProvider.Init(), CHIP_NO_ERROR);
+        Credentials::SetGroupDataProvider(&mProvider);
+        MatterGroupKeyManagementPluginServerInitCallback();
+    }
+
+    void TearDown() override
+    {
+        MatterGroupKeyManagementPluginServerShutdownCallback();
+        Credentials::SetGroupDataProvider(nullptr);
+        mProvider.Finish();
+    }
+
+protected:
+    // Writes the whole GroupKeyMap of the test fabric through the cluster
+    CHIP_ERROR WriteGroupKeyMap(const std::vector<Structs::GroupKeyMapStruct::Type> & entries)
+    {
+        uint8_t buf[kTestBufferSize];
+        TLV::TLVWriter writer;
+        writer.Init(buf);
+        ReturnErrorOnFailure(DataModel::EncodeForWrite(
+            writer, TLV::AnonymousTag(), DataModel::List<const Structs::GroupKeyMapStruct::Type>(entries.data(), entries.size())));
+        ReturnErrorOnFailure(writer.Finalize());
+
+        TLV::TLVReader reader;
+        reader.Init(buf, writer.GetLengthWritten());
+        ReturnErrorOnFailure(reader.Next());
+
+        AttributeAccessInterface * attrAccess = AttributeAccessInterfaceRegistry::Instance().Get(kRootEndpointId, Id);
+        VerifyOrReturnError(attrAccess != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+        Access::SubjectDescriptor subjectDescriptor = { .fabricIndex = kTestFabricIndex };
+        AttributeValueDecoder decoder(reader, subjectDescriptor);
+        return attrAccess->Write(ConcreteDataAttributePath(kRootEndpointId, Id, Attributes::GroupKeyMap::Id), decoder);
+    }
+
+    std::vector<GroupDataProvider::GroupKey> ReadGroupKeys()
+    {
+        std::vector<GroupDataProvider::GroupKey> keys;
+        auto iter = mProvider.IterateGroupKeys(kTestFabricIndex);
+        GroupDataProvider::GroupKey key;
+        while (iter != nullptr && iter->Next(key))
+        {
+            keys.push_back(key);
+        }
+        if (iter != nullptr)
+        {
+            iter->Release();
+        }
+        return keys;
+    }
+
+    static std::vector<Structs::GroupKeyMapStruct::Type> MakeEntries(size_t count)
+    {
+        std::vector<Structs::GroupKeyMapStruct::Type> entries(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            entries[i].groupId       = static_cast<GroupId>(0x0101 + i);
+            entries[i].groupKeySetID = 1;
+            entries[i].fabricIndex   = kTestFabricIndex;
+        }
+        return entries;
+    }
+
+    TestPersistentStorageDelegate mStorage;
+    Crypto::DefaultSessionKeystore mSessionKeystore;
+    Credentials::GroupDataProviderImpl mProvider{ kMaxGroupsPerFabric, kMaxGroupKeysPerFabric };
+};
+
+TEST_F(TestGroupKeyManagementCluster, TestReplaceGroupKeyMap)
+{
+    ASSERT_EQ(mProvider.SetGroupKeyAt(kTestFabricIndex, 0, GroupDataProvider::GroupKey(0x0A01, 2)), CHIP_NO_ERROR);
+
+    EXPECT_EQ(WriteGroupKeyMap(MakeEntries(2)), CHIP_NO_ERROR);
+
+    auto keys = ReadGroupKeys();
+    ASSERT_EQ(keys.size(), 2u);
+    EXPECT_EQ(keys[0].group_id, 0x0101);
+    EXPECT_EQ(keys[1].group_id, 0x0102);
+}
+
+TEST_F(TestGroupKeyManagementCluster, TestReplaceUpToProviderLimit)
+{
+    EXPECT_EQ(WriteGroupKeyMap(MakeEntries(kMaxGroupsPerFabric)), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadGroupKeys().size(), static_cast<size_t>(kMaxGroupsPerFabric));
+}
+
+TEST_F(TestGroupKeyManagementCluster, TestInvalidEntryKeepsGroupKeyMap)
+{
+    ASSERT_EQ(mProvider.SetGroupKeyAt(kTestFabricIndex, 0, GroupDataProvider::GroupKey(0x0A01, 2)), CHIP_NO_ERROR);
+
+    // The last entry maps to the IPK, which is not allowed
+    auto entries                 = MakeEntries(3);
+    entries.back().groupKeySetID = 0;
+    EXPECT_EQ(WriteGroupKeyMap(entries), CHIP_IM_GLOBAL_STATUS(ConstraintError));
+
+    auto keys = ReadGroupKeys();
+    ASSERT_EQ(keys.size(), 1u);
+    EXPECT_EQ(keys[0].group_id, 0x0A01);
+    EXPECT_EQ(keys[0].keyset_id, 2);
+}
+
+TEST_F(TestGroupKeyManagementCluster, TestTooLongListKeepsGroupKeyMap)
+{
+    ASSERT_EQ(mProvider.SetGroupKeyAt(kTestFabricIndex, 0, GroupDataProvider::GroupKey(0x0A01, 2)), CHIP_NO_ERROR);
+
+    EXPECT_EQ(WriteGroupKeyMap(MakeEntries(kMaxGroupsPerFabric + 1)), CHIP_ERROR_INVALID_LIST_LENGTH);
+
+    auto keys = ReadGroupKeys();
+    ASSERT_EQ(keys.size(), 1u);
+    EXPECT_EQ(keys[0].group_id, 0x0A01);
+}
+
+} // namespace
@@ -1745,6 +1745,81 @@ TEST_F(TestMessageDef, TestAttributeReportIB)
     ParseAttributeReportIB(attributeReportIBParser);
 }
 
+TEST_F(TestMessageDef, TestAttributeReportIBFastParse)
+{
+    AttributeReportIB::Builder attributeReportIBBuilder;
+    chip::System::PacketBufferTLVWriter writer;
+    chip::System::PacketBufferTLVReader reader;
+    writer.Init(chip::System::PacketBufferHandle::New(chip::System::PacketBuffer::kMaxSize));
+    attributeReportIBBuilder.Init(&writer);
+
+    // Encode the report the way servers do
+    ConcreteDataAttributePath path(2, 3, 4);
+    path.mListOp = ConcreteDataAttributePath::ListOperation::AppendItem;
+
+    AttributeDataIB::Builder & attributeDataIBBuilder = attributeReportIBBuilder.CreateAttributeData();
+    attributeDataIBBuilder.DataVersion(7);
+    EXPECT_EQ(attributeDataIBBuilder.CreatePath().Encode(path), CHIP_NO_ERROR);
+    EXPECT_EQ(attributeDataIBBuilder.GetWriter()->PutBoolean(
+                  chip::TLV::ContextTag(chip::to_underlying(AttributeDataIB::Tag::kData)), true),
+              CHIP_NO_ERROR);
+    attributeDataIBBuilder.EndOfAttributeDataIB();
+    attributeReportIBBuilder.EndOfAttributeReportIB();
+    EXPECT_EQ(attributeReportIBBuilder.GetError(), CHIP_NO_ERROR);
+
+    chip::System::PacketBufferHandle buf;
+    EXPECT_EQ(writer.Finalize(&buf), CHIP_NO_ERROR);
+    reader.Init(std::move(buf));
+    EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+
+    ConcreteDataAttributePath parsedPath;
+    chip::TLV::TLVReader dataReader;
+    EXPECT_TRUE(AttributeReportIB::FastParseAttributeData(reader, parsedPath, dataReader));
+    EXPECT_EQ(parsedPath.mEndpointId, 2u);
+    EXPECT_EQ(parsedPath.mClusterId, 3u);
+    EXPECT_EQ(parsedPath.mAttributeId, 4u);
+    EXPECT_EQ(parsedPath.mListOp, ConcreteDataAttributePath::ListOperation::AppendItem);
+    EXPECT_EQ(parsedPath.mDataVersion, chip::MakeOptional(static_cast<chip::DataVersion>(7)));
+
+    bool value = false;
+    EXPECT_EQ(dataReader.Get(value), CHIP_NO_ERROR);
+    EXPECT_TRUE(value);
+}
+
+TEST_F(TestMessageDef, TestAttributeReportIBFastParseFallback)
+{
+    // Reports that are not encoded like servers do, such as attribute statuses or paths with a list
+    // index, are left to the generic parsers.
+    for (bool buildStatus : { false, true })
+    {
+        AttributeReportIB::Builder attributeReportIBBuilder;
+        chip::System::PacketBufferTLVWriter writer;
+        chip::System::PacketBufferTLVReader reader;
+        writer.Init(chip::System::PacketBufferHandle::New(chip::System::PacketBuffer::kMaxSize));
+        attributeReportIBBuilder.Init(&writer);
+
+        if (buildStatus)
+        {
+            BuildAttributeStatusIB(attributeReportIBBuilder.CreateAttributeStatus());
+            attributeReportIBBuilder.EndOfAttributeReportIB();
+        }
+        else
+        {
+            BuildAttributeReportIB(attributeReportIBBuilder);
+        }
+        EXPECT_EQ(attributeReportIBBuilder.GetError(), CHIP_NO_ERROR);
+
+        chip::System::PacketBufferHandle buf;
+        EXPECT_EQ(writer.Finalize(&buf), CHIP_NO_ERROR);
+        reader.Init(std::move(buf));
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+
+        ConcreteDataAttributePath parsedPath;
+        chip::TLV::TLVReader dataReader;
+        EXPECT_FALSE(AttributeReportIB::FastParseAttributeData(reader, parsedPath, dataReader));
+    }
+}
+
 TEST_F(TestMessageDef, TestAttributeReportIBs)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -275,6 +275,8 @@ public:
         mReadError = true;
     }
 
+    void OnReportEnd() override { mNumReports++; }
+
     void OnDone(chip::app::ReadClient *) override {}
 
     void OnDeallocatePaths(chip::app::ReadPrepareParams && aReadPrepareParams) override
@@ -426,6 +428,7 @@ public:
     int mNumReadEventFailureStatusReceived = 0;
     int mNumAttributeResponse              = 0;
     int mNumArrayItems                     = 0;
+    int mNumReports                        = 0;
     bool mGotReport                        = false;
     bool mReadError                        = false;
     chip::app::ReadHandler * mpReadHandler = nullptr;
@@ -530,10 +533,12 @@ public:
     void TestPostSubscribeRoundtripChunkStatusReportTimeout();
     void TestPostSubscribeRoundtripStatusReportTimeout();
     void TestProcessSubscribeRequest();
+    void TestReadArenaFabricBudget();
     void TestReadChunking();
     void TestReadChunkingInvalidSubscriptionId();
     void TestReadChunkingStatusReportTimeout();
     void TestReadClient();
+    void TestReadClientDataVersionFiltersFillAvailableSpace();
     void TestReadClientGenerateAttributePathList();
     void TestReadClientGenerateInvalidAttributePathList();
     void TestReadClientGenerateOneEventPaths();
@@ -552,6 +557,7 @@ public:
     void TestReadReportFailure();
     void TestReadRoundtrip();
     void TestReadRoundtripWithDataVersionFilter();
+    void TestReadRoundtripWithDataVersionFilterPerCluster();
     void TestReadRoundtripWithMultiSamePathDifferentDataVersionFilter();
     void TestReadRoundtripWithNoMatchPathDataVersionFilter();
     void TestReadRoundtripWithSameDifferentPathsDataVersionFilter();
@@ -566,6 +572,8 @@ public:
     void TestSubscribeClientReceiveUnsolicitedInvalidReportMessage();
     void TestSubscribeClientReceiveUnsolicitedReportMessageWithInvalidSubscriptionId();
     void TestSubscribeClientReceiveWellFormedStatusResponse();
+    void TestSubscribeDataVersionFilterArenaRelease();
+    void TestSubscribeDirtyBatch();
     void TestSubscribeEarlyReport();
     void TestSubscribeEarlyShutdown();
     void TestSubscribeInvalidateFabric();
@@ -894,6 +902,53 @@ void TestReadInteraction::TestReadHandlerSetMaxReportingInterval()
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadClientDataVersionFiltersFillAvailableSpace)
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestReadClientDataVersionFiltersFillAvailableSpace)
+void TestReadInteraction::TestReadClientDataVersionFiltersFillAvailableSpace()
+{
+    MockInteractionModelApp delegate;
+    app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &GetExchangeManager(), delegate,
+                               chip::app::ReadClient::InteractionType::Subscribe);
+
+    AttributePathParams wildcardPath;
+    Span<AttributePathParams> attributePaths(&wildcardPath, 1);
+
+    // The first filter has a longer encoding than the second one
+    DataVersionFilter dataVersionFilters[2] = { DataVersionFilter(kTestEndpointId, 0xFFF1FC01, 0x12345678),
+                                                DataVersionFilter(kTestEndpointId, kTestClusterId, kTestDataVersion1) };
+
+    uint32_t filterSizes[2];
+    for (size_t i = 0; i < 2; i++)
+    {
+        uint8_t buf[64];
+        TLV::TLVWriter writer;
+        writer.Init(buf);
+        DataVersionFilterIBs::Builder builder;
+        EXPECT_EQ(builder.Init(&writer), CHIP_NO_ERROR);
+        uint32_t emptyLength = writer.GetLengthWritten();
+        EXPECT_EQ(builder.EncodeDataVersionFilterIB(dataVersionFilters[i]), CHIP_NO_ERROR);
+        filterSizes[i] = writer.GetLengthWritten() - emptyLength;
+    }
+    ASSERT_GT(filterSizes[0], filterSizes[1]);
+
+    // Only the second filter fits: it is encoded even though the first one was skipped
+    uint8_t buf[64];
+    TLV::TLVWriter writer;
+    writer.Init(buf);
+    DataVersionFilterIBs::Builder builder;
+    EXPECT_EQ(builder.Init(&writer), CHIP_NO_ERROR);
+    uint32_t emptyLength = writer.GetLengthWritten();
+    EXPECT_EQ(writer.ReserveBuffer(static_cast<uint32_t>(sizeof(buf)) - emptyLength - filterSizes[1]), CHIP_NO_ERROR);
+
+    bool encodedDataVersionList = false;
+    EXPECT_EQ(readClient.BuildDataVersionFilterList(builder, attributePaths, Span<DataVersionFilter>(dataVersionFilters),
+                                                    encodedDataVersionList),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(builder.GetError(), CHIP_NO_ERROR);
+    EXPECT_TRUE(encodedDataVersionList);
+    EXPECT_EQ(writer.GetLengthWritten() - emptyLength, filterSizes[1]);
+}
+
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadClientGenerateAttributePathList)
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestReadClientGenerateAttributePathList)
 void TestReadInteraction::TestReadClientGenerateAttributePathList()
@@ -1288,6 +1343,56 @@ void TestReadInteraction::TestReadRoundtripWithDataVersionFilter()
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadRoundtripWithDataVersionFilterPerCluster)
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestReadRoundtripWithDataVersionFilterPerCluster)
+void TestReadInteraction::TestReadRoundtripWithDataVersionFilterPerCluster()
+{
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    // Every cluster of the endpoint, in order: MockClusterId(1), MockClusterId(2), MockClusterId(3)
+    chip::app::AttributePathParams attributePathParams[1];
+    attributePathParams[0].mEndpointId = chip::Test::kMockEndpoint2;
+
+    // Only the filter of the middle cluster is up to date. The clusters before and after it are reported.
+    chip::app::DataVersionFilter dataVersionFilters[2];
+    dataVersionFilters[0].mEndpointId = chip::Test::kMockEndpoint2;
+    dataVersionFilters[0].mClusterId  = chip::Test::MockClusterId(1);
+    dataVersionFilters[0].mDataVersion.SetValue(chip::Test::GetVersion() + 1);
+
+    dataVersionFilters[1].mEndpointId = chip::Test::kMockEndpoint2;
+    dataVersionFilters[1].mClusterId  = chip::Test::MockClusterId(2);
+    dataVersionFilters[1].mDataVersion.SetValue(chip::Test::GetVersion());
+
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+    readPrepareParams.mpDataVersionFilterList      = dataVersionFilters;
+    readPrepareParams.mDataVersionFilterListSize   = 2;
+
+    {
+        app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &GetExchangeManager(), delegate,
+                                   chip::app::ReadClient::InteractionType::Read);
+
+        EXPECT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+
+        DrainAndServiceIO();
+        EXPECT_FALSE(delegate.mReadError);
+
+        // MockClusterId(1) has 2 attributes and MockClusterId(3) 5, plus the 3 global lists of each
+        EXPECT_EQ(delegate.mNumAttributeResponse, 13);
+        for (const auto & path : delegate.mReceivedAttributePaths)
+        {
+            EXPECT_NE(path.mClusterId, chip::Test::MockClusterId(2));
+        }
+    }
+
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadRoundtripWithNoMatchPathDataVersionFilter)
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestReadRoundtripWithNoMatchPathDataVersionFilter)
 void TestReadInteraction::TestReadRoundtripWithNoMatchPathDataVersionFilter()
@@ -1825,6 +1930,143 @@ void TestReadInteraction::TestProcessSubscribeRequest()
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+#if CHIP_IM_READ_HANDLER_ARENA
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestSubscribeDataVersionFilterArenaRelease)
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestSubscribeDataVersionFilterArenaRelease)
+void TestReadInteraction::TestSubscribeDataVersionFilterArenaRelease()
+{
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    chip::app::AttributePathParams attributePathParams[1];
+    attributePathParams[0].mEndpointId  = kTestEndpointId;
+    attributePathParams[0].mClusterId   = kTestClusterId;
+    attributePathParams[0].mAttributeId = 1;
+
+    chip::app::DataVersionFilter dataVersionFilters[1];
+    dataVersionFilters[0].mEndpointId = kTestEndpointId;
+    dataVersionFilters[0].mClusterId  = kTestClusterId;
+    dataVersionFilters[0].mDataVersion.SetValue(kTestDataVersion1);
+
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+    readPrepareParams.mpDataVersionFilterList      = dataVersionFilters;
+    readPrepareParams.mDataVersionFilterListSize   = 1;
+    readPrepareParams.mMinIntervalFloorSeconds     = 1;
+    readPrepareParams.mMaxIntervalCeilingSeconds   = 2;
+
+    {
+        app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &GetExchangeManager(), delegate,
+                                   chip::app::ReadClient::InteractionType::Subscribe);
+
+        EXPECT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+
+        DrainAndServiceIO();
+
+        EXPECT_FALSE(delegate.mReadError);
+        // The filter matches the current data version, so the priming report skipped the attribute
+        EXPECT_EQ(delegate.mNumAttributeResponse, 0);
+
+        ASSERT_EQ(engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe), 1u);
+        ReadHandler * readHandler = engine->ActiveHandlerAt(0);
+        ASSERT_NE(readHandler, nullptr);
+
+        // The filters are only needed for the priming report: their arena is released once it is sent, the paths are kept
+        EXPECT_EQ(readHandler->GetDataVersionFilterCount(), 0u);
+        EXPECT_EQ(readHandler->mDataVersionFilterArena.GetBytesReserved(), 0u);
+        EXPECT_EQ(readHandler->GetAttributePathCount(), 1u);
+        EXPECT_GT(readHandler->mPathArena.GetBytesReserved(), 0u);
+    }
+
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadArenaFabricBudget)
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestReadArenaFabricBudget)
+void TestReadInteraction::TestReadArenaFabricBudget()
+{
+    MockInteractionModelApp subscribeDelegate;
+    MockInteractionModelApp readDelegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    chip::app::AttributePathParams attributePathParams[1];
+    attributePathParams[0].mEndpointId  = kTestEndpointId;
+    attributePathParams[0].mClusterId   = kTestClusterId;
+    attributePathParams[0].mAttributeId = 1;
+
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+    readPrepareParams.mMinIntervalFloorSeconds     = 1;
+    readPrepareParams.mMaxIntervalCeilingSeconds   = 2;
+
+    {
+        app::ReadClient subscribeClient(chip::app::InteractionModelEngine::GetInstance(), &GetExchangeManager(),
+                                        subscribeDelegate, chip::app::ReadClient::InteractionType::Subscribe);
+
+        EXPECT_EQ(subscribeClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+        DrainAndServiceIO();
+        EXPECT_FALSE(subscribeDelegate.mReadError);
+
+        ASSERT_EQ(engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe), 1u);
+        ReadHandler * readHandler = engine->ActiveHandlerAt(0);
+        ASSERT_NE(readHandler, nullptr);
+
+        // The first chunk of the arena is sized for the single path, not the chunk size
+        const FabricIndex fabricIndex = readHandler->GetAccessingFabricIndex();
+        const size_t usage            = engine->GetFabricArenaUsage(fabricIndex);
+        EXPECT_EQ(usage, readHandler->GetArenaBytesReserved());
+        EXPECT_GT(usage, 0u);
+        EXPECT_LT(usage, static_cast<size_t>(CHIP_IM_READ_HANDLER_ARENA_CHUNK_SIZE));
+
+        // The subscription uses up the whole budget of the fabric: a read on the same fabric is refused
+        engine->SetFabricArenaBudget(usage);
+        EXPECT_FALSE(engine->ReserveFabricArenaMemory(fabricIndex, 1));
+        EXPECT_TRUE(engine->ReserveFabricArenaMemory(static_cast<FabricIndex>(fabricIndex + 1), usage));
+        engine->ReleaseFabricArenaMemory(static_cast<FabricIndex>(fabricIndex + 1), usage);
+        EXPECT_EQ(engine->GetFabricArenaUsage(fabricIndex), usage);
+
+        {
+            app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &GetExchangeManager(), readDelegate,
+                                       chip::app::ReadClient::InteractionType::Read);
+
+            EXPECT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+            DrainAndServiceIO();
+
+            EXPECT_TRUE(readDelegate.mReadError);
+            EXPECT_EQ(readDelegate.mError, CHIP_IM_GLOBAL_STATUS(PathsExhausted));
+            EXPECT_EQ(readDelegate.mNumAttributeResponse, 0);
+        }
+
+        // Without a budget, the same read succeeds
+        engine->SetFabricArenaBudget(0);
+        readDelegate.Reset();
+
+        {
+            app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &GetExchangeManager(), readDelegate,
+                                       chip::app::ReadClient::InteractionType::Read);
+
+            EXPECT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+            DrainAndServiceIO();
+
+            EXPECT_FALSE(readDelegate.mReadError);
+            EXPECT_EQ(readDelegate.mNumAttributeResponse, 1);
+        }
+        EXPECT_EQ(engine->GetFabricArenaUsage(fabricIndex), usage);
+
+        engine->ShutdownAllSubscriptionHandlers();
+        EXPECT_EQ(engine->GetFabricArenaUsage(fabricIndex), 0u);
+    }
+
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+#endif // CHIP_IM_READ_HANDLER_ARENA
+
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
 /**
  * @brief Test validates that an ICD will choose its IdleModeDuration (GetPublisherSelectedIntervalLimit)
@@ -3229,6 +3471,78 @@ void TestReadInteraction::TestSubscribeSetDirtyFullyOverlap()
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+// Subscribe (E2, C3, A1) and (E2, C3, A2), then mark both and an unrelated path dirty in a batch, receive a single report
+// with both attributes once the batch ends
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestSubscribeDirtyBatch)
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestSubscribeDirtyBatch)
+void TestReadInteraction::TestSubscribeDirtyBatch()
+{
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mEventPathParamsListSize = 0;
+
+    readPrepareParams.mAttributePathParamsListSize = 2;
+    auto attributePathParams = std::make_unique<chip::app::AttributePathParams[]>(readPrepareParams.mAttributePathParamsListSize);
+    attributePathParams[0].mEndpointId          = chip::Test::kMockEndpoint2;
+    attributePathParams[0].mClusterId           = chip::Test::MockClusterId(3);
+    attributePathParams[0].mAttributeId         = chip::Test::MockAttributeId(1);
+    attributePathParams[1].mEndpointId          = chip::Test::kMockEndpoint2;
+    attributePathParams[1].mClusterId           = chip::Test::MockClusterId(3);
+    attributePathParams[1].mAttributeId         = chip::Test::MockAttributeId(2);
+    readPrepareParams.mpAttributePathParamsList = attributePathParams.get();
+
+    readPrepareParams.mMinIntervalFloorSeconds   = 0;
+    readPrepareParams.mMaxIntervalCeilingSeconds = 1;
+
+    {
+        app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &GetExchangeManager(), delegate,
+                                   chip::app::ReadClient::InteractionType::Subscribe);
+
+        attributePathParams.release();
+        EXPECT_EQ(readClient.SendAutoResubscribeRequest(std::move(readPrepareParams)), CHIP_NO_ERROR);
+
+        DrainAndServiceIO();
+
+        EXPECT_EQ(delegate.mNumAttributeResponse, 2);
+        EXPECT_EQ(engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe), 1u);
+
+        delegate.mGotReport            = false;
+        delegate.mNumAttributeResponse = 0;
+        delegate.mNumReports           = 0;
+        delegate.mReceivedAttributePaths.clear();
+
+        reporting::Engine & reportingEngine = engine->GetReportingEngine();
+        reportingEngine.BeginDirtyBatch();
+        reportingEngine.MarkDirty(AttributePathParams(chip::Test::kMockEndpoint2, chip::Test::MockClusterId(3),
+                                                      chip::Test::MockAttributeId(1)));
+        reportingEngine.MarkDirty(AttributePathParams(chip::Test::kMockEndpoint3, chip::Test::MockClusterId(1),
+                                                      chip::Test::MockAttributeId(1)));
+        reportingEngine.MarkDirty(AttributePathParams(chip::Test::kMockEndpoint2, chip::Test::MockClusterId(3),
+                                                      chip::Test::MockAttributeId(2)));
+
+        // Nothing is reported while the batch is open
+        DrainAndServiceIO();
+        EXPECT_FALSE(delegate.mGotReport);
+
+        reportingEngine.EndDirtyBatch();
+        DrainAndServiceIO();
+
+        EXPECT_EQ(delegate.mNumReports, 1);
+        ASSERT_EQ(delegate.mNumAttributeResponse, 2);
+        EXPECT_EQ(delegate.mReceivedAttributePaths[0],
+                  ConcreteAttributePath(chip::Test::kMockEndpoint2, chip::Test::MockClusterId(3), chip::Test::MockAttributeId(1)));
+        EXPECT_EQ(delegate.mReceivedAttributePaths[1],
+                  ConcreteAttributePath(chip::Test::kMockEndpoint2, chip::Test::MockClusterId(3), chip::Test::MockAttributeId(2)));
+    }
+
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 // Verify that subscription can be shut down just after receiving SUBSCRIBE RESPONSE,
 // before receiving any subsequent REPORT DATA.
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestSubscribeEarlyShutdown)
@@ -17,6 +17,7 @@
  */
 
 #include <app/InteractionModelEngine.h>
+#include <app/reporting/CostAwareReportSchedulerImpl.h>
 #include <app/reporting/ReportSchedulerImpl.h>
 #include <app/reporting/SynchronizedReportSchedulerImpl.h>
 #include <app/tests/AppTestContext.h>
@@ -58,6 +59,7 @@ public:
     void TestReportTiming();
     void TestObserverCallbacks();
     void TestSynchronizedScheduler();
+    void TestCostAwareScheduler();
 
     /// @brief Mimicks the various operations that happen on a subscription transaction after a read handler was created so that
     /// readhandlers are in the expected state for further tests.
@@ -260,6 +262,9 @@ ReportSchedulerImpl sScheduler(&sTestTimerDelegate);
 TestTimerSynchronizedDelegate sTestTimerSynchronizedDelegate;
 SynchronizedReportSchedulerImpl syncScheduler(&sTestTimerSynchronizedDelegate);
 
+TestTimerDelegate sTestTimerCostAwareDelegate;
+CostAwareReportSchedulerImpl costAwareScheduler(&sTestTimerCostAwareDelegate);
+
 TEST_F_FROM_FIXTURE(TestReportScheduler, TestReadHandlerList)
 {
 
@@ -807,6 +812,104 @@ TEST_F_FROM_FIXTURE(TestReportScheduler, TestSynchronizedScheduler)
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+TEST_F_FROM_FIXTURE(TestReportScheduler, TestCostAwareScheduler)
+{
+    NullReadHandlerCallback nullCallback;
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(nullptr, false);
+    ObjectPool<ReadHandler, kNumMaxReadHandlers> readHandlerPool;
+    constexpr size_t kNumHandlers = 6;
+    ReadHandler * readHandlers[kNumHandlers];
+    ReadHandlerNode * nodes[kNumHandlers];
+
+    // Default parameters: ticks of 100ms with a budget of 20ms of encode time
+    sTestTimerCostAwareDelegate.SetMockSystemTimestamp(Milliseconds64(0));
+    costAwareScheduler.ResetStatistics();
+
+    for (size_t i = 0; i < kNumHandlers; i++)
+    {
+        readHandlers[i] =
+            readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe, &costAwareScheduler);
+        EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandlers[i], &costAwareScheduler, 0, 10));
+        nodes[i] = costAwareScheduler.FindReadHandlerNode(readHandlers[i]);
+        ASSERT_NE(nodes[i], nullptr);
+
+        // Reports that did not run yet are assumed to be cheap and all fit on the max interval
+        EXPECT_FALSE(nodes[i]->HasReportCost());
+        EXPECT_EQ(nodes[i]->GetScheduledTimestamp(), Milliseconds64(10000));
+    }
+    EXPECT_EQ(costAwareScheduler.GetStatistics().reportsAdvanced, 0u);
+
+    // The first handler generates a chunked report, the cost of the chunks adds up
+    costAwareScheduler.OnReportChunkGenerated(readHandlers[0], System::Clock::Microseconds32(8000), 100, false);
+    EXPECT_EQ(nodes[0]->GetEstimatedEncodeTime(), System::Clock::Microseconds32(8000));
+    EXPECT_EQ(nodes[0]->GetEstimatedReportBytes(), 100u);
+    costAwareScheduler.OnReportChunkGenerated(readHandlers[0], System::Clock::Microseconds32(6000), 100, true);
+    readHandlers[0]->SetStateFlag(ReadHandler::ReadHandlerFlags::ChunkedReport);
+    costAwareScheduler.OnReportChunkGenerated(readHandlers[0], System::Clock::Microseconds32(10000), 100, false);
+    readHandlers[0]->ClearStateFlag(ReadHandler::ReadHandlerFlags::ChunkedReport);
+    EXPECT_EQ(nodes[0]->GetEstimatedEncodeTime(), System::Clock::Microseconds32(10000));
+    EXPECT_EQ(nodes[0]->GetEstimatedReportBytes(), 125u);
+
+    for (size_t i = 1; i < kNumHandlers; i++)
+    {
+        costAwareScheduler.OnReportChunkGenerated(readHandlers[i], System::Clock::Microseconds32(8000), 100, false);
+    }
+    EXPECT_EQ(costAwareScheduler.GetStatistics().reportsGenerated, kNumHandlers + 1);
+    EXPECT_EQ(costAwareScheduler.GetStatistics().maxLateness, System::Clock::Milliseconds32(0));
+
+    // Everything becomes dirty at once, only the reports that fit in the budget are generated right away
+    for (size_t i = 0; i < kNumHandlers; i++)
+    {
+        readHandlers[i]->ForceDirtyState();
+    }
+    EXPECT_TRUE(costAwareScheduler.IsReportableNow(readHandlers[0]));
+    EXPECT_TRUE(costAwareScheduler.IsReportableNow(readHandlers[1]));
+    for (size_t i = 2; i < kNumHandlers; i++)
+    {
+        EXPECT_FALSE(costAwareScheduler.IsReportableNow(readHandlers[i]));
+        EXPECT_EQ(nodes[i]->GetScheduledTimestamp(), Milliseconds64(100 * (i / 2)));
+        EXPECT_EQ(nodes[i]->GetMinTimestamp(), Milliseconds64(100 * (i / 2)));
+    }
+    EXPECT_EQ(costAwareScheduler.GetStatistics().reportsDeferred, 4u);
+    EXPECT_EQ(costAwareScheduler.GetStatistics().peakTickCost, System::Clock::Microseconds32(18000));
+
+    // Next tick, the deferred reports of the second pair become reportable
+    sTestTimerCostAwareDelegate.IncrementMockTimestamp(Milliseconds64(100));
+    EXPECT_TRUE(costAwareScheduler.IsReportableNow(readHandlers[2]));
+    EXPECT_TRUE(costAwareScheduler.IsReportableNow(readHandlers[3]));
+    EXPECT_FALSE(costAwareScheduler.IsReportableNow(readHandlers[4]));
+    EXPECT_FALSE(costAwareScheduler.IsReportableNow(readHandlers[5]));
+    EXPECT_EQ(costAwareScheduler.GetStatistics().queueDepth, 4u);
+
+    // Simulate the reports of the first two pairs, the first pair was generated a tick late
+    for (size_t i = 0; i < 4; i++)
+    {
+        costAwareScheduler.OnReportChunkGenerated(readHandlers[i], System::Clock::Microseconds32(8000), 100, false);
+        readHandlers[i]->ClearForceDirtyFlag();
+        costAwareScheduler.OnSubscriptionReportSent(readHandlers[i]);
+        EXPECT_FALSE(costAwareScheduler.IsReportableNow(readHandlers[i]));
+    }
+    EXPECT_EQ(costAwareScheduler.GetStatistics().maxLateness, System::Clock::Milliseconds32(100));
+    EXPECT_EQ(costAwareScheduler.GetStatistics().maxIntervalOverruns, 0u);
+
+    // Their next max interval reports do not fit in the same tick, the second pair reports a tick earlier
+    EXPECT_EQ(nodes[0]->GetScheduledTimestamp(), Milliseconds64(10100));
+    EXPECT_EQ(nodes[1]->GetScheduledTimestamp(), Milliseconds64(10100));
+    EXPECT_EQ(nodes[2]->GetScheduledTimestamp(), Milliseconds64(10000));
+    EXPECT_EQ(nodes[3]->GetScheduledTimestamp(), Milliseconds64(10000));
+    EXPECT_EQ(costAwareScheduler.GetStatistics().reportsAdvanced, 2u);
+
+    sTestTimerCostAwareDelegate.IncrementMockTimestamp(Milliseconds64(100));
+    EXPECT_TRUE(costAwareScheduler.IsReportableNow(readHandlers[4]));
+    EXPECT_TRUE(costAwareScheduler.IsReportableNow(readHandlers[5]));
+    EXPECT_EQ(costAwareScheduler.GetStatistics().reportsOverBudget, 0u);
+
+    costAwareScheduler.UnregisterAllHandlers();
+    readHandlerPool.ReleaseAll();
+    exchangeCtx->Close();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
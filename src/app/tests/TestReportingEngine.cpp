@@ -98,6 +98,7 @@ public:
     void TestBuildAndSendSingleReportData();
     void TestMergeOverlappedAttributePath();
     void TestMergeAttributePathWhenDirtySetPoolExhausted();
+    void TestDirtyBatch();
 
 private:
     chip::app::DataModel::Provider * mOldProvider = nullptr;
@@ -351,6 +352,67 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
 
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestDirtyBatch)
+{
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                          app::reporting::GetDefaultReportScheduler()),
+              CHIP_NO_ERROR);
+
+    Engine & engine     = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    uint64_t generation = engine.GetDirtySetGeneration();
+
+    // Nested batches are only processed when the outermost one ends, duplicate paths are dropped.
+    engine.BeginDirtyBatch();
+    engine.BeginDirtyBatch();
+    engine.MarkDirty(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1));
+    engine.MarkDirty(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1));
+    engine.MarkDirty(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId2));
+    engine.EndDirtyBatch();
+    EXPECT_EQ(engine.GetDirtySetGeneration(), generation);
+    engine.EndDirtyBatch();
+    EXPECT_EQ(engine.GetDirtySetGeneration(), generation + 1);
+
+    // Paths already covered by a batched wildcard path are dropped too.
+    engine.BeginDirtyBatch();
+    engine.MarkDirty(AttributePathParams(kTestEndpointId, kTestClusterId));
+    engine.MarkDirty(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1));
+    engine.EndDirtyBatch();
+    EXPECT_EQ(engine.GetDirtySetGeneration(), generation + 2);
+
+    // A full batch is processed before taking more paths.
+    engine.BeginDirtyBatch();
+    for (AttributeId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_BATCH_PATHS + 1; i++)
+    {
+        engine.MarkDirty(AttributePathParams(kTestEndpointId, kTestClusterId, i));
+    }
+    EXPECT_EQ(engine.GetDirtySetGeneration(), generation + 3);
+    engine.EndDirtyBatch();
+    EXPECT_EQ(engine.GetDirtySetGeneration(), generation + 4);
+
+    // Outside of a batch, every path is processed right away.
+    engine.MarkDirty(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1));
+    engine.MarkDirty(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId2));
+    EXPECT_EQ(engine.GetDirtySetGeneration(), generation + 6);
+
+    // A batch still open across a shutdown can be ended afterwards. The paths it buffered are dropped.
+    engine.BeginDirtyBatch();
+    engine.MarkDirty(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1));
+    engine.Shutdown();
+    engine.EndDirtyBatch();
+    EXPECT_EQ(engine.GetDirtySetGeneration(), generation + 6);
+
+    // A span longer than a batch is processed one batch at a time.
+    AttributePathParams paths[CHIP_IM_SERVER_MAX_NUM_DIRTY_BATCH_PATHS + 1];
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(paths); i++)
+    {
+        paths[i] = AttributePathParams(kTestEndpointId, kTestClusterId, static_cast<AttributeId>(i + 1));
+    }
+    EXPECT_EQ(engine.SetDirty(Span<const AttributePathParams>(paths)), CHIP_NO_ERROR);
+    EXPECT_EQ(engine.GetDirtySetGeneration(), generation + 8);
+
+    engine.Shutdown();
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -0,0 +1,197 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/TestEventTriggerDelegate.h>
+#include <app/TimerDelegates.h>
+#include <app/reporting/ReportSchedulerImpl.h>
+#include <app/server/Server.h>
+#include <app/tests/ServerTestAccess.h>
+#include <credentials/GroupDataProviderImpl.h>
+#include <credentials/tests/CHIPCert_unit_test_vectors.h>
+#include <data-model-providers/codegen/CodegenDataModelProvider.h>
+#include <lib/dnssd/Advertiser.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <platform/CommissionableDataProvider.h>
+#include <platform/TestOnlyCommissionableDataProvider.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+using chip::Server;
+
+namespace {
+
+// Counts the group iterations of a fabric, which is what rejoining the multicast groups goes through
+class CountingGroupDataProvider : public chip::Credentials::GroupDataProviderImpl
+{
+public:
+    GroupInfoIterator * IterateGroupInfo(chip::FabricIndex fabric_index) override
+    {
+        if (fabric_index == mCountedFabricIndex)
+        {
+            mIterations++;
+        }
+        return GroupDataProviderImpl::IterateGroupInfo(fabric_index);
+    }
+
+    chip::FabricIndex mCountedFabricIndex = chip::kUndefinedFabricIndex;
+    size_t mIterations                    = 0;
+};
+
+chip::CommonCaseDeviceServerInitParams sInitParams;
+CountingGroupDataProvider sGroupDataProvider;
+
+void TearDownTask(intptr_t context)
+{
+    Server::GetInstance().Shutdown();
+}
+
+void StopEventLoop(intptr_t context)
+{
+    chip::DeviceLayer::PlatformMgr().StopEventLoopTask();
+}
+
+class TestServerStartup : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+        ASSERT_EQ(chip::DeviceLayer::PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+
+        static chip::DeviceLayer::TestOnlyCommissionableDataProvider commissionableDataProvider;
+        chip::DeviceLayer::SetCommissionableDataProvider(&commissionableDataProvider);
+
+        static chip::app::DefaultTimerDelegate sTimerDelegate;
+        static chip::app::reporting::ReportSchedulerImpl sReportScheduler(&sTimerDelegate);
+        sInitParams.reportScheduler = &sReportScheduler;
+        static chip::SimpleTestEventTriggerDelegate sSimpleTestEventTriggerDelegate;
+        sInitParams.testEventTriggerDelegate = &sSimpleTestEventTriggerDelegate;
+        ASSERT_EQ(sInitParams.InitializeStaticResourcesBeforeServerInit(), CHIP_NO_ERROR);
+
+        sGroupDataProvider.SetStorageDelegate(sInitParams.persistentStorageDelegate);
+        sGroupDataProvider.SetSessionKeystore(sInitParams.sessionKeystore);
+        ASSERT_EQ(sGroupDataProvider.Init(), CHIP_NO_ERROR);
+        sInitParams.groupDataProvider = &sGroupDataProvider;
+
+        static chip::app::CodegenDataModelProvider sDataModelProvider;
+        sDataModelProvider.SetPersistentStorageDelegate(sInitParams.persistentStorageDelegate);
+        sInitParams.dataModelProvider = &sDataModelProvider;
+        // Use whatever server port the kernel decides to give us.
+        sInitParams.operationalServicePort = 0;
+
+        ASSERT_EQ(Server::GetInstance().Init(sInitParams), CHIP_NO_ERROR);
+        Server::GetInstance().GetCommissioningWindowManager().CloseCommissioningWindow();
+    }
+
+    static void TearDownTestSuite()
+    {
+        chip::DeviceLayer::PlatformMgr().ScheduleWork(TearDownTask, 0);
+        chip::DeviceLayer::PlatformMgr().ScheduleWork(StopEventLoop);
+        chip::DeviceLayer::PlatformMgr().RunEventLoop();
+
+        chip::DeviceLayer::PlatformMgr().Shutdown();
+
+        auto & mdnsAdvertiser = chip::Dnssd::ServiceAdvertiser::Instance();
+        mdnsAdvertiser.RemoveServices();
+        mdnsAdvertiser.Shutdown();
+
+        // Platform memory is left initialized, see TestCommissioningWindowManager.
+    }
+};
+
+TEST_F(TestServerStartup, TestInitPhaseDurations)
+{
+    Server & server = Server::GetInstance();
+
+    uint64_t totalMicroseconds = 0;
+    for (uint8_t i = 0; i < chip::to_underlying(Server::InitPhase::kCount); i++)
+    {
+        totalMicroseconds += server.GetInitPhaseDuration(static_cast<Server::InitPhase>(i)).count();
+    }
+    EXPECT_GT(totalMicroseconds, 0u);
+    EXPECT_LE(totalMicroseconds, server.TimeSinceInit().count());
+
+    EXPECT_EQ(server.GetInitPhaseDuration(Server::InitPhase::kCount), chip::System::Clock::Microseconds32(0));
+}
+
+TEST_F(TestServerStartup, TestDeferredMulticastRejoin)
+{
+    using namespace chip::TestCerts;
+
+    Server & server = Server::GetInstance();
+    chip::Test::ServerTestAccess serverAccess(&server);
+
+    chip::FabricIndex fabricIndex = chip::kUndefinedFabricIndex;
+    ASSERT_EQ(server.GetFabricTable().AddNewFabricForTestIgnoringCollisions(GetRootACertAsset().mCert, GetIAA1CertAsset().mCert,
+                                                                            GetNodeA1CertAsset().mCert, GetNodeA1CertAsset().mKey,
+                                                                            &fabricIndex),
+              CHIP_NO_ERROR);
+    sGroupDataProvider.mCountedFabricIndex = fabricIndex;
+    sGroupDataProvider.mIterations         = 0;
+
+    // The rejoin runs from the event loop, not from the call that schedules it
+    serverAccess.ScheduleMulticastRejoin();
+    EXPECT_TRUE(serverAccess.IsMulticastRejoinPending());
+    EXPECT_EQ(sGroupDataProvider.mIterations, 0u);
+
+    chip::DeviceLayer::PlatformMgr().ScheduleWork(StopEventLoop);
+    chip::DeviceLayer::PlatformMgr().RunEventLoop();
+
+    EXPECT_FALSE(serverAccess.IsMulticastRejoinPending());
+    EXPECT_EQ(sGroupDataProvider.mIterations, 1u);
+
+    sGroupDataProvider.mCountedFabricIndex = chip::kUndefinedFabricIndex;
+    EXPECT_EQ(server.GetFabricTable().Delete(fabricIndex), CHIP_NO_ERROR);
+}
+
+void RestartServerTask(intptr_t context)
+{
+    chip::Test::ServerTestAccess serverAccess(&Server::GetInstance());
+
+    // The stale rejoin scheduled before Shutdown() has run by now and must not have done anything
+    EXPECT_FALSE(serverAccess.IsMulticastRejoinPending());
+
+    EXPECT_EQ(Server::GetInstance().Init(sInitParams), CHIP_NO_ERROR);
+    Server::GetInstance().GetCommissioningWindowManager().CloseCommissioningWindow();
+
+    // Init() scheduled a new rejoin
+    EXPECT_TRUE(serverAccess.IsMulticastRejoinPending());
+
+    chip::DeviceLayer::PlatformMgr().ScheduleWork(StopEventLoop);
+}
+
+void ShutdownBeforeMulticastRejoinTask(intptr_t context)
+{
+    chip::Test::ServerTestAccess serverAccess(&Server::GetInstance());
+
+    serverAccess.ScheduleMulticastRejoin();
+    Server::GetInstance().Shutdown();
+    EXPECT_FALSE(serverAccess.IsMulticastRejoinPending());
+
+    // Queued behind the rejoin, so it only runs once the rejoin has been handled
+    chip::DeviceLayer::PlatformMgr().ScheduleWork(RestartServerTask);
+}
+
+TEST_F(TestServerStartup, TestShutdownBeforeDeferredMulticastRejoin)
+{
+    chip::DeviceLayer::PlatformMgr().ScheduleWork(ShutdownBeforeMulticastRejoinTask);
+    chip::DeviceLayer::PlatformMgr().RunEventLoop();
+}
+
+} // namespace
@@ -0,0 +1,229 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <app/tests/TimerAndMockClock.h>
+#include <app/util/TransitionScheduler.h>
+#include <lib/support/CHIPMem.h>
+#include <system/SystemClock.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+// A transition stepping every 100 ms for a number of steps
+struct Transition
+{
+    TransitionScheduler * scheduler = nullptr;
+    int stepsRemaining              = 0;
+    int stepsRun                    = 0;
+
+    static void Step(System::Layer *, void * context)
+    {
+        auto * transition = static_cast<Transition *>(context);
+        transition->stepsRun++;
+        if (--transition->stepsRemaining > 0)
+        {
+            EXPECT_EQ(transition->scheduler->Schedule(100_ms32, Step, transition), CHIP_NO_ERROR);
+        }
+    }
+};
+
+class TestTransitionScheduler : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        sSavedClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&sLayerAndClock);
+    }
+
+    static void TearDownTestSuite()
+    {
+        System::Clock::Internal::SetSystemClockForTesting(sSavedClock);
+        Platform::MemoryShutdown();
+    }
+
+    void SetUp() override
+    {
+        // The monotonic clock never goes back, each test starts on the next second
+        mStart = System::Clock::Milliseconds64((sLayerAndClock.GetMonotonicMilliseconds64().count() / 1000 + 1) * 1000);
+        sLayerAndClock.SetMonotonic(mStart);
+        sLayerAndClock.mTimersStarted = 0;
+        mScheduler.SetSystemLayer(&sLayerAndClock);
+    }
+
+    void TearDown() override
+    {
+        mScheduler.Shutdown();
+        sLayerAndClock.Shutdown();
+    }
+
+protected:
+    static chip::Test::TimerAndMockClock sLayerAndClock;
+    static System::Clock::ClockBase * sSavedClock;
+
+    TransitionScheduler mScheduler{ 10_ms32 };
+    System::Clock::Milliseconds64 mStart;
+};
+
+chip::Test::TimerAndMockClock TestTransitionScheduler::sLayerAndClock;
+System::Clock::ClockBase * TestTransitionScheduler::sSavedClock = nullptr;
+
+TEST_F(TestTransitionScheduler, TestConcurrentTransitionsShareTicks)
+{
+    constexpr int kTransitionCount = CHIP_CONFIG_MAX_CONCURRENT_TRANSITIONS;
+    Transition transitions[kTransitionCount];
+
+    // Transitions started a few milliseconds apart by the same group command
+    for (int i = 0; i < kTransitionCount; i++)
+    {
+        sLayerAndClock.SetMonotonic(mStart + System::Clock::Milliseconds64(1 + i * 5 / kTransitionCount));
+        transitions[i].scheduler      = &mScheduler;
+        transitions[i].stepsRemaining = 10;
+        EXPECT_EQ(mScheduler.Schedule(100_ms32, Transition::Step, &transitions[i]), CHIP_NO_ERROR);
+    }
+
+    sLayerAndClock.AdvanceMonotonic(105_ms64);
+    for (int i = 1; i < 10; i++)
+    {
+        sLayerAndClock.AdvanceMonotonic(100_ms64);
+    }
+
+    for (auto & transition : transitions)
+    {
+        EXPECT_EQ(transition.stepsRun, 10);
+        EXPECT_FALSE(mScheduler.IsScheduled(Transition::Step, &transition));
+    }
+
+    const auto & statistics = mScheduler.GetStatistics();
+    EXPECT_EQ(statistics.ticks, 10u);
+    EXPECT_EQ(statistics.steps, 10u * kTransitionCount);
+    EXPECT_EQ(statistics.peakStepsPerTick, static_cast<uint32_t>(kTransitionCount));
+    EXPECT_EQ(sLayerAndClock.mTimersStarted, 10u);
+}
+
+TEST_F(TestTransitionScheduler, TestStepsAlignOnTicks)
+{
+    Transition first{ &mScheduler, 1 };
+    Transition second{ &mScheduler, 1 };
+
+    sLayerAndClock.SetMonotonic(mStart + 1_ms64);
+    EXPECT_EQ(mScheduler.Schedule(100_ms32, Transition::Step, &first), CHIP_NO_ERROR);
+    sLayerAndClock.SetMonotonic(mStart + 9_ms64);
+    EXPECT_EQ(mScheduler.Schedule(100_ms32, Transition::Step, &second), CHIP_NO_ERROR);
+
+    // Both are due on the tick boundary 110 ms after the start
+    sLayerAndClock.AdvanceMonotonic(100_ms64);
+    EXPECT_EQ(first.stepsRun, 0);
+    EXPECT_EQ(second.stepsRun, 0);
+
+    sLayerAndClock.AdvanceMonotonic(1_ms64);
+    EXPECT_EQ(first.stepsRun, 1);
+    EXPECT_EQ(second.stepsRun, 1);
+    EXPECT_EQ(mScheduler.GetStatistics().ticks, 1u);
+}
+
+TEST_F(TestTransitionScheduler, TestRescheduleAndCancel)
+{
+    Transition first{ &mScheduler, 1 };
+    Transition second{ &mScheduler, 1 };
+
+    EXPECT_EQ(mScheduler.Schedule(100_ms32, Transition::Step, &first), CHIP_NO_ERROR);
+    EXPECT_EQ(mScheduler.Schedule(100_ms32, Transition::Step, &second), CHIP_NO_ERROR);
+
+    // Scheduling again moves the step
+    EXPECT_EQ(mScheduler.Schedule(300_ms32, Transition::Step, &first), CHIP_NO_ERROR);
+    mScheduler.Cancel(Transition::Step, &second);
+    EXPECT_TRUE(mScheduler.IsScheduled(Transition::Step, &first));
+    EXPECT_FALSE(mScheduler.IsScheduled(Transition::Step, &second));
+
+    sLayerAndClock.AdvanceMonotonic(200_ms64);
+    EXPECT_EQ(first.stepsRun, 0);
+    EXPECT_EQ(second.stepsRun, 0);
+
+    sLayerAndClock.AdvanceMonotonic(100_ms64);
+    EXPECT_EQ(first.stepsRun, 1);
+    EXPECT_EQ(second.stepsRun, 0);
+
+    // Cancelling and moving steps later did not restart the timer, only the pass that found nothing due did
+    EXPECT_EQ(sLayerAndClock.mTimersStarted, 2u);
+    EXPECT_EQ(mScheduler.GetStatistics().ticks, 2u);
+}
+
+// Once the scheduler is full, steps run from their own timer instead of failing
+TEST_F(TestTransitionScheduler, TestFallbackTimersWhenFull)
+{
+    TransitionScheduler scheduler{ 10_ms32, 2 };
+    scheduler.SetSystemLayer(&sLayerAndClock);
+
+    Transition transitions[4] = { { &scheduler, 1 }, { &scheduler, 1 }, { &scheduler, 1 }, { &scheduler, 1 } };
+    for (auto & transition : transitions)
+    {
+        EXPECT_EQ(scheduler.Schedule(100_ms32, Transition::Step, &transition), CHIP_NO_ERROR);
+        EXPECT_TRUE(scheduler.IsScheduled(Transition::Step, &transition));
+    }
+    EXPECT_EQ(scheduler.GetStatistics().fallbackTimers, 2u);
+
+    scheduler.Cancel(Transition::Step, &transitions[3]);
+    EXPECT_FALSE(scheduler.IsScheduled(Transition::Step, &transitions[3]));
+
+    sLayerAndClock.AdvanceMonotonic(100_ms64);
+    for (auto & transition : transitions)
+    {
+        EXPECT_FALSE(scheduler.IsScheduled(Transition::Step, &transition));
+    }
+    EXPECT_EQ(transitions[0].stepsRun, 1);
+    EXPECT_EQ(transitions[1].stepsRun, 1);
+    EXPECT_EQ(transitions[2].stepsRun, 1);
+    EXPECT_EQ(transitions[3].stepsRun, 0);
+
+    // Only the steps that fit in the scheduler shared its tick
+    EXPECT_EQ(scheduler.GetStatistics().ticks, 1u);
+    EXPECT_EQ(scheduler.GetStatistics().steps, 2u);
+}
+
+// Steps scheduled without delay from a step run on the next pass, not in the pass that scheduled them
+TEST_F(TestTransitionScheduler, TestImmediateStepRunsOnNextPass)
+{
+    struct Chained
+    {
+        TransitionScheduler * scheduler;
+        int runs;
+
+        static void Step(System::Layer *, void * context)
+        {
+            auto * chained = static_cast<Chained *>(context);
+            if (chained->runs++ == 0)
+            {
+                EXPECT_EQ(chained->scheduler->Schedule(0_ms32, Step, chained), CHIP_NO_ERROR);
+            }
+        }
+    } chained{ &mScheduler, 0 };
+
+    EXPECT_EQ(mScheduler.Schedule(0_ms32, Chained::Step, &chained), CHIP_NO_ERROR);
+    sLayerAndClock.AdvanceMonotonic(0_ms64);
+    EXPECT_EQ(chained.runs, 2);
+    EXPECT_EQ(mScheduler.GetStatistics().ticks, 2u);
+}
+
+} // namespace
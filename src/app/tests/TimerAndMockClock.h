@@ -0,0 +1,102 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+#include <system/SystemTimer.h>
+
+namespace chip {
+namespace Test {
+
+/**
+ * A system layer running on a mock clock: timers fire as the clock is advanced through AdvanceMonotonic().
+ *
+ * Set it as the system clock with System::Clock::Internal::SetSystemClockForTesting(), and as the device layer
+ * system layer with DeviceLayer::SetSystemLayerForTesting() for code that uses DeviceLayer::SystemLayer().
+ */
+class TimerAndMockClock : public System::Clock::Internal::MockClock, public System::Layer
+{
+public:
+    CHIP_ERROR Init() override { return CHIP_NO_ERROR; }
+    void Shutdown() override { Clear(); }
+    void Clear()
+    {
+        mTimerList.Clear();
+        mTimerNodes.ReleaseAll();
+    }
+    bool IsInitialized() const override { return true; }
+
+    CHIP_ERROR StartTimer(System::Clock::Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        CancelTimer(aComplete, aAppState);
+        System::Clock::Timestamp awakenTime =
+            GetMonotonicMilliseconds64() + std::chrono::duration_cast<System::Clock::Milliseconds64>(aDelay);
+        mTimerList.Add(mTimerNodes.Create(*this, awakenTime, aComplete, aAppState));
+        mTimersStarted++;
+        return CHIP_NO_ERROR;
+    }
+    void CancelTimer(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        System::TimerList::Node * cancelled = mTimerList.Remove(aComplete, aAppState);
+        if (cancelled != nullptr)
+        {
+            mTimerNodes.Release(cancelled);
+        }
+    }
+    CHIP_ERROR ExtendTimerTo(System::Clock::Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    bool IsTimerActive(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mTimerList.GetRemainingTime(onComplete, appState) != System::Clock::Timeout(0);
+    }
+    System::Clock::Timeout GetRemainingTime(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mTimerList.GetRemainingTime(onComplete, appState);
+    }
+    CHIP_ERROR ScheduleWork(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    void SetMonotonic(System::Clock::Milliseconds64 timestamp)
+    {
+        MockClock::SetMonotonic(timestamp);
+        // Invoke the callbacks of all the timers that fired at this time or before
+        System::TimerList::Node * node;
+        while ((node = mTimerList.Earliest()) != nullptr && node->AwakenTime() <= timestamp)
+        {
+            mTimerList.PopEarliest();
+            // Invoke auto-releases
+            mTimerNodes.Invoke(node);
+        }
+    }
+
+    void AdvanceMonotonic(System::Clock::Milliseconds64 increment) { SetMonotonic(GetMonotonicMilliseconds64() + increment); }
+
+    size_t mTimersStarted = 0;
+
+private:
+    System::TimerPool<> mTimerNodes;
+    System::TimerList mTimerList;
+};
+
+} // namespace Test
+} // namespace chip
@@ -0,0 +1,646 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Interaction Model load generator.
+ *
+ *      Runs an in-process server on the mock data model and a number of
+ *      controllers over the loopback transport, drives mixes of reads,
+ *      wildcard subscriptions, writes, invokes and group invokes, and prints
+ *      one IM_BENCHMARK line per scenario. See README.md for the output format
+ *      and the environment variables configuring the runs.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/CommandSender.h>
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/WriteClient.h>
+#include <app/data-model/EncodableToTLV.h>
+#include <app/tests/AppTestContext.h>
+#include <app/tests/test-interaction-model-api.h>
+#include <app/util/mock/Constants.h>
+#include <app/util/mock/Functions.h>
+#include <app/util/mock/MockNodeConfig.h>
+#include <credentials/GroupDataProviderImpl.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/MemoryAccounting.h>
+#include <lib/support/TestGroupData.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/TypeTraits.h>
+#include <system/SystemClock.h>
+
+#include <algorithm>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters::Globals::Attributes;
+using Protocols::InteractionModel::Status;
+
+constexpr ClusterId kLoadClusterId         = Test::MockClusterId(1);
+constexpr AttributeId kReadAttributeId     = Test::MockAttributeId(2);
+constexpr AttributeId kWritableAttributeId = Test::MockAttributeId(1);
+constexpr CommandId kLoadCommandId         = 1;
+constexpr EndpointId kLoadEndpoints[]      = { Test::kMockEndpoint1, Test::kMockEndpoint2 };
+
+constexpr uint16_t kMaxGroupsPerFabric    = 5;
+constexpr uint16_t kMaxGroupKeysPerFabric = 8;
+
+constexpr uint32_t kDefaultOperations  = 500;
+constexpr uint32_t kDefaultControllers = 4;
+
+// Number of concrete attribute paths of each subscription of the subscription storm
+constexpr size_t kStormPathCount = 50;
+
+// A scenario that does not complete in this time is reported as failed
+constexpr System::Clock::Seconds16 kScenarioTimeout = System::Clock::Seconds16(60);
+
+enum class Operation : uint8_t
+{
+    kRead,
+    kSubscribe,
+    kWrite,
+    kInvoke,
+    kGroupInvoke,
+    kSubscribeStorm,
+
+    kCount
+};
+
+constexpr const char * kOperationNames[] = { "read", "subscribe", "write", "invoke", "group_invoke", "subscribe_storm" };
+static_assert(MATTER_ARRAY_SIZE(kOperationNames) == to_underlying(Operation::kCount));
+
+/// Relative weights of the operations in a scenario.
+struct OperationMix
+{
+    uint8_t weights[to_underlying(Operation::kCount)];
+
+    uint32_t TotalWeight() const
+    {
+        uint32_t total = 0;
+        for (uint8_t weight : weights)
+        {
+            total += weight;
+        }
+        return total;
+    }
+
+    // Operations are interleaved in a fixed order, so that runs are repeatable
+    Operation OperationAt(uint32_t index) const
+    {
+        uint32_t slot = index % TotalWeight();
+        for (uint8_t i = 0; i < to_underlying(Operation::kCount); i++)
+        {
+            if (slot < weights[i])
+            {
+                return static_cast<Operation>(i);
+            }
+            slot -= weights[i];
+        }
+        return Operation::kRead;
+    }
+};
+
+uint32_t GetConfigValue(const char * name, uint32_t defaultValue)
+{
+    const char * value = getenv(name);
+    VerifyOrReturnValue(value != nullptr && *value != '\0', defaultValue);
+    unsigned long parsed = strtoul(value, nullptr, 10);
+    return (parsed > 0 && parsed <= UINT32_MAX) ? static_cast<uint32_t>(parsed) : defaultValue;
+}
+
+// Parses a mix such as "read=4,write=1,invoke=1"
+bool ParseOperationMix(const char * text, OperationMix & mix)
+{
+    mix = {};
+    while (*text != '\0')
+    {
+        const char * separator = strchr(text, '=');
+        VerifyOrReturnValue(separator != nullptr, false);
+
+        char * end           = nullptr;
+        unsigned long weight = strtoul(separator + 1, &end, 10);
+        VerifyOrReturnValue(end != separator + 1 && weight <= UINT8_MAX, false);
+
+        size_t nameLength = static_cast<size_t>(separator - text);
+        bool found        = false;
+        for (uint8_t i = 0; i < to_underlying(Operation::kCount) && !found; i++)
+        {
+            found = (strlen(kOperationNames[i]) == nameLength && strncmp(text, kOperationNames[i], nameLength) == 0);
+            if (found)
+            {
+                mix.weights[i] = static_cast<uint8_t>(weight);
+            }
+        }
+        VerifyOrReturnValue(found, false);
+
+        VerifyOrReturnValue(*end == ',' || *end == '\0', false);
+        text = (*end == ',') ? end + 1 : end;
+    }
+    return mix.TotalWeight() > 0;
+}
+
+uint64_t NowMicroseconds()
+{
+    return System::SystemClock().GetMonotonicMicroseconds64().count();
+}
+
+size_t HeapInUse()
+{
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+constexpr bool kHasHeapInUse =
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+    true;
+#else
+    false;
+#endif
+
+// Heap allocations made through chip::Platform so far, when memory accounting is enabled
+size_t AllocationCount()
+{
+    size_t count = 0;
+    for (uint8_t tag = 0; tag < to_underlying(Platform::MemoryTag::kCount); tag++)
+    {
+        count += Platform::GetMemoryTagStats(static_cast<Platform::MemoryTag>(tag)).allocations;
+    }
+    return count;
+}
+
+const Test::MockNodeConfig & LoadMockNodeConfig()
+{
+    using namespace chip::Test;
+
+    // clang-format off
+    static const MockNodeConfig config({
+        MockEndpointConfig(kMockEndpoint1, {
+            MockClusterConfig(kLoadClusterId, {
+                ClusterRevision::Id, FeatureMap::Id,
+                MockAttributeConfig(kWritableAttributeId, ZCL_BOOLEAN_ATTRIBUTE_TYPE),
+                MockAttributeId(2), MockAttributeId(3),
+            }, {}, { kLoadCommandId }),
+            MockClusterConfig(MockClusterId(2), {
+                ClusterRevision::Id, FeatureMap::Id, MockAttributeId(2), MockAttributeId(3),
+            }),
+        }),
+        MockEndpointConfig(kMockEndpoint2, {
+            MockClusterConfig(kLoadClusterId, {
+                ClusterRevision::Id, FeatureMap::Id,
+                MockAttributeConfig(kWritableAttributeId, ZCL_BOOLEAN_ATTRIBUTE_TYPE),
+                MockAttributeId(2), MockAttributeId(3),
+            }, {}, { kLoadCommandId }),
+        }),
+    });
+    // clang-format on
+    return config;
+}
+
+/// The mock data model, with the load command succeeding.
+class LoadDataModel : public TestImCustomDataModel
+{
+public:
+    std::optional<DataModel::ActionReturnStatus> InvokeCommand(const DataModel::InvokeRequest & request,
+                                                               TLV::TLVReader & input_arguments, CommandHandler * handler) override
+    {
+        handler->AddStatus(request.path, Status::Success);
+        return std::nullopt;
+    }
+};
+
+LoadDataModel gLoadDataModel;
+
+class EmptyCommandPayload : public DataModel::EncodableToTLV
+{
+public:
+    CHIP_ERROR EncodeTo(TLV::TLVWriter & writer, TLV::Tag tag) const override
+    {
+        TLV::TLVType outerType;
+        ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outerType));
+        return writer.EndContainer(outerType);
+    }
+};
+
+struct ScenarioResult
+{
+    uint32_t completed = 0;
+    uint32_t errors    = 0;
+    std::vector<uint32_t> latenciesUs;
+    size_t peakExchanges    = 0;
+    size_t peakReadHandlers = 0;
+    size_t peakHeapBytes    = 0;
+    size_t allocations      = 0;
+
+    void Record(uint64_t startUs, uint64_t endUs, bool success)
+    {
+        completed++;
+        errors += success ? 0 : 1;
+        latenciesUs.push_back(static_cast<uint32_t>(std::min<uint64_t>(endUs - startUs, UINT32_MAX)));
+    }
+};
+
+/**
+ * A controller with at most one operation in flight. All the controllers share
+ * the loopback session to the server.
+ */
+class Controller : public ReadClient::Callback, public WriteClient::Callback, public CommandSender::ExtendableCallback
+{
+public:
+    void Init(Test::AppContext & context, uint32_t index)
+    {
+        mContext  = &context;
+        mEndpoint = kLoadEndpoints[index % MATTER_ARRAY_SIZE(kLoadEndpoints)];
+    }
+
+    bool IsBusy() const { return mBusy; }
+    bool IsDone() const { return mBusy && mDone; }
+    bool IsSubscribing() const
+    {
+        return mBusy && !mDone && (mOperation == Operation::kSubscribe || mOperation == Operation::kSubscribeStorm);
+    }
+
+    CHIP_ERROR Start(Operation operation, uint32_t sequence)
+    {
+        mBusy      = true;
+        mDone      = false;
+        mFailed    = false;
+        mOperation = operation;
+        mStartUs   = NowMicroseconds();
+
+        CHIP_ERROR err = StartOperation(sequence);
+        if (err != CHIP_NO_ERROR)
+        {
+            Release();
+        }
+        return err;
+    }
+
+    // Record the completed operation and release its clients
+    void Finish(ScenarioResult & result)
+    {
+        result.Record(mStartUs, mEndUs, !mFailed);
+        Release();
+    }
+
+private:
+    CHIP_ERROR StartOperation(uint32_t sequence)
+    {
+        auto & exchangeManager = mContext->GetExchangeManager();
+
+        switch (mOperation)
+        {
+        case Operation::kRead:
+        case Operation::kSubscribe:
+        case Operation::kSubscribeStorm: {
+            const bool subscribe = (mOperation != Operation::kRead);
+            mReadClient          = Platform::MakeUnique<ReadClient>(InteractionModelEngine::GetInstance(), &exchangeManager, *this,
+                                                                    subscribe ? ReadClient::InteractionType::Subscribe
+                                                                              : ReadClient::InteractionType::Read);
+            VerifyOrReturnError(mReadClient, CHIP_ERROR_NO_MEMORY);
+
+            // Subscriptions are wildcard, reads target a single attribute, and the storm subscribes to
+            // concrete paths cycling over the attributes of the load cluster
+            size_t pathCount = 1;
+            if (mOperation == Operation::kSubscribeStorm)
+            {
+                constexpr AttributeId kStormAttributeIds[] = { ClusterRevision::Id, FeatureMap::Id, kWritableAttributeId,
+                                                               kReadAttributeId, Test::MockAttributeId(3) };
+                for (size_t i = 0; i < kStormPathCount; i++)
+                {
+                    mAttributePaths[i] = AttributePathParams(kLoadEndpoints[i % MATTER_ARRAY_SIZE(kLoadEndpoints)], kLoadClusterId,
+                                                             kStormAttributeIds[i % MATTER_ARRAY_SIZE(kStormAttributeIds)]);
+                }
+                pathCount = kStormPathCount;
+            }
+            else
+            {
+                mAttributePaths[0] =
+                    subscribe ? AttributePathParams() : AttributePathParams(mEndpoint, kLoadClusterId, kReadAttributeId);
+            }
+
+            ReadPrepareParams params(mContext->GetSessionBobToAlice());
+            params.mpAttributePathParamsList    = mAttributePaths;
+            params.mAttributePathParamsListSize = pathCount;
+            params.mMinIntervalFloorSeconds     = 0;
+            params.mMaxIntervalCeilingSeconds   = 60;
+            params.mKeepSubscriptions           = true;
+            return mReadClient->SendRequest(params);
+        }
+        case Operation::kWrite: {
+            mWriteClient = Platform::MakeUnique<WriteClient>(&exchangeManager, this, NullOptional);
+            VerifyOrReturnError(mWriteClient, CHIP_ERROR_NO_MEMORY);
+            const AttributePathParams path(mEndpoint, kLoadClusterId, kWritableAttributeId);
+            ReturnErrorOnFailure(mWriteClient->EncodeAttribute(path, (sequence & 1) != 0));
+            return mWriteClient->SendWriteRequest(mContext->GetSessionBobToAlice());
+        }
+        case Operation::kInvoke:
+        case Operation::kGroupInvoke: {
+            const bool group = (mOperation == Operation::kGroupInvoke);
+            mCommandSender   = Platform::MakeUnique<CommandSender>(this, &exchangeManager);
+            VerifyOrReturnError(mCommandSender, CHIP_ERROR_NO_MEMORY);
+
+            CommandPathParams path = group
+                ? CommandPathParams(mContext->GetFriendsGroupId(), kLoadClusterId, kLoadCommandId, CommandPathFlags::kGroupIdValid)
+                : CommandPathParams(mEndpoint, kLoadClusterId, kLoadCommandId, CommandPathFlags::kEndpointIdValid);
+            CommandSender::AddRequestDataParameters addRequestDataParams;
+            ReturnErrorOnFailure(mCommandSender->AddRequestData(path, EmptyCommandPayload(), addRequestDataParams));
+
+            // Group invokes get no response, they are done once sent
+            return group ? mCommandSender->SendGroupCommandRequest(mContext->GetSessionBobToFriends())
+                         : mCommandSender->SendCommandRequest(mContext->GetSessionBobToAlice());
+        }
+        default:
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    void Complete()
+    {
+        VerifyOrReturn(!mDone);
+        mDone  = true;
+        mEndUs = NowMicroseconds();
+    }
+
+    void Release()
+    {
+        mReadClient.reset();
+        mWriteClient.reset();
+        mCommandSender.reset();
+        mBusy = false;
+    }
+
+    // ReadClient::Callback
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        mFailed = mFailed || (mOperation == Operation::kRead && !aStatus.IsSuccess());
+    }
+    void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override { Complete(); }
+    void OnError(CHIP_ERROR aError) override { mFailed = true; }
+    void OnDone(ReadClient * apReadClient) override { Complete(); }
+
+    // WriteClient::Callback
+    void OnResponse(const WriteClient * apWriteClient, const ConcreteDataAttributePath & aPath, StatusIB attributeStatus) override
+    {
+        mFailed = mFailed || !attributeStatus.IsSuccess();
+    }
+    void OnError(const WriteClient * apWriteClient, CHIP_ERROR aError) override { mFailed = true; }
+    void OnDone(WriteClient * apWriteClient) override { Complete(); }
+
+    // CommandSender::ExtendableCallback
+    void OnResponse(CommandSender * apCommandSender, const CommandSender::ResponseData & aResponseData) override
+    {
+        mFailed = mFailed || !aResponseData.statusIB.IsSuccess();
+    }
+    void OnError(const CommandSender * apCommandSender, const CommandSender::ErrorData & aErrorData) override { mFailed = true; }
+    void OnDone(CommandSender * apCommandSender) override { Complete(); }
+
+    Test::AppContext * mContext = nullptr;
+    EndpointId mEndpoint        = kInvalidEndpointId;
+    Operation mOperation        = Operation::kRead;
+    bool mBusy                  = false;
+    bool mDone                  = false;
+    bool mFailed                = false;
+    uint64_t mStartUs           = 0;
+    uint64_t mEndUs             = 0;
+    AttributePathParams mAttributePaths[kStormPathCount];
+    Platform::UniquePtr<ReadClient> mReadClient;
+    Platform::UniquePtr<WriteClient> mWriteClient;
+    Platform::UniquePtr<CommandSender> mCommandSender;
+};
+
+class TestIMLoadGenerator : public chip::Test::AppContext
+{
+public:
+    void SetUp() override
+    {
+        AppContext::SetUp();
+
+        mStorage.ClearStorage();
+        mGroupsProvider.SetStorageDelegate(&mStorage);
+        mGroupsProvider.SetSessionKeystore(&mSessionKeystore);
+        ASSERT_EQ(mGroupsProvider.Init(), CHIP_NO_ERROR);
+        Credentials::SetGroupDataProvider(&mGroupsProvider);
+
+        uint8_t buf[sizeof(CompressedFabricId)];
+        MutableByteSpan span(buf);
+        ASSERT_EQ(GetBobFabric()->GetCompressedFabricIdBytes(span), CHIP_NO_ERROR);
+        ASSERT_EQ(GroupTesting::InitData(&mGroupsProvider, GetBobFabricIndex(), span), CHIP_NO_ERROR);
+
+        mOldProvider = InteractionModelEngine::GetInstance()->SetDataModelProvider(&gLoadDataModel);
+        chip::Test::SetMockNodeConfig(LoadMockNodeConfig());
+    }
+
+    void TearDown() override
+    {
+        chip::Test::ResetMockNodeConfig();
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(mOldProvider);
+        mGroupsProvider.Finish();
+        Credentials::SetGroupDataProvider(nullptr);
+        AppContext::TearDown();
+    }
+
+protected:
+    void RunScenario(const char * name, const OperationMix & mix);
+
+private:
+    static void ReportScenario(const char * name, uint32_t controllers, uint64_t durationUs, ScenarioResult & result);
+
+    TestPersistentStorageDelegate mStorage;
+    Crypto::DefaultSessionKeystore mSessionKeystore;
+    Credentials::GroupDataProviderImpl mGroupsProvider{ kMaxGroupsPerFabric, kMaxGroupKeysPerFabric };
+    DataModel::Provider * mOldProvider = nullptr;
+};
+
+void TestIMLoadGenerator::RunScenario(const char * name, const OperationMix & mix)
+{
+    const uint32_t operations  = GetConfigValue("CHIP_IM_BENCHMARK_OPERATIONS", kDefaultOperations);
+    const uint32_t controllers = GetConfigValue("CHIP_IM_BENCHMARK_CONTROLLERS", kDefaultControllers);
+
+    std::vector<Controller> pool(controllers);
+    for (uint32_t i = 0; i < controllers; i++)
+    {
+        pool[i].Init(*this, i);
+    }
+
+    ScenarioResult result;
+    result.latenciesUs.reserve(operations);
+
+    auto * engine                = InteractionModelEngine::GetInstance();
+    const size_t heapBase        = HeapInUse();
+    const size_t allocationsBase = AllocationCount();
+    const uint64_t start         = NowMicroseconds();
+    uint32_t started             = 0;
+    bool busy                    = false;
+
+    do
+    {
+        bool subscribing = false;
+        for (auto & controller : pool)
+        {
+            if (controller.IsDone())
+            {
+                controller.Finish(result);
+            }
+            subscribing = subscribing || controller.IsSubscribing();
+        }
+
+        // Releasing a ReadClient leaves its subscription on the server: tear the established ones
+        // down in batches, while no subscription is being set up.
+        if (!subscribing)
+        {
+            engine->ShutdownAllSubscriptionHandlers();
+        }
+
+        busy = false;
+        for (auto & controller : pool)
+        {
+            if (!controller.IsBusy() && started < operations)
+            {
+                uint32_t sequence = started++;
+                if (controller.Start(mix.OperationAt(sequence), sequence) != CHIP_NO_ERROR)
+                {
+                    result.Record(NowMicroseconds(), NowMicroseconds(), false);
+                }
+            }
+            busy = busy || controller.IsBusy();
+        }
+
+        // Everything that was started is in flight now
+        result.peakExchanges    = std::max(result.peakExchanges, GetExchangeManager().GetNumActiveExchanges());
+        result.peakReadHandlers = std::max<size_t>(result.peakReadHandlers, engine->GetNumActiveReadHandlers());
+        result.peakHeapBytes    = std::max(result.peakHeapBytes, HeapInUse() - std::min(heapBase, HeapInUse()));
+
+        DrainAndServiceIO();
+
+        ASSERT_LT(NowMicroseconds() - start, static_cast<uint64_t>(System::Clock::Microseconds64(kScenarioTimeout).count()))
+            << "Scenario " << name << " timed out";
+    } while (busy || started < operations);
+
+    engine->ShutdownAllSubscriptionHandlers();
+    DrainAndServiceIO();
+    result.allocations = AllocationCount() - allocationsBase;
+
+    ReportScenario(name, controllers, NowMicroseconds() - start, result);
+
+    EXPECT_EQ(result.completed, operations);
+    EXPECT_EQ(result.errors, 0u);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+    EXPECT_EQ(engine->GetNumActiveReadHandlers(), 0u);
+}
+
+void TestIMLoadGenerator::ReportScenario(const char * name, uint32_t controllers, uint64_t durationUs, ScenarioResult & result)
+{
+    std::sort(result.latenciesUs.begin(), result.latenciesUs.end());
+
+    auto percentile = [&result](uint32_t percent) -> uint32_t {
+        VerifyOrReturnValue(!result.latenciesUs.empty(), 0);
+        size_t index = (result.latenciesUs.size() * percent + 99) / 100;
+        return result.latenciesUs[std::max<size_t>(index, 1) - 1];
+    };
+
+    char peakHeap[24] = "n/a";
+    if (kHasHeapInUse)
+    {
+        snprintf(peakHeap, sizeof(peakHeap), "%u", static_cast<unsigned>(result.peakHeapBytes));
+    }
+
+    char allocations[24] = "n/a";
+    if (CHIP_CONFIG_MEMORY_ACCOUNTING)
+    {
+        snprintf(allocations, sizeof(allocations), "%u", static_cast<unsigned>(result.allocations));
+    }
+
+    // Stable format parsed by CI, only add fields at the end of the line
+    printf("IM_BENCHMARK scenario=%s controllers=%u operations=%u errors=%u duration_us=%" PRIu64
+           " ops_per_sec=%.1f p50_us=%u p99_us=%u max_us=%u peak_exchanges=%u peak_read_handlers=%u peak_heap_bytes=%s"
+           " allocations=%s\n",
+           name, controllers, result.completed, result.errors, durationUs,
+           (durationUs > 0) ? static_cast<double>(result.completed) * 1e6 / static_cast<double>(durationUs) : 0.0, percentile(50),
+           percentile(99), result.latenciesUs.empty() ? 0 : result.latenciesUs.back(), static_cast<unsigned>(result.peakExchanges),
+           static_cast<unsigned>(result.peakReadHandlers), peakHeap, allocations);
+}
+
+TEST_F(TestIMLoadGenerator, Read)
+{
+    RunScenario("read", OperationMix{ { 1, 0, 0, 0, 0 } });
+}
+
+TEST_F(TestIMLoadGenerator, WildcardSubscribe)
+{
+    RunScenario("subscribe", OperationMix{ { 0, 1, 0, 0, 0 } });
+}
+
+TEST_F(TestIMLoadGenerator, Write)
+{
+    RunScenario("write", OperationMix{ { 0, 0, 1, 0, 0 } });
+}
+
+TEST_F(TestIMLoadGenerator, Invoke)
+{
+    RunScenario("invoke", OperationMix{ { 0, 0, 0, 1, 0 } });
+}
+
+TEST_F(TestIMLoadGenerator, GroupInvoke)
+{
+    RunScenario("group_invoke", OperationMix{ { 0, 0, 0, 0, 1 } });
+}
+
+// All the controllers subscribe to 50 concrete paths at once
+TEST_F(TestIMLoadGenerator, SubscriptionStorm)
+{
+    RunScenario("subscription_storm", OperationMix{ { 0, 0, 0, 0, 0, 1 } });
+}
+
+TEST_F(TestIMLoadGenerator, Mixed)
+{
+    RunScenario("mixed", OperationMix{ { 6, 1, 2, 2, 1 } });
+}
+
+// Runs the mix given in CHIP_IM_BENCHMARK_MIX, e.g. "read=4,subscribe=1,write=1"
+TEST_F(TestIMLoadGenerator, Custom)
+{
+    const char * text = getenv("CHIP_IM_BENCHMARK_MIX");
+    if (text == nullptr)
+    {
+        GTEST_SKIP();
+    }
+
+    OperationMix mix;
+    ASSERT_TRUE(ParseOperationMix(text, mix)) << "Invalid CHIP_IM_BENCHMARK_MIX: " << text;
+    RunScenario("custom", mix);
+}
+
+} // namespace
@@ -0,0 +1,307 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      List write benchmark.
+ *
+ *      Times the decoding of 100-entry GroupKeyMap and ACL list writes, with
+ *      one iterator walk per pass as the write handlers used to do, and with
+ *      the single decode pass they do now. Also times a whole GroupKeyMap
+ *      write through the Group Key Management cluster. Prints one
+ *      LIST_WRITE_BENCHMARK line per case. See README.md for the output format.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <access/AccessControl.h>
+#include <access/examples/ExampleAccessControlDelegate.h>
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/AttributeAccessInterfaceRegistry.h>
+#include <app/AttributeValueDecoder.h>
+#include <app/server/AclStorage.h>
+#include <credentials/GroupDataProviderImpl.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+
+#include <algorithm>
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+// Defined by the cluster, declared by the application's generated PluginApplicationCallbacks.h
+void MatterGroupKeyManagementPluginServerInitCallback();
+void MatterGroupKeyManagementPluginServerShutdownCallback();
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+
+using GroupKeyMapEntry = GroupKeyManagement::Structs::GroupKeyMapStruct::Type;
+using AclEntry         = AccessControl::Structs::AccessControlEntryStruct::Type;
+
+constexpr size_t kListEntries         = 100;
+constexpr uint32_t kDefaultIterations = 1000;
+constexpr FabricIndex kFabricIndex    = 1;
+constexpr size_t kBufferSize          = 8192;
+
+// Writes go to storage, which is much slower than decoding
+constexpr uint32_t kWriteIterationsDivider = 10;
+
+uint32_t GetIterations()
+{
+    const char * value = getenv("CHIP_LIST_WRITE_BENCHMARK_ITERATIONS");
+    VerifyOrReturnValue(value != nullptr && *value != '\0', kDefaultIterations);
+    unsigned long parsed = strtoul(value, nullptr, 10);
+    return (parsed > 0 && parsed <= UINT32_MAX) ? static_cast<uint32_t>(parsed) : kDefaultIterations;
+}
+
+// Keeps the results alive so that the loops are not optimized out.
+volatile uint32_t gSink;
+
+template <typename Operation>
+double MicrosecondsPerOperation(uint32_t iterations, Operation && operation)
+{
+    uint32_t sink    = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        sink += operation();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    gSink          = sink;
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / 1000.0 / iterations;
+}
+
+void Report(const char * name, uint32_t iterations, double us)
+{
+    printf("LIST_WRITE_BENCHMARK case=%s entries=%u iterations=%" PRIu32 " us=%.2f\n", name, static_cast<unsigned>(kListEntries),
+           iterations, us);
+}
+
+class DeviceTypeResolver : public Access::AccessControl::DeviceTypeResolver
+{
+public:
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+} gDeviceTypeResolver;
+
+class ListWriteBenchmark : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+protected:
+    // Encodes the list the way a write request carries it
+    template <typename T>
+    void EncodeList(const std::vector<T> & entries)
+    {
+        TLV::TLVWriter writer;
+        writer.Init(mBuffer);
+        ASSERT_EQ(DataModel::EncodeForWrite(writer, TLV::AnonymousTag(), DataModel::List<const T>(entries.data(), entries.size())),
+                  CHIP_NO_ERROR);
+        ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+        mLength = writer.GetLengthWritten();
+    }
+
+    // Decodes the encoded list as a write handler receives it
+    template <typename List>
+    CHIP_ERROR DecodeList(List & list)
+    {
+        mReader.Init(mBuffer, mLength);
+        ReturnErrorOnFailure(mReader.Next());
+        AttributeValueDecoder decoder(mReader, mSubjectDescriptor);
+        return decoder.Decode(list);
+    }
+
+    CHIP_ERROR WriteAttribute(ClusterId clusterId, AttributeId attributeId)
+    {
+        mReader.Init(mBuffer, mLength);
+        ReturnErrorOnFailure(mReader.Next());
+        AttributeValueDecoder decoder(mReader, mSubjectDescriptor);
+
+        AttributeAccessInterface * attrAccess = AttributeAccessInterfaceRegistry::Instance().Get(kRootEndpointId, clusterId);
+        VerifyOrReturnError(attrAccess != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        return attrAccess->Write(ConcreteDataAttributePath(kRootEndpointId, clusterId, attributeId), decoder);
+    }
+
+    static std::vector<GroupKeyMapEntry> MakeGroupKeyMap()
+    {
+        std::vector<GroupKeyMapEntry> entries(kListEntries);
+        for (size_t i = 0; i < kListEntries; i++)
+        {
+            entries[i].groupId       = static_cast<GroupId>(0x0101 + i);
+            entries[i].groupKeySetID = 1;
+            entries[i].fabricIndex   = kFabricIndex;
+        }
+        return entries;
+    }
+
+    uint8_t mBuffer[kBufferSize];
+    uint32_t mLength = 0;
+    TLV::TLVReader mReader;
+    Access::SubjectDescriptor mSubjectDescriptor = { .fabricIndex = kFabricIndex, .authMode = Access::AuthMode::kCase };
+};
+
+TEST_F(ListWriteBenchmark, GroupKeyMapDecode)
+{
+    EncodeList(MakeGroupKeyMap());
+    const uint32_t iterations = GetIterations();
+
+    // Validate, size, then apply, each walking the TLV again
+    const double multiPassUs = MicrosecondsPerOperation(iterations, [&]() -> uint32_t {
+        GroupKeyManagement::Attributes::GroupKeyMap::TypeInfo::DecodableType list;
+        VerifyOrDie(DecodeList(list) == CHIP_NO_ERROR);
+
+        uint32_t sum  = 0;
+        auto validate = list.begin();
+        while (validate.Next())
+        {
+            sum += validate.GetValue().groupKeySetID;
+        }
+        size_t size = 0;
+        VerifyOrDie(list.ComputeSize(&size) == CHIP_NO_ERROR);
+        auto apply = list.begin();
+        while (apply.Next())
+        {
+            sum += apply.GetValue().groupId;
+        }
+        return sum + static_cast<uint32_t>(size);
+    });
+    Report("group_key_map_multi_pass", iterations, multiPassUs);
+
+    // Decode once, then go over the decoded entries
+    GroupKeyManagement::Structs::GroupKeyMapStruct::DecodableType entries[kListEntries];
+    const double decodeAllUs = MicrosecondsPerOperation(iterations, [&]() -> uint32_t {
+        GroupKeyManagement::Attributes::GroupKeyMap::TypeInfo::DecodableType list;
+        VerifyOrDie(DecodeList(list) == CHIP_NO_ERROR);
+
+        Span<GroupKeyManagement::Structs::GroupKeyMapStruct::DecodableType> values(entries);
+        VerifyOrDie(list.DecodeAll(values) == CHIP_NO_ERROR);
+
+        uint32_t sum = 0;
+        for (const auto & value : values)
+        {
+            sum += value.groupKeySetID;
+        }
+        for (const auto & value : values)
+        {
+            sum += value.groupId;
+        }
+        return sum + static_cast<uint32_t>(values.size());
+    });
+    Report("group_key_map_decode_all", iterations, decodeAllUs);
+}
+
+TEST_F(ListWriteBenchmark, GroupKeyMapWrite)
+{
+    TestPersistentStorageDelegate storage;
+    Crypto::DefaultSessionKeystore sessionKeystore;
+    Credentials::GroupDataProviderImpl provider(kListEntries, 3);
+    provider.SetStorageDelegate(&storage);
+    provider.SetSessionKeystore(&sessionKeystore);
+    ASSERT_EQ(provider.Init(), CHIP_NO_ERROR);
+    Credentials::SetGroupDataProvider(&provider);
+    MatterGroupKeyManagementPluginServerInitCallback();
+
+    EncodeList(MakeGroupKeyMap());
+    const uint32_t iterations = std::max<uint32_t>(GetIterations() / kWriteIterationsDivider, 1);
+
+    const double us = MicrosecondsPerOperation(iterations, [&]() -> uint32_t {
+        VerifyOrDie(WriteAttribute(GroupKeyManagement::Id, GroupKeyManagement::Attributes::GroupKeyMap::Id) == CHIP_NO_ERROR);
+        return 1;
+    });
+    Report("group_key_map_write", iterations, us);
+
+    MatterGroupKeyManagementPluginServerShutdownCallback();
+    Credentials::SetGroupDataProvider(nullptr);
+    provider.Finish();
+}
+
+// The ACL entries cannot be decoded ahead: each one holds an entry delegate from the access control pool
+TEST_F(ListWriteBenchmark, AclDecode)
+{
+    ASSERT_EQ(Access::GetAccessControl().Init(Access::Examples::GetAccessControlDelegate(), gDeviceTypeResolver), CHIP_NO_ERROR);
+
+    uint64_t subjects[kListEntries];
+    std::vector<AclEntry> entries(kListEntries);
+    for (size_t i = 0; i < kListEntries; i++)
+    {
+        subjects[i]            = 0x1000 + i;
+        entries[i].privilege   = AccessControl::AccessControlEntryPrivilegeEnum::kOperate;
+        entries[i].authMode    = AccessControl::AccessControlEntryAuthModeEnum::kCase;
+        entries[i].fabricIndex = kFabricIndex;
+        entries[i].subjects.SetNonNull(DataModel::List<const uint64_t>(&subjects[i], 1));
+    }
+    EncodeList(entries);
+    const uint32_t iterations = GetIterations();
+
+    // Size, validate, then apply, each walking the TLV again
+    const double multiPassUs = MicrosecondsPerOperation(iterations, [&]() -> uint32_t {
+        DataModel::DecodableList<AclStorage::DecodableEntry> list;
+        VerifyOrDie(DecodeList(list) == CHIP_NO_ERROR);
+
+        size_t size = 0;
+        VerifyOrDie(list.ComputeSize(&size) == CHIP_NO_ERROR);
+        uint32_t valid = 0;
+        auto validate  = list.begin();
+        while (validate.Next())
+        {
+            valid += validate.GetValue().GetEntry().IsValid() ? 1 : 0;
+        }
+        auto apply = list.begin();
+        while (apply.Next())
+        {
+            valid += apply.GetValue().GetEntry().IsValid() ? 1 : 0;
+        }
+        return valid + static_cast<uint32_t>(size);
+    });
+    Report("acl_multi_pass", iterations, multiPassUs);
+
+    // Count and validate in one pass, then apply
+    const double twoPassUs = MicrosecondsPerOperation(iterations, [&]() -> uint32_t {
+        DataModel::DecodableList<AclStorage::DecodableEntry> list;
+        VerifyOrDie(DecodeList(list) == CHIP_NO_ERROR);
+
+        uint32_t count = 0;
+        uint32_t valid = 0;
+        auto validate  = list.begin();
+        while (validate.Next())
+        {
+            valid += validate.GetValue().GetEntry().IsValid() ? 1 : 0;
+            count++;
+        }
+        auto apply = list.begin();
+        while (apply.Next())
+        {
+            valid += apply.GetValue().GetEntry().IsValid() ? 1 : 0;
+        }
+        return valid + count;
+    });
+    Report("acl_two_pass", iterations, twoPassUs);
+
+    Access::GetAccessControl().Finish();
+}
+
+} // namespace
@@ -0,0 +1,330 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Server cold-start benchmark.
+ *
+ *      Starts the Server, then establishes a CASE session to it from an
+ *      initiator running in the same process, over UDP on the loopback
+ *      interface. Prints one SERVER_STARTUP_BENCHMARK line with the Init()
+ *      duration, the time until the first CASE session is established and
+ *      the duration of each Init() phase. See README.md for the output format.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/TestEventTriggerDelegate.h>
+#include <app/TimerDelegates.h>
+#include <app/reporting/ReportSchedulerImpl.h>
+#include <app/server/Dnssd.h>
+#include <app/server/Server.h>
+#include <credentials/GroupDataProviderImpl.h>
+#include <credentials/PersistentStorageOpCertStore.h>
+#include <credentials/tests/CHIPCert_test_vectors.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <data-model-providers/codegen/CodegenDataModelProvider.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/dnssd/Advertiser.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <platform/CommissionableDataProvider.h>
+#include <platform/TestOnlyCommissionableDataProvider.h>
+#include <protocols/secure_channel/CASESession.h>
+#include <system/SystemClock.h>
+
+#include <algorithm>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::TestCerts;
+
+using InitPhase = Server::InitPhase;
+
+constexpr uint32_t kDefaultRuns = 20;
+
+constexpr NodeId kServerNodeId = 0xDEDEDEDE00010001;
+
+// A session that is not established in this time is reported as failed
+constexpr System::Clock::Seconds16 kCaseTimeout = System::Clock::Seconds16(10);
+
+// Shared by both fabrics, CASE only needs it to match
+const uint8_t kIpkEpochKey[Crypto::CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES] = { 0x4a, 0x71, 0xcd, 0xd7, 0xb2, 0xa3, 0xca, 0x90,
+                                                                               0x24, 0xf9, 0x6f, 0x3c, 0x96, 0xa1, 0x9d, 0xee };
+
+// Same order as Server::InitPhase
+const char * const kInitPhaseNames[] = { "storage", "fabrics", "access_control", "transports", "sessions", "event_logging",
+                                         "data_model", "dnssd", "case", "interaction_model", "icd", "completion" };
+static_assert(MATTER_ARRAY_SIZE(kInitPhaseNames) == to_underlying(InitPhase::kCount), "Missing init phase name");
+
+uint32_t GetRuns()
+{
+    const char * value = getenv("CHIP_SERVER_STARTUP_BENCHMARK_RUNS");
+    VerifyOrReturnValue(value != nullptr && *value != '\0', kDefaultRuns);
+    unsigned long parsed = strtoul(value, nullptr, 10);
+    return (parsed > 0 && parsed <= UINT32_MAX) ? static_cast<uint32_t>(parsed) : kDefaultRuns;
+}
+
+uint64_t NowMicroseconds()
+{
+    return System::SystemClock().GetMonotonicMicroseconds64().count();
+}
+
+CHIP_ERROR SerializeOpKey(const ByteSpan & publicKey, const ByteSpan & privateKey, Crypto::P256SerializedKeypair & serialized)
+{
+    VerifyOrReturnError(publicKey.size() + privateKey.size() <= serialized.Capacity(), CHIP_ERROR_BUFFER_TOO_SMALL);
+    memcpy(serialized.Bytes(), publicKey.data(), publicKey.size());
+    memcpy(serialized.Bytes() + publicKey.size(), privateKey.data(), privateKey.size());
+    return serialized.SetLength(publicKey.size() + privateKey.size());
+}
+
+CHIP_ERROR SetIpk(Credentials::GroupDataProvider * groups, const FabricTable & fabrics, FabricIndex fabricIndex)
+{
+    const FabricInfo * fabricInfo = fabrics.FindFabricWithIndex(fabricIndex);
+    VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INTERNAL);
+
+    uint8_t compressedId[sizeof(uint64_t)];
+    MutableByteSpan compressedIdSpan(compressedId);
+    ReturnErrorOnFailure(fabricInfo->GetCompressedFabricIdBytes(compressedIdSpan));
+    return Credentials::SetSingleIpkEpochKey(groups, fabricIndex, ByteSpan(kIpkEpochKey), compressedIdSpan);
+}
+
+void ShutdownServerTask(intptr_t context)
+{
+    Server::GetInstance().Shutdown();
+    DeviceLayer::PlatformMgr().StopEventLoopTask();
+}
+
+// The controller side: Node01_02 on the same root as the server, with its own fabric table and keys
+class Initiator
+{
+public:
+    CHIP_ERROR Init()
+    {
+        ReturnErrorOnFailure(mOpCertStore.Init(&mStorage));
+
+        FabricTable::InitParams initParams;
+        initParams.storage     = &mStorage;
+        initParams.opCertStore = &mOpCertStore;
+        ReturnErrorOnFailure(mFabrics.Init(initParams));
+
+        mGroups.SetStorageDelegate(&mStorage);
+        mGroups.SetSessionKeystore(&mSessionKeystore);
+        ReturnErrorOnFailure(mGroups.Init());
+
+        // sTestCert_Node01_02_Chip is issued by sTestCert_Root01_Chip directly without an ICAC
+        Crypto::P256SerializedKeypair opKey;
+        ReturnErrorOnFailure(SerializeOpKey(sTestCert_Node01_02_PublicKey, sTestCert_Node01_02_PrivateKey, opKey));
+        ReturnErrorOnFailure(mFabrics.AddNewFabricForTest(ByteSpan(sTestCert_Root01_Chip), ByteSpan(),
+                                                          ByteSpan(sTestCert_Node01_02_Chip),
+                                                          ByteSpan(opKey.ConstBytes(), opKey.Length()), &mFabricIndex));
+        return SetIpk(&mGroups, mFabrics, mFabricIndex);
+    }
+
+    void Shutdown()
+    {
+        mFabrics.DeleteAllFabrics();
+        mFabrics.Shutdown();
+        mGroups.Finish();
+        mOpCertStore.Finish();
+    }
+
+    FabricTable & GetFabrics() { return mFabrics; }
+    Credentials::GroupDataProvider & GetGroups() { return mGroups; }
+    FabricIndex GetFabricIndex() const { return mFabricIndex; }
+
+private:
+    TestPersistentStorageDelegate mStorage;
+    Credentials::PersistentStorageOpCertStore mOpCertStore;
+    Crypto::DefaultSessionKeystore mSessionKeystore;
+    Credentials::GroupDataProviderImpl mGroups;
+    FabricTable mFabrics;
+    FabricIndex mFabricIndex = kUndefinedFabricIndex;
+};
+
+// One CASE establishment to the server, stopping the event loop once it is done
+class CaseAttempt : public SessionEstablishmentDelegate
+{
+public:
+    CHIP_ERROR Start(Initiator & initiator)
+    {
+        Server & server = Server::GetInstance();
+
+        const auto peerAddress = Transport::PeerAddress::UDP(Inet::IPAddress::Loopback(Inet::IPAddressType::kIPv6),
+                                                             app::DnssdServer::Instance().GetSecuredPort());
+        auto session           = server.GetSecureSessionManager().CreateUnauthenticatedSession(peerAddress, GetDefaultMRPConfig());
+        VerifyOrReturnError(session.HasValue(), CHIP_ERROR_NO_MEMORY);
+
+        Messaging::ExchangeContext * exchange = server.GetExchangeManager().NewContext(session.Value(), &mSession);
+        VerifyOrReturnError(exchange != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        ReturnErrorOnFailure(DeviceLayer::SystemLayer().StartTimer(kCaseTimeout, HandleTimeout, this));
+
+        mSession.SetGroupDataProvider(&initiator.GetGroups());
+        return mSession.EstablishSession(server.GetSecureSessionManager(), &initiator.GetFabrics(),
+                                         ScopedNodeId(kServerNodeId, initiator.GetFabricIndex()), exchange,
+                                         nullptr /* sessionResumptionStorage */, nullptr /* policy */, this, NullOptional);
+    }
+
+    void OnSessionEstablished(const SessionHandle & session) override { Done(CHIP_NO_ERROR); }
+    void OnSessionEstablishmentError(CHIP_ERROR error) override { Done(error); }
+
+    CHIP_ERROR GetResult() const { return mResult; }
+    uint64_t GetDoneMicroseconds() const { return mDoneMicroseconds; }
+
+private:
+    static void HandleTimeout(System::Layer * layer, void * context)
+    {
+        static_cast<CaseAttempt *>(context)->Done(CHIP_ERROR_TIMEOUT);
+    }
+
+    void Done(CHIP_ERROR result)
+    {
+        mDoneMicroseconds = NowMicroseconds();
+        mResult           = result;
+        DeviceLayer::SystemLayer().CancelTimer(HandleTimeout, this);
+        DeviceLayer::PlatformMgr().StopEventLoopTask();
+    }
+
+    CASESession mSession;
+    CHIP_ERROR mResult         = CHIP_ERROR_INCORRECT_STATE;
+    uint64_t mDoneMicroseconds = 0;
+};
+
+class ServerStartupBenchmark : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        ASSERT_EQ(DeviceLayer::PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+
+        static DeviceLayer::TestOnlyCommissionableDataProvider commissionableDataProvider;
+        DeviceLayer::SetCommissionableDataProvider(&commissionableDataProvider);
+
+        static app::DefaultTimerDelegate sTimerDelegate;
+        static app::reporting::ReportSchedulerImpl sReportScheduler(&sTimerDelegate);
+        sInitParams.reportScheduler = &sReportScheduler;
+        static SimpleTestEventTriggerDelegate sSimpleTestEventTriggerDelegate;
+        sInitParams.testEventTriggerDelegate = &sSimpleTestEventTriggerDelegate;
+        ASSERT_EQ(sInitParams.InitializeStaticResourcesBeforeServerInit(), CHIP_NO_ERROR);
+
+        static app::CodegenDataModelProvider sDataModelProvider;
+        sDataModelProvider.SetPersistentStorageDelegate(sInitParams.persistentStorageDelegate);
+        sInitParams.dataModelProvider = &sDataModelProvider;
+        // Use whatever server port the kernel decides to give us.
+        sInitParams.operationalServicePort = 0;
+
+        ASSERT_EQ(sInitiator.Init(), CHIP_NO_ERROR);
+    }
+
+    static void TearDownTestSuite()
+    {
+        sInitiator.Shutdown();
+        DeviceLayer::PlatformMgr().Shutdown();
+
+        auto & mdnsAdvertiser = Dnssd::ServiceAdvertiser::Instance();
+        mdnsAdvertiser.RemoveServices();
+        mdnsAdvertiser.Shutdown();
+
+        // Platform memory is left initialized, see TestCommissioningWindowManager.
+    }
+
+protected:
+    static CommonCaseDeviceServerInitParams sInitParams;
+    static Initiator sInitiator;
+};
+
+CommonCaseDeviceServerInitParams ServerStartupBenchmark::sInitParams;
+Initiator ServerStartupBenchmark::sInitiator;
+
+// Adds the Node01_01 fabric the initiator connects to. Its operational key is
+// only held in memory, so the fabric is added once Init() has returned and
+// removed before Shutdown().
+CHIP_ERROR AddServerFabric(FabricIndex & fabricIndex)
+{
+    Server & server = Server::GetInstance();
+
+    Crypto::P256SerializedKeypair opKey;
+    ReturnErrorOnFailure(SerializeOpKey(sTestCert_Node01_01_PublicKey, sTestCert_Node01_01_PrivateKey, opKey));
+    ReturnErrorOnFailure(server.GetFabricTable().AddNewFabricForTest(
+        ByteSpan(sTestCert_Root01_Chip), ByteSpan(sTestCert_ICA01_Chip), ByteSpan(sTestCert_Node01_01_Chip),
+        ByteSpan(opKey.ConstBytes(), opKey.Length()), &fabricIndex));
+    return SetIpk(server.GetGroupDataProvider(), server.GetFabricTable(), fabricIndex);
+}
+
+TEST_F(ServerStartupBenchmark, ColdStartToFirstCase)
+{
+    const uint32_t runs = GetRuns();
+
+    uint64_t initTotalUs      = 0;
+    uint64_t firstCaseTotalUs = 0;
+    uint64_t firstCaseMaxUs   = 0;
+
+    uint64_t phaseTotalUs[to_underlying(InitPhase::kCount)] = {};
+
+    for (uint32_t run = 0; run < runs; run++)
+    {
+        Server & server = Server::GetInstance();
+
+        const uint64_t start = NowMicroseconds();
+        ASSERT_EQ(server.Init(sInitParams), CHIP_NO_ERROR);
+        const uint64_t initUs = NowMicroseconds() - start;
+        server.GetCommissioningWindowManager().CloseCommissioningWindow();
+
+        // The fabric setup stands in for the fabric a device would have loaded from storage, so it is not counted
+        const uint64_t setupStart = NowMicroseconds();
+        FabricIndex fabricIndex   = kUndefinedFabricIndex;
+        ASSERT_EQ(AddServerFabric(fabricIndex), CHIP_NO_ERROR);
+        const uint64_t setupUs = NowMicroseconds() - setupStart;
+
+        // The startup work Init() deferred runs from the event loop along with the handshake
+        CaseAttempt attempt;
+        ASSERT_EQ(attempt.Start(sInitiator), CHIP_NO_ERROR);
+        DeviceLayer::PlatformMgr().RunEventLoop();
+        ASSERT_EQ(attempt.GetResult(), CHIP_NO_ERROR);
+
+        const uint64_t firstCaseUs = attempt.GetDoneMicroseconds() - start - setupUs;
+        initTotalUs += initUs;
+        firstCaseTotalUs += firstCaseUs;
+        firstCaseMaxUs = std::max(firstCaseMaxUs, firstCaseUs);
+        for (uint8_t i = 0; i < to_underlying(InitPhase::kCount); i++)
+        {
+            phaseTotalUs[i] += server.GetInitPhaseDuration(static_cast<InitPhase>(i)).count();
+        }
+
+        // Deleting the fabric also removes its IPK from the server's group data
+        ASSERT_EQ(server.GetFabricTable().Delete(fabricIndex), CHIP_NO_ERROR);
+        DeviceLayer::PlatformMgr().ScheduleWork(ShutdownServerTask);
+        DeviceLayer::PlatformMgr().RunEventLoop();
+    }
+
+    printf("SERVER_STARTUP_BENCHMARK runs=%" PRIu32 " init_us=%" PRIu64 " first_case_us=%" PRIu64 " max_first_case_us=%" PRIu64,
+           runs, initTotalUs / runs, firstCaseTotalUs / runs, firstCaseMaxUs);
+    for (uint8_t i = 0; i < to_underlying(InitPhase::kCount); i++)
+    {
+        printf(" %s_us=%" PRIu64, kInitPhaseNames[i], phaseTotalUs[i] / runs);
+    }
+    printf("\n");
+}
+
+} // namespace
@@ -0,0 +1,228 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/util/TransitionScheduler.h>
+
+#include <app/reporting/reporting.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace app {
+
+using namespace System::Clock;
+
+TransitionScheduler & TransitionScheduler::GetInstance()
+{
+    static TransitionScheduler sInstance;
+    return sInstance;
+}
+
+void TransitionScheduler::SetSystemLayer(System::Layer * systemLayer)
+{
+    Shutdown();
+    mSystemLayer = systemLayer;
+}
+
+System::Layer & TransitionScheduler::GetSystemLayer()
+{
+    return (mSystemLayer != nullptr) ? *mSystemLayer : DeviceLayer::SystemLayer();
+}
+
+CHIP_ERROR TransitionScheduler::Schedule(Milliseconds32 delay, System::TimerCompleteCallback callback, void * context)
+{
+    const Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+
+    Step * step = FindStep(callback, context);
+    if (step == nullptr)
+    {
+        step = (mSteps.Allocated() < mMaxSteps) ? mSteps.CreateObject(callback, context) : nullptr;
+        if (step == nullptr)
+        {
+            return StartFallbackTimer(delay, callback, context);
+        }
+        CancelFallbackTimer(callback, context);
+    }
+
+    step->dueTime = GetDueTime(delay, now);
+    step->pass    = mInPass ? mPass : 0;
+
+    // The timer is restarted once the pass is over
+    VerifyOrReturnError(!mInPass, CHIP_NO_ERROR);
+    VerifyOrReturnError(!mTimerArmed || step->dueTime < mTimerDueTime, CHIP_NO_ERROR);
+
+    CHIP_ERROR err = StartTimer(step->dueTime, now);
+    if (err != CHIP_NO_ERROR)
+    {
+        mSteps.ReleaseObject(step);
+    }
+    return err;
+}
+
+void TransitionScheduler::Cancel(System::TimerCompleteCallback callback, void * context)
+{
+    CancelFallbackTimer(callback, context);
+
+    Step * step = FindStep(callback, context);
+    VerifyOrReturn(step != nullptr);
+    mSteps.ReleaseObject(step);
+
+    // The timer is left running unless nothing else is scheduled, an early expiry only finds nothing to run
+    if (!mInPass && mTimerArmed && !mSteps.Allocated())
+    {
+        GetSystemLayer().CancelTimer(OnTimer, this);
+        mTimerArmed = false;
+    }
+}
+
+bool TransitionScheduler::IsScheduled(System::TimerCompleteCallback callback, void * context)
+{
+    return FindStep(callback, context) != nullptr || (mFallbackUsed && GetSystemLayer().IsTimerActive(callback, context));
+}
+
+void TransitionScheduler::Shutdown()
+{
+    if (mTimerArmed)
+    {
+        GetSystemLayer().CancelTimer(OnTimer, this);
+        mTimerArmed = false;
+    }
+    mSteps.ReleaseAll();
+}
+
+void TransitionScheduler::LogStatistics() const
+{
+    ChipLogProgress(Zcl,
+                    "Transition scheduler: %" PRIu32 " ticks, %" PRIu32 " steps, peak %" PRIu32 " steps per tick, longest tick %" PRIu32
+                    "us, %" PRIu32 " fallback timers",
+                    mStatistics.ticks, mStatistics.steps, mStatistics.peakStepsPerTick, mStatistics.maxTickDuration.count(),
+                    mStatistics.fallbackTimers);
+}
+
+void TransitionScheduler::OnTimer(System::Layer * systemLayer, void * context)
+{
+    auto * scheduler       = static_cast<TransitionScheduler *>(context);
+    scheduler->mTimerArmed = false;
+    scheduler->RunDueSteps();
+}
+
+TransitionScheduler::Step * TransitionScheduler::FindStep(System::TimerCompleteCallback callback, void * context)
+{
+    Step * found = nullptr;
+    mSteps.ForEachActiveObject([&](Step * step) {
+        if (step->callback == callback && step->context == context)
+        {
+            found = step;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+    return found;
+}
+
+CHIP_ERROR TransitionScheduler::StartFallbackTimer(Milliseconds32 delay, System::TimerCompleteCallback callback, void * context)
+{
+    ReturnErrorOnFailure(GetSystemLayer().StartTimer(delay, callback, context));
+    mFallbackUsed = true;
+    mStatistics.fallbackTimers++;
+    return CHIP_NO_ERROR;
+}
+
+void TransitionScheduler::CancelFallbackTimer(System::TimerCompleteCallback callback, void * context)
+{
+    VerifyOrReturn(mFallbackUsed);
+    GetSystemLayer().CancelTimer(callback, context);
+}
+
+Timestamp TransitionScheduler::GetDueTime(Milliseconds32 delay, Timestamp now) const
+{
+    VerifyOrReturnValue(delay.count() > 0 && mTickDuration.count() > 0, now + delay);
+
+    // Round up to the next tick boundary, so that steps scheduled around the same time run together
+    const uint64_t tick = mTickDuration.count();
+    const uint64_t due  = std::chrono::duration_cast<Milliseconds64>(now + delay).count();
+    return Milliseconds64((due + tick - 1) / tick * tick);
+}
+
+void TransitionScheduler::RunDueSteps()
+{
+    const Timestamp now        = System::SystemClock().GetMonotonicTimestamp();
+    const uint64_t passStartUs = System::SystemClock().GetMonotonicMicroseconds64().count();
+    uint32_t stepCount         = 0;
+
+    mInPass = true;
+    if (++mPass == 0)
+    {
+        mPass = 1;
+    }
+
+    {
+        reporting::ScopedAttributeChangeBatch batch;
+        mSteps.ForEachActiveObject([&](Step * step) {
+            VerifyOrReturnValue(step->pass != mPass && step->dueTime <= now, Loop::Continue);
+
+            // Released before the call, so that the callback can schedule the next step
+            System::TimerCompleteCallback callback = step->callback;
+            void * context                         = step->context;
+            mSteps.ReleaseObject(step);
+
+            callback(&GetSystemLayer(), context);
+            stepCount++;
+            return Loop::Continue;
+        });
+    }
+
+    mInPass = false;
+
+    const uint64_t passDurationUs = System::SystemClock().GetMonotonicMicroseconds64().count() - passStartUs;
+    mStatistics.ticks++;
+    mStatistics.steps += stepCount;
+    mStatistics.peakStepsPerTick = std::max(mStatistics.peakStepsPerTick, stepCount);
+    mStatistics.maxTickDuration =
+        std::max(mStatistics.maxTickDuration, Microseconds32(static_cast<uint32_t>(std::min<uint64_t>(passDurationUs, UINT32_MAX))));
+
+    // Restart the timer for the earliest remaining step
+    Timestamp nextDueTime = Timestamp::max();
+    mSteps.ForEachActiveObject([&](Step * step) {
+        nextDueTime = std::min(nextDueTime, step->dueTime);
+        return Loop::Continue;
+    });
+    VerifyOrReturn(nextDueTime != Timestamp::max());
+
+    const Timestamp after = System::SystemClock().GetMonotonicTimestamp();
+    CHIP_ERROR err        = StartTimer(nextDueTime, after);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Zcl, "Transition scheduler failed to start its timer: %" CHIP_ERROR_FORMAT, err.Format());
+        mSteps.ReleaseAll();
+    }
+}
+
+CHIP_ERROR TransitionScheduler::StartTimer(Timestamp dueTime, Timestamp now)
+{
+    const Timeout delay = (dueTime > now) ? std::chrono::duration_cast<Timeout>(dueTime - now) : Timeout(0);
+    ReturnErrorOnFailure(GetSystemLayer().StartTimer(delay, OnTimer, this));
+    mTimerArmed   = true;
+    mTimerDueTime = dueTime;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,140 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/Pool.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+
+/**
+ * Runs the steps of the transitions of every endpoint from a single timer.
+ *
+ * Clusters that move attributes over time, such as Level Control and Color Control, schedule their next step here instead of
+ * starting a timer per endpoint. Steps are due on tick boundaries, so the steps of transitions started by the same group command
+ * fall in the same tick. All the steps due when the timer fires are run in one pass, within a
+ * reporting::ScopedAttributeChangeBatch, so the attributes they change are handed to the reporting engine together.
+ *
+ * Steps are identified by their callback and context, like System::Layer timers: scheduling a step that is already scheduled
+ * moves it. Callbacks may schedule or cancel any step, including their own. A step scheduled during a pass runs in a later pass,
+ * even when it is due immediately.
+ *
+ * Once maxSteps steps are scheduled, further steps are run from a System::Layer timer of their own, as the clusters did before
+ * the scheduler: they no longer share ticks, but transitions on any number of endpoints keep running.
+ *
+ * Must only be used with the Matter stack locked.
+ */
+class TransitionScheduler
+{
+public:
+    struct Statistics
+    {
+        uint32_t ticks            = 0;
+        uint32_t steps            = 0;
+        uint32_t peakStepsPerTick = 0;
+        System::Clock::Microseconds32 maxTickDuration{ 0 }; ///< Longest time spent running the steps of a tick
+        uint32_t fallbackTimers = 0;                        ///< Steps run from their own timer because maxSteps were scheduled
+    };
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    static constexpr size_t kDefaultMaxSteps = SIZE_MAX;
+#else
+    static constexpr size_t kDefaultMaxSteps = CHIP_CONFIG_MAX_CONCURRENT_TRANSITIONS;
+#endif
+
+    TransitionScheduler(System::Clock::Milliseconds32 tickDuration =
+                            System::Clock::Milliseconds32(CHIP_CONFIG_TRANSITION_SCHEDULER_TICK_DURATION_MS),
+                        size_t maxSteps = kDefaultMaxSteps) :
+        mTickDuration(tickDuration),
+        mMaxSteps(maxSteps)
+    {}
+    ~TransitionScheduler() { Shutdown(); }
+
+    TransitionScheduler(const TransitionScheduler &)             = delete;
+    TransitionScheduler & operator=(const TransitionScheduler &) = delete;
+
+    /// @brief The scheduler shared by the clusters, which runs on DeviceLayer::SystemLayer()
+    static TransitionScheduler & GetInstance();
+
+    /// @brief Use another system layer, for instance a mock one in tests. Scheduled steps are dropped.
+    void SetSystemLayer(System::Layer * systemLayer);
+
+    /**
+     * Schedule a step to run once the delay expired, on the following tick boundary.
+     *
+     * A zero delay runs the step on the next pass, without waiting for a tick boundary. When maxSteps steps are already
+     * scheduled, the step is run from its own System::Layer timer instead.
+     *
+     * @return the error of starting the timer.
+     */
+    CHIP_ERROR Schedule(System::Clock::Milliseconds32 delay, System::TimerCompleteCallback callback, void * context);
+
+    /// @brief Cancel a step. Does nothing if it is not scheduled.
+    void Cancel(System::TimerCompleteCallback callback, void * context);
+
+    bool IsScheduled(System::TimerCompleteCallback callback, void * context);
+
+    /// @brief Drop every scheduled step and stop the timer. Steps run from their own timer are left to Cancel().
+    void Shutdown();
+
+    const Statistics & GetStatistics() const { return mStatistics; }
+    void ResetStatistics() { mStatistics = Statistics(); }
+    void LogStatistics() const;
+
+private:
+    struct Step
+    {
+        Step(System::TimerCompleteCallback aCallback, void * aContext) : callback(aCallback), context(aContext) {}
+
+        const System::TimerCompleteCallback callback;
+        void * const context;
+        System::Clock::Timestamp dueTime;
+        uint32_t pass = 0; ///< The pass during which the step was scheduled
+    };
+
+    static void OnTimer(System::Layer * systemLayer, void * context);
+
+    System::Layer & GetSystemLayer();
+    Step * FindStep(System::TimerCompleteCallback callback, void * context);
+    CHIP_ERROR StartFallbackTimer(System::Clock::Milliseconds32 delay, System::TimerCompleteCallback callback, void * context);
+    void CancelFallbackTimer(System::TimerCompleteCallback callback, void * context);
+    System::Clock::Timestamp GetDueTime(System::Clock::Milliseconds32 delay, System::Clock::Timestamp now) const;
+    void RunDueSteps();
+    CHIP_ERROR StartTimer(System::Clock::Timestamp dueTime, System::Clock::Timestamp now);
+
+    const System::Clock::Milliseconds32 mTickDuration;
+    const size_t mMaxSteps;
+    System::Layer * mSystemLayer = nullptr;
+    ObjectPool<Step, CHIP_CONFIG_MAX_CONCURRENT_TRANSITIONS> mSteps;
+    bool mTimerArmed   = false;
+    bool mInPass       = false;
+    bool mFallbackUsed = false; ///< Whether a step ever ran from its own timer, so that only then are those looked for
+    uint32_t mPass     = 0;     ///< Incremented when a pass starts, so that 0 means "not scheduled during a pass"
+    System::Clock::Timestamp mTimerDueTime;
+    Statistics mStatistics;
+};
+
+} // namespace app
+} // namespace chip
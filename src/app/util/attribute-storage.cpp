@@ -1575,7 +1575,7 @@ public:
 
     void MarkDirty(const AttributePathParams & path) override
     {
-        InteractionModelEngine::GetInstance()->GetReportingEngine().SetDirty(path);
+        InteractionModelEngine::GetInstance()->GetReportingEngine().MarkDirty(path);
     }
 };
 
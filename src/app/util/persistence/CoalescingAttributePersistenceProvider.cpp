@@ -0,0 +1,283 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/util/persistence/CoalescingAttributePersistenceProvider.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <algorithm>
+#include <string.h>
+
+namespace chip {
+namespace app {
+
+CoalescingAttributePersistenceProvider::~CoalescingAttributePersistenceProvider()
+{
+    CHIP_ERROR err = Flush();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Zcl, "Dropping %u buffered attribute values: %" CHIP_ERROR_FORMAT, static_cast<unsigned>(mDirtyCount),
+                     err.Format());
+    }
+
+    if (mTimerArmed)
+    {
+        DeviceLayer::SystemLayer().CancelTimer(OnFlushTimer, this);
+    }
+}
+
+CHIP_ERROR CoalescingAttributePersistenceProvider::WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue)
+{
+    mStatistics.writes++;
+
+    DirtyAttribute * attribute = FindDirtyAttribute(aPath);
+    if (attribute != nullptr)
+    {
+        mStatistics.coalescedWrites++;
+    }
+
+    // Values that can never be buffered are written through, replacing the buffered one
+    if (mDirtyAttributes.empty() || aValue.size() > mValueBuffer.size())
+    {
+        if (attribute != nullptr)
+        {
+            RemoveDirtyAttribute(*attribute);
+        }
+        mStatistics.persistedWrites++;
+        return mPersister.WriteValue(aPath, aValue);
+    }
+
+    const bool added = (attribute == nullptr && mDirtyCount < mDirtyAttributes.size());
+    if (added)
+    {
+        attribute = &AddDirtyAttribute(aPath);
+    }
+
+    if (attribute == nullptr || !Reserve(*attribute, aValue.size()))
+    {
+        // The dirty set is full, write it out before buffering the new value. An attribute that was already buffered is
+        // written out with the others, so that its previous value is not lost if the flush fails.
+        if (added)
+        {
+            RemoveDirtyAttribute(*attribute);
+        }
+        mStatistics.capacityFlushes++;
+        ReturnErrorOnFailure(Flush());
+
+        attribute = &AddDirtyAttribute(aPath);
+        VerifyOrDie(Reserve(*attribute, aValue.size()));
+    }
+
+    memcpy(mValueBuffer.data() + attribute->offset, aValue.data(), aValue.size());
+    attribute->size = aValue.size();
+
+    mStatistics.peakDirtyAttributes = std::max(mStatistics.peakDirtyAttributes, mDirtyCount);
+    mStatistics.peakBufferedBytes   = std::max(mStatistics.peakBufferedBytes, mBufferUsed);
+
+    ScheduleFlush();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CoalescingAttributePersistenceProvider::ReadValue(const ConcreteAttributePath & aPath,
+                                                             const EmberAfAttributeMetadata * aMetadata, MutableByteSpan & aValue)
+{
+    DirtyAttribute * attribute = FindDirtyAttribute(aPath);
+    VerifyOrReturnError(attribute != nullptr, mPersister.ReadValue(aPath, aMetadata, aValue));
+
+    return CopySpanToMutableSpan(ByteSpan(mValueBuffer.data() + attribute->offset, attribute->size), aValue);
+}
+
+CHIP_ERROR CoalescingAttributePersistenceProvider::Flush()
+{
+    CHIP_ERROR firstError = CHIP_NO_ERROR;
+    size_t failedCount    = 0;
+
+    for (size_t i = 0; i < mDirtyCount; i++)
+    {
+        const DirtyAttribute & attribute = mDirtyAttributes[i];
+        const ByteSpan value(mValueBuffer.data() + attribute.offset, attribute.size);
+
+        CHIP_ERROR err = mPersister.WriteValue(attribute.path, value);
+        if (err == CHIP_NO_ERROR)
+        {
+            mStatistics.persistedWrites++;
+            continue;
+        }
+
+        // Failed values stay buffered, at the start of the dirty set
+        mDirtyAttributes[failedCount++] = attribute;
+
+        mStatistics.failedWrites++;
+        ChipLogError(Zcl, "Failed to persist attribute %u/" ChipLogFormatMEI "/" ChipLogFormatMEI ": %" CHIP_ERROR_FORMAT,
+                     attribute.path.mEndpointId, ChipLogValueMEI(attribute.path.mClusterId),
+                     ChipLogValueMEI(attribute.path.mAttributeId), err.Format());
+        if (firstError == CHIP_NO_ERROR)
+        {
+            firstError = err;
+        }
+    }
+
+    if (mDirtyCount > 0)
+    {
+        mStatistics.flushes++;
+    }
+    mDirtyCount = failedCount;
+    CompactValueBuffer();
+
+    if (mTimerArmed)
+    {
+        DeviceLayer::SystemLayer().CancelTimer(OnFlushTimer, this);
+        mTimerArmed = false;
+    }
+
+    if (mDirtyCount > 0)
+    {
+        // Retry the failed values once the idle delay expired
+        mOldestWrite   = System::SystemClock().GetMonotonicTimestamp();
+        CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(mParams.idleDelay, OnFlushTimer, this);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Zcl, "Failed to schedule the attribute persistence retry: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+        mTimerArmed = (err == CHIP_NO_ERROR);
+    }
+
+    return firstError;
+}
+
+void CoalescingAttributePersistenceProvider::LogStatistics() const
+{
+    ChipLogProgress(Zcl,
+                    "Attribute persistence: %" PRIu32 " writes, %" PRIu32 " coalesced, %" PRIu32 " persisted, %" PRIu32
+                    " failed, %" PRIu32 " flushes (%" PRIu32 " when full)",
+                    mStatistics.writes, mStatistics.coalescedWrites, mStatistics.persistedWrites, mStatistics.failedWrites,
+                    mStatistics.flushes, mStatistics.capacityFlushes);
+}
+
+void CoalescingAttributePersistenceProvider::OnFlushTimer(System::Layer * systemLayer, void * context)
+{
+    auto * provider       = static_cast<CoalescingAttributePersistenceProvider *>(context);
+    provider->mTimerArmed = false;
+    provider->Flush();
+}
+
+CoalescingAttributePersistenceProvider::DirtyAttribute *
+CoalescingAttributePersistenceProvider::FindDirtyAttribute(const ConcreteAttributePath & aPath)
+{
+    for (size_t i = 0; i < mDirtyCount; i++)
+    {
+        if (mDirtyAttributes[i].path == aPath)
+        {
+            return &mDirtyAttributes[i];
+        }
+    }
+    return nullptr;
+}
+
+CoalescingAttributePersistenceProvider::DirtyAttribute &
+CoalescingAttributePersistenceProvider::AddDirtyAttribute(const ConcreteAttributePath & aPath)
+{
+    if (mDirtyCount == 0)
+    {
+        mOldestWrite = System::SystemClock().GetMonotonicTimestamp();
+    }
+
+    DirtyAttribute & attribute = mDirtyAttributes[mDirtyCount++];
+    attribute                  = DirtyAttribute();
+    attribute.path             = aPath;
+    return attribute;
+}
+
+void CoalescingAttributePersistenceProvider::RemoveDirtyAttribute(DirtyAttribute & attribute)
+{
+    // The space of its value is reclaimed when the buffer is compacted, or right away if it was the last one
+    attribute = mDirtyAttributes[--mDirtyCount];
+    if (mDirtyCount == 0)
+    {
+        mBufferUsed = 0;
+    }
+}
+
+bool CoalescingAttributePersistenceProvider::Reserve(DirtyAttribute & attribute, size_t size)
+{
+    // Values are rewritten in place, unless they grew, e.g. for strings
+    VerifyOrReturnValue(size > attribute.capacity, true);
+    if (size > mValueBuffer.size() - mBufferUsed)
+    {
+        CompactValueBuffer();
+        VerifyOrReturnValue(size <= mValueBuffer.size() - mBufferUsed, false);
+    }
+
+    attribute.offset   = mBufferUsed;
+    attribute.capacity = size;
+    mBufferUsed += size;
+    return true;
+}
+
+void CoalescingAttributePersistenceProvider::CompactValueBuffer()
+{
+    // Values are moved towards the start of the buffer in the order of their offsets, so that none is overwritten before it
+    // is moved. The dirty set is small, finding the next value each time is cheaper than sorting it.
+    size_t used           = 0;
+    size_t previousOffset = 0;
+    for (bool first = true;; first = false)
+    {
+        DirtyAttribute * next = nullptr;
+        for (size_t i = 0; i < mDirtyCount; i++)
+        {
+            DirtyAttribute & attribute = mDirtyAttributes[i];
+            if (attribute.capacity > 0 && (first || attribute.offset > previousOffset) &&
+                (next == nullptr || attribute.offset < next->offset))
+            {
+                next = &attribute;
+            }
+        }
+        if (next == nullptr)
+        {
+            break;
+        }
+
+        previousOffset = next->offset;
+        memmove(mValueBuffer.data() + used, mValueBuffer.data() + next->offset, next->size);
+        next->offset   = used;
+        next->capacity = next->size;
+        used += next->size;
+    }
+    mBufferUsed = used;
+}
+
+void CoalescingAttributePersistenceProvider::ScheduleFlush()
+{
+    const System::Clock::Timestamp now      = System::SystemClock().GetMonotonicTimestamp();
+    const System::Clock::Timestamp deadline = mOldestWrite + mParams.maxDelay;
+    const System::Clock::Timestamp idle     = now + mParams.idleDelay;
+    const System::Clock::Timestamp flushAt  = std::min(deadline, idle);
+
+    CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(
+        (flushAt > now) ? std::chrono::duration_cast<System::Clock::Timeout>(flushAt - now) : System::Clock::Timeout(0),
+        OnFlushTimer, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Zcl, "Failed to schedule the attribute persistence flush: %" CHIP_ERROR_FORMAT, err.Format());
+        Flush();
+        return;
+    }
+    mTimerArmed = true;
+}
+
+} // namespace app
+} // namespace chip
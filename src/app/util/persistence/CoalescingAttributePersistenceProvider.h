@@ -0,0 +1,141 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/util/persistence/AttributePersistenceProvider.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+
+/**
+ * Decorator class for the AttributePersistenceProvider implementation that
+ * coalesces the writes of every attribute.
+ *
+ * Written values are buffered in a bounded dirty set, and only the last value
+ * written to each attribute is passed to the decorated persister. The dirty set
+ * is flushed as a batch:
+ *   - once no attribute was written for the idle delay,
+ *   - at the latest the max delay after the oldest buffered write, so that
+ *     attributes that keep changing are still persisted,
+ *   - when a write does not fit in the dirty set anymore,
+ *   - when Flush() is called, e.g. when power is about to fail,
+ *   - when the provider is destroyed.
+ *
+ * Values that fail to be persisted stay buffered, and are retried after the
+ * idle delay.
+ *
+ * Reads return the buffered value of an attribute, if there is one.
+ *
+ * Unlike DeferredAttributePersistenceProvider, which defers a fixed list of
+ * attributes with a buffer each, any attribute can be buffered, and values
+ * share a single buffer provided by the application.
+ */
+class CoalescingAttributePersistenceProvider : public AttributePersistenceProvider
+{
+public:
+    struct Parameters
+    {
+        /// Delay without any attribute write after which the dirty set is flushed
+        System::Clock::Milliseconds32 idleDelay{ 1000 };
+        /// Longest time a write stays buffered, even if attributes keep being written
+        System::Clock::Milliseconds32 maxDelay{ 10000 };
+    };
+
+    struct Statistics
+    {
+        uint32_t writes            = 0;
+        uint32_t coalescedWrites   = 0; ///< Writes replaced by a later write of the same attribute before being flushed
+        uint32_t persistedWrites   = 0; ///< Writes passed to the decorated persister
+        uint32_t failedWrites      = 0;
+        uint32_t flushes           = 0;
+        uint32_t capacityFlushes   = 0; ///< Flushes forced by a full dirty set
+        size_t peakDirtyAttributes = 0;
+        size_t peakBufferedBytes   = 0;
+    };
+
+    /// A buffered value, stored in the value buffer. The storage for the dirty set is provided by the application.
+    struct DirtyAttribute
+    {
+        ConcreteAttributePath path;
+        size_t offset   = 0;
+        size_t capacity = 0;
+        size_t size     = 0;
+    };
+
+    /**
+     * @param persister The decorated persister.
+     * @param dirtyAttributes Storage for the dirty set, which bounds the number of attributes buffered at once.
+     * @param valueBuffer Storage for the buffered values. Values larger than the buffer are written through.
+     * @param params Flush delays.
+     */
+    CoalescingAttributePersistenceProvider(AttributePersistenceProvider & persister, const Span<DirtyAttribute> & dirtyAttributes,
+                                           const MutableByteSpan & valueBuffer, const Parameters & params) :
+        mPersister(persister),
+        mDirtyAttributes(dirtyAttributes), mValueBuffer(valueBuffer), mParams(params)
+    {}
+    CoalescingAttributePersistenceProvider(AttributePersistenceProvider & persister, const Span<DirtyAttribute> & dirtyAttributes,
+                                           const MutableByteSpan & valueBuffer) :
+        CoalescingAttributePersistenceProvider(persister, dirtyAttributes, valueBuffer, Parameters())
+    {}
+    ~CoalescingAttributePersistenceProvider() override;
+
+    CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue) override;
+    CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                         MutableByteSpan & aValue) override;
+
+    /**
+     * Pass every buffered value to the decorated persister right away.
+     *
+     * Values that fail to be written stay buffered and are retried after the idle delay. Returns the first error.
+     */
+    CHIP_ERROR Flush();
+
+    size_t GetDirtyCount() const { return mDirtyCount; }
+
+    const Statistics & GetStatistics() const { return mStatistics; }
+    void ResetStatistics() { mStatistics = Statistics(); }
+    void LogStatistics() const;
+
+private:
+    static void OnFlushTimer(System::Layer * systemLayer, void * context);
+
+    DirtyAttribute * FindDirtyAttribute(const ConcreteAttributePath & aPath);
+    DirtyAttribute & AddDirtyAttribute(const ConcreteAttributePath & aPath);
+    void RemoveDirtyAttribute(DirtyAttribute & attribute);
+    bool Reserve(DirtyAttribute & attribute, size_t size);
+    void CompactValueBuffer();
+    void ScheduleFlush();
+
+    AttributePersistenceProvider & mPersister;
+    const Span<DirtyAttribute> mDirtyAttributes;
+    const MutableByteSpan mValueBuffer;
+    const Parameters mParams;
+
+    size_t mDirtyCount = 0;
+    size_t mBufferUsed = 0; ///< Values are appended to the buffer, which is compacted when it is full
+    bool mTimerArmed   = false;
+    System::Clock::Timestamp mOldestWrite;
+    Statistics mStatistics;
+};
+
+} // namespace app
+} // namespace chip
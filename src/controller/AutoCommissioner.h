@@ -51,7 +51,7 @@ public:
 protected:
     CommissioningStage GetNextCommissioningStage(CommissioningStage currentStage, CHIP_ERROR & lastErr);
     DeviceCommissioner * GetCommissioner() { return mCommissioner; }
-    CHIP_ERROR PerformStep(CommissioningStage nextStage);
+    virtual CHIP_ERROR PerformStep(CommissioningStage nextStage);
     CommissioneeDeviceProxy * GetCommissioneeDeviceProxy() { return mCommissioneeDeviceProxy; }
     /**
      * The device argument to GetCommandTimeout is the device whose session will
@@ -0,0 +1,460 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/BatchCommissioner.h>
+
+#include <controller/CHIPDeviceController.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Controller {
+
+using namespace System::Clock;
+
+void CommissioningLatencyHistogram::Record(Milliseconds64 duration)
+{
+    size_t bucket = 0;
+    for (uint64_t ms = duration.count(); ms != 0 && bucket < kBucketCount - 1; ms >>= 1)
+    {
+        bucket++;
+    }
+
+    count++;
+    total += duration;
+    max = std::max(max, duration);
+    buckets[bucket]++;
+}
+
+BatchAutoCommissioner::~BatchAutoCommissioner()
+{
+    ReleaseStage();
+}
+
+CHIP_ERROR BatchAutoCommissioner::StartCommissioning(DeviceCommissioner * commissioner, CommissioneeDeviceProxy * proxy)
+{
+    // Nothing from a previous, abandoned commissioning can still be running
+    ReleaseStage();
+    Unlink();
+    mWaitingStage = CommissioningStage::kError;
+    return AutoCommissioner::StartCommissioning(commissioner, proxy);
+}
+
+CHIP_ERROR BatchAutoCommissioner::CommissioningStepFinished(CHIP_ERROR err, CommissioningDelegate::CommissioningReport report)
+{
+    // A step of a limited stage always ends with this call, whether it succeeded or not
+    ReleaseStage();
+    return AutoCommissioner::CommissioningStepFinished(err, report);
+}
+
+CHIP_ERROR BatchAutoCommissioner::PerformStep(CommissioningStage nextStage)
+{
+    if (!mBatch.IsStageLimited(nextStage))
+    {
+        return RunStep(nextStage);
+    }
+
+    bool queued = false;
+    for (auto & waiting : mBatch.mWaitingCommissioners)
+    {
+        queued = queued || (waiting.mWaitingStage == nextStage);
+    }
+
+    if (queued || !mBatch.HasFreeSlot(nextStage))
+    {
+        ChipLogProgress(Controller, "Commissioning step '%s' waits for a free slot", StageToString(nextStage));
+        mWaitingStage = nextStage;
+        mBatch.mWaitingCommissioners.PushBack(this);
+        return CHIP_NO_ERROR;
+    }
+
+    mBatch.mStageRunning[nextStage]++;
+    mHeldStage = nextStage;
+    return RunStep(nextStage);
+}
+
+void BatchAutoCommissioner::ReleaseStage()
+{
+    VerifyOrReturn(mHeldStage != CommissioningStage::kError);
+
+    // Slots are reset when a new batch starts, do not release one taken from a previous batch
+    if (mBatch.IsStageLimited(mHeldStage) && mBatch.mStageRunning[mHeldStage] > 0)
+    {
+        mBatch.mStageRunning[mHeldStage]--;
+        if (!mBatch.mWaitingCommissioners.Empty())
+        {
+            mBatch.ScheduleProcessLanes();
+        }
+    }
+    mHeldStage = CommissioningStage::kError;
+}
+
+void BatchAutoCommissioner::Resume()
+{
+    mHeldStage    = mWaitingStage;
+    mWaitingStage = CommissioningStage::kError;
+    mBatch.mStageRunning[mHeldStage]++;
+
+    CHIP_ERROR err = RunStep(mHeldStage);
+    if (err != CHIP_NO_ERROR)
+    {
+        // Only fails when the commissionee went away while waiting, nothing is left to clean up
+        ChipLogError(Controller, "Failed to resume commissioning step '%s': %" CHIP_ERROR_FORMAT, StageToString(mHeldStage),
+                     err.Format());
+        ReleaseStage();
+    }
+}
+
+BatchCommissionerBase::~BatchCommissionerBase()
+{
+    CancelWaitingCommissioners();
+
+    VerifyOrReturn(mSystemLayer != nullptr);
+    mSystemLayer->CancelTimer(ProcessLanes, this);
+
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        if (mLanes[i].mCommissioner != nullptr)
+        {
+            mLanes[i].mCommissioner->RegisterPairingDelegate(mLanes[i].mSavedDelegate);
+        }
+    }
+}
+
+CHIP_ERROR BatchCommissionerBase::Start(System::Layer * systemLayer, Span<DeviceCommissioner *> commissioners,
+                                        Span<BatchCommissionee> commissionees, const BatchCommissioningParameters & params,
+                                        BatchCommissioningDelegate * delegate)
+{
+    VerifyOrReturnError(!IsRunning(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(systemLayer != nullptr && delegate != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!commissioners.empty() && commissioners.size() <= mLaneCount, CHIP_ERROR_INVALID_ARGUMENT);
+    for (auto * commissioner : commissioners)
+    {
+        VerifyOrReturnError(commissioner != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+    for (auto & commissionee : commissionees)
+    {
+        VerifyOrReturnError(commissionee.setUpCode != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        commissionee.result      = CHIP_ERROR_IN_PROGRESS;
+        commissionee.failedStage = CommissioningStage::kError;
+    }
+    for (const auto & limit : params.stageLimits)
+    {
+        // kReadCommissioningInfo and kSendTrustedRootCert are not started through AutoCommissioner::PerformStep()
+        VerifyOrReturnError(limit.stage != CommissioningStage::kError && limit.stage != CommissioningStage::kSecurePairing &&
+                                limit.stage != CommissioningStage::kReadCommissioningInfo &&
+                                limit.stage != CommissioningStage::kSendTrustedRootCert &&
+                                limit.stage != CommissioningStage::kCleanup && static_cast<size_t>(limit.stage) < kStageCount,
+                            CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    std::fill(std::begin(mStageLimit), std::end(mStageLimit), 0);
+    std::fill(std::begin(mStageRunning), std::end(mStageRunning), 0);
+    for (const auto & limit : params.stageLimits)
+    {
+        mStageLimit[limit.stage] = limit.maxConcurrent;
+    }
+
+    mSystemLayer      = systemLayer;
+    mDelegate         = delegate;
+    mCommissionees    = commissionees;
+    mNextCommissionee = 0;
+    mParams           = params;
+    mActiveLaneCount  = 0;
+
+    // Copied into mStageLimit above, the span is not required to outlive Start()
+    mParams.stageLimits = Span<const CommissioningStageLimit>();
+
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        Lane & lane = mLanes[i];
+        lane        = Lane();
+        if (i < commissioners.size())
+        {
+            lane.mOwner         = this;
+            lane.mCommissioner  = commissioners[i];
+            lane.mSavedDelegate = lane.mCommissioner->GetPairingDelegate();
+            lane.mCommissioner->RegisterPairingDelegate(&lane);
+        }
+    }
+
+    ChipLogProgress(Controller, "Batch commissioning %u devices with %u commissioners", static_cast<unsigned>(commissionees.size()),
+                    static_cast<unsigned>(commissioners.size()));
+
+    // Start from the event loop, so that the delegate is never called back from within Start()
+    ScheduleProcessLanes();
+    return CHIP_NO_ERROR;
+}
+
+void BatchCommissionerBase::Stop()
+{
+    VerifyOrReturn(IsRunning());
+
+    for (; mNextCommissionee < mCommissionees.size(); mNextCommissionee++)
+    {
+        BatchCommissionee & commissionee = mCommissionees[mNextCommissionee];
+        commissionee.result              = CHIP_ERROR_CANCELLED;
+        mDelegate->OnCommissioneeComplete(commissionee);
+    }
+
+    ScheduleProcessLanes();
+}
+
+const CommissioningLatencyHistogram & BatchCommissionerBase::GetStageLatency(CommissioningStage stage) const
+{
+    VerifyOrDie(static_cast<size_t>(stage) < kStageCount);
+    return mStageLatency[stage];
+}
+
+void BatchCommissionerBase::ClearLatencyStatistics()
+{
+    for (auto & histogram : mStageLatency)
+    {
+        histogram.Clear();
+    }
+    mTotalLatency.Clear();
+}
+
+void BatchCommissionerBase::LogLatencyStatistics() const
+{
+    auto logHistogram = [](const char * name, const CommissioningLatencyHistogram & histogram) {
+        VerifyOrReturn(histogram.count > 0);
+        ChipLogProgress(Controller, "%s: count %u, mean %u ms, max %u ms", name, static_cast<unsigned>(histogram.count),
+                        static_cast<unsigned>(histogram.total.count() / histogram.count),
+                        static_cast<unsigned>(histogram.max.count()));
+    };
+
+    for (size_t stage = 0; stage < kStageCount; stage++)
+    {
+        logHistogram(StageToString(static_cast<CommissioningStage>(stage)), mStageLatency[stage]);
+    }
+    logHistogram("Total", mTotalLatency);
+}
+
+CHIP_ERROR BatchCommissionerBase::StartPairing(DeviceCommissioner & commissioner, const BatchCommissionee & commissionee)
+{
+    return commissioner.PairDevice(commissionee.nodeId, commissionee.setUpCode, mParams.commissioningParameters,
+                                   mParams.discoveryType);
+}
+
+void BatchCommissionerBase::ScheduleProcessLanes()
+{
+    // Restarting the timer coalesces requests, ProcessLanes handles every lane each time
+    CHIP_ERROR err = mSystemLayer->StartTimer(Milliseconds32(0), ProcessLanes, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to schedule batch commissioning work: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void BatchCommissionerBase::ProcessLanes(System::Layer * systemLayer, void * context)
+{
+    static_cast<BatchCommissionerBase *>(context)->ProcessLanes();
+}
+
+void BatchCommissionerBase::ProcessLanes()
+{
+    VerifyOrReturn(IsRunning());
+
+    ResumeWaitingCommissioners();
+
+    size_t pairingCount = 0;
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        Lane & lane = mLanes[i];
+
+        // A PASE failure is reported without OnPairingComplete when discovery timed out
+        if (lane.mState == Lane::State::kPairing && lane.mPairingFailed)
+        {
+            lane.Finish(CHIP_ERROR_TIMEOUT, CommissioningStage::kSecurePairing);
+        }
+
+        if (lane.mState == Lane::State::kDone)
+        {
+            lane.mState        = Lane::State::kIdle;
+            lane.mCommissionee = nullptr;
+            mActiveLaneCount--;
+        }
+
+        if (lane.mState == Lane::State::kPairing)
+        {
+            pairingCount++;
+        }
+    }
+
+    for (size_t i = 0; i < mLaneCount && mNextCommissionee < mCommissionees.size(); i++)
+    {
+        Lane & lane = mLanes[i];
+        if (lane.mCommissioner == nullptr || lane.mState != Lane::State::kIdle)
+        {
+            continue;
+        }
+        if (mParams.maxConcurrentPASE != 0 && pairingCount >= mParams.maxConcurrentPASE)
+        {
+            break;
+        }
+
+        BatchCommissionee & commissionee = mCommissionees[mNextCommissionee++];
+
+        lane.mCommissionee  = &commissionee;
+        lane.mState         = Lane::State::kPairing;
+        lane.mPairingFailed = false;
+        lane.mStarted       = System::SystemClock().GetMonotonicTimestamp();
+        lane.mStageStarted  = lane.mStarted;
+        mActiveLaneCount++;
+        pairingCount++;
+
+        CHIP_ERROR err = StartPairing(*lane.mCommissioner, commissionee);
+        if (err != CHIP_NO_ERROR && lane.mState == Lane::State::kPairing && lane.mCommissionee == &commissionee)
+        {
+            ChipLogError(Controller, "Failed to start pairing node 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(commissionee.nodeId), err.Format());
+            lane.Finish(err, CommissioningStage::kSecurePairing);
+        }
+    }
+
+    VerifyOrReturn(mActiveLaneCount == 0 && mNextCommissionee >= mCommissionees.size());
+
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        Lane & lane = mLanes[i];
+        if (lane.mCommissioner != nullptr)
+        {
+            lane.mCommissioner->RegisterPairingDelegate(lane.mSavedDelegate);
+        }
+        lane = Lane();
+    }
+
+    // Only commissioners abandoned while waiting can be left
+    CancelWaitingCommissioners();
+
+    // Clear the delegate first, so that a new batch can be started from the callback
+    BatchCommissioningDelegate * delegate = mDelegate;
+    mDelegate                             = nullptr;
+
+    ChipLogProgress(Controller, "Batch commissioning complete");
+    delegate->OnBatchCommissioningComplete();
+}
+
+void BatchCommissionerBase::OnLaneFinished(Lane & lane)
+{
+    mTotalLatency.Record(std::chrono::duration_cast<Milliseconds64>(System::SystemClock().GetMonotonicTimestamp() - lane.mStarted));
+    mDelegate->OnCommissioneeComplete(*lane.mCommissionee);
+
+    // The lane is reused from the event loop, the commissioner may still be unwinding from this callback
+    ScheduleProcessLanes();
+}
+
+bool BatchCommissionerBase::IsStageLimited(CommissioningStage stage) const
+{
+    return IsRunning() && static_cast<size_t>(stage) < kStageCount && mStageLimit[stage] != 0;
+}
+
+void BatchCommissionerBase::ResumeWaitingCommissioners()
+{
+    for (auto it = mWaitingCommissioners.begin(); it != mWaitingCommissioners.end();)
+    {
+        BatchAutoCommissioner & commissioner = *it++;
+        if (HasFreeSlot(commissioner.mWaitingStage))
+        {
+            mWaitingCommissioners.Remove(&commissioner);
+            commissioner.Resume();
+        }
+    }
+}
+
+void BatchCommissionerBase::CancelWaitingCommissioners()
+{
+    for (auto & commissioner : mWaitingCommissioners)
+    {
+        commissioner.mWaitingStage = CommissioningStage::kError;
+    }
+    mWaitingCommissioners.Clear();
+}
+
+void BatchCommissionerBase::RecordStageLatency(CommissioningStage stage, Timestamp start, Timestamp end)
+{
+    VerifyOrReturn(static_cast<size_t>(stage) < kStageCount);
+    mStageLatency[stage].Record(std::chrono::duration_cast<Milliseconds64>(end - start));
+}
+
+void BatchCommissionerBase::Lane::OnStatusUpdate(DevicePairingDelegate::Status status)
+{
+    VerifyOrReturn(mState == State::kPairing && status == DevicePairingDelegate::Status::SecurePairingFailed);
+
+    // Usually followed by OnPairingComplete with the actual error, otherwise the lane is
+    // finished on the next ProcessLanes()
+    mPairingFailed = true;
+    mOwner->ScheduleProcessLanes();
+}
+
+void BatchCommissionerBase::Lane::OnPairingComplete(CHIP_ERROR error)
+{
+    VerifyOrReturn(mState == State::kPairing);
+
+    Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    mOwner->RecordStageLatency(CommissioningStage::kSecurePairing, mStageStarted, now);
+    mStageStarted = now;
+
+    if (error != CHIP_NO_ERROR)
+    {
+        Finish(error, CommissioningStage::kSecurePairing);
+        return;
+    }
+
+    // The PASE slot is free, another commissionee can start pairing
+    mState = State::kCommissioning;
+    mOwner->ScheduleProcessLanes();
+}
+
+void BatchCommissionerBase::Lane::OnCommissioningStatusUpdate(PeerId peerId, CommissioningStage stageCompleted, CHIP_ERROR error)
+{
+    VerifyOrReturn(mState == State::kCommissioning);
+
+    Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    mOwner->RecordStageLatency(stageCompleted, mStageStarted, now);
+    mStageStarted = now;
+}
+
+void BatchCommissionerBase::Lane::OnCommissioningSuccess(PeerId peerId)
+{
+    VerifyOrReturn(mState == State::kCommissioning);
+    Finish(CHIP_NO_ERROR, CommissioningStage::kError);
+}
+
+void BatchCommissionerBase::Lane::OnCommissioningFailure(PeerId peerId, CHIP_ERROR error, CommissioningStage stageFailed,
+                                                         Optional<Credentials::AttestationVerificationResult> additionalErrorInfo)
+{
+    VerifyOrReturn(mState == State::kPairing || mState == State::kCommissioning);
+    Finish(error, stageFailed);
+}
+
+void BatchCommissionerBase::Lane::Finish(CHIP_ERROR error, CommissioningStage failedStage)
+{
+    ChipLogProgress(Controller, "Batch commissioning of node 0x" ChipLogFormatX64 " done: %" CHIP_ERROR_FORMAT,
+                    ChipLogValueX64(mCommissionee->nodeId), error.Format());
+
+    mCommissionee->result      = error;
+    mCommissionee->failedStage = failedStage;
+    mState                     = State::kDone;
+    mOwner->OnLaneFinished(*this);
+}
+
+} // namespace Controller
+} // namespace chip
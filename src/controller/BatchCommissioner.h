@@ -0,0 +1,295 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Declaration of BatchCommissioner, which commissions a list of
+ *      devices by running several DeviceCommissioner instances at once.
+ */
+
+#pragma once
+
+#include <controller/AutoCommissioner.h>
+#include <controller/CommissioningDelegate.h>
+#include <controller/DevicePairingDelegate.h>
+#include <controller/SetUpCodePairer.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/NodeId.h>
+#include <lib/support/IntrusiveList.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace Controller {
+
+class BatchCommissionerBase;
+class DeviceCommissioner;
+
+/**
+ * Latency distribution of one commissioning stage.
+ *
+ * Bucket 0 counts durations below 1 ms, bucket i (i > 0) counts durations in
+ * [2^(i-1), 2^i) ms, and the last bucket also counts everything longer.
+ */
+struct CommissioningLatencyHistogram
+{
+    static constexpr size_t kBucketCount = 18;
+
+    uint32_t count = 0;
+    System::Clock::Milliseconds64 total{ 0 };
+    System::Clock::Milliseconds64 max{ 0 };
+    uint32_t buckets[kBucketCount] = {};
+
+    void Record(System::Clock::Milliseconds64 duration);
+    void Clear() { *this = CommissioningLatencyHistogram(); }
+};
+
+/**
+ * A device to commission as part of a batch.
+ *
+ * The setup code is not copied and must remain valid until the batch completes.
+ * The result fields are filled in by the BatchCommissioner once this device is done.
+ */
+struct BatchCommissionee
+{
+    NodeId nodeId                  = kUndefinedNodeId;
+    const char * setUpCode         = nullptr;
+    CHIP_ERROR result              = CHIP_ERROR_IN_PROGRESS;
+    CommissioningStage failedStage = CommissioningStage::kError;
+};
+
+class BatchCommissioningDelegate
+{
+public:
+    virtual ~BatchCommissioningDelegate() {}
+
+    /**
+     * Called once for each commissionee, when it was commissioned or failed to be.
+     */
+    virtual void OnCommissioneeComplete(const BatchCommissionee & commissionee) {}
+
+    /**
+     * Called once every commissionee has completed, or once the in-flight ones
+     * have completed after Stop() was called.
+     */
+    virtual void OnBatchCommissioningComplete() = 0;
+};
+
+/**
+ * Maximum number of commissionees running a commissioning stage at the same time.
+ */
+struct CommissioningStageLimit
+{
+    CommissioningStage stage;
+    size_t maxConcurrent;
+};
+
+struct BatchCommissioningParameters
+{
+    /// Commissioning parameters used for every commissionee. Data referenced by the
+    /// parameters must remain valid until the batch completes.
+    CommissioningParameters commissioningParameters;
+
+    DiscoveryType discoveryType = DiscoveryType::kAll;
+
+    /// Maximum number of commissionees in discovery and PASE establishment at the same time,
+    /// 0 for no limit other than the number of commissioners. Useful when the transport only
+    /// supports a few concurrent commissioning channels (e.g. BLE).
+    size_t maxConcurrentPASE = 0;
+
+    /// Per-stage concurrency limits, for instance to bound the load on attestation verification
+    /// (kAttestationVerification) or on the certificate authority (kGenerateNOCChain). A limit of 0
+    /// means no limit. The limits are copied by Start(), and only apply to commissioners using a
+    /// BatchAutoCommissioner of this batch as their default commissioner.
+    Span<const CommissioningStageLimit> stageLimits;
+};
+
+/**
+ * AutoCommissioner that holds back the steps of stages limited by
+ * BatchCommissioningParameters::stageLimits until the batch has a free slot
+ * for them. Waiting steps resume in the order they were held back.
+ *
+ * Give each commissioner of the batch its own instance as
+ * SetupParams::defaultCommissioner, and keep the batch commissioner alive
+ * for as long as these instances. Outside of a running batch, steps are
+ * performed right away. Time spent waiting counts against the fail-safe armed
+ * on the commissionee, so limits should keep waits well below its expiry.
+ */
+class BatchAutoCommissioner : public AutoCommissioner, public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>
+{
+public:
+    explicit BatchAutoCommissioner(BatchCommissionerBase & batch) : mBatch(batch) {}
+    ~BatchAutoCommissioner() override;
+
+    CHIP_ERROR StartCommissioning(DeviceCommissioner * commissioner, CommissioneeDeviceProxy * proxy) override;
+    CHIP_ERROR CommissioningStepFinished(CHIP_ERROR err, CommissioningDelegate::CommissioningReport report) override;
+
+protected:
+    CHIP_ERROR PerformStep(CommissioningStage nextStage) override;
+
+    /**
+     * Performs a commissioning step once its stage is allowed to run.
+     */
+    virtual CHIP_ERROR RunStep(CommissioningStage stage) { return AutoCommissioner::PerformStep(stage); }
+
+private:
+    friend class BatchCommissionerBase;
+
+    void ReleaseStage();
+    void Resume();
+
+    BatchCommissionerBase & mBatch;
+    CommissioningStage mHeldStage    = CommissioningStage::kError; ///< Limited stage being run
+    CommissioningStage mWaitingStage = CommissioningStage::kError; ///< Limited stage waiting for a free slot
+};
+
+/**
+ * Commissions a list of devices using several DeviceCommissioner instances at once.
+ *
+ * Each commissioner commissions one device at a time, so the number of
+ * commissioners sets how many devices are commissioned in parallel. The
+ * commissioners must be initialized on the same fabric and should share their
+ * operational credentials delegate, so that attestation verification and NOC
+ * issuance of all commissionees go through the same delegates. Their pairing
+ * delegates are replaced while the batch runs and restored once it completes.
+ *
+ * Latency of each commissioning stage is recorded across the batch. The
+ * kSecurePairing stage covers discovery and PASE establishment, and the
+ * latency of a limited stage includes the time spent waiting for a slot.
+ */
+class BatchCommissionerBase
+{
+public:
+    virtual ~BatchCommissionerBase();
+
+    /**
+     * Start commissioning the given devices.
+     *
+     * Returns CHIP_ERROR_INCORRECT_STATE if a batch is already running, and CHIP_ERROR_INVALID_ARGUMENT
+     * if a stage limit is set on kSecurePairing (see maxConcurrentPASE) or on a stage that
+     * AutoCommissioner does not start through AutoCommissioner::PerformStep().
+     */
+    CHIP_ERROR Start(System::Layer * systemLayer, Span<DeviceCommissioner *> commissioners, Span<BatchCommissionee> commissionees,
+                     const BatchCommissioningParameters & params, BatchCommissioningDelegate * delegate);
+
+    /**
+     * Do not start any more commissionees. Commissionees already in progress run to completion,
+     * and the ones not started are completed with CHIP_ERROR_CANCELLED.
+     */
+    void Stop();
+
+    bool IsRunning() const { return mDelegate != nullptr; }
+
+    const CommissioningLatencyHistogram & GetStageLatency(CommissioningStage stage) const;
+    const CommissioningLatencyHistogram & GetTotalLatency() const { return mTotalLatency; }
+    void ClearLatencyStatistics();
+    void LogLatencyStatistics() const;
+
+protected:
+    class Lane : public DevicePairingDelegate
+    {
+    public:
+        void OnStatusUpdate(DevicePairingDelegate::Status status) override;
+        void OnPairingComplete(CHIP_ERROR error) override;
+        void OnCommissioningStatusUpdate(PeerId peerId, CommissioningStage stageCompleted, CHIP_ERROR error) override;
+        void OnCommissioningSuccess(PeerId peerId) override;
+        void OnCommissioningFailure(PeerId peerId, CHIP_ERROR error, CommissioningStage stageFailed,
+                                    Optional<Credentials::AttestationVerificationResult> additionalErrorInfo) override;
+
+    private:
+        friend class BatchCommissionerBase;
+
+        enum class State : uint8_t
+        {
+            kIdle,
+            kPairing,       ///< Discovery and PASE establishment
+            kCommissioning, ///< Commissioning over the PASE session
+            kDone,          ///< Completed, released on the next ProcessLanes()
+        };
+
+        void Finish(CHIP_ERROR error, CommissioningStage failedStage);
+
+        BatchCommissionerBase * mOwner         = nullptr;
+        DeviceCommissioner * mCommissioner     = nullptr;
+        DevicePairingDelegate * mSavedDelegate = nullptr;
+        BatchCommissionee * mCommissionee      = nullptr;
+        State mState                           = State::kIdle;
+        bool mPairingFailed                    = false;
+        System::Clock::Timestamp mStarted      = System::Clock::kZero;
+        System::Clock::Timestamp mStageStarted = System::Clock::kZero;
+    };
+
+    BatchCommissionerBase(Lane * lanes, size_t laneCount) : mLanes(lanes), mLaneCount(laneCount) {}
+
+    /**
+     * Starts discovery and PASE establishment for a commissionee. Commissioning proceeds
+     * automatically once PASE is established.
+     */
+    virtual CHIP_ERROR StartPairing(DeviceCommissioner & commissioner, const BatchCommissionee & commissionee);
+
+private:
+    friend class BatchAutoCommissioner;
+
+    // CommissioningStage values are contiguous, from kError to kSendVIDVerificationRequest
+    static constexpr size_t kStageCount = static_cast<size_t>(CommissioningStage::kSendVIDVerificationRequest) + 1;
+
+    static void ProcessLanes(System::Layer * systemLayer, void * context);
+
+    void ScheduleProcessLanes();
+    void ProcessLanes();
+    void OnLaneFinished(Lane & lane);
+    void RecordStageLatency(CommissioningStage stage, System::Clock::Timestamp start, System::Clock::Timestamp end);
+
+    bool IsStageLimited(CommissioningStage stage) const;
+    bool HasFreeSlot(CommissioningStage stage) const { return mStageRunning[stage] < mStageLimit[stage]; }
+    void ResumeWaitingCommissioners();
+    void CancelWaitingCommissioners();
+
+    Lane * mLanes;
+    const size_t mLaneCount;
+    size_t mActiveLaneCount = 0;
+
+    System::Layer * mSystemLayer           = nullptr;
+    BatchCommissioningDelegate * mDelegate = nullptr;
+    Span<BatchCommissionee> mCommissionees;
+    size_t mNextCommissionee = 0;
+    BatchCommissioningParameters mParams;
+
+    size_t mStageLimit[kStageCount]   = {};
+    size_t mStageRunning[kStageCount] = {};
+    IntrusiveList<BatchAutoCommissioner, IntrusiveMode::AutoUnlink> mWaitingCommissioners;
+
+    CommissioningLatencyHistogram mStageLatency[kStageCount];
+    CommissioningLatencyHistogram mTotalLatency;
+};
+
+template <size_t kMaxCommissioners>
+class BatchCommissioner : public BatchCommissionerBase
+{
+public:
+    BatchCommissioner() : BatchCommissionerBase(mLaneStorage, kMaxCommissioners) {}
+
+private:
+    Lane mLaneStorage[kMaxCommissioners];
+};
+
+} // namespace Controller
+} // namespace chip
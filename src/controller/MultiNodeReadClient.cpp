@@ -0,0 +1,389 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/MultiNodeReadClient.h>
+
+#include <app/CASESessionManager.h>
+#include <app/ReadPrepareParams.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <messaging/ExchangeMgr.h>
+#include <transport/SessionManager.h>
+
+#include <algorithm>
+
+#if CHIP_CONFIG_ENABLE_READ_CLIENT
+namespace chip {
+namespace Controller {
+
+using namespace System::Clock;
+
+namespace {
+
+Milliseconds64 ElapsedSince(Timestamp start)
+{
+    return std::chrono::duration_cast<Milliseconds64>(System::SystemClock().GetMonotonicTimestamp() - start);
+}
+
+} // namespace
+
+MultiNodeReadClient::Node::Node(MultiNodeReadClient & owner, NodeId nodeId) :
+    mOwner(owner), mNodeId(nodeId), mOnConnected(OnConnected, this), mOnConnectionFailure(OnConnectionFailure, this)
+{}
+
+CHIP_ERROR MultiNodeReadClient::Start(FabricIndex fabricIndex, Span<const NodeId> nodes, const Parameters & params,
+                                      Callback * callback)
+{
+    VerifyOrReturnError(!IsRunning(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mEngine != nullptr && mEngine->GetExchangeManager() != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(callback != nullptr && IsValidFabricIndex(fabricIndex), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!params.attributePaths.empty() || !params.eventPaths.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(params.maxConcurrentSessionSetups > 0 && params.maxConcurrentInteractions > 0 && params.maxAttempts > 0,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    mCallback        = callback;
+    mParams          = params;
+    mFabricIndex     = fabricIndex;
+    mNodes           = nodes;
+    mNextNode        = 0;
+    mActiveCount     = 0;
+    mConnectingCount = 0;
+    mDoneNotified    = false;
+    mStatistics      = Statistics();
+    mStarted         = System::SystemClock().GetMonotonicTimestamp();
+
+    ChipLogProgress(Controller, "Multi-node %s of %u nodes",
+                    params.interactionType == app::ReadClient::InteractionType::Read ? "read" : "subscribe",
+                    static_cast<unsigned>(nodes.size()));
+
+    // Start from the event loop, so that the callback is never called from within Start()
+    ScheduleProcessNodes();
+    return CHIP_NO_ERROR;
+}
+
+void MultiNodeReadClient::Shutdown()
+{
+    VerifyOrReturn(mCallback != nullptr);
+
+    System::Layer & systemLayer = GetSystemLayer();
+    systemLayer.CancelTimer(ProcessNodes, this);
+
+    while (!mNodeList.Empty())
+    {
+        Node & node = *mNodeList.begin();
+        systemLayer.CancelTimer(Node::OnBackoffTimer, &node);
+        mNodeList.Remove(&node);
+        Platform::Delete(&node);
+    }
+
+    mCallback        = nullptr;
+    mActiveCount     = 0;
+    mConnectingCount = 0;
+}
+
+void MultiNodeReadClient::LogStatistics() const
+{
+    const uint64_t elapsedMs = mStatistics.elapsed.count();
+    const uint64_t completed = mStatistics.nodesSucceeded + mStatistics.nodesFailed;
+
+    ChipLogProgress(Controller, "Multi-node read: %u succeeded, %u failed, %u retries in %u ms (%u nodes/s)",
+                    static_cast<unsigned>(mStatistics.nodesSucceeded), static_cast<unsigned>(mStatistics.nodesFailed),
+                    static_cast<unsigned>(mStatistics.retries), static_cast<unsigned>(elapsedMs),
+                    static_cast<unsigned>(elapsedMs == 0 ? completed : completed * 1000 / elapsedMs));
+    ChipLogProgress(Controller, "Multi-node read: %u session setups (mean %u ms), %u attribute and %u event reports",
+                    static_cast<unsigned>(mStatistics.sessionSetups),
+                    static_cast<unsigned>(mStatistics.sessionSetups == 0
+                                              ? 0
+                                              : mStatistics.sessionSetupTime.count() / mStatistics.sessionSetups),
+                    static_cast<unsigned>(mStatistics.attributeReports), static_cast<unsigned>(mStatistics.eventReports));
+    ChipLogProgress(Controller, "Multi-node read: peak %u session setups, peak %u interactions",
+                    static_cast<unsigned>(mStatistics.peakSessionSetups), static_cast<unsigned>(mStatistics.peakInteractions));
+}
+
+void MultiNodeReadClient::FindOrEstablishSession(const ScopedNodeId & peerId,
+                                                 chip::Callback::Callback<OnDeviceConnected> * onConnection,
+                                                 chip::Callback::Callback<OnDeviceConnectionFailure> * onFailure)
+{
+    CASESessionManager * caseSessionManager = mEngine->GetCASESessionManager();
+    if (caseSessionManager == nullptr)
+    {
+        onFailure->mCall(onFailure->mContext, peerId, CHIP_ERROR_INCORRECT_STATE);
+        return;
+    }
+
+    caseSessionManager->FindOrEstablishSession(peerId, onConnection, onFailure);
+}
+
+System::Layer & MultiNodeReadClient::GetSystemLayer() const
+{
+    return *mEngine->GetExchangeManager()->GetSessionManager()->SystemLayer();
+}
+
+void MultiNodeReadClient::ScheduleProcessNodes()
+{
+    // Restarting the timer coalesces requests, ProcessNodes handles every node each time
+    CHIP_ERROR err = GetSystemLayer().StartTimer(Milliseconds32(0), ProcessNodes, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to schedule multi-node read work: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void MultiNodeReadClient::ProcessNodes(System::Layer * systemLayer, void * context)
+{
+    static_cast<MultiNodeReadClient *>(context)->ProcessNodes();
+}
+
+void MultiNodeReadClient::ProcessNodes()
+{
+    VerifyOrReturn(mCallback != nullptr);
+
+    for (auto it = mNodeList.begin(); it != mNodeList.end();)
+    {
+        Node & node = *it++;
+        if (node.mState == Node::State::kDone)
+        {
+            ReleaseNode(node);
+        }
+    }
+
+    while (mNextNode < mNodes.size() && mActiveCount < mParams.maxConcurrentInteractions)
+    {
+        Node * node = Platform::New<Node>(*this, mNodes[mNextNode++]);
+        if (node == nullptr)
+        {
+            mStatistics.nodesFailed++;
+            mCallback->OnNodeDone(mNodes[mNextNode - 1], CHIP_ERROR_NO_MEMORY);
+            continue;
+        }
+
+        mActiveCount++;
+        mStatistics.peakInteractions = std::max(mStatistics.peakInteractions, mActiveCount);
+        mNodeList.PushBack(node);
+    }
+
+    // Nodes waiting to retry come first, they are earlier in the list
+    for (auto it = mNodeList.begin(); it != mNodeList.end() && mConnectingCount < mParams.maxConcurrentSessionSetups;)
+    {
+        Node & node = *it++;
+        if (node.mState == Node::State::kPending)
+        {
+            Connect(node);
+        }
+    }
+
+    VerifyOrReturn(!mDoneNotified && mActiveCount == 0 && mNextNode >= mNodes.size());
+
+    mDoneNotified       = true;
+    mStatistics.elapsed = ElapsedSince(mStarted);
+    LogStatistics();
+    mCallback->OnDone();
+}
+
+void MultiNodeReadClient::Connect(Node & node)
+{
+    node.mState          = Node::State::kConnecting;
+    node.mAttempt        = static_cast<uint8_t>(node.mAttempt + 1);
+    node.mLastError      = CHIP_NO_ERROR;
+    node.mConnectStarted = System::SystemClock().GetMonotonicTimestamp();
+    mConnectingCount++;
+    mStatistics.sessionSetups++;
+    mStatistics.peakSessionSetups = std::max(mStatistics.peakSessionSetups, mConnectingCount);
+
+    FindOrEstablishSession(ScopedNodeId(node.mNodeId, mFabricIndex), &node.mOnConnected, &node.mOnConnectionFailure);
+}
+
+void MultiNodeReadClient::OnConnected(Node & node, Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle)
+{
+    mConnectingCount--;
+    mStatistics.sessionSetupTime += ElapsedSince(node.mConnectStarted);
+
+    // A session setup slot is free, let pending nodes start their setup while this one is interacting
+    ScheduleProcessNodes();
+
+    node.mState      = Node::State::kInteracting;
+    node.mReadClient = Platform::MakeUnique<app::ReadClient>(mEngine, &exchangeMgr, node, mParams.interactionType);
+    if (node.mReadClient == nullptr)
+    {
+        OnAttemptFailed(node, CHIP_ERROR_NO_MEMORY);
+        return;
+    }
+
+    app::ReadPrepareParams readParams(sessionHandle);
+    readParams.mpAttributePathParamsList    = mParams.attributePaths.data();
+    readParams.mAttributePathParamsListSize = mParams.attributePaths.size();
+    readParams.mpEventPathParamsList        = mParams.eventPaths.data();
+    readParams.mEventPathParamsListSize     = mParams.eventPaths.size();
+    readParams.mIsFabricFiltered            = mParams.isFabricFiltered;
+    readParams.mMinIntervalFloorSeconds     = mParams.minIntervalFloorSeconds;
+    readParams.mMaxIntervalCeilingSeconds   = mParams.maxIntervalCeilingSeconds;
+    readParams.mKeepSubscriptions           = true;
+
+    // The path lists are owned by the caller, so OnDeallocatePaths does not need to free them
+    CHIP_ERROR err = (mParams.interactionType == app::ReadClient::InteractionType::Read)
+        ? node.mReadClient->SendRequest(readParams)
+        : node.mReadClient->SendAutoResubscribeRequest(std::move(readParams));
+    if (err != CHIP_NO_ERROR)
+    {
+        OnAttemptFailed(node, err);
+    }
+}
+
+void MultiNodeReadClient::OnAttemptFailed(Node & node, CHIP_ERROR error)
+{
+    if (node.mAttempt >= mParams.maxAttempts)
+    {
+        OnNodeDone(node, error);
+        return;
+    }
+
+    // retryBackoffBase * 2^(attempt-1), without overflowing
+    Milliseconds32 backoff = mParams.retryBackoffBase;
+    for (uint8_t i = 1; i < node.mAttempt && backoff < mParams.retryBackoffMax; i++)
+    {
+        backoff = Milliseconds32(backoff.count() * 2);
+    }
+    backoff = std::min(backoff, mParams.retryBackoffMax);
+
+    ChipLogDetail(Controller, "Multi-node read of " ChipLogFormatX64 " failed: %" CHIP_ERROR_FORMAT ", retrying in %u ms",
+                  ChipLogValueX64(node.mNodeId), error.Format(), static_cast<unsigned>(backoff.count()));
+
+    mStatistics.retries++;
+    node.mState    = Node::State::kBackingOff;
+    CHIP_ERROR err = GetSystemLayer().StartTimer(backoff, Node::OnBackoffTimer, &node);
+    if (err != CHIP_NO_ERROR)
+    {
+        OnNodeDone(node, err);
+    }
+}
+
+void MultiNodeReadClient::OnNodeDone(Node & node, CHIP_ERROR error)
+{
+    if (error == CHIP_NO_ERROR)
+    {
+        mStatistics.nodesSucceeded++;
+    }
+    else
+    {
+        mStatistics.nodesFailed++;
+        ChipLogError(Controller, "Multi-node read of " ChipLogFormatX64 " failed: %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(node.mNodeId), error.Format());
+    }
+
+    // Established subscriptions stay alive, everything else is released from the event loop,
+    // since the node may be called back from within its ReadClient or session setup.
+    mActiveCount--;
+    if (node.mState != Node::State::kSubscribed)
+    {
+        node.mState = Node::State::kDone;
+    }
+    mCallback->OnNodeDone(node.mNodeId, error);
+    ScheduleProcessNodes();
+}
+
+void MultiNodeReadClient::ReleaseNode(Node & node)
+{
+    mNodeList.Remove(&node);
+    Platform::Delete(&node);
+}
+
+void MultiNodeReadClient::Node::OnConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                            const SessionHandle & sessionHandle)
+{
+    Node * node = static_cast<Node *>(context);
+    node->mOwner.OnConnected(*node, exchangeMgr, sessionHandle);
+}
+
+void MultiNodeReadClient::Node::OnConnectionFailure(void * context, const ScopedNodeId & peerId, CHIP_ERROR error)
+{
+    Node * node = static_cast<Node *>(context);
+    node->mOwner.mConnectingCount--;
+    node->mOwner.mStatistics.sessionSetupTime += ElapsedSince(node->mConnectStarted);
+    node->mOwner.OnAttemptFailed(*node, error);
+
+    // A session setup slot is free
+    node->mOwner.ScheduleProcessNodes();
+}
+
+void MultiNodeReadClient::Node::OnBackoffTimer(System::Layer * systemLayer, void * context)
+{
+    Node * node  = static_cast<Node *>(context);
+    node->mState = State::kPending;
+    node->mOwner.ProcessNodes();
+}
+
+void MultiNodeReadClient::Node::OnAttributeData(const app::ConcreteDataAttributePath & path, TLV::TLVReader * data,
+                                                const app::StatusIB & status)
+{
+    mOwner.mStatistics.attributeReports++;
+    mOwner.mCallback->OnAttributeData(mNodeId, path, data, status);
+}
+
+void MultiNodeReadClient::Node::OnEventData(const app::EventHeader & eventHeader, TLV::TLVReader * data,
+                                            const app::StatusIB * status)
+{
+    mOwner.mStatistics.eventReports++;
+    mOwner.mCallback->OnEventData(mNodeId, eventHeader, data, status);
+}
+
+void MultiNodeReadClient::Node::OnSubscriptionEstablished(SubscriptionId subscriptionId)
+{
+    // Also called on every resubscription
+    VerifyOrReturn(mState == State::kInteracting);
+
+    mState = State::kSubscribed;
+    mOwner.OnNodeDone(*this, CHIP_NO_ERROR);
+}
+
+CHIP_ERROR MultiNodeReadClient::Node::OnResubscriptionNeeded(app::ReadClient * readClient, CHIP_ERROR terminationCause)
+{
+    // Until the subscription is first established, failures are retried like reads
+    VerifyOrReturnError(mState == State::kSubscribed, terminationCause);
+    return app::ReadClient::Callback::OnResubscriptionNeeded(readClient, terminationCause);
+}
+
+void MultiNodeReadClient::Node::OnError(CHIP_ERROR error)
+{
+    mLastError = error;
+}
+
+void MultiNodeReadClient::Node::OnDone(app::ReadClient * readClient)
+{
+    if (mState == State::kSubscribed)
+    {
+        mState = State::kDone;
+        mOwner.mCallback->OnSubscriptionTerminated(mNodeId, mLastError);
+        mOwner.ScheduleProcessNodes();
+        return;
+    }
+
+    VerifyOrReturn(mState == State::kInteracting);
+
+    if (mLastError == CHIP_NO_ERROR && mOwner.mParams.interactionType == app::ReadClient::InteractionType::Read)
+    {
+        mOwner.OnNodeDone(*this, CHIP_NO_ERROR);
+        return;
+    }
+
+    // A subscription that completes without being established failed
+    mOwner.OnAttemptFailed(*this, mLastError == CHIP_NO_ERROR ? CHIP_ERROR_INCORRECT_STATE : mLastError);
+}
+
+} // namespace Controller
+} // namespace chip
+#endif // CHIP_CONFIG_ENABLE_READ_CLIENT
@@ -0,0 +1,244 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Declaration of MultiNodeReadClient, which reads or subscribes to the
+ *      same paths on many nodes with bounded concurrency.
+ */
+
+#pragma once
+
+#include <app/AppConfig.h>
+#include <app/AttributePathParams.h>
+#include <app/EventPathParams.h>
+#include <app/InteractionModelEngine.h>
+#include <app/OperationalSessionSetup.h>
+#include <app/ReadClient.h>
+#include <lib/core/CHIPCallback.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/NodeId.h>
+#include <lib/core/ScopedNodeId.h>
+#include <lib/support/IntrusiveList.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#if CHIP_CONFIG_ENABLE_READ_CLIENT
+namespace chip {
+namespace Controller {
+
+/**
+ * Reads or subscribes to the same attribute and event paths on a set of nodes.
+ *
+ * Nodes are processed in order. The number of CASE sessions being set up and the
+ * number of interactions in flight are bounded, so that bursts over large node
+ * sets do not exhaust the OperationalSessionSetup pool or the exchange and
+ * packet buffer pools. Failed session setups and interactions are retried with
+ * exponential backoff. Reports of every node are streamed to a single callback
+ * as they arrive.
+ *
+ * For subscriptions, a node is done once its subscription is established. The
+ * subscription then stays active, and resubscribes using the default
+ * ReadClient policy, until Shutdown() is called or the MultiNodeReadClient is
+ * destroyed.
+ */
+class MultiNodeReadClient
+{
+public:
+    class Callback
+    {
+    public:
+        virtual ~Callback() = default;
+
+        virtual void OnAttributeData(NodeId nodeId, const app::ConcreteDataAttributePath & path, TLV::TLVReader * data,
+                                     const app::StatusIB & status)
+        {}
+
+        virtual void OnEventData(NodeId nodeId, const app::EventHeader & eventHeader, TLV::TLVReader * data,
+                                 const app::StatusIB * status)
+        {}
+
+        /**
+         * Called once per node, when its read completed or its subscription was established,
+         * or with the last error once every attempt failed.
+         *
+         * Data from failed attempts may already have been reported for the node.
+         */
+        virtual void OnNodeDone(NodeId nodeId, CHIP_ERROR error) {}
+
+        /**
+         * Called when an established subscription ended, because resubscribing was given up on.
+         */
+        virtual void OnSubscriptionTerminated(NodeId nodeId, CHIP_ERROR error) {}
+
+        /**
+         * Called once OnNodeDone was called for every node.
+         */
+        virtual void OnDone() = 0;
+    };
+
+    struct Parameters
+    {
+        /// Paths requested from every node. The lists are not copied and must remain valid
+        /// until OnDone, or until Shutdown() for subscriptions.
+        Span<app::AttributePathParams> attributePaths;
+        Span<app::EventPathParams> eventPaths;
+
+        app::ReadClient::InteractionType interactionType = app::ReadClient::InteractionType::Read;
+        bool isFabricFiltered                            = true;
+        uint16_t minIntervalFloorSeconds                 = 0;
+        uint16_t maxIntervalCeilingSeconds               = 0;
+
+        /// Maximum number of CASE sessions being looked up or established at the same time
+        size_t maxConcurrentSessionSetups = 4;
+
+        /// Maximum number of nodes in progress at the same time, including the ones
+        /// setting up a session or waiting to retry
+        size_t maxConcurrentInteractions = 16;
+
+        /// Number of attempts per node, including the first one
+        uint8_t maxAttempts = 3;
+
+        /// The delay before the n-th retry of a node is retryBackoffBase * 2^(n-1), up to retryBackoffMax
+        System::Clock::Milliseconds32 retryBackoffBase{ 1000 };
+        System::Clock::Milliseconds32 retryBackoffMax{ 30000 };
+    };
+
+    struct Statistics
+    {
+        uint32_t nodesSucceeded   = 0;
+        uint32_t nodesFailed      = 0;
+        uint32_t retries          = 0;
+        uint32_t sessionSetups    = 0;
+        uint32_t attributeReports = 0;
+        uint32_t eventReports     = 0;
+        size_t peakSessionSetups  = 0;
+        size_t peakInteractions   = 0;
+        System::Clock::Milliseconds64 sessionSetupTime{ 0 }; ///< Summed over every session setup
+        System::Clock::Milliseconds64 elapsed{ 0 };          ///< From Start() to OnDone
+    };
+
+    MultiNodeReadClient(app::InteractionModelEngine * engine = app::InteractionModelEngine::GetInstance()) : mEngine(engine) {}
+    virtual ~MultiNodeReadClient() { Shutdown(); }
+
+    MultiNodeReadClient(const MultiNodeReadClient &)             = delete;
+    MultiNodeReadClient & operator=(const MultiNodeReadClient &) = delete;
+
+    /**
+     * Start reading from or subscribing to the given nodes of a fabric.
+     *
+     * The node list is not copied and must remain valid until OnDone.
+     * Returns CHIP_ERROR_INCORRECT_STATE if nodes are still in progress.
+     */
+    CHIP_ERROR Start(FabricIndex fabricIndex, Span<const NodeId> nodes, const Parameters & params, Callback * callback);
+
+    /**
+     * Abort every interaction in progress and tear down established subscriptions.
+     * No more callbacks are called.
+     */
+    void Shutdown();
+
+    bool IsRunning() const { return mCallback != nullptr && !mDoneNotified; }
+
+    const Statistics & GetStatistics() const { return mStatistics; }
+    void LogStatistics() const;
+
+protected:
+    /**
+     * Finds or establishes a CASE session with a node. Exactly one of the callbacks
+     * is called, possibly before this returns.
+     */
+    virtual void FindOrEstablishSession(const ScopedNodeId & peerId, chip::Callback::Callback<OnDeviceConnected> * onConnection,
+                                        chip::Callback::Callback<OnDeviceConnectionFailure> * onFailure);
+
+private:
+    class Node : public app::ReadClient::Callback, public IntrusiveListNodeBase<>
+    {
+    public:
+        Node(MultiNodeReadClient & owner, NodeId nodeId);
+
+        // ReadClient::Callback
+        void OnAttributeData(const app::ConcreteDataAttributePath & path, TLV::TLVReader * data,
+                             const app::StatusIB & status) override;
+        void OnEventData(const app::EventHeader & eventHeader, TLV::TLVReader * data, const app::StatusIB * status) override;
+        void OnSubscriptionEstablished(SubscriptionId subscriptionId) override;
+        CHIP_ERROR OnResubscriptionNeeded(app::ReadClient * readClient, CHIP_ERROR terminationCause) override;
+        void OnError(CHIP_ERROR error) override;
+        void OnDone(app::ReadClient * readClient) override;
+
+    private:
+        friend class MultiNodeReadClient;
+
+        enum class State : uint8_t
+        {
+            kPending,     ///< Waiting for a session setup slot
+            kConnecting,  ///< Session lookup or establishment in progress
+            kInteracting, ///< Read or subscribe request in progress
+            kBackingOff,  ///< Waiting for the retry timer
+            kSubscribed,  ///< Subscription established, the node is done
+            kDone,        ///< Released on the next ProcessNodes()
+        };
+
+        static void OnConnected(void * context, Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle);
+        static void OnConnectionFailure(void * context, const ScopedNodeId & peerId, CHIP_ERROR error);
+        static void OnBackoffTimer(System::Layer * systemLayer, void * context);
+
+        MultiNodeReadClient & mOwner;
+        const NodeId mNodeId;
+        State mState          = State::kPending;
+        uint8_t mAttempt      = 0;
+        CHIP_ERROR mLastError = CHIP_NO_ERROR;
+        System::Clock::Timestamp mConnectStarted;
+        Platform::UniquePtr<app::ReadClient> mReadClient;
+        chip::Callback::Callback<OnDeviceConnected> mOnConnected;
+        chip::Callback::Callback<OnDeviceConnectionFailure> mOnConnectionFailure;
+    };
+
+    static void ProcessNodes(System::Layer * systemLayer, void * context);
+
+    System::Layer & GetSystemLayer() const;
+    void ScheduleProcessNodes();
+    void ProcessNodes();
+    void Connect(Node & node);
+    void OnConnected(Node & node, Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle);
+    void OnAttemptFailed(Node & node, CHIP_ERROR error);
+    void OnNodeDone(Node & node, CHIP_ERROR error);
+    void ReleaseNode(Node & node);
+
+    app::InteractionModelEngine * const mEngine;
+    Callback * mCallback = nullptr;
+    Parameters mParams;
+    FabricIndex mFabricIndex = kUndefinedFabricIndex;
+    Span<const NodeId> mNodes;
+    size_t mNextNode        = 0;
+    size_t mActiveCount     = 0; ///< Nodes not done yet
+    size_t mConnectingCount = 0;
+    bool mDoneNotified      = false;
+    System::Clock::Timestamp mStarted;
+
+    IntrusiveList<Node> mNodeList;
+    Statistics mStatistics;
+};
+
+} // namespace Controller
+} // namespace chip
+#endif // CHIP_CONFIG_ENABLE_READ_CLIENT
@@ -0,0 +1,338 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/tests/AppTestContext.h>
+#include <controller/BatchCommissioner.h>
+#include <controller/CHIPDeviceController.h>
+#include <lib/core/StringBuilderAdapters.h>
+
+#include <vector>
+
+using namespace chip;
+using namespace chip::Controller;
+
+namespace {
+
+constexpr size_t kMaxCommissioners = 3;
+constexpr char kSetUpCode[]        = "34970112332";
+
+class TestBatchCommissionerImpl : public BatchCommissioner<kMaxCommissioners>
+{
+public:
+    struct Pairing
+    {
+        DeviceCommissioner * commissioner;
+        NodeId nodeId;
+    };
+
+    std::vector<Pairing> mPairings;
+    CHIP_ERROR mStartPairingError = CHIP_NO_ERROR;
+
+protected:
+    CHIP_ERROR StartPairing(DeviceCommissioner & commissioner, const BatchCommissionee & commissionee) override
+    {
+        mPairings.push_back({ &commissioner, commissionee.nodeId });
+        return mStartPairingError;
+    }
+};
+
+class TestAutoCommissioner : public BatchAutoCommissioner
+{
+public:
+    explicit TestAutoCommissioner(BatchCommissionerBase & batch) : BatchAutoCommissioner(batch) {}
+
+    using BatchAutoCommissioner::PerformStep;
+
+    std::vector<CommissioningStage> mSteps;
+
+protected:
+    CHIP_ERROR RunStep(CommissioningStage stage) override
+    {
+        mSteps.push_back(stage);
+        return CHIP_NO_ERROR;
+    }
+};
+
+class TestBatchDelegate : public BatchCommissioningDelegate
+{
+public:
+    void OnCommissioneeComplete(const BatchCommissionee & commissionee) override { mCompleted.push_back(commissionee.nodeId); }
+    void OnBatchCommissioningComplete() override { mBatchComplete = true; }
+
+    std::vector<NodeId> mCompleted;
+    bool mBatchComplete = false;
+};
+
+class TestBatchCommissioner : public chip::Test::AppContext
+{
+protected:
+    void StartBatch(size_t commissionerCount, size_t commissioneeCount, size_t maxConcurrentPASE = 0,
+                    Span<const CommissioningStageLimit> stageLimits = Span<const CommissioningStageLimit>())
+    {
+        for (size_t i = 0; i < commissionerCount; i++)
+        {
+            mCommissionerPtrs[i] = &mCommissioners[i];
+        }
+        for (size_t i = 0; i < commissioneeCount; i++)
+        {
+            mCommissionees[i].nodeId    = 100 + i;
+            mCommissionees[i].setUpCode = kSetUpCode;
+        }
+
+        BatchCommissioningParameters params;
+        params.maxConcurrentPASE = maxConcurrentPASE;
+        params.stageLimits       = stageLimits;
+
+        ASSERT_EQ(mBatch.Start(&GetSystemLayer(), Span<DeviceCommissioner *>(mCommissionerPtrs, commissionerCount),
+                               Span<BatchCommissionee>(mCommissionees, commissioneeCount), params, &mDelegate),
+                  CHIP_NO_ERROR);
+        DrainAndServiceIO();
+    }
+
+    // Runs the commissioning flow of the device paired by the given pairing
+    void CompleteCommissioning(size_t pairing, CHIP_ERROR error = CHIP_NO_ERROR)
+    {
+        DevicePairingDelegate * pairingDelegate = mBatch.mPairings[pairing].commissioner->GetPairingDelegate();
+        PeerId peerId(0, mBatch.mPairings[pairing].nodeId);
+
+        pairingDelegate->OnPairingComplete(CHIP_NO_ERROR);
+        pairingDelegate->OnCommissioningStatusUpdate(peerId, CommissioningStage::kArmFailsafe, CHIP_NO_ERROR);
+        if (error == CHIP_NO_ERROR)
+        {
+            pairingDelegate->OnCommissioningStatusUpdate(peerId, CommissioningStage::kSendComplete, CHIP_NO_ERROR);
+            pairingDelegate->OnCommissioningSuccess(peerId);
+        }
+        else
+        {
+            pairingDelegate->OnCommissioningStatusUpdate(peerId, CommissioningStage::kSendNOC, error);
+            pairingDelegate->OnCommissioningFailure(peerId, error, CommissioningStage::kSendNOC, NullOptional);
+        }
+        DrainAndServiceIO();
+    }
+
+    DeviceCommissioner mCommissioners[kMaxCommissioners];
+    DeviceCommissioner * mCommissionerPtrs[kMaxCommissioners];
+    BatchCommissionee mCommissionees[8];
+    TestBatchCommissionerImpl mBatch;
+    TestBatchDelegate mDelegate;
+};
+
+TEST_F(TestBatchCommissioner, TestCommissionsAllDevices)
+{
+    StartBatch(2, 5);
+
+    // One device per commissioner at a time
+    ASSERT_EQ(mBatch.mPairings.size(), 2u);
+    EXPECT_NE(mBatch.mPairings[0].commissioner, mBatch.mPairings[1].commissioner);
+
+    for (size_t i = 0; i < 5; i++)
+    {
+        ASSERT_GT(mBatch.mPairings.size(), i);
+        CompleteCommissioning(i, (i == 3) ? CHIP_ERROR_TIMEOUT : CHIP_NO_ERROR);
+        EXPECT_EQ(mBatch.mPairings.size(), std::min<size_t>(i + 3, 5));
+    }
+
+    EXPECT_TRUE(mDelegate.mBatchComplete);
+    EXPECT_FALSE(mBatch.IsRunning());
+    EXPECT_EQ(mDelegate.mCompleted.size(), 5u);
+
+    for (size_t i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(mCommissionees[i].result, (i == 3) ? CHIP_ERROR_TIMEOUT : CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(mCommissionees[3].failedStage, CommissioningStage::kSendNOC);
+
+    EXPECT_EQ(mBatch.GetStageLatency(CommissioningStage::kSecurePairing).count, 5u);
+    EXPECT_EQ(mBatch.GetStageLatency(CommissioningStage::kArmFailsafe).count, 5u);
+    EXPECT_EQ(mBatch.GetStageLatency(CommissioningStage::kSendComplete).count, 4u);
+    EXPECT_EQ(mBatch.GetStageLatency(CommissioningStage::kSendNOC).count, 1u);
+    EXPECT_EQ(mBatch.GetTotalLatency().count, 5u);
+
+    // Pairing delegates are restored once the batch completes
+    EXPECT_EQ(mCommissioners[0].GetPairingDelegate(), nullptr);
+    EXPECT_EQ(mCommissioners[1].GetPairingDelegate(), nullptr);
+}
+
+TEST_F(TestBatchCommissioner, TestConcurrentPASELimit)
+{
+    StartBatch(3, 3, 1);
+    ASSERT_EQ(mBatch.mPairings.size(), 1u);
+
+    // The next device starts pairing once PASE with the previous one is established
+    mBatch.mPairings[0].commissioner->GetPairingDelegate()->OnPairingComplete(CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    ASSERT_EQ(mBatch.mPairings.size(), 2u);
+
+    mBatch.mPairings[1].commissioner->GetPairingDelegate()->OnPairingComplete(CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    ASSERT_EQ(mBatch.mPairings.size(), 3u);
+
+    // Three devices commissioning at the same time
+    EXPECT_NE(mBatch.mPairings[0].commissioner, mBatch.mPairings[1].commissioner);
+    EXPECT_NE(mBatch.mPairings[1].commissioner, mBatch.mPairings[2].commissioner);
+    EXPECT_NE(mBatch.mPairings[0].commissioner, mBatch.mPairings[2].commissioner);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        CompleteCommissioning(i);
+    }
+    EXPECT_TRUE(mDelegate.mBatchComplete);
+    EXPECT_EQ(mDelegate.mCompleted.size(), 3u);
+}
+
+TEST_F(TestBatchCommissioner, TestPairingFailures)
+{
+    StartBatch(1, 3);
+    ASSERT_EQ(mBatch.mPairings.size(), 1u);
+
+    // PASE failure reported with its error
+    DevicePairingDelegate * pairingDelegate = mCommissioners[0].GetPairingDelegate();
+    pairingDelegate->OnStatusUpdate(DevicePairingDelegate::Status::SecurePairingFailed);
+    pairingDelegate->OnPairingComplete(CHIP_ERROR_INVALID_PASE_PARAMETER);
+    DrainAndServiceIO();
+    EXPECT_EQ(mCommissionees[0].result, CHIP_ERROR_INVALID_PASE_PARAMETER);
+    EXPECT_EQ(mCommissionees[0].failedStage, CommissioningStage::kSecurePairing);
+    ASSERT_EQ(mBatch.mPairings.size(), 2u);
+
+    // PASE failure reported on its own, when discovery times out
+    pairingDelegate->OnStatusUpdate(DevicePairingDelegate::Status::SecurePairingFailed);
+    DrainAndServiceIO();
+    EXPECT_EQ(mCommissionees[1].result, CHIP_ERROR_TIMEOUT);
+    EXPECT_EQ(mCommissionees[1].failedStage, CommissioningStage::kSecurePairing);
+    ASSERT_EQ(mBatch.mPairings.size(), 3u);
+
+    // Nothing left to start, Stop() lets the last device complete
+    mBatch.Stop();
+    DrainAndServiceIO();
+    EXPECT_FALSE(mDelegate.mBatchComplete);
+    CompleteCommissioning(2);
+    EXPECT_TRUE(mDelegate.mBatchComplete);
+    EXPECT_EQ(mCommissionees[2].result, CHIP_NO_ERROR);
+}
+
+TEST_F(TestBatchCommissioner, TestStopAndStartFailure)
+{
+    mBatch.mStartPairingError = CHIP_ERROR_NO_MEMORY;
+    StartBatch(2, 2);
+
+    EXPECT_TRUE(mDelegate.mBatchComplete);
+    EXPECT_EQ(mCommissionees[0].result, CHIP_ERROR_NO_MEMORY);
+    EXPECT_EQ(mCommissionees[1].result, CHIP_ERROR_NO_MEMORY);
+
+    mBatch.mStartPairingError = CHIP_NO_ERROR;
+    mBatch.mPairings.clear();
+    mDelegate = TestBatchDelegate();
+    StartBatch(1, 3);
+    ASSERT_EQ(mBatch.mPairings.size(), 1u);
+
+    // Devices not started yet are cancelled, the one in progress runs to completion
+    mBatch.Stop();
+    EXPECT_EQ(mCommissionees[1].result, CHIP_ERROR_CANCELLED);
+    EXPECT_EQ(mCommissionees[2].result, CHIP_ERROR_CANCELLED);
+    EXPECT_FALSE(mDelegate.mBatchComplete);
+
+    CompleteCommissioning(0);
+    EXPECT_TRUE(mDelegate.mBatchComplete);
+    EXPECT_EQ(mCommissionees[0].result, CHIP_NO_ERROR);
+    EXPECT_EQ(mBatch.mPairings.size(), 1u);
+}
+
+TEST_F(TestBatchCommissioner, TestStageLimits)
+{
+    constexpr CommissioningStage kLimitedStage = CommissioningStage::kAttestationVerification;
+    const CommissioningStageLimit limits[]     = { { kLimitedStage, 1 } };
+
+    TestAutoCommissioner first(mBatch);
+    TestAutoCommissioner second(mBatch);
+    TestAutoCommissioner third(mBatch);
+
+    // Outside of a batch, nothing is held back
+    EXPECT_EQ(first.PerformStep(kLimitedStage), CHIP_NO_ERROR);
+    EXPECT_EQ(first.mSteps.size(), 1u);
+    first.mSteps.clear();
+
+    StartBatch(3, 3, 0, Span<const CommissioningStageLimit>(limits));
+
+    EXPECT_EQ(first.PerformStep(kLimitedStage), CHIP_NO_ERROR);
+    EXPECT_EQ(second.PerformStep(kLimitedStage), CHIP_NO_ERROR);
+    EXPECT_EQ(third.PerformStep(kLimitedStage), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    ASSERT_EQ(first.mSteps.size(), 1u);
+    EXPECT_TRUE(second.mSteps.empty());
+    EXPECT_TRUE(third.mSteps.empty());
+
+    // Other stages are not limited
+    EXPECT_EQ(second.PerformStep(CommissioningStage::kSendOpCertSigningRequest), CHIP_NO_ERROR);
+    EXPECT_EQ(second.mSteps.size(), 1u);
+    second.mSteps.clear();
+
+    // A failed step frees its slot too, waiting steps resume in order
+    CommissioningDelegate::CommissioningReport report;
+    report.stageCompleted = kLimitedStage;
+    first.CommissioningStepFinished(CHIP_ERROR_TIMEOUT, report);
+    DrainAndServiceIO();
+    ASSERT_EQ(second.mSteps.size(), 1u);
+    EXPECT_EQ(second.mSteps[0], kLimitedStage);
+    EXPECT_TRUE(third.mSteps.empty());
+    first.mSteps.clear();
+
+    // A step finishing moves on to the next stage and lets the last waiting step run
+    second.CommissioningStepFinished(CHIP_NO_ERROR, report);
+    DrainAndServiceIO();
+    ASSERT_EQ(second.mSteps.size(), 2u);
+    EXPECT_EQ(second.mSteps[1], CommissioningStage::kAttestationRevocationCheck);
+    ASSERT_EQ(third.mSteps.size(), 1u);
+    EXPECT_EQ(third.mSteps[0], kLimitedStage);
+
+    // A newly started step waits behind the one running
+    EXPECT_EQ(first.PerformStep(kLimitedStage), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    EXPECT_TRUE(first.mSteps.empty());
+
+    third.CommissioningStepFinished(CHIP_NO_ERROR, report);
+    DrainAndServiceIO();
+    ASSERT_EQ(first.mSteps.size(), 1u);
+    EXPECT_EQ(first.mSteps[0], kLimitedStage);
+    first.CommissioningStepFinished(CHIP_NO_ERROR, report);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        CompleteCommissioning(i);
+    }
+    EXPECT_TRUE(mDelegate.mBatchComplete);
+}
+
+TEST_F(TestBatchCommissioner, TestInvalidStageLimits)
+{
+    const CommissioningStageLimit limits[] = { { CommissioningStage::kSendTrustedRootCert, 1 } };
+
+    mCommissionerPtrs[0]        = &mCommissioners[0];
+    mCommissionees[0].nodeId    = 100;
+    mCommissionees[0].setUpCode = kSetUpCode;
+
+    BatchCommissioningParameters params;
+    params.stageLimits = Span<const CommissioningStageLimit>(limits);
+    EXPECT_EQ(mBatch.Start(&GetSystemLayer(), Span<DeviceCommissioner *>(mCommissionerPtrs, 1),
+                           Span<BatchCommissionee>(mCommissionees, 1), params, &mDelegate),
+              CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_FALSE(mBatch.IsRunning());
+}
+
+} // namespace
@@ -0,0 +1,302 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app-common/zap-generated/ids/Clusters.h>
+#include <app/AttributeAccessInterface.h>
+#include <app/AttributeAccessInterfaceRegistry.h>
+#include <app/InteractionModelEngine.h>
+#include <app/tests/AppTestContext.h>
+#include <app/util/DataModelHandler.h>
+#include <app/util/attribute-storage.h>
+#include <controller/MultiNodeReadClient.h>
+#include <data-model-providers/codegen/Instance.h>
+#include <lib/core/StringBuilderAdapters.h>
+
+#include <set>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+using namespace chip::Controller;
+
+namespace {
+
+constexpr EndpointId kTestEndpointId = 2;
+constexpr FabricIndex kFabricIndex   = 1;
+constexpr size_t kNodeCount          = 20;
+
+// clang-format off
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(testClusterAttrs)
+DECLARE_DYNAMIC_ATTRIBUTE(0x00000001, INT8U, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE(0x00000002, INT8U, 1, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE_LIST_END();
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(testEndpointClusters)
+DECLARE_DYNAMIC_CLUSTER(UnitTesting::Id, testClusterAttrs, ZAP_CLUSTER_MASK(SERVER), nullptr, nullptr),
+    DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(testEndpoint, testEndpointClusters);
+// clang-format on
+
+class TestAttrAccess : public AttributeAccessInterface
+{
+public:
+    TestAttrAccess() : AttributeAccessInterface(MakeOptional(kTestEndpointId), UnitTesting::Id) {}
+
+    CHIP_ERROR Read(const ConcreteReadAttributePath & aPath, AttributeValueEncoder & aEncoder) override
+    {
+        return aEncoder.Encode(static_cast<uint8_t>(aPath.mAttributeId));
+    }
+};
+
+class TestCallback : public MultiNodeReadClient::Callback
+{
+public:
+    void OnAttributeData(NodeId nodeId, const ConcreteDataAttributePath & path, TLV::TLVReader * data,
+                         const StatusIB & status) override
+    {
+        mAttributeCount++;
+        mNodesWithData.insert(nodeId);
+    }
+
+    void OnNodeDone(NodeId nodeId, CHIP_ERROR error) override
+    {
+        (error == CHIP_NO_ERROR ? mSucceeded : mFailed).push_back(nodeId);
+    }
+
+    void OnDone() override { mDoneCount++; }
+
+    size_t mAttributeCount = 0;
+    std::set<NodeId> mNodesWithData;
+    std::vector<NodeId> mSucceeded;
+    std::vector<NodeId> mFailed;
+    int mDoneCount = 0;
+};
+
+// Connects every node to the loopback peer. Session setups stay pending until completed by the test.
+class TestMultiNodeReadClientImpl : public MultiNodeReadClient
+{
+public:
+    TestMultiNodeReadClientImpl(Test::AppContext & context) : mContext(context) {}
+
+    struct PendingSetup
+    {
+        ScopedNodeId peerId;
+        chip::Callback::Callback<OnDeviceConnected> * onConnection;
+        chip::Callback::Callback<OnDeviceConnectionFailure> * onFailure;
+    };
+
+    void CompletePendingSetups()
+    {
+        std::vector<PendingSetup> pending;
+        pending.swap(mPending);
+        for (auto & setup : pending)
+        {
+            if (mUnreachableNodes.count(setup.peerId.GetNodeId()) > 0)
+            {
+                mUnreachableNodes.erase(mUnreachableNodes.find(setup.peerId.GetNodeId()));
+                setup.onFailure->mCall(setup.onFailure->mContext, setup.peerId, CHIP_ERROR_TIMEOUT);
+            }
+            else
+            {
+                setup.onConnection->mCall(setup.onConnection->mContext, mContext.GetExchangeManager(),
+                                          mContext.GetSessionBobToAlice());
+            }
+        }
+    }
+
+    // Drives the loopback until every node is done, checking the session setup window on the way
+    void RunToCompletion(const TestCallback & callback, size_t maxSessionSetups)
+    {
+        for (int i = 0; i < 100 && callback.mDoneCount == 0; i++)
+        {
+            mContext.DrainAndServiceIO();
+            EXPECT_LE(mPending.size(), maxSessionSetups);
+            CompletePendingSetups();
+            mContext.DrainAndServiceIO();
+        }
+    }
+
+    std::vector<PendingSetup> mPending;
+    std::multiset<NodeId> mUnreachableNodes; ///< One failed setup per occurrence
+    const TestCallback * mTestCallback = nullptr;
+    std::vector<size_t> mNodesDoneAtSetup; ///< Nodes done when each session setup started, if mTestCallback is set
+
+protected:
+    void FindOrEstablishSession(const ScopedNodeId & peerId, chip::Callback::Callback<OnDeviceConnected> * onConnection,
+                                chip::Callback::Callback<OnDeviceConnectionFailure> * onFailure) override
+    {
+        EXPECT_EQ(peerId.GetFabricIndex(), kFabricIndex);
+        mPending.push_back({ peerId, onConnection, onFailure });
+        if (mTestCallback != nullptr)
+        {
+            mNodesDoneAtSetup.push_back(mTestCallback->mSucceeded.size() + mTestCallback->mFailed.size());
+        }
+    }
+
+private:
+    Test::AppContext & mContext;
+};
+
+class TestMultiNodeReadClient : public Test::AppContext
+{
+protected:
+    void SetUp() override
+    {
+        AppContext::SetUp();
+
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(CodegenDataModelProviderInstance(nullptr /* delegate */));
+        InitDataModelHandler();
+        emberAfSetDynamicEndpoint(0, kTestEndpointId, &testEndpoint, Span<DataVersion>(mDataVersionStorage));
+        AttributeAccessInterfaceRegistry::Instance().Register(&mAttrAccess);
+
+        for (size_t i = 0; i < kNodeCount; i++)
+        {
+            mNodes[i] = 0x1000 + i;
+        }
+    }
+
+    void TearDown() override
+    {
+        AttributeAccessInterfaceRegistry::Instance().Unregister(&mAttrAccess);
+        emberAfClearDynamicEndpoint(0);
+        AppContext::TearDown();
+    }
+
+    MultiNodeReadClient::Parameters MakeParameters()
+    {
+        MultiNodeReadClient::Parameters params;
+        params.attributePaths             = Span<AttributePathParams>(&mAttributePath, 1);
+        params.maxConcurrentSessionSetups = 2;
+        params.maxConcurrentInteractions  = 5;
+        params.retryBackoffBase           = System::Clock::Milliseconds32(0);
+        return params;
+    }
+
+    TestAttrAccess mAttrAccess;
+    DataVersion mDataVersionStorage[MATTER_ARRAY_SIZE(testEndpointClusters)];
+    AttributePathParams mAttributePath{ kTestEndpointId, UnitTesting::Id, 0x00000001 };
+    NodeId mNodes[kNodeCount];
+};
+
+TEST_F(TestMultiNodeReadClient, TestReadAllNodes)
+{
+    TestCallback callback;
+    TestMultiNodeReadClientImpl client(*this);
+
+    ASSERT_EQ(client.Start(kFabricIndex, Span<const NodeId>(mNodes), MakeParameters(), &callback), CHIP_NO_ERROR);
+    EXPECT_EQ(client.Start(kFabricIndex, Span<const NodeId>(mNodes), MakeParameters(), &callback), CHIP_ERROR_INCORRECT_STATE);
+    client.RunToCompletion(callback, 2);
+
+    EXPECT_EQ(callback.mDoneCount, 1);
+    EXPECT_FALSE(client.IsRunning());
+    EXPECT_EQ(callback.mSucceeded.size(), kNodeCount);
+    EXPECT_TRUE(callback.mFailed.empty());
+    EXPECT_EQ(callback.mNodesWithData.size(), kNodeCount);
+
+    EXPECT_EQ(callback.mAttributeCount, kNodeCount);
+
+    const auto & statistics = client.GetStatistics();
+    EXPECT_EQ(statistics.nodesSucceeded, kNodeCount);
+    EXPECT_EQ(statistics.sessionSetups, kNodeCount);
+    EXPECT_EQ(statistics.attributeReports, kNodeCount);
+    EXPECT_EQ(statistics.retries, 0u);
+    EXPECT_EQ(statistics.peakSessionSetups, 2u);
+    EXPECT_EQ(statistics.peakInteractions, 5u);
+
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->GetNumActiveReadClients(), 0u);
+}
+
+TEST_F(TestMultiNodeReadClient, TestRetries)
+{
+    TestCallback callback;
+    TestMultiNodeReadClientImpl client(*this);
+
+    // The first node recovers on the second attempt, the second node never does
+    client.mUnreachableNodes.insert(mNodes[0]);
+    for (int i = 0; i < 3; i++)
+    {
+        client.mUnreachableNodes.insert(mNodes[1]);
+    }
+
+    ASSERT_EQ(client.Start(kFabricIndex, Span<const NodeId>(mNodes), MakeParameters(), &callback), CHIP_NO_ERROR);
+    client.RunToCompletion(callback, 2);
+
+    EXPECT_EQ(callback.mDoneCount, 1);
+    EXPECT_EQ(callback.mSucceeded.size(), kNodeCount - 1);
+    ASSERT_EQ(callback.mFailed.size(), 1u);
+    EXPECT_EQ(callback.mFailed[0], mNodes[1]);
+
+    const auto & statistics = client.GetStatistics();
+    EXPECT_EQ(statistics.nodesFailed, 1u);
+    EXPECT_EQ(statistics.retries, 3u);
+    EXPECT_EQ(statistics.sessionSetups, kNodeCount + 3);
+}
+
+TEST_F(TestMultiNodeReadClient, TestSessionSetupsOverlapInteractions)
+{
+    TestCallback callback;
+    TestMultiNodeReadClientImpl client(*this);
+    client.mTestCallback = &callback;
+
+    MultiNodeReadClient::Parameters params = MakeParameters();
+    params.maxConcurrentSessionSetups      = 1;
+    params.maxConcurrentInteractions       = 4;
+
+    ASSERT_EQ(client.Start(kFabricIndex, Span<const NodeId>(mNodes, 4), params, &callback), CHIP_NO_ERROR);
+    client.RunToCompletion(callback, 1);
+
+    EXPECT_EQ(callback.mDoneCount, 1);
+    EXPECT_EQ(callback.mSucceeded.size(), 4u);
+
+    // Each session setup after the first one starts as soon as the previous setup completes, while the
+    // read over that session is still in flight, rather than once the previous node is done
+    ASSERT_EQ(client.mNodesDoneAtSetup.size(), 4u);
+    EXPECT_EQ(client.mNodesDoneAtSetup[0], 0u);
+    for (size_t i = 1; i < client.mNodesDoneAtSetup.size(); i++)
+    {
+        EXPECT_EQ(client.mNodesDoneAtSetup[i], i - 1);
+    }
+}
+
+TEST_F(TestMultiNodeReadClient, TestSubscribe)
+{
+    TestCallback callback;
+    TestMultiNodeReadClientImpl client(*this);
+
+    MultiNodeReadClient::Parameters params = MakeParameters();
+    params.interactionType                 = ReadClient::InteractionType::Subscribe;
+    params.maxIntervalCeilingSeconds       = 60;
+
+    ASSERT_EQ(client.Start(kFabricIndex, Span<const NodeId>(mNodes, 3), params, &callback), CHIP_NO_ERROR);
+    client.RunToCompletion(callback, 2);
+
+    EXPECT_EQ(callback.mDoneCount, 1);
+    EXPECT_EQ(callback.mSucceeded.size(), 3u);
+    EXPECT_EQ(callback.mAttributeCount, 3u);
+
+    // Subscriptions stay up once the batch is done, until shut down
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->GetNumActiveReadClients(), 3u);
+    client.Shutdown();
+    DrainAndServiceIO();
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->GetNumActiveReadClients(), 0u);
+}
+
+} // namespace
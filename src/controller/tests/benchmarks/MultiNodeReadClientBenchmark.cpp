@@ -0,0 +1,234 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Multi-node read client benchmark.
+ *
+ *      Reads an attribute from a few hundred simulated nodes with a
+ *      MultiNodeReadClient. Every node is served by the same in-process server
+ *      over the loopback transport, and session setups complete one
+ *      IO drain after they are started. Prints one MULTI_NODE_READ_BENCHMARK
+ *      line per concurrency setting. See README.md for the output format.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app-common/zap-generated/ids/Clusters.h>
+#include <app/AttributeAccessInterface.h>
+#include <app/AttributeAccessInterfaceRegistry.h>
+#include <app/InteractionModelEngine.h>
+#include <app/tests/AppTestContext.h>
+#include <app/util/DataModelHandler.h>
+#include <app/util/attribute-storage.h>
+#include <controller/MultiNodeReadClient.h>
+#include <data-model-providers/codegen/Instance.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <system/SystemClock.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+using namespace chip::Controller;
+
+namespace {
+
+constexpr EndpointId kBenchmarkEndpointId = 2;
+constexpr FabricIndex kFabricIndex        = 1;
+constexpr NodeId kFirstNodeId             = 0x1000;
+constexpr uint32_t kDefaultNodes          = 500;
+
+// A case that does not complete in this time is reported as failed
+constexpr System::Clock::Seconds16 kCaseTimeout = System::Clock::Seconds16(60);
+
+// clang-format off
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(benchmarkClusterAttrs)
+DECLARE_DYNAMIC_ATTRIBUTE(0x00000001, INT8U, 1, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE_LIST_END();
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(benchmarkEndpointClusters)
+DECLARE_DYNAMIC_CLUSTER(UnitTesting::Id, benchmarkClusterAttrs, ZAP_CLUSTER_MASK(SERVER), nullptr, nullptr),
+    DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(benchmarkEndpoint, benchmarkEndpointClusters);
+// clang-format on
+
+uint32_t GetConfigValue(const char * name, uint32_t defaultValue)
+{
+    const char * value = getenv(name);
+    VerifyOrReturnValue(value != nullptr && *value != '\0', defaultValue);
+    unsigned long parsed = strtoul(value, nullptr, 10);
+    return (parsed > 0 && parsed <= UINT32_MAX) ? static_cast<uint32_t>(parsed) : defaultValue;
+}
+
+uint64_t NowMicroseconds()
+{
+    return System::SystemClock().GetMonotonicMicroseconds64().count();
+}
+
+class BenchmarkAttrAccess : public AttributeAccessInterface
+{
+public:
+    BenchmarkAttrAccess() : AttributeAccessInterface(MakeOptional(kBenchmarkEndpointId), UnitTesting::Id) {}
+
+    CHIP_ERROR Read(const ConcreteReadAttributePath & aPath, AttributeValueEncoder & aEncoder) override
+    {
+        return aEncoder.Encode(static_cast<uint8_t>(aPath.mAttributeId));
+    }
+};
+
+class BenchmarkCallback : public MultiNodeReadClient::Callback
+{
+public:
+    void OnDone() override { mDone = true; }
+
+    bool mDone = false;
+};
+
+// Every node is reached over the loopback session. Session setups are held until the next CompletePendingSetups().
+class BenchmarkMultiNodeReadClient : public MultiNodeReadClient
+{
+public:
+    BenchmarkMultiNodeReadClient(Test::AppContext & context) : mContext(context) {}
+
+    void CompletePendingSetups()
+    {
+        std::vector<chip::Callback::Callback<OnDeviceConnected> *> pending;
+        pending.swap(mPending);
+        for (auto * onConnection : pending)
+        {
+            onConnection->mCall(onConnection->mContext, mContext.GetExchangeManager(), mContext.GetSessionBobToAlice());
+        }
+    }
+
+protected:
+    void FindOrEstablishSession(const ScopedNodeId & peerId, chip::Callback::Callback<OnDeviceConnected> * onConnection,
+                                chip::Callback::Callback<OnDeviceConnectionFailure> * onFailure) override
+    {
+        mPending.push_back(onConnection);
+    }
+
+private:
+    Test::AppContext & mContext;
+    std::vector<chip::Callback::Callback<OnDeviceConnected> *> mPending;
+};
+
+class TestMultiNodeReadClientBenchmark : public Test::AppContext
+{
+public:
+    void SetUp() override
+    {
+        AppContext::SetUp();
+
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(CodegenDataModelProviderInstance(nullptr /* delegate */));
+        InitDataModelHandler();
+        emberAfSetDynamicEndpoint(0, kBenchmarkEndpointId, &benchmarkEndpoint, Span<DataVersion>(mDataVersionStorage));
+        AttributeAccessInterfaceRegistry::Instance().Register(&mAttrAccess);
+    }
+
+    void TearDown() override
+    {
+        AttributeAccessInterfaceRegistry::Instance().Unregister(&mAttrAccess);
+        emberAfClearDynamicEndpoint(0);
+        AppContext::TearDown();
+    }
+
+protected:
+    void RunCase(size_t maxConcurrentSessionSetups, size_t maxConcurrentInteractions);
+
+private:
+    BenchmarkAttrAccess mAttrAccess;
+    DataVersion mDataVersionStorage[MATTER_ARRAY_SIZE(benchmarkEndpointClusters)];
+    AttributePathParams mAttributePath{ kBenchmarkEndpointId, UnitTesting::Id, 0x00000001 };
+};
+
+void TestMultiNodeReadClientBenchmark::RunCase(size_t maxConcurrentSessionSetups, size_t maxConcurrentInteractions)
+{
+    const uint32_t nodeCount = GetConfigValue("CHIP_MULTI_NODE_BENCHMARK_NODES", kDefaultNodes);
+
+    std::vector<NodeId> nodes(nodeCount);
+    for (uint32_t i = 0; i < nodeCount; i++)
+    {
+        nodes[i] = kFirstNodeId + i;
+    }
+
+    MultiNodeReadClient::Parameters params;
+    params.attributePaths             = Span<AttributePathParams>(&mAttributePath, 1);
+    params.maxConcurrentSessionSetups = maxConcurrentSessionSetups;
+    params.maxConcurrentInteractions  = maxConcurrentInteractions;
+    params.retryBackoffBase           = System::Clock::Milliseconds32(0);
+
+    BenchmarkCallback callback;
+    BenchmarkMultiNodeReadClient client(*this);
+
+    const uint64_t start = NowMicroseconds();
+    ASSERT_EQ(client.Start(kFabricIndex, Span<const NodeId>(nodes.data(), nodes.size()), params, &callback), CHIP_NO_ERROR);
+
+    // Each pass delivers the in-flight messages, then completes the session setups started so far
+    while (!callback.mDone)
+    {
+        DrainAndServiceIO();
+        client.CompletePendingSetups();
+
+        ASSERT_LT(NowMicroseconds() - start, static_cast<uint64_t>(System::Clock::Microseconds64(kCaseTimeout).count()))
+            << "Case timed out";
+    }
+
+    const uint64_t durationUs = NowMicroseconds() - start;
+    const auto & statistics   = client.GetStatistics();
+
+    printf("MULTI_NODE_READ_BENCHMARK nodes=%" PRIu32 " max_setups=%u max_interactions=%u succeeded=%" PRIu32 " failed=%" PRIu32
+           " retries=%" PRIu32 " duration_us=%" PRIu64 " nodes_per_sec=%.1f peak_setups=%u peak_interactions=%u\n",
+           nodeCount, static_cast<unsigned>(maxConcurrentSessionSetups), static_cast<unsigned>(maxConcurrentInteractions),
+           statistics.nodesSucceeded, statistics.nodesFailed, statistics.retries, durationUs,
+           durationUs > 0 ? static_cast<double>(nodeCount) * 1e6 / static_cast<double>(durationUs) : 0.0,
+           static_cast<unsigned>(statistics.peakSessionSetups), static_cast<unsigned>(statistics.peakInteractions));
+
+    EXPECT_EQ(statistics.nodesSucceeded, nodeCount);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+// One node at a time, the baseline of the pipelined cases
+TEST_F(TestMultiNodeReadClientBenchmark, Serial)
+{
+    RunCase(1, 1);
+}
+
+// The reads of the previous nodes overlap the session setup of the next one
+TEST_F(TestMultiNodeReadClientBenchmark, PipelinedSingleSetup)
+{
+    RunCase(1, 4);
+}
+
+TEST_F(TestMultiNodeReadClientBenchmark, Default)
+{
+    MultiNodeReadClient::Parameters defaults;
+    RunCase(defaults.maxConcurrentSessionSetups, defaults.maxConcurrentInteractions);
+}
+
+TEST_F(TestMultiNodeReadClientBenchmark, Wide)
+{
+    RunCase(16, 32);
+}
+
+} // namespace
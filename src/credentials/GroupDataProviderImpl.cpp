@@ -17,6 +17,7 @@
 #include <credentials/GroupDataProviderImpl.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/CommonPersistentData.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
@@ -832,6 +833,12 @@ void GroupDataProviderImpl::Finish()
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mGroupKeyContexPool.ReleaseAll();
+
+    for (auto & entry : mEndpointCache)
+    {
+        FreeEndpointCacheEntry(entry);
+        entry.readers = 0;
+    }
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
@@ -895,6 +902,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfo(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index, size_t index, const GroupInfo & info)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateEndpointCache(fabric_index);
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -977,6 +985,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupInfoAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfoAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateEndpointCache(fabric_index);
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1037,6 +1046,7 @@ bool GroupDataProviderImpl::HasEndpoint(chip::FabricIndex fabric_index, chip::Gr
 CHIP_ERROR GroupDataProviderImpl::AddEndpoint(chip::FabricIndex fabric_index, chip::GroupId group_id, chip::EndpointId endpoint_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateEndpointCache(fabric_index);
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1095,6 +1105,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index,
                                                  chip::EndpointId endpoint_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateEndpointCache(fabric_index);
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -1211,9 +1222,26 @@ GroupDataProvider::EndpointIterator * GroupDataProviderImpl::IterateEndpoints(ch
                                                                               std::optional<GroupId> group_id)
 {
     VerifyOrReturnError(IsInitialized(), nullptr);
+
+    if (group_id.has_value())
+    {
+        EndpointCacheEntry * entry = GetCachedEndpoints(fabric_index, *group_id);
+        if (entry != nullptr)
+        {
+            return mEndpointIterators.CreateObject(*this, *entry);
+        }
+    }
+
     return mEndpointIterators.CreateObject(*this, fabric_index, group_id);
 }
 
+GroupDataProviderImpl::EndpointIteratorImpl::EndpointIteratorImpl(GroupDataProviderImpl & provider, EndpointCacheEntry & entry) :
+    mProvider(provider), mFabric(entry.fabric_index), mFirstGroup(entry.group_id), mGroup(entry.group_id), mGroupCount(1),
+    mEndpointCount(entry.endpoint_count), mCacheEntry(&entry)
+{
+    entry.readers++;
+}
+
 GroupDataProviderImpl::EndpointIteratorImpl::EndpointIteratorImpl(GroupDataProviderImpl & provider, chip::FabricIndex fabric_index,
                                                                   std::optional<GroupId> group_id) :
     mProvider(provider),
@@ -1248,6 +1276,11 @@ GroupDataProviderImpl::EndpointIteratorImpl::EndpointIteratorImpl(GroupDataProvi
 
 size_t GroupDataProviderImpl::EndpointIteratorImpl::Count()
 {
+    if (mCacheEntry != nullptr)
+    {
+        return mEndpointCount;
+    }
+
     GroupData group(mFabric, mFirstGroup);
     size_t group_index    = 0;
     size_t endpoint_index = 0;
@@ -1277,6 +1310,14 @@ size_t GroupDataProviderImpl::EndpointIteratorImpl::Count()
 
 bool GroupDataProviderImpl::EndpointIteratorImpl::Next(GroupEndpoint & output)
 {
+    if (mCacheEntry != nullptr)
+    {
+        VerifyOrReturnValue(mEndpointIndex < mEndpointCount, false);
+        output.group_id    = mGroup;
+        output.endpoint_id = mCacheEntry->endpoints[mEndpointIndex++];
+        return true;
+    }
+
     while (mGroupIndex < mGroupCount)
     {
         GroupData group(mFabric, mGroup);
@@ -1313,12 +1354,107 @@ bool GroupDataProviderImpl::EndpointIteratorImpl::Next(GroupEndpoint & output)
 
 void GroupDataProviderImpl::EndpointIteratorImpl::Release()
 {
+    if (mCacheEntry != nullptr)
+    {
+        mProvider.ReleaseEndpointCacheEntry(*mCacheEntry);
+    }
     mProvider.mEndpointIterators.ReleaseObject(this);
 }
 
+GroupDataProviderImpl::EndpointCacheEntry * GroupDataProviderImpl::GetCachedEndpoints(chip::FabricIndex fabric_index,
+                                                                                      chip::GroupId group_id)
+{
+    EndpointCacheEntry * victim = nullptr;
+
+    VerifyOrReturnValue(kEndpointCacheEntries > 0, nullptr);
+
+    for (auto & entry : mEndpointCache)
+    {
+        if (entry.valid && entry.fabric_index == fabric_index && entry.group_id == group_id)
+        {
+            entry.last_used = ++mEndpointCacheClock;
+            return &entry;
+        }
+
+        // Prefer unused slots, otherwise replace the least recently used list that no iterator is reading
+        if (entry.readers == 0 && (victim == nullptr || (victim->valid && (!entry.valid || entry.last_used < victim->last_used))))
+        {
+            victim = &entry;
+        }
+    }
+    VerifyOrReturnValue(victim != nullptr, nullptr);
+
+    FabricData fabric(fabric_index);
+    VerifyOrReturnValue(CHIP_NO_ERROR == fabric.Load(mStorage), nullptr);
+
+    GroupData group(fabric_index, group_id);
+    VerifyOrReturnValue(CHIP_NO_ERROR == group.Load(mStorage), nullptr);
+
+    FreeEndpointCacheEntry(*victim);
+    if (group.endpoint_count > 0)
+    {
+        victim->endpoints = static_cast<EndpointId *>(Platform::MemoryCalloc(group.endpoint_count, sizeof(EndpointId)));
+        VerifyOrReturnValue(victim->endpoints != nullptr, nullptr);
+    }
+
+    EndpointData endpoint(fabric_index, group_id, group.first_endpoint);
+    for (uint16_t i = 0; i < group.endpoint_count; i++)
+    {
+        if (CHIP_NO_ERROR != endpoint.Load(mStorage))
+        {
+            // Let the storage iterator deal with inconsistent data
+            FreeEndpointCacheEntry(*victim);
+            return nullptr;
+        }
+        victim->endpoints[i] = endpoint.endpoint_id;
+        endpoint.endpoint_id = endpoint.next;
+    }
+
+    victim->fabric_index   = fabric_index;
+    victim->group_id       = group_id;
+    victim->endpoint_count = group.endpoint_count;
+    victim->last_used      = ++mEndpointCacheClock;
+    victim->valid          = true;
+    return victim;
+}
+
+void GroupDataProviderImpl::InvalidateEndpointCache(chip::FabricIndex fabric_index)
+{
+    for (auto & entry : mEndpointCache)
+    {
+        if (entry.valid && entry.fabric_index == fabric_index)
+        {
+            entry.valid = false;
+            if (entry.readers == 0)
+            {
+                FreeEndpointCacheEntry(entry);
+            }
+        }
+    }
+}
+
+void GroupDataProviderImpl::ReleaseEndpointCacheEntry(EndpointCacheEntry & entry)
+{
+    VerifyOrReturn(entry.readers > 0);
+    entry.readers--;
+    if (!entry.valid && entry.readers == 0)
+    {
+        FreeEndpointCacheEntry(entry);
+    }
+}
+
+void GroupDataProviderImpl::FreeEndpointCacheEntry(EndpointCacheEntry & entry)
+{
+    Platform::MemoryFree(entry.endpoints);
+    entry.endpoints      = nullptr;
+    entry.endpoint_count = 0;
+    entry.valid          = false;
+}
+
 CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index, chip::GroupId group_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateEndpointCache(fabric_index);
 
     FabricData fabric(fabric_index);
     GroupData group;
@@ -27,7 +27,8 @@ namespace Credentials {
 class GroupDataProviderImpl : public GroupDataProvider
 {
 public:
-    static constexpr size_t kIteratorsMax = CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS;
+    static constexpr size_t kIteratorsMax         = CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS;
+    static constexpr size_t kEndpointCacheEntries = CHIP_CONFIG_GROUP_ENDPOINT_CACHE_SIZE;
 
     GroupDataProviderImpl() = default;
     GroupDataProviderImpl(uint16_t maxGroupsPerFabric, uint16_t maxGroupKeysPerFabric) :
@@ -130,10 +131,24 @@ protected:
         size_t mTotal       = 0;
     };
 
+    // Endpoint list of a group, copied from storage. `readers` counts the iterators currently
+    // reading `endpoints`: an invalidated entry is only freed once it has no readers left.
+    struct EndpointCacheEntry
+    {
+        FabricIndex fabric_index = kUndefinedFabricIndex;
+        GroupId group_id         = kUndefinedGroupId;
+        EndpointId * endpoints   = nullptr;
+        uint16_t endpoint_count  = 0;
+        uint16_t readers         = 0;
+        uint32_t last_used       = 0;
+        bool valid               = false;
+    };
+
     class EndpointIteratorImpl : public EndpointIterator
     {
     public:
         EndpointIteratorImpl(GroupDataProviderImpl & provider, FabricIndex fabric_index, std::optional<GroupId> group_id);
+        EndpointIteratorImpl(GroupDataProviderImpl & provider, EndpointCacheEntry & entry);
         size_t Count() override;
         bool Next(GroupEndpoint & output) override;
         void Release() override;
@@ -149,6 +164,9 @@ protected:
         size_t mEndpointIndex = 0;
         size_t mEndpointCount = 0;
         bool mFirstEndpoint   = true;
+
+        // When set, endpoints are read from this cached list instead of storage.
+        EndpointCacheEntry * mCacheEntry = nullptr;
     };
 
     class GroupKeyContext : public Crypto::SymmetricKeyContext
@@ -246,6 +264,11 @@ protected:
     bool IsInitialized() { return (mStorage != nullptr); }
     CHIP_ERROR RemoveEndpoints(FabricIndex fabric_index, GroupId group_id);
 
+    EndpointCacheEntry * GetCachedEndpoints(FabricIndex fabric_index, GroupId group_id);
+    void InvalidateEndpointCache(FabricIndex fabric_index);
+    void ReleaseEndpointCacheEntry(EndpointCacheEntry & entry);
+    static void FreeEndpointCacheEntry(EndpointCacheEntry & entry);
+
     PersistentStorageDelegate * mStorage       = nullptr;
     Crypto::SessionKeystore * mSessionKeystore = nullptr;
     ObjectPool<GroupInfoIteratorImpl, kIteratorsMax> mGroupInfoIterators;
@@ -254,6 +277,8 @@ protected:
     ObjectPool<KeySetIteratorImpl, kIteratorsMax> mKeySetIterators;
     ObjectPool<GroupSessionIteratorImpl, kIteratorsMax> mGroupSessionsIterator;
     ObjectPool<GroupKeyContext, kIteratorsMax> mGroupKeyContexPool;
+    EndpointCacheEntry mEndpointCache[kEndpointCacheEntries > 0 ? kEndpointCacheEntries : 1];
+    uint32_t mEndpointCacheClock = 0;
 };
 
 } // namespace Credentials
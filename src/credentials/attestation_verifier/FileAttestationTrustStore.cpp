@@ -17,6 +17,8 @@
 #include "FileAttestationTrustStore.h"
 
 #include <crypto/CHIPCryptoPAL.h>
+
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <string>
@@ -46,13 +48,50 @@ FileAttestationTrustStore::FileAttestationTrustStore(const char * paaTrustStoreP
 
     if (paaTrustStorePath != nullptr)
     {
-        mPAADerCerts = LoadAllX509DerCerts(paaTrustStorePath);
+        mPAATrustStorePath = paaTrustStorePath;
+        mPAADerCerts       = LoadAllX509DerCerts(paaTrustStorePath);
         VerifyOrReturn(paaCount());
     }
 
+    BuildSkidIndex();
     mIsInitialized = true;
 }
 
+CHIP_ERROR FileAttestationTrustStore::Reload()
+{
+    VerifyOrReturnError(!mPAATrustStorePath.empty(), CHIP_ERROR_INCORRECT_STATE);
+
+    std::vector<std::vector<uint8_t>> certs = LoadAllX509DerCerts(mPAATrustStorePath.c_str());
+    VerifyOrReturnError(!certs.empty(), CHIP_ERROR_NOT_FOUND);
+
+    mPAADerCerts = std::move(certs);
+    BuildSkidIndex();
+    mIsInitialized = true;
+
+    return CHIP_NO_ERROR;
+}
+
+void FileAttestationTrustStore::BuildSkidIndex()
+{
+    mPAASkidIndex.clear();
+    mPAASkidIndex.reserve(mPAADerCerts.size());
+
+    for (size_t i = 0; i < mPAADerCerts.size(); i++)
+    {
+        const ByteSpan certSpan{ mPAADerCerts[i].data(), mPAADerCerts[i].size() };
+        SubjectKeyIdentifier skid;
+        MutableByteSpan skidSpan{ skid };
+        if (CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(certSpan, skidSpan) || skidSpan.size() != skid.size())
+        {
+            continue;
+        }
+        mPAASkidIndex.emplace_back(skid, i);
+    }
+
+    // Stable, so that the first loaded certificate wins if several share a SKID.
+    std::stable_sort(mPAASkidIndex.begin(), mPAASkidIndex.end(), [](const auto & a, const auto & b) { return a.first < b.first; });
+}
+
 std::vector<std::vector<uint8_t>> LoadAllX509DerCerts(const char * trustStorePath, CertificateValidationMode validationMode)
 {
     std::vector<std::vector<uint8_t>> certs;
@@ -141,6 +180,7 @@ FileAttestationTrustStore::~FileAttestationTrustStore()
 void FileAttestationTrustStore::Cleanup()
 {
     mPAADerCerts.clear();
+    mPAASkidIndex.clear();
     mIsInitialized = false;
 }
 
@@ -158,23 +198,15 @@ CHIP_ERROR FileAttestationTrustStore::GetProductAttestationAuthorityCert(const B
     VerifyOrReturnError(!skid.empty() && (skid.data() != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(skid.size() == Crypto::kSubjectKeyIdentifierLength, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto candidate : mPAADerCerts)
-    {
-        uint8_t skidBuf[Crypto::kSubjectKeyIdentifierLength] = { 0 };
-        MutableByteSpan candidateSkidSpan{ skidBuf };
-        if (CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(ByteSpan{ candidate.data(), candidate.size() }, candidateSkidSpan))
-        {
-            continue;
-        }
+    SubjectKeyIdentifier key;
+    std::copy(skid.begin(), skid.end(), key.begin());
 
-        if (skid.data_equal(candidateSkidSpan))
-        {
-            // Found a match
-            return CopySpanToMutableSpan(ByteSpan{ candidate.data(), candidate.size() }, outPaaDerBuffer);
-        }
-    }
+    auto match = std::lower_bound(mPAASkidIndex.begin(), mPAASkidIndex.end(), key,
+                                  [](const auto & entry, const SubjectKeyIdentifier & value) { return entry.first < value; });
+    VerifyOrReturnError(match != mPAASkidIndex.end() && match->first == key, CHIP_ERROR_CA_CERT_NOT_FOUND);
 
-    return CHIP_ERROR_CA_CERT_NOT_FOUND;
+    const std::vector<uint8_t> & candidate = mPAADerCerts[match->second];
+    return CopySpanToMutableSpan(ByteSpan{ candidate.data(), candidate.size() }, outPaaDerBuffer);
 }
 
 } // namespace Credentials
@@ -20,6 +20,8 @@
 #include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
 
 #include <array>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace chip {
@@ -57,6 +59,19 @@ public:
 
     CHIP_ERROR GetProductAttestationAuthorityCert(const ByteSpan & skid, MutableByteSpan & outPaaDerBuffer) const override;
 
+    /**
+     * @brief Re-scan the PAA trust store path given at construction, e.g. after its content changed.
+     *
+     * The new certificates are fully loaded and indexed before replacing the current ones. If the
+     * path does not contain any valid PAA, the current certificates are kept.
+     *
+     * Must be called from the same context as GetProductAttestationAuthorityCert.
+     *
+     * @retval CHIP_ERROR_INCORRECT_STATE if the store was constructed without a path.
+     * @retval CHIP_ERROR_NOT_FOUND if no valid PAA was found.
+     */
+    CHIP_ERROR Reload();
+
     bool IsInitialized() const { return mIsInitialized; }
     size_t paaCount() const { return mPAADerCerts.size(); };
 
@@ -64,8 +79,14 @@ protected:
     std::vector<std::vector<uint8_t>> mPAADerCerts;
 
 private:
+    using SubjectKeyIdentifier = std::array<uint8_t, Crypto::kSubjectKeyIdentifierLength>;
+
+    // SKID of each entry of mPAADerCerts (by index), sorted by SKID so lookups do not need to parse certificates.
+    std::vector<std::pair<SubjectKeyIdentifier, size_t>> mPAASkidIndex;
+    std::string mPAATrustStorePath;
     bool mIsInitialized = false;
 
+    void BuildSkidIndex();
     void Cleanup();
 };
 
@@ -24,6 +24,8 @@
 #include <algorithm>
 #include <fstream>
 #include <json/json.h>
+#include <sstream>
+#include <sys/stat.h>
 
 using namespace chip::Crypto;
 
@@ -47,24 +49,111 @@ CHIP_ERROR TestDACRevocationDelegateImpl::SetDeviceAttestationRevocationSetPath(
 {
     VerifyOrReturnError(path.empty() != true, CHIP_ERROR_INVALID_ARGUMENT);
     mDeviceAttestationRevocationSetPath = path;
+    mRevocationSetFileStamp             = FileStamp();
+
+    // Direct data takes precedence, the file is loaded once that is cleared
+    VerifyOrReturnError(!mHasRevocationData, CHIP_NO_ERROR);
+
+    // A file that cannot be opened yet is retried on each revocation check
+    mRevocationSet.clear();
+    RefreshRevocationSetFile();
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR TestDACRevocationDelegateImpl::SetDeviceAttestationRevocationData(const std::string & jsonData)
 {
-    mRevocationData = jsonData;
-    return CHIP_NO_ERROR;
+    if (jsonData.empty())
+    {
+        ClearDeviceAttestationRevocationData();
+        return CHIP_NO_ERROR;
+    }
+
+    mHasRevocationData = true;
+    mRevocationSet.clear();
+
+    std::istringstream jsonStream(jsonData);
+    return CompileRevocationSet(jsonStream, mRevocationSet);
 }
 
 void TestDACRevocationDelegateImpl::ClearDeviceAttestationRevocationSetPath()
 {
     // clear the string_view
     mDeviceAttestationRevocationSetPath = mDeviceAttestationRevocationSetPath.substr(0, 0);
+    mRevocationSetFileStamp             = FileStamp();
+
+    if (!mHasRevocationData)
+    {
+        mRevocationSet.clear();
+    }
 }
 
 void TestDACRevocationDelegateImpl::ClearDeviceAttestationRevocationData()
 {
-    mRevocationData.clear();
+    VerifyOrReturn(mHasRevocationData);
+
+    mHasRevocationData = false;
+    mRevocationSet.clear();
+
+    if (!mDeviceAttestationRevocationSetPath.empty())
+    {
+        mRevocationSetFileStamp = FileStamp();
+        RefreshRevocationSetFile();
+    }
+}
+
+TestDACRevocationDelegateImpl::FileStamp TestDACRevocationDelegateImpl::GetFileStamp(const std::string & path)
+{
+    FileStamp stamp;
+    struct stat fileStat;
+
+    if (stat(path.c_str(), &fileStat) == 0)
+    {
+        stamp.valid    = true;
+        stamp.modified = fileStat.st_mtime;
+        stamp.size     = fileStat.st_size;
+        stamp.inode    = fileStat.st_ino;
+    }
+    return stamp;
+}
+
+void TestDACRevocationDelegateImpl::RefreshRevocationSetFile()
+{
+    FileStamp stamp = GetFileStamp(mDeviceAttestationRevocationSetPath);
+    if (!stamp.valid)
+    {
+        ChipLogError(NotSpecified, "Failed to open file: %s", mDeviceAttestationRevocationSetPath.c_str());
+        return;
+    }
+
+    // Only parse each version of the file once, even if it is invalid
+    VerifyOrReturn(!(stamp == mRevocationSetFileStamp));
+    mRevocationSetFileStamp = stamp;
+
+    std::ifstream file(mDeviceAttestationRevocationSetPath.c_str());
+    if (!file.is_open())
+    {
+        ChipLogError(NotSpecified, "Failed to open file: %s", mDeviceAttestationRevocationSetPath.c_str());
+        return;
+    }
+
+    // Compile the new revocation set aside, so that the current one stays in use if this one is invalid
+    RevocationSet revocationSet;
+    VerifyOrReturn(CompileRevocationSet(file, revocationSet) == CHIP_NO_ERROR);
+
+    mRevocationSet.swap(revocationSet);
+    ChipLogProgress(NotSpecified, "Loaded %u revoked certificates from %s", static_cast<unsigned>(mRevocationSet.size()),
+                    mDeviceAttestationRevocationSetPath.c_str());
+}
+
+std::string TestDACRevocationDelegateImpl::MakeRevocationKey(const std::string & akidHexStr,
+                                                             const std::string & issuerNameBase64Str,
+                                                             const std::string & serialNumberHexStr)
+{
+    // Neither hex nor base64 strings contain spaces, which keeps the key unambiguous
+    std::string key;
+    key.reserve(akidHexStr.size() + issuerNameBase64Str.size() + serialNumberHexStr.size() + 2);
+    key.append(akidHexStr).append(1, ' ').append(issuerNameBase64Str).append(1, ' ').append(serialNumberHexStr);
+    return key;
 }
 
 // Check if issuer and AKID matches with the crl signer OR crl signer delegator's subject and SKID
@@ -123,74 +212,56 @@ bool TestDACRevocationDelegateImpl::CrossValidateCert(const Json::Value & revoke
 //   }
 // ]
 //
-bool TestDACRevocationDelegateImpl::IsEntryInRevocationSet(const std::string & akidHexStr, const std::string & issuerNameBase64Str,
-                                                           const std::string & serialNumberHexStr)
+// CRL signers are cross validated here, once, so that checking a certificate is a single lookup.
+CHIP_ERROR TestDACRevocationDelegateImpl::CompileRevocationSet(std::istream & jsonStream, RevocationSet & outRevocationSet)
 {
     Json::Value jsonData;
+    std::string errs;
 
-    // Try direct data first, then fall back to file
-    if (!mRevocationData.empty())
+    if (!Json::parseFromStream(Json::CharReaderBuilder(), jsonStream, &jsonData, &errs))
     {
-        std::string errs;
-        std::istringstream jsonStream(!mRevocationData.empty() ? mRevocationData : "[]");
-        if (!Json::parseFromStream(Json::CharReaderBuilder(), jsonStream, &jsonData, &errs))
-        {
-            ChipLogError(NotSpecified, "Failed to parse JSON data: %s", errs.c_str());
-            return false;
-        }
+        ChipLogError(NotSpecified, "Failed to parse JSON data: %s", errs.c_str());
+        return CHIP_ERROR_INVALID_ARGUMENT;
     }
-    else if (!mDeviceAttestationRevocationSetPath.empty())
-    {
-        std::string errs;
-        std::ifstream file(mDeviceAttestationRevocationSetPath.c_str());
-        if (!file.is_open())
-        {
-            ChipLogError(NotSpecified, "Failed to open file: %s", mDeviceAttestationRevocationSetPath.c_str());
-            return false;
-        }
-
-        bool parsingSuccessful = Json::parseFromStream(Json::CharReaderBuilder(), file, &jsonData, &errs);
-        file.close();
 
-        if (!parsingSuccessful)
-        {
-            ChipLogError(NotSpecified, "Failed to parse JSON from file: %s", errs.c_str());
-            return false;
-        }
-    }
-    else
-    {
-        ChipLogProgress(NotSpecified, "No revocation data available");
-        // No revocation data available
-        return false;
-    }
+    // Issuers with a revoked set that failed cross validation. A certificate check stops at the first
+    // such set, so only the revoked sets of that issuer that precede it are used.
+    std::unordered_set<std::string> invalidIssuers;
 
     // 6.2.4.2. Determining Revocation Status of an Entity
     for (const auto & revokedSet : jsonData)
     {
-        if (revokedSet["issuer_name"].asString() != issuerNameBase64Str)
-        {
-            continue;
-        }
-        if (revokedSet["issuer_subject_key_id"].asString() != akidHexStr)
+        const std::string akidHexStr          = revokedSet["issuer_subject_key_id"].asString();
+        const std::string issuerNameBase64Str = revokedSet["issuer_name"].asString();
+        const std::string issuerKey           = MakeRevocationKey(akidHexStr, issuerNameBase64Str, std::string());
+
+        if (invalidIssuers.count(issuerKey) != 0)
         {
             continue;
         }
 
         // 4.a cross validate PAI with crl signer OR crl signer delegator
         // 4.b cross validate DAC with crl signer OR crl signer delegator
-        VerifyOrReturnValue(CrossValidateCert(revokedSet, akidHexStr, issuerNameBase64Str), false);
+        if (!CrossValidateCert(revokedSet, akidHexStr, issuerNameBase64Str))
+        {
+            invalidIssuers.insert(issuerKey);
+            continue;
+        }
 
-        // 4.c check if serial number is revoked
         for (const auto & revokedSerialNumber : revokedSet["revoked_serial_numbers"])
         {
-            if (revokedSerialNumber.asString() == serialNumberHexStr)
-            {
-                return true;
-            }
+            outRevocationSet.insert(MakeRevocationKey(akidHexStr, issuerNameBase64Str, revokedSerialNumber.asString()));
         }
     }
-    return false;
+
+    return CHIP_NO_ERROR;
+}
+
+bool TestDACRevocationDelegateImpl::IsEntryInRevocationSet(const std::string & akidHexStr, const std::string & issuerNameBase64Str,
+                                                           const std::string & serialNumberHexStr)
+{
+    // 4.c check if serial number is revoked
+    return mRevocationSet.count(MakeRevocationKey(akidHexStr, issuerNameBase64Str, serialNumberHexStr)) != 0;
 }
 
 CHIP_ERROR TestDACRevocationDelegateImpl::GetKeyIDHexStr(const ByteSpan & certDer, std::string & outKeyIDHexStr,
@@ -305,13 +376,18 @@ void TestDACRevocationDelegateImpl::CheckForRevokedDACChain(
 {
     AttestationVerificationResult attestationError = AttestationVerificationResult::kSuccess;
 
-    if (mDeviceAttestationRevocationSetPath.empty() && mRevocationData.empty())
+    if (mDeviceAttestationRevocationSetPath.empty() && !mHasRevocationData)
     {
         ChipLogProgress(NotSpecified, "WARNING: No revocation information available. Revocation checks will be skipped!");
         onCompletion->mCall(onCompletion->mContext, info, attestationError);
         return;
     }
 
+    if (!mHasRevocationData)
+    {
+        RefreshRevocationSetFile();
+    }
+
     ChipLogDetail(NotSpecified, "Checking for revoked DAC in %s", mDeviceAttestationRevocationSetPath.c_str());
 
     if (IsCertificateRevoked(info.dacDerBuffer))
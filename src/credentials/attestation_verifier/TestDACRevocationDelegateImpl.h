@@ -21,7 +21,11 @@
 #include <json/json.h>
 #include <lib/support/Span.h>
 
+#include <ctime>
+#include <istream>
 #include <string>
+#include <sys/types.h>
+#include <unordered_set>
 
 namespace chip {
 namespace Credentials {
@@ -46,6 +50,10 @@ public:
     // Set the path to the device attestation revocation set JSON file.
     // revocation set can be generated using credentials/generate-revocation-set.py script
     // This API returns CHIP_ERROR_INVALID_ARGUMENT if the path is null.
+    //
+    // The file is parsed once into an in-memory index. It is parsed again only when the file is
+    // modified or replaced, and the previously loaded revocation set is kept if the new one fails
+    // to load.
     CHIP_ERROR SetDeviceAttestationRevocationSetPath(std::string_view path);
 
     // Clear the path to the device attestation revocation set JSON file.
@@ -53,6 +61,7 @@ public:
     void ClearDeviceAttestationRevocationSetPath();
 
     // Set JSON data directly for unit test purposes.
+    // Returns CHIP_ERROR_INVALID_ARGUMENT if the data is not a valid JSON revocation set.
     CHIP_ERROR SetDeviceAttestationRevocationData(const std::string & jsonData);
     void ClearDeviceAttestationRevocationData();
 
@@ -69,6 +78,31 @@ private:
         kSubject = 1,
     };
 
+    // Revoked certificates, each keyed by its issuer AKID, issuer name and serial number.
+    using RevocationSet = std::unordered_set<std::string>;
+
+    // Identifies a version of the revocation set file, so that it is only parsed again when changed.
+    struct FileStamp
+    {
+        bool valid      = false;
+        time_t modified = 0;
+        off_t size      = 0;
+        ino_t inode     = 0;
+
+        bool operator==(const FileStamp & other) const
+        {
+            return valid == other.valid && modified == other.modified && size == other.size && inode == other.inode;
+        }
+    };
+
+    static std::string MakeRevocationKey(const std::string & akidHexStr, const std::string & issuerNameBase64Str,
+                                         const std::string & serialNumberHexStr);
+
+    static FileStamp GetFileStamp(const std::string & path);
+
+    CHIP_ERROR CompileRevocationSet(std::istream & jsonStream, RevocationSet & outRevocationSet);
+    void RefreshRevocationSetFile();
+
     bool CrossValidateCert(const Json::Value & revokedSet, const std::string & akIdHexStr, const std::string & issuerNameBase64Str);
 
     CHIP_ERROR GetKeyIDHexStr(const ByteSpan & certDer, std::string & outKeyIDHexStr, KeyIdType keyIdType);
@@ -87,7 +121,10 @@ private:
     bool IsCertificateRevoked(const ByteSpan & certDer);
 
     std::string mDeviceAttestationRevocationSetPath;
-    std::string mRevocationData; // Stores direct JSON data
+    bool mHasRevocationData = false; // Whether direct JSON data was set, which takes precedence over the file
+
+    RevocationSet mRevocationSet;
+    FileStamp mRevocationSetFileStamp;
 };
 
 } // namespace Credentials
@@ -645,6 +645,74 @@ TEST_F(TestDeviceAttestationCredentials, TestDACRevocationDelegateImpl)
     EXPECT_EQ(attestationResult, AttestationVerificationResult::kSuccess);
 }
 
+TEST_F(TestDeviceAttestationCredentials, TestDACRevocationDelegateImplMultipleRevokedSets)
+{
+    uint8_t attestationElementsTestVector[]  = { 0 };
+    uint8_t attestationChallengeTestVector[] = { 0 };
+    uint8_t attestationSignatureTestVector[] = { 0 };
+    uint8_t attestationNonceTestVector[]     = { 0 };
+
+    Credentials::DeviceAttestationVerifier::AttestationInfo info(
+        ByteSpan(attestationElementsTestVector), ByteSpan(attestationChallengeTestVector), ByteSpan(attestationSignatureTestVector),
+        TestCerts::sTestCert_PAI_FFF1_8000_Cert, TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert, ByteSpan(attestationNonceTestVector),
+        static_cast<VendorId>(0xFFF1), 0x8000);
+
+    AttestationVerificationResult attestationResult = AttestationVerificationResult::kNotImplemented;
+
+    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> attestationInformationVerificationCallback(
+        OnAttestationInformationVerificationCallback, &attestationResult);
+
+    TestDACRevocationDelegateImpl revocationDelegateImpl;
+
+    // Revoked set header for the issuer of TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert
+    const std::string dacIssuer = R"(
+        "type": "revocation_set",
+        "issuer_subject_key_id": "AF42B7094DEBD515EC6ECF33B81115225F325288",
+        "issuer_name": "MEYxGDAWBgNVBAMMD01hdHRlciBUZXN0IFBBSTEUMBIGCisGAQQBgqJ8AgEMBEZGRjExFDASBgorBgEEAYKifAICDAQ4MDAw",)";
+
+    // TestCerts::sTestCert_PAI_FFF1_8000_Cert, which is the CRL signer for the DAC issuer
+    const std::string paiCrlSigner =
+        R"("crl_signer_cert": "MIIB1DCCAXqgAwIBAgIIPmzmUJrYQM0wCgYIKoZIzj0EAwIwMDEYMBYGA1UEAwwPTWF0dGVyIFRlc3QgUEFBMRQwEgYKKwYBBAGConwCAQwERkZGMTAgFw0yMTA2MjgxNDIzNDNaGA85OTk5MTIzMTIzNTk1OVowRjEYMBYGA1UEAwwPTWF0dGVyIFRlc3QgUEFJMRQwEgYKKwYBBAGConwCAQwERkZGMTEUMBIGCisGAQQBgqJ8AgIMBDgwMDAwWTATBgcqhkjOPQIBBggqhkjOPQMBBwNCAASA3fEbIo8+MfY7z1eY2hRiOuu96C7zeO6tv7GP4avOMdCO1LIGBLbMxtm1+rZOfeEMt0vgF8nsFRYFbXDyzQsio2YwZDASBgNVHRMBAf8ECDAGAQH/AgEAMA4GA1UdDwEB/wQEAwIBBjAdBgNVHQ4EFgQUr0K3CU3r1RXsbs8zuBEVIl8yUogwHwYDVR0jBBgwFoAUav0idx9RH+y/FkGXZxDc3DGhcX4wCgYIKoZIzj0EAwIDSAAwRQIhAJbJyM8uAYhgBdj1vHLAe3X9mldpWsSRETETi+oDPOUDAiAlVJQ75X1T1sR199I+v8/CA2zSm6Y5PsfvrYcUq3GCGQ==",)";
+
+    // Matter Test PAA certificate for FFF1, which does not cross validate against the DAC issuer
+    const std::string paaCrlSigner =
+        R"("crl_signer_cert": "MIIBvTCCAWSgAwIBAgIITqjoMYLUHBwwCgYIKoZIzj0EAwIwMDEYMBYGA1UEAwwPTWF0dGVyIFRlc3QgUEFBMRQwEgYKKwYBBAGConwCAQwERkZGMTAgFw0yMTA2MjgxNDIzNDNaGA85OTk5MTIzMTIzNTk1OVowMDEYMBYGA1UEAwwPTWF0dGVyIFRlc3QgUEFBMRQwEgYKKwYBBAGConwCAQwERkZGMTBZMBMGByqGSM49AgEGCCqGSM49AwEHA0IABLbLY3KIfyko9brIGqnZOuJDHK2p154kL2UXfvnO2TKijs0Duq9qj8oYShpQNUKWDUU/MD8fGUIddR6Pjxqam3WjZjBkMBIGA1UdEwEB/wQIMAYBAf8CAQEwDgYDVR0PAQH/BAQDAgEGMB0GA1UdDgQWBBRq/SJ3H1Ef7L8WQZdnENzcMaFxfjAfBgNVHSMEGDAWgBRq/SJ3H1Ef7L8WQZdnENzcMaFxfjAKBggqhkjOPQQDAgNHADBEAiBQqoAC9NkyqaAFOPZTaK0P/8jvu8m+t9pWmDXPmqdRDgIgI7rI/g8j51RFtlM5CBpHmUkpxyqvChVI1A0DTVFLJd4=",)";
+
+    // Test DAC is revoked by a later revoked set of the same issuer, and the result holds across checks
+    std::string jsonData = "[{" + dacIssuer + paiCrlSigner + R"("revoked_serial_numbers": ["BC694F7F866067B1"]},
+                             {)" + dacIssuer + paiCrlSigner + R"("revoked_serial_numbers": ["0C694F7F866067B2"]}])";
+    EXPECT_EQ(revocationDelegateImpl.SetDeviceAttestationRevocationData(jsonData), CHIP_NO_ERROR);
+    for (int i = 0; i < 3; i++)
+    {
+        attestationResult = AttestationVerificationResult::kNotImplemented;
+        revocationDelegateImpl.CheckForRevokedDACChain(info, &attestationInformationVerificationCallback);
+        EXPECT_EQ(attestationResult, AttestationVerificationResult::kDacRevoked);
+    }
+    revocationDelegateImpl.ClearDeviceAttestationRevocationData();
+
+    // Test DAC is not revoked when an earlier revoked set of the same issuer fails cross validation
+    jsonData = "[{" + dacIssuer + paaCrlSigner + R"("revoked_serial_numbers": ["BC694F7F866067B1"]},
+                 {)" + dacIssuer + paiCrlSigner + R"("revoked_serial_numbers": ["0C694F7F866067B2"]}])";
+    EXPECT_EQ(revocationDelegateImpl.SetDeviceAttestationRevocationData(jsonData), CHIP_NO_ERROR);
+    revocationDelegateImpl.CheckForRevokedDACChain(info, &attestationInformationVerificationCallback);
+    revocationDelegateImpl.ClearDeviceAttestationRevocationData();
+    EXPECT_EQ(attestationResult, AttestationVerificationResult::kSuccess);
+
+    // Test DAC revoked by an earlier valid revoked set stays revoked when a later one fails cross validation
+    jsonData = "[{" + dacIssuer + paiCrlSigner + R"("revoked_serial_numbers": ["0C694F7F866067B2"]},
+                 {)" + dacIssuer + paaCrlSigner + R"("revoked_serial_numbers": ["BC694F7F866067B1"]}])";
+    EXPECT_EQ(revocationDelegateImpl.SetDeviceAttestationRevocationData(jsonData), CHIP_NO_ERROR);
+    revocationDelegateImpl.CheckForRevokedDACChain(info, &attestationInformationVerificationCallback);
+    EXPECT_EQ(attestationResult, AttestationVerificationResult::kDacRevoked);
+
+    // Test malformed JSON is rejected, and no certificate is considered revoked
+    jsonData = "[{" + dacIssuer + paiCrlSigner + R"("revoked_serial_numbers": ["0C694F7F866067B2"])";
+    EXPECT_EQ(revocationDelegateImpl.SetDeviceAttestationRevocationData(jsonData), CHIP_ERROR_INVALID_ARGUMENT);
+    revocationDelegateImpl.CheckForRevokedDACChain(info, &attestationInformationVerificationCallback);
+    revocationDelegateImpl.ClearDeviceAttestationRevocationData();
+    EXPECT_EQ(attestationResult, AttestationVerificationResult::kSuccess);
+}
+
 TEST(DeviceAttestationVerifier, GetAttestationResultDescriptionWorks)
 {
     ASSERT_STREQ(GetAttestationResultDescription(AttestationVerificationResult::kSuccess), "Success");
@@ -0,0 +1,150 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <credentials/attestation_verifier/FileAttestationTrustStore.h>
+#include <credentials/tests/CHIPAttCert_test_vectors.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Span.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::TestCerts;
+
+namespace {
+
+class TestFileAttestationTrustStore : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        char dirTemplate[] = "/tmp/chip-paa-store-XXXXXX";
+        ASSERT_NE(mkdtemp(dirTemplate), nullptr);
+        mStorePath = dirTemplate;
+    }
+
+    void TearDown() override
+    {
+        for (const char * fileName : { kFirstPaaFile, kSecondPaaFile, kNotACertFile })
+        {
+            unlink(FilePath(fileName).c_str());
+        }
+        rmdir(mStorePath.c_str());
+    }
+
+protected:
+    static constexpr const char * kFirstPaaFile  = "first-paa.der";
+    static constexpr const char * kSecondPaaFile = "second-paa.der";
+    static constexpr const char * kNotACertFile  = "not-a-cert.der";
+
+    std::string FilePath(const char * fileName) const { return mStorePath + "/" + fileName; }
+
+    void WriteFile(const char * fileName, const ByteSpan & content) const
+    {
+        FILE * file = fopen(FilePath(fileName).c_str(), "wb");
+        ASSERT_NE(file, nullptr);
+        EXPECT_EQ(fwrite(content.data(), 1, content.size(), file), content.size());
+        fclose(file);
+    }
+
+    static CHIP_ERROR LookUp(const FileAttestationTrustStore & store, const ByteSpan & skid, const ByteSpan & expectedCert)
+    {
+        uint8_t buffer[kMaxDERCertLength];
+        MutableByteSpan paaCert{ buffer };
+        ReturnErrorOnFailure(store.GetProductAttestationAuthorityCert(skid, paaCert));
+        VerifyOrReturnError(paaCert.data_equal(expectedCert), CHIP_ERROR_INTERNAL);
+        return CHIP_NO_ERROR;
+    }
+
+    std::string mStorePath;
+};
+
+TEST_F(TestFileAttestationTrustStore, TestSkidLookup)
+{
+    WriteFile(kFirstPaaFile, sTestCert_PAA_FFF2_ValInPast_Cert);
+    WriteFile(kSecondPaaFile, sTestCert_PAA_NoVID_ToResignPAIs_Cert);
+    WriteFile(kNotACertFile, ByteSpan(reinterpret_cast<const uint8_t *>("garbage"), 7));
+
+    FileAttestationTrustStore store(mStorePath.c_str());
+    EXPECT_TRUE(store.IsInitialized());
+    EXPECT_EQ(store.paaCount(), 2u);
+
+    // Hits
+    EXPECT_EQ(LookUp(store, sTestCert_PAA_FFF2_ValInPast_SKID, sTestCert_PAA_FFF2_ValInPast_Cert), CHIP_NO_ERROR);
+    EXPECT_EQ(LookUp(store, sTestCert_PAA_NoVID_ToResignPAIs_SKID, sTestCert_PAA_NoVID_ToResignPAIs_Cert), CHIP_NO_ERROR);
+
+    // Miss: a well-formed SKID that is not in the store
+    EXPECT_EQ(LookUp(store, sTestCert_PAA_FFF2_ValInFuture_SKID, sTestCert_PAA_FFF2_ValInFuture_Cert),
+              CHIP_ERROR_CA_CERT_NOT_FOUND);
+
+    // Malformed SKIDs
+    EXPECT_EQ(LookUp(store, ByteSpan(), ByteSpan()), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(LookUp(store, sTestCert_PAA_FFF2_ValInPast_SKID.SubSpan(1), ByteSpan()), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Output buffer too small for the matching certificate
+    uint8_t smallBuffer[16];
+    MutableByteSpan smallSpan{ smallBuffer };
+    EXPECT_EQ(store.GetProductAttestationAuthorityCert(sTestCert_PAA_FFF2_ValInPast_SKID, smallSpan), CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
+TEST_F(TestFileAttestationTrustStore, TestReload)
+{
+    WriteFile(kFirstPaaFile, sTestCert_PAA_FFF2_ValInPast_Cert);
+
+    FileAttestationTrustStore store(mStorePath.c_str());
+    EXPECT_EQ(store.paaCount(), 1u);
+
+    // A PAA added to the directory is only found after a reload
+    WriteFile(kSecondPaaFile, sTestCert_PAA_NoVID_ToResignPAIs_Cert);
+    EXPECT_EQ(store.paaCount(), 1u);
+    EXPECT_EQ(store.Reload(), CHIP_NO_ERROR);
+    EXPECT_EQ(store.paaCount(), 2u);
+    EXPECT_EQ(LookUp(store, sTestCert_PAA_NoVID_ToResignPAIs_SKID, sTestCert_PAA_NoVID_ToResignPAIs_Cert), CHIP_NO_ERROR);
+
+    // A PAA removed from the directory is no longer found after a reload
+    unlink(FilePath(kFirstPaaFile).c_str());
+    EXPECT_EQ(store.Reload(), CHIP_NO_ERROR);
+    EXPECT_EQ(store.paaCount(), 1u);
+    EXPECT_EQ(LookUp(store, sTestCert_PAA_FFF2_ValInPast_SKID, sTestCert_PAA_FFF2_ValInPast_Cert), CHIP_ERROR_CA_CERT_NOT_FOUND);
+
+    // Reloading an empty directory keeps the current certificates
+    unlink(FilePath(kSecondPaaFile).c_str());
+    EXPECT_EQ(store.Reload(), CHIP_ERROR_NOT_FOUND);
+    EXPECT_EQ(store.paaCount(), 1u);
+    EXPECT_EQ(LookUp(store, sTestCert_PAA_NoVID_ToResignPAIs_SKID, sTestCert_PAA_NoVID_ToResignPAIs_Cert), CHIP_NO_ERROR);
+}
+
+TEST_F(TestFileAttestationTrustStore, TestReloadWithoutPath)
+{
+    FileAttestationTrustStore store;
+    EXPECT_FALSE(store.IsInitialized());
+    EXPECT_EQ(store.Reload(), CHIP_ERROR_INCORRECT_STATE);
+}
+
+} // namespace
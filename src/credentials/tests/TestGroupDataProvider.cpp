@@ -611,6 +611,67 @@ TEST_F(TestGroupDataProvider, TestEndpointIterator)
     it->Release();
 }
 
+TEST_F(TestGroupDataProvider, TestEndpointIteratorByGroup)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    auto collectEndpoints = [provider](FabricIndex fabric, GroupId group) {
+        std::set<EndpointId> endpoints;
+        auto it = provider->IterateEndpoints(fabric, std::make_optional(group));
+        if (it == nullptr)
+        {
+            return endpoints;
+        }
+        size_t count = it->Count();
+        GroupEndpoint output;
+        while (it->Next(output))
+        {
+            EXPECT_EQ(output.group_id, group);
+            endpoints.insert(output.endpoint_id);
+        }
+        EXPECT_EQ(count, endpoints.size());
+        it->Release();
+        return endpoints;
+    };
+
+    EXPECT_EQ(provider->AddEndpoint(kFabric1, kGroup1, kEndpointId0), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->AddEndpoint(kFabric1, kGroup1, kEndpointId2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->AddEndpoint(kFabric1, kGroup2, kEndpointId1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->AddEndpoint(kFabric2, kGroup1, kEndpointId3), CHIP_NO_ERROR);
+
+    // Repeated lookups (served from memory after the first one) return the same endpoints
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(collectEndpoints(kFabric1, kGroup1), (std::set<EndpointId>{ kEndpointId0, kEndpointId2 }));
+        EXPECT_EQ(collectEndpoints(kFabric1, kGroup2), (std::set<EndpointId>{ kEndpointId1 }));
+        EXPECT_EQ(collectEndpoints(kFabric2, kGroup1), (std::set<EndpointId>{ kEndpointId3 }));
+        EXPECT_TRUE(collectEndpoints(kFabric1, kGroup3).empty());
+    }
+
+    // Changes are visible to the next lookup
+    EXPECT_EQ(provider->AddEndpoint(kFabric1, kGroup1, kEndpointId4), CHIP_NO_ERROR);
+    EXPECT_EQ(collectEndpoints(kFabric1, kGroup1), (std::set<EndpointId>{ kEndpointId0, kEndpointId2, kEndpointId4 }));
+    EXPECT_EQ(provider->RemoveEndpoint(kFabric1, kEndpointId2), CHIP_NO_ERROR);
+    EXPECT_EQ(collectEndpoints(kFabric1, kGroup1), (std::set<EndpointId>{ kEndpointId0, kEndpointId4 }));
+
+    // Modifying the group while iterating does not disturb the ongoing iteration
+    auto it = provider->IterateEndpoints(kFabric1, std::make_optional(kGroup1));
+    ASSERT_TRUE(it);
+    GroupEndpoint output;
+    EXPECT_TRUE(it->Next(output));
+    EXPECT_EQ(provider->RemoveGroupInfo(kFabric1, kGroup1), CHIP_NO_ERROR);
+    EXPECT_TRUE(collectEndpoints(kFabric1, kGroup1).empty());
+    it->Release();
+
+    EXPECT_EQ(provider->RemoveFabric(kFabric2), CHIP_NO_ERROR);
+    EXPECT_TRUE(collectEndpoints(kFabric2, kGroup1).empty());
+    EXPECT_EQ(collectEndpoints(kFabric1, kGroup2), (std::set<EndpointId>{ kEndpointId1 }));
+}
+
 TEST_F(TestGroupDataProvider, TestGroupKeys)
 {
     GroupDataProvider * provider = GetGroupDataProvider();
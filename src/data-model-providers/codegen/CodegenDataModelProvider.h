@@ -25,6 +25,9 @@
 #include <data-model-providers/codegen/ServerClusterInterfaceRegistry.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/support/ReadOnlyBuffer.h>
+#include <protocols/interaction_model/StatusCode.h>
+
+#include <variant>
 
 namespace chip {
 namespace app {
@@ -126,6 +129,14 @@ private:
     /// Effectively the same as `emberAfFindServerCluster` except with some caching capabilities
     const EmberAfCluster * FindServerCluster(const ConcreteClusterPath & path);
 
+    /// Finds the ember metadata of the given attribute, or the Unsupported* status
+    /// explaining why it does not exist.
+    ///
+    /// Effectively the same as `Ember::FindAttributeMetadata` except it uses the
+    /// cached cluster from `FindServerCluster`.
+    std::variant<const EmberAfAttributeMetadata *, Protocols::InteractionModel::Status>
+    FindAttributeMetadata(const ConcreteAttributePath & path);
+
     /// Find the index of the given endpoint id
     std::optional<unsigned> TryFindEndpointIndex(EndpointId id) const;
 };
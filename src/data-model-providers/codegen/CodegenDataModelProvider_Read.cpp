@@ -88,6 +88,27 @@ std::optional<CHIP_ERROR> TryReadViaAccessInterface(const ConcreteAttributePath
 
 } // namespace
 
+std::variant<const EmberAfAttributeMetadata *, Status> CodegenDataModelProvider::FindAttributeMetadata(const ConcreteAttributePath & path)
+{
+    // Reads generally go through all attributes of a cluster in order (e.g. wildcard
+    // reads), so searching the cached cluster avoids a search through all endpoints
+    // for every attribute.
+    if (const EmberAfCluster * cluster = FindServerCluster(path); cluster != nullptr)
+    {
+        for (uint16_t i = 0; i < cluster->attributeCount; i++)
+        {
+            if (cluster->attributes[i].attributeId == path.mAttributeId)
+            {
+                return &cluster->attributes[i];
+            }
+        }
+        return Status::UnsupportedAttribute;
+    }
+
+    // Figures out the exact failure status
+    return Ember::FindAttributeMetadata(path);
+}
+
 /// separated-out ReadAttribute implementation (given existing complexity)
 ///
 /// Generally will:
@@ -107,7 +128,7 @@ DataModel::ActionReturnStatus CodegenDataModelProvider::ReadAttribute(const Data
         return cluster->ReadAttribute(request, encoder);
     }
 
-    auto metadata = Ember::FindAttributeMetadata(request.path);
+    auto metadata = FindAttributeMetadata(request.path);
 
     // Explicit failure in finding a suitable metadata
     if (const Status * status = std::get_if<Status>(&metadata))
@@ -1448,6 +1448,33 @@ TEST_F(TestCodegenModelViaMocks, EmberAttributeInvalidRead)
     }
 }
 
+TEST_F(TestCodegenModelViaMocks, EmberAttributeInvalidReadWithinFoundCluster)
+{
+    UseMockNodeConfig config(gTestNodeConfig);
+    CodegenDataModelProviderWithContext model;
+    ScopedMockAccessControl accessControl;
+
+    // Repeated reads within the same cluster reuse the found cluster and must
+    // still detect missing attributes.
+    for (int i = 0; i < 2; i++)
+    {
+        ReadOperation testRequest(kMockEndpoint2, MockClusterId(2), MockAttributeId(10));
+        testRequest.SetSubjectDescriptor(kAdminSubjectDescriptor);
+
+        std::unique_ptr<AttributeValueEncoder> encoder = testRequest.StartEncoding();
+        ASSERT_EQ(model.ReadAttribute(testRequest.GetRequest(), *encoder), Status::UnsupportedAttribute);
+    }
+
+    // Same cluster on another endpoint has a different set of attributes
+    {
+        ReadOperation testRequest(kMockEndpoint1, MockClusterId(2), MockAttributeId(2));
+        testRequest.SetSubjectDescriptor(kAdminSubjectDescriptor);
+
+        std::unique_ptr<AttributeValueEncoder> encoder = testRequest.StartEncoding();
+        ASSERT_EQ(model.ReadAttribute(testRequest.GetRequest(), *encoder), Status::UnsupportedAttribute);
+    }
+}
+
 TEST_F(TestCodegenModelViaMocks, AccessInterfaceUnsupportedRead)
 {
     UseMockNodeConfig config(gTestNodeConfig);
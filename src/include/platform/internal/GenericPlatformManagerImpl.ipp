@@ -38,6 +38,7 @@
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <lib/support/logging/DeferredLogging.h>
 
 namespace chip {
 namespace DeviceLayer {
@@ -46,6 +47,32 @@ namespace Internal {
 
 extern CHIP_ERROR InitEntropy();
 
+#if CHIP_DEFERRED_LOGGING
+static void DrainDeferredLogsWork(intptr_t context)
+{
+    Logging::DrainDeferredLogs();
+}
+
+static bool ScheduleDeferredLogDrain()
+{
+#if CHIP_SYSTEM_CONFIG_USE_LIBEV && CHIP_STACK_LOCK_TRACKING_ENABLED
+    // Work can only be scheduled with the stack lock held
+    VerifyOrReturnValue(PlatformMgr().IsChipStackLockedByCurrentThread(), false);
+#endif
+    return PlatformMgr().ScheduleWork(DrainDeferredLogsWork) == CHIP_NO_ERROR;
+}
+
+static uint64_t GetDeferredLogTime()
+{
+    System::Clock::Microseconds64 now;
+    if (System::SystemClock().GetClock_RealTime(now) != CHIP_NO_ERROR)
+    {
+        now = System::SystemClock().GetMonotonicMicroseconds64();
+    }
+    return now.count();
+}
+#endif // CHIP_DEFERRED_LOGGING
+
 template <class ImplClass>
 CHIP_ERROR GenericPlatformManagerImpl<ImplClass>::_InitChipStack()
 {
@@ -144,6 +171,12 @@ CHIP_ERROR GenericPlatformManagerImpl<ImplClass>::_InitChipStack()
 
     SuccessOrExit(err);
 
+#if CHIP_DEFERRED_LOGGING
+    // Deferred log messages are drained on the event loop
+    Logging::SetDeferredLogClock(GetDeferredLogTime);
+    Logging::SetDeferredLogDrainRequestHandler(ScheduleDeferredLogDrain);
+#endif
+
 exit:
     return err;
 }
@@ -176,6 +209,13 @@ void GenericPlatformManagerImpl<ImplClass>::_Shutdown()
 
     ChipLogProgress(DeviceLayer, "System Layer shutdown");
     SystemLayer().Shutdown();
+
+#if CHIP_DEFERRED_LOGGING
+    // The event loop is not running anymore
+    Logging::SetDeferredLogDrainRequestHandler(nullptr);
+    Logging::DrainDeferredLogs();
+    Logging::SetDeferredLogClock(nullptr);
+#endif
 }
 
 template <class ImplClass>
@@ -253,6 +253,14 @@ public:
     /// any new lookups until re-initialized.
     virtual void Shutdown() = 0;
 
+    /// Inform the resolver that the result of a previous lookup for the given
+    /// node turned out to be unusable (e.g. establishing a session with it
+    /// failed), so that subsequent lookups go to the network instead of
+    /// reusing any cached data.
+    ///
+    /// Implementations that do not cache lookup results may ignore this.
+    virtual void InvalidateCachedResult(const PeerId & peerId) {}
+
     /// Expected to be provided by the implementation.
     static Resolver & Instance();
 };
@@ -28,6 +28,25 @@ namespace {
 
 static constexpr System::Clock::Timeout kInvalidTimeout{ System::Clock::Timeout::max() };
 
+/// Fills in all the parts of a resolve result except for the IP address.
+ResolveResult ResolveResultWithoutAddress(const Dnssd::ResolvedNodeData & nodeData)
+{
+    ResolveResult result;
+
+    result.address.SetPort(nodeData.resolutionData.port);
+    result.address.SetInterface(nodeData.resolutionData.interfaceId);
+    result.mrpRemoteConfig   = nodeData.resolutionData.GetRemoteMRPConfig();
+    result.supportsTcpClient = nodeData.resolutionData.supportsTcpClient;
+    result.supportsTcpServer = nodeData.resolutionData.supportsTcpServer;
+
+    if (nodeData.resolutionData.isICDOperatingAsLIT.has_value())
+    {
+        result.isICDOperatingAsLIT = *(nodeData.resolutionData.isICDOperatingAsLIT);
+    }
+
+    return result;
+}
+
 } // namespace
 
 void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLookupRequest & request)
@@ -35,6 +54,19 @@ void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLo
     mRequestStartTime = now;
     mRequest          = request;
     mResults          = NodeLookupResults();
+    mCachedError      = CHIP_NO_ERROR;
+    mCachedLookup     = false;
+}
+
+void NodeLookupHandle::ResetForCachedLookup(System::Clock::Timestamp now, const NodeLookupRequest & request,
+                                            const ResolveCacheBase::Entry & entry)
+{
+    ResetForLookup(now, request);
+
+    mResults          = entry.results;
+    mResults.consumed = 0;
+    mCachedError      = entry.error;
+    mCachedLookup     = true;
 }
 
 void NodeLookupHandle::LookupResult(const ResolveResult & result)
@@ -64,6 +96,12 @@ void NodeLookupHandle::LookupResult(const ResolveResult & result)
 
 System::Clock::Timeout NodeLookupHandle::NextEventTimeout(System::Clock::Timestamp now)
 {
+    if (mCachedLookup)
+    {
+        // Cached data is complete already, report it as soon as possible.
+        return System::Clock::Timeout::zero();
+    }
+
     const System::Clock::Timestamp elapsed = now - mRequestStartTime;
 
     if (elapsed < mRequest.GetMinLookupTime())
@@ -104,6 +142,15 @@ NodeLookupAction NodeLookupHandle::NextAction(System::Clock::Timestamp now)
     ChipLogProgress(Discovery, "Checking node lookup status for " ChipLogFormatPeerId " after %lu ms",
                     ChipLogValuePeerId(mRequest.GetPeerId()), static_cast<unsigned long>(elapsed.count()));
 
+    if (mCachedLookup)
+    {
+        if (HasLookupResult())
+        {
+            return NodeLookupAction::Success(TakeLookupResult());
+        }
+        return NodeLookupAction::Error(mCachedError != CHIP_NO_ERROR ? mCachedError : CHIP_ERROR_NOT_FOUND);
+    }
+
     // We are still within the minimal search time. Wait for more results.
     if (elapsed < mRequest.GetMinLookupTime())
     {
@@ -198,14 +245,130 @@ bool NodeLookupResults::UpdateResults(const ResolveResult & result, const Dnssd:
     return true;
 }
 
+ResolveCacheBase::Entry * ResolveCacheBase::Find(const PeerId & peerId, System::Clock::Timestamp now)
+{
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        Entry & entry = mEntries[i];
+        if (!entry.valid || (entry.peerId != peerId))
+        {
+            continue;
+        }
+
+        const System::Clock::Timeout ttl = entry.IsNegative() ? kNegativeTtl : kPositiveTtl;
+        if (now - entry.stored >= ttl)
+        {
+            entry.valid = false;
+            return nullptr;
+        }
+        return &entry;
+    }
+    return nullptr;
+}
+
+ResolveCacheBase::Entry * ResolveCacheBase::Allocate(const PeerId & peerId, System::Clock::Timestamp now)
+{
+    VerifyOrReturnValue(mEntryCount > 0, nullptr);
+
+    // Prefer the existing entry for the peer, then unused slots, then the oldest entry
+    Entry * target = nullptr;
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        Entry & entry = mEntries[i];
+        if (entry.valid && (entry.peerId == peerId))
+        {
+            target = &entry;
+            break;
+        }
+        if ((target == nullptr) || (target->valid && (!entry.valid || (entry.stored < target->stored))))
+        {
+            target = &entry;
+        }
+    }
+
+    *target        = Entry();
+    target->peerId = peerId;
+    target->stored = now;
+    target->valid  = true;
+    return target;
+}
+
+void ResolveCacheBase::StoreResults(const PeerId & peerId, const NodeLookupResults & results, System::Clock::Timestamp now)
+{
+    VerifyOrReturn(results.count > 0);
+
+    Entry * entry = Allocate(peerId, now);
+    VerifyOrReturn(entry != nullptr);
+
+    entry->results          = results;
+    entry->results.consumed = 0;
+}
+
+void ResolveCacheBase::StoreFailure(const PeerId & peerId, CHIP_ERROR error, System::Clock::Timestamp now)
+{
+    VerifyOrReturn(error != CHIP_NO_ERROR);
+
+    Entry * entry = Allocate(peerId, now);
+    VerifyOrReturn(entry != nullptr);
+
+    entry->error = error;
+}
+
+bool ResolveCacheBase::Remove(const PeerId & peerId)
+{
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        Entry & entry = mEntries[i];
+        if (entry.valid && (entry.peerId == peerId))
+        {
+            entry.valid = false;
+            return entry.refreshPending;
+        }
+    }
+    return false;
+}
+
+void ResolveCacheBase::Clear()
+{
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        mEntries[i].valid = false;
+    }
+}
+
+bool ResolveCacheBase::NeedsRefresh(const Entry & entry, System::Clock::Timestamp now)
+{
+    return !entry.IsNegative() && !entry.refreshPending && (now - entry.stored >= kPositiveTtl / 2);
+}
+
 CHIP_ERROR Resolver::LookupNode(const NodeLookupRequest & request, Impl::NodeLookupHandle & handle)
 {
     MATTER_LOG_NODE_LOOKUP(&request);
 
     VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    handle.ResetForLookup(mTimeSource.GetMonotonicTimestamp(), request);
-    auto & peerId = request.GetPeerId();
+    const System::Clock::Timestamp now = mTimeSource.GetMonotonicTimestamp();
+    auto & peerId                      = request.GetPeerId();
+
+    ResolveCacheBase::Entry * cached = mCache.Find(peerId, now);
+    if (cached != nullptr)
+    {
+        handle.ResetForCachedLookup(now, request, *cached);
+
+        // Cached results are returned right away. Entries that are getting old
+        // are updated in the background, so that they remain usable.
+        if (ResolveCacheBase::NeedsRefresh(*cached, now) && (Dnssd::Resolver::Instance().ResolveNodeId(peerId) == CHIP_NO_ERROR))
+        {
+            cached->refreshPending = true;
+        }
+
+        mActiveLookups.PushBack(&handle);
+        ReArmTimer();
+        ChipLogProgress(Discovery, "Lookup for " ChipLogFormatPeerId " answered from cache", ChipLogValuePeerId(peerId));
+        return CHIP_NO_ERROR;
+    }
+
+    handle.ResetForLookup(now, request);
     ReturnErrorOnFailure(Dnssd::Resolver::Instance().ResolveNodeId(peerId));
     mActiveLookups.PushBack(&handle);
     ReArmTimer();
@@ -232,7 +395,10 @@ CHIP_ERROR Resolver::CancelLookup(Impl::NodeLookupHandle & handle, FailureCallba
 {
     VerifyOrReturnError(handle.IsActive(), CHIP_ERROR_INVALID_ARGUMENT);
     mActiveLookups.Remove(&handle);
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(handle.GetRequest().GetPeerId());
+    if (!handle.IsCachedLookup())
+    {
+        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(handle.GetRequest().GetPeerId());
+    }
 
     // Adjust any timing updates.
     ReArmTimer();
@@ -273,12 +439,16 @@ void Resolver::Shutdown()
 
         const PeerId peerId     = current->GetRequest().GetPeerId();
         NodeListener * listener = current->GetListener();
+        const bool cachedLookup = current->IsCachedLookup();
 
         mActiveLookups.Erase(current);
 
         MATTER_LOG_NODE_DISCOVERY_FAILED(&peerId, CHIP_ERROR_SHUT_DOWN);
 
-        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+        if (!cachedLookup)
+        {
+            Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+        }
         // Failure callback only called after iterator was cleared:
         // This allows failure handlers to deallocate structures that may
         // contain the active lookup data as a member (intrusive lists members)
@@ -289,12 +459,58 @@ void Resolver::Shutdown()
     // internal list of active lookups is empty at this point.
     ReArmTimer();
 
+    mCache.Clear();
     mSystemLayer = nullptr;
     Dnssd::Resolver::Instance().SetOperationalDelegate(nullptr);
 }
 
+void Resolver::InvalidateCachedResult(const PeerId & peerId)
+{
+    if (mCache.Remove(peerId))
+    {
+        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+    }
+}
+
+void Resolver::HandleCacheRefresh(const Dnssd::ResolvedNodeData & nodeData)
+{
+    const PeerId & peerId = nodeData.operationalData.peerId;
+
+    if (nodeData.operationalData.hasZeroTTL)
+    {
+        // Node is going away, do not keep any of its addresses around.
+        InvalidateCachedResult(peerId);
+        return;
+    }
+
+    ResolveCacheBase::Entry * cached = mCache.Find(peerId, mTimeSource.GetMonotonicTimestamp());
+    VerifyOrReturn((cached != nullptr) && cached->refreshPending);
+
+    ResolveResult result = ResolveResultWithoutAddress(nodeData);
+    NodeLookupResults results;
+
+    for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
+    {
+#if !INET_CONFIG_ENABLE_IPV4
+        if (!nodeData.resolutionData.ipAddress[i].IsIPv6())
+        {
+            continue;
+        }
+#endif
+        result.address.SetIPAddress(nodeData.resolutionData.ipAddress[i]);
+        results.UpdateResults(result,
+                              Dnssd::IPAddressSorter::ScoreIpAddress(result.address.GetIPAddress(), result.address.GetInterface()));
+    }
+
+    // Entry is replaced, which also clears the pending refresh.
+    mCache.StoreResults(peerId, results, mTimeSource.GetMonotonicTimestamp());
+    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+}
+
 void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeData)
 {
+    HandleCacheRefresh(nodeData);
+
     auto it = mActiveLookups.begin();
     while (it != mActiveLookups.end())
     {
@@ -305,18 +521,7 @@ void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeDat
             continue;
         }
 
-        ResolveResult result;
-
-        result.address.SetPort(nodeData.resolutionData.port);
-        result.address.SetInterface(nodeData.resolutionData.interfaceId);
-        result.mrpRemoteConfig   = nodeData.resolutionData.GetRemoteMRPConfig();
-        result.supportsTcpClient = nodeData.resolutionData.supportsTcpClient;
-        result.supportsTcpServer = nodeData.resolutionData.supportsTcpServer;
-
-        if (nodeData.resolutionData.isICDOperatingAsLIT.has_value())
-        {
-            result.isICDOperatingAsLIT = *(nodeData.resolutionData.isICDOperatingAsLIT);
-        }
+        ResolveResult result = ResolveResultWithoutAddress(nodeData);
 
         for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
         {
@@ -350,9 +555,27 @@ void Resolver::HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current)
     // final result, handle either success or failure
     const PeerId peerId     = current->GetRequest().GetPeerId();
     NodeListener * listener = current->GetListener();
+    const bool cachedLookup = current->IsCachedLookup();
+
+    if (!cachedLookup)
+    {
+        // Remember the outcome, so that subsequent lookups do not need to wait for DNSSD.
+        if (action.Type() == NodeLookupResult::kLookupSuccess)
+        {
+            mCache.StoreResults(peerId, current->GetLookupResults(), mTimeSource.GetMonotonicTimestamp());
+        }
+        else
+        {
+            mCache.StoreFailure(peerId, action.ErrorResult(), mTimeSource.GetMonotonicTimestamp());
+        }
+    }
+
     mActiveLookups.Erase(current);
 
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+    if (!cachedLookup)
+    {
+        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+    }
 
     // ensure action is taken AFTER the current current lookup is marked complete
     // This allows failure handlers to deallocate structures that may
@@ -389,12 +612,16 @@ void Resolver::HandleTimer()
 
 void Resolver::OnOperationalNodeResolutionFailed(const PeerId & peerId, CHIP_ERROR error)
 {
+    // Any cached addresses (and pending refresh) are replaced by the failure.
+    InvalidateCachedResult(peerId);
+    mCache.StoreFailure(peerId, error, mTimeSource.GetMonotonicTimestamp());
+
     auto it = mActiveLookups.begin();
     while (it != mActiveLookups.end())
     {
         auto current = it;
         it++;
-        if (current->GetRequest().GetPeerId() != peerId)
+        if ((current->GetRequest().GetPeerId() != peerId) || current->IsCachedLookup())
         {
             continue;
         }
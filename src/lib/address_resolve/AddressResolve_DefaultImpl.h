@@ -27,6 +27,7 @@ namespace AddressResolve {
 namespace Impl {
 
 inline constexpr uint8_t kNodeLookupResultsLen = CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS;
+inline constexpr size_t kResolveCacheSize       = CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE;
 
 enum class NodeLookupResult
 {
@@ -64,6 +65,81 @@ struct NodeLookupResults
 #endif // CHIP_DETAIL_LOGGING
 };
 
+/// Keeps the outcome of recent node lookups, so that repeated lookups of the
+/// same node (e.g. a controller reconnecting to many nodes at once) can be
+/// answered without waiting for DNSSD.
+///
+/// Positive entries hold all the addresses found by a lookup and expire after
+/// kPositiveTtl. Negative entries remember that a node could not be found and
+/// expire after kNegativeTtl.
+class ResolveCacheBase
+{
+public:
+    static constexpr System::Clock::Seconds16 kPositiveTtl{ CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_TTL_SECS };
+    static constexpr System::Clock::Seconds16 kNegativeTtl{ CHIP_CONFIG_ADDRESS_RESOLVE_NEGATIVE_CACHE_TTL_SECS };
+
+    struct Entry
+    {
+        PeerId peerId;
+        NodeLookupResults results;
+        CHIP_ERROR error                = CHIP_NO_ERROR; // lookup failure for negative entries
+        System::Clock::Timestamp stored = System::Clock::kZero;
+        bool valid                      = false;
+        bool refreshPending             = false; // a DNSSD resolve was started to update this entry
+
+        bool IsNegative() const { return error != CHIP_NO_ERROR; }
+    };
+
+    ResolveCacheBase(Entry * entries, size_t entryCount) : mEntries(entries), mEntryCount(entryCount) {}
+    virtual ~ResolveCacheBase() {}
+
+    /// Returns the non-expired entry for the given peer or nullptr if none exists.
+    Entry * Find(const PeerId & peerId, System::Clock::Timestamp now);
+
+    /// Remember the results of a successful lookup. Replaces any existing
+    /// entry for the peer or the oldest entry if the cache is full.
+    void StoreResults(const PeerId & peerId, const NodeLookupResults & results, System::Clock::Timestamp now);
+
+    /// Remember that a lookup for the given peer failed.
+    void StoreFailure(const PeerId & peerId, CHIP_ERROR error, System::Clock::Timestamp now);
+
+    /// Removes any entry for the given peer.
+    ///
+    /// Returns true if a background refresh was pending for the removed entry.
+    bool Remove(const PeerId & peerId);
+
+    /// Removes all entries.
+    void Clear();
+
+    /// Positive entries are refreshed in the background once half of their
+    /// lifetime has passed, so that frequently used entries do not expire.
+    static bool NeedsRefresh(const Entry & entry, System::Clock::Timestamp now);
+
+private:
+    Entry * Allocate(const PeerId & peerId, System::Clock::Timestamp now);
+
+    Entry * mEntries;
+    const size_t mEntryCount;
+};
+
+template <size_t kEntryCount>
+class ResolveCache : public ResolveCacheBase
+{
+public:
+    ResolveCache() : ResolveCacheBase(mData, kEntryCount) {}
+
+private:
+    Entry mData[kEntryCount];
+};
+
+/// A disabled cache: never stores anything.
+template <>
+class ResolveCache<0> : public ResolveCacheBase
+{
+public:
+    ResolveCache() : ResolveCacheBase(nullptr, 0) {}
+};
+
 /// Action to take when some resolve data
 /// has been received by an active lookup
 class NodeLookupAction
@@ -133,6 +209,15 @@ public:
     /// Resets internal state (i.e. best address so far)
     void ResetForLookup(System::Clock::Timestamp now, const NodeLookupRequest & request);
 
+    /// Sets up a request that is answered from a cache entry instead of DNSSD.
+    /// The outcome of the entry is reported on the next NextAction call,
+    /// without waiting for the minimum lookup time.
+    void ResetForCachedLookup(System::Clock::Timestamp now, const NodeLookupRequest & request,
+                              const ResolveCacheBase::Entry & entry);
+
+    /// Was this lookup answered from the cache?
+    bool IsCachedLookup() const { return mCachedLookup; }
+
     /// Mark that a specific IP address has been found
     void LookupResult(const ResolveResult & result);
 
@@ -153,6 +238,9 @@ public:
     /// Return the next valid lookup result.
     ResolveResult TakeLookupResult() { return mResults.ConsumeResult(); }
 
+    /// All results found so far, including already consumed ones.
+    const NodeLookupResults & GetLookupResults() const { return mResults; }
+
     /// Return when the next timer (min or max lookup time) is required to
     /// be triggered for this lookup handle
     System::Clock::Timeout NextEventTimeout(System::Clock::Timestamp now);
@@ -161,6 +249,8 @@ private:
     NodeLookupResults mResults;
     NodeLookupRequest mRequest; // active request to process
     System::Clock::Timestamp mRequestStartTime;
+    CHIP_ERROR mCachedError = CHIP_NO_ERROR;
+    bool mCachedLookup      = false;
 };
 
 class Resolver : public ::chip::AddressResolve::Resolver, public Dnssd::OperationalResolveDelegate
@@ -175,6 +265,7 @@ public:
     CHIP_ERROR TryNextResult(Impl::NodeLookupHandle & handle) override;
     CHIP_ERROR CancelLookup(Impl::NodeLookupHandle & handle, FailureCallback cancel_method) override;
     void Shutdown() override;
+    void InvalidateCachedResult(const PeerId & peerId) override;
 
     // Dnssd::OperationalResolveDelegate
 
@@ -200,9 +291,13 @@ private:
     /// be used after calling this method.
     void HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current);
 
+    /// Updates a cache entry that is waiting for a background refresh
+    void HandleCacheRefresh(const Dnssd::ResolvedNodeData & nodeData);
+
     System::Layer * mSystemLayer = nullptr;
     Time::TimeSource<Time::Source::kSystem> mTimeSource;
     IntrusiveList<NodeLookupHandle> mActiveLookups;
+    ResolveCache<kResolveCacheSize> mCache;
 };
 
 } // namespace Impl
@@ -335,4 +335,265 @@ TEST(TestAddressResolveDefaultImpl, TestLookupResult)
     // Check that the results has been consumed properly.
     EXPECT_FALSE(handle.HasLookupResult());
 }
+
+TEST(TestAddressResolveDefaultImpl, TestResolveCache)
+{
+    using namespace chip::System::Clock::Literals;
+
+    Impl::ResolveCache<2> cache;
+
+    const PeerId peer1(1, 2);
+    const PeerId peer2(1, 3);
+    const PeerId peer3(1, 4);
+
+    ResolveResult result;
+    result.address = GetAddressWithHighScore();
+
+    Impl::NodeLookupResults results;
+    results.UpdateResults(result, IpScore::kLinkLocal);
+    results.ConsumeResult();
+
+    System::Clock::Timestamp now = 1000_ms64;
+    EXPECT_EQ(cache.Find(peer1, now), nullptr);
+
+    cache.StoreResults(peer1, results, now);
+    cache.StoreFailure(peer2, CHIP_ERROR_TIMEOUT, now);
+
+    // Stored results can be read back in full, even if already consumed by the lookup
+    auto * entry = cache.Find(peer1, now);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_FALSE(entry->IsNegative());
+    EXPECT_TRUE(entry->results.HasValidResult());
+    EXPECT_EQ(entry->results.ConsumeResult().address, result.address);
+
+    entry = cache.Find(peer2, now);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_TRUE(entry->IsNegative());
+    EXPECT_EQ(entry->error, CHIP_ERROR_TIMEOUT);
+
+    // Cache is full: the oldest entry (peer1) is replaced
+    now += 1_ms64;
+    cache.StoreResults(peer3, results, now);
+    EXPECT_EQ(cache.Find(peer1, now), nullptr);
+    EXPECT_NE(cache.Find(peer2, now), nullptr);
+    EXPECT_NE(cache.Find(peer3, now), nullptr);
+
+    // Positive entries want a refresh once half their lifetime has passed
+    entry = cache.Find(peer3, now);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_FALSE(Impl::ResolveCacheBase::NeedsRefresh(*entry, now));
+    EXPECT_TRUE(Impl::ResolveCacheBase::NeedsRefresh(*entry, now + Impl::ResolveCacheBase::kPositiveTtl / 2));
+    entry->refreshPending = true;
+    EXPECT_FALSE(Impl::ResolveCacheBase::NeedsRefresh(*entry, now + Impl::ResolveCacheBase::kPositiveTtl / 2));
+
+    // Negative entries expire sooner than positive ones
+    const System::Clock::Timestamp storedAt = now;
+    now += Impl::ResolveCacheBase::kNegativeTtl;
+    EXPECT_EQ(cache.Find(peer2, now), nullptr);
+    EXPECT_NE(cache.Find(peer3, now), nullptr);
+    EXPECT_EQ(cache.Find(peer3, storedAt + Impl::ResolveCacheBase::kPositiveTtl), nullptr);
+
+    // Removal reports pending refreshes
+    cache.StoreResults(peer1, results, now);
+    EXPECT_FALSE(cache.Remove(peer1));
+    EXPECT_EQ(cache.Find(peer1, now), nullptr);
+
+    cache.StoreResults(peer1, results, now);
+    cache.Find(peer1, now)->refreshPending = true;
+    EXPECT_TRUE(cache.Remove(peer1));
+    EXPECT_FALSE(cache.Remove(peer1));
+}
+
+TEST(TestAddressResolveDefaultImpl, TestCachedLookup)
+{
+    Impl::ResolveCache<1> cache;
+
+    ResolveResult result;
+    result.address = GetAddressWithMediumScore();
+
+    Impl::NodeLookupResults results;
+    results.UpdateResults(result, IpScore::kGlobalUnicast);
+
+    auto now     = System::SystemClock().GetMonotonicTimestamp();
+    auto request = NodeLookupRequest(chip::PeerId(1, 2));
+    cache.StoreResults(request.GetPeerId(), results, now);
+
+    AddressResolve::NodeLookupHandle handle;
+    handle.ResetForCachedLookup(now, request, *cache.Find(request.GetPeerId(), now));
+    EXPECT_TRUE(handle.IsCachedLookup());
+
+    // Cached results do not wait for the minimum lookup time
+    EXPECT_EQ(handle.NextEventTimeout(now), System::Clock::Timeout::zero());
+    auto action = handle.NextAction(now);
+    ASSERT_EQ(action.Type(), Impl::NodeLookupResult::kLookupSuccess);
+    EXPECT_EQ(action.ResolveResult().address, result.address);
+
+    // Negative entries fail the lookup right away
+    cache.StoreFailure(request.GetPeerId(), CHIP_ERROR_TIMEOUT, now);
+    handle.ResetForCachedLookup(now, request, *cache.Find(request.GetPeerId(), now));
+    action = handle.NextAction(now);
+    ASSERT_EQ(action.Type(), Impl::NodeLookupResult::kLookupError);
+    EXPECT_EQ(action.ErrorResult(), CHIP_ERROR_TIMEOUT);
+
+    // A regular lookup is not cached
+    handle.ResetForLookup(now, request);
+    EXPECT_FALSE(handle.IsCachedLookup());
+    EXPECT_EQ(handle.NextAction(now).Type(), Impl::NodeLookupResult::kKeepSearching);
+}
+
+/// Counts the DNSSD resolves that the resolver starts
+class CountingDnssdResolver : public Dnssd::Resolver
+{
+public:
+    CHIP_ERROR Init(Inet::EndPointManager<Inet::UDPEndPoint> * endPointManager) override { return CHIP_NO_ERROR; }
+    bool IsInitialized() override { return true; }
+    void Shutdown() override {}
+    void SetOperationalDelegate(Dnssd::OperationalResolveDelegate * delegate) override {}
+    CHIP_ERROR ResolveNodeId(const PeerId & peerId) override
+    {
+        mResolveCount++;
+        return CHIP_NO_ERROR;
+    }
+    void NodeIdResolutionNoLongerNeeded(const PeerId & peerId) override {}
+    CHIP_ERROR StartDiscovery(Dnssd::DiscoveryType type, Dnssd::DiscoveryFilter filter, Dnssd::DiscoveryContext &) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR StopDiscovery(Dnssd::DiscoveryContext &) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR ReconfirmRecord(const char * hostname, Inet::IPAddress address, Inet::InterfaceId interfaceId) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    size_t mResolveCount = 0;
+};
+
+/// Keeps the resolver timer so that the test fires it when it wants
+class ManualTimerLayer : public System::Layer
+{
+public:
+    CHIP_ERROR Init() override { return CHIP_NO_ERROR; }
+    void Shutdown() override {}
+    bool IsInitialized() const override { return true; }
+    CHIP_ERROR StartTimer(System::Clock::Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        mCallback = aComplete;
+        mAppState = aAppState;
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR ExtendTimerTo(System::Clock::Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    bool IsTimerActive(System::TimerCompleteCallback onComplete, void * appState) override { return mCallback != nullptr; }
+    System::Clock::Timeout GetRemainingTime(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return System::Clock::Timeout::zero();
+    }
+    void CancelTimer(System::TimerCompleteCallback aOnComplete, void * aAppState) override { mCallback = nullptr; }
+    CHIP_ERROR ScheduleWork(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    void FireTimer()
+    {
+        System::TimerCompleteCallback callback = mCallback;
+        mCallback                              = nullptr;
+        ASSERT_NE(callback, nullptr);
+        callback(this, mAppState);
+    }
+
+private:
+    System::TimerCompleteCallback mCallback = nullptr;
+    void * mAppState                        = nullptr;
+};
+
+class RecordingListener : public NodeListener
+{
+public:
+    void OnNodeAddressResolved(const PeerId & peerId, const ResolveResult & result) override
+    {
+        mResolvedCount++;
+        mLastAddress = result.address;
+    }
+    void OnNodeAddressResolutionFailed(const PeerId & peerId, CHIP_ERROR reason) override { mFailedCount++; }
+
+    size_t mResolvedCount = 0;
+    size_t mFailedCount   = 0;
+    Transport::PeerAddress mLastAddress;
+};
+
+TEST(TestAddressResolveDefaultImpl, TestResolverCache)
+{
+    using namespace chip::System::Clock::Literals;
+
+    CountingDnssdResolver dnssd;
+    Dnssd::Resolver & previousDnssd = Dnssd::Resolver::Instance();
+    Dnssd::Resolver::SetInstance(dnssd);
+
+    ManualTimerLayer layer;
+    Impl::Resolver resolver;
+    ASSERT_EQ(resolver.Init(&layer), CHIP_NO_ERROR);
+
+    const PeerId peer(1, 2);
+    NodeLookupRequest request(peer);
+    request.SetMinLookupTime(0_ms32);
+
+    RecordingListener listener;
+    Impl::NodeLookupHandle first;
+    first.SetListener(&listener);
+    ASSERT_EQ(resolver.LookupNode(request, first), CHIP_NO_ERROR);
+    EXPECT_EQ(dnssd.mResolveCount, 1u);
+
+    const Transport::PeerAddress address = GetAddressWithMediumScore();
+    Dnssd::ResolvedNodeData nodeData;
+    nodeData.operationalData.peerId      = peer;
+    nodeData.operationalData.hasZeroTTL  = false;
+    nodeData.resolutionData.port         = address.GetPort();
+    nodeData.resolutionData.numIPs       = 1;
+    nodeData.resolutionData.ipAddress[0] = address.GetIPAddress();
+    resolver.OnOperationalNodeResolved(nodeData);
+    EXPECT_EQ(listener.mResolvedCount, 1u);
+
+    // The same node again
+    Impl::NodeLookupHandle second;
+    second.SetListener(&listener);
+    ASSERT_EQ(resolver.LookupNode(request, second), CHIP_NO_ERROR);
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    // Answered from the cache on the next timer, without DNSSD
+    EXPECT_TRUE(second.IsCachedLookup());
+    EXPECT_EQ(dnssd.mResolveCount, 1u);
+    layer.FireTimer();
+    EXPECT_EQ(listener.mResolvedCount, 2u);
+    EXPECT_EQ(listener.mLastAddress, address);
+
+    // Invalidated results are looked up again
+    resolver.InvalidateCachedResult(peer);
+    Impl::NodeLookupHandle third;
+    third.SetListener(&listener);
+    ASSERT_EQ(resolver.LookupNode(request, third), CHIP_NO_ERROR);
+    EXPECT_FALSE(third.IsCachedLookup());
+    EXPECT_EQ(dnssd.mResolveCount, 2u);
+
+    // Failures are cached as well
+    resolver.OnOperationalNodeResolutionFailed(peer, CHIP_ERROR_TIMEOUT);
+    EXPECT_EQ(listener.mFailedCount, 1u);
+    Impl::NodeLookupHandle fourth;
+    fourth.SetListener(&listener);
+    ASSERT_EQ(resolver.LookupNode(request, fourth), CHIP_NO_ERROR);
+    EXPECT_TRUE(fourth.IsCachedLookup());
+    layer.FireTimer();
+    EXPECT_EQ(listener.mFailedCount, 2u);
+    EXPECT_EQ(dnssd.mResolveCount, 2u);
+#else
+    // Without a cache every lookup goes to DNSSD
+    EXPECT_FALSE(second.IsCachedLookup());
+    EXPECT_EQ(dnssd.mResolveCount, 2u);
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
+    resolver.Shutdown();
+    Dnssd::Resolver::SetInstance(previousDnssd);
+}
+
 } // namespace
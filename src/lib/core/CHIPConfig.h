@@ -163,6 +163,24 @@
 #define CHIP_CONFIG_MEMORY_DEBUG_DMALLOC 0
 #endif // CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
 
+/**
+ *  @def CHIP_CONFIG_MEMORY_ACCOUNTING
+ *
+ *  @brief
+ *    Enable (1) or disable (0) attributing heap allocations and object
+ *    pool usage to subsystem tags, with per-tag high-water marks (see
+ *    lib/support/MemoryAccounting.h). When enabled, each heap allocation
+ *    carries a small header holding its size and tag.
+ *
+ *  @note Only supported with #CHIP_CONFIG_MEMORY_MGMT_MALLOC.
+ *
+ *  GN builds set it through the chip_config_memory_accounting argument.
+ *
+ */
+#ifndef CHIP_CONFIG_MEMORY_ACCOUNTING
+#define CHIP_CONFIG_MEMORY_ACCOUNTING 0
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
+
 /**
  *  @def CHIP_CONFIG_GLOBALS_LAZY_INIT
  *
@@ -483,6 +501,27 @@
 #define CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE 256
 #endif
 
+/**
+ * CHIP_CONFIG_DEFERRED_LOGGING_ENTRIES
+ *
+ * The number of log messages that can wait to be formatted when deferred
+ * logging (CHIP_DEFERRED_LOGGING) is enabled. Must be a power of two.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_LOGGING_ENTRIES
+#define CHIP_CONFIG_DEFERRED_LOGGING_ENTRIES 64
+#endif
+
+/**
+ * CHIP_CONFIG_DEFERRED_LOGGING_ARGS_SIZE
+ *
+ * The size (in bytes) available for the arguments of a deferred log message,
+ * including copies of its string arguments. Messages whose arguments do not
+ * fit are logged right away instead.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_LOGGING_ARGS_SIZE
+#define CHIP_CONFIG_DEFERRED_LOGGING_ARGS_SIZE 96
+#endif
+
 /**
  *  @def CHIP_CONFIG_ENABLE_CONDITION_LOGGING
  *
@@ -802,6 +841,24 @@
 #define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (CHIP_CONFIG_MAX_FABRICS * 3 + 2)
 #endif // CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
 
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+ *
+ * @brief Enables auxiliary indexes in the secure session table: a hash of
+ * local session IDs, a per-peer index, a bitmap of used session IDs and
+ * O(n log n) eviction ordering.
+ *
+ * Lookups in the default table are linear in the number of sessions, which
+ * is fine for devices but becomes a bottleneck on controllers configured
+ * with a CHIP_CONFIG_SECURE_SESSION_POOL_SIZE in the thousands. The indexes
+ * cost roughly 8 KB plus two pointers per session slot of extra RAM.
+ *
+ * GN builds set it through the chip_config_secure_session_table_indexed argument.
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+#define CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED 0
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+
 /**
  *  @def CHIP_CONFIG_MAX_GROUP_DATA_PEERS
  *
@@ -887,6 +944,7 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
  *      * #CHIP_IM_MAX_REPORTS_IN_FLIGHT
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS
  *      * #CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+ *      * #CHIP_IM_SERVER_MAX_NUM_DIRTY_BATCH_PATHS
  *      * #CHIP_IM_MAX_NUM_WRITE_HANDLER
  *      * #CHIP_IM_MAX_NUM_WRITE_CLIENT
  *      * #CHIP_IM_MAX_NUM_TIMED_HANDLER
@@ -955,6 +1013,41 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS (CHIP_IM_MAX_NUM_READS * 9)
 #endif
 
+/**
+ * @def CHIP_IM_READ_HANDLER_ARENA
+ *
+ * @brief Allocate the attribute paths, event paths and data version filters of each ReadHandler from arenas owned by the
+ *        handler, instead of the path pools shared by all handlers. The arenas are carved out of heap chunks, so this
+ *        is meant for platforms whose object pools are allocated from the heap.
+ *
+ *        GN builds set it through the chip_im_read_handler_arena argument.
+ */
+#ifndef CHIP_IM_READ_HANDLER_ARENA
+#define CHIP_IM_READ_HANDLER_ARENA 0
+#endif
+
+/**
+ * @def CHIP_IM_READ_HANDLER_ARENA_CHUNK_SIZE
+ *
+ * @brief Size in bytes of the chunks the ReadHandler arenas allocate at a time, see CHIP_IM_READ_HANDLER_ARENA. The
+ *        chunks allocated when a request is parsed are sized for its paths instead, so this only applies to paths added
+ *        afterwards.
+ */
+#ifndef CHIP_IM_READ_HANDLER_ARENA_CHUNK_SIZE
+#define CHIP_IM_READ_HANDLER_ARENA_CHUNK_SIZE 512
+#endif
+
+/**
+ * @def CHIP_IM_READ_HANDLER_ARENA_FABRIC_BUDGET
+ *
+ * @brief Bytes of arena memory the ReadHandlers of a fabric can hold together, see CHIP_IM_READ_HANDLER_ARENA. Reads and
+ *        subscriptions that would go over it fail with PathsExhausted. 0 means no limit. It can be changed at runtime
+ *        with InteractionModelEngine::SetFabricArenaBudget.
+ */
+#ifndef CHIP_IM_READ_HANDLER_ARENA_FABRIC_BUDGET
+#define CHIP_IM_READ_HANDLER_ARENA_FABRIC_BUDGET 0
+#endif
+
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
  *
@@ -964,6 +1057,16 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_MAX_NUM_DIRTY_BATCH_PATHS
+ *
+ * @brief Defines the number of distinct changed attribute paths the reporting engine buffers while a dirty batch is open,
+ *        before marking them dirty together.
+ */
+#ifndef CHIP_IM_SERVER_MAX_NUM_DIRTY_BATCH_PATHS
+#define CHIP_IM_SERVER_MAX_NUM_DIRTY_BATCH_PATHS 16
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -1151,6 +1254,21 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_GROUP_ENDPOINT_CACHE_SIZE
+ *
+ * @brief Defines the number of groups whose endpoint lists are kept in memory
+ *
+ * Group commands and writes look up the endpoints of the destination group on
+ * every message. The most recently used groups have their endpoint list cached
+ * (on the heap) so that repeated group messages do not reload the group table
+ * from storage. Any change to the groups of a fabric drops its cached entries.
+ * Set to 0 to disable caching.
+ */
+#ifndef CHIP_CONFIG_GROUP_ENDPOINT_CACHE_SIZE
+#define CHIP_CONFIG_GROUP_ENDPOINT_CACHE_SIZE 2
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_NAME_LENGTH
  *
@@ -1436,6 +1554,19 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES 2
 #endif // CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES
 
+/*
+ * @def CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+ *
+ * @brief Number of serialized replies the minmdns advertiser keeps for
+ *        answering repeated queries without rebuilding records.
+ *
+ *        Each entry holds up to two reply packets in heap memory. Setting
+ *        this to 0 disables reply caching.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE 0
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+
 /**
  * def CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS
  *
@@ -1469,6 +1600,43 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS 45000
 #endif // CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS
 
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+ *
+ * @brief Number of node lookup outcomes (resolved addresses or lookup failures)
+ *        that the default address resolver keeps, so that repeated lookups of
+ *        the same node are answered without waiting for DNSSD.
+ *
+ *        Controllers that (re)connect to many nodes at once benefit from a cache
+ *        sized to the number of nodes they talk to. A value of 0 disables caching.
+ *
+ *        GN builds set it through the chip_config_address_resolve_cache_size argument.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE 0
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_TTL_SECS
+ *
+ * @brief How long resolved node addresses are kept in the address resolve cache,
+ *        in seconds. Matches the TTL of operational DNSSD host records. Entries
+ *        in use are refreshed in the background after half of this time.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_TTL_SECS
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_TTL_SECS 120
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_TTL_SECS
+
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_NEGATIVE_CACHE_TTL_SECS
+ *
+ * @brief How long a failed node lookup is remembered in the address resolve
+ *        cache, in seconds. Lookups started during this time fail immediately.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_NEGATIVE_CACHE_TTL_SECS
+#define CHIP_CONFIG_ADDRESS_RESOLVE_NEGATIVE_CACHE_TTL_SECS 10
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_NEGATIVE_CACHE_TTL_SECS
+
 /*
  * @def CHIP_CONFIG_NETWORK_COMMISSIONING_DEBUG_TEXT_BUFFER_SIZE
  *
@@ -1940,6 +2108,29 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID 0
 #endif // CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID
 
+/**
+ *  @def CHIP_CONFIG_TRANSITION_SCHEDULER_TICK_DURATION_MS
+ *
+ *  @brief
+ *    Granularity of the steps run by chip::app::TransitionScheduler on behalf of the Level Control and Color Control
+ *    clusters. Steps due within the same tick are run together, with a single reporting pass.
+ */
+#ifndef CHIP_CONFIG_TRANSITION_SCHEDULER_TICK_DURATION_MS
+#define CHIP_CONFIG_TRANSITION_SCHEDULER_TICK_DURATION_MS 10
+#endif // CHIP_CONFIG_TRANSITION_SCHEDULER_TICK_DURATION_MS
+
+/**
+ *  @def CHIP_CONFIG_MAX_CONCURRENT_TRANSITIONS
+ *
+ *  @brief
+ *    Maximum number of steps scheduled at the same time by chip::app::TransitionScheduler, which is one per endpoint
+ *    and cluster with a transition in progress. Steps beyond it run from a timer of their own, without sharing ticks.
+ *    Ignored when object pools are allocated on the heap.
+ */
+#ifndef CHIP_CONFIG_MAX_CONCURRENT_TRANSITIONS
+#define CHIP_CONFIG_MAX_CONCURRENT_TRANSITIONS 16
+#endif // CHIP_CONFIG_MAX_CONCURRENT_TRANSITIONS
+
 /**
  * @}
  */
@@ -177,6 +177,10 @@ public:
         {
             ChipLogError(Discovery, "Failed to set up commissioner responder: %" CHIP_ERROR_FORMAT, err.Format());
         }
+
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+        mResponseSender.SetResponseCache(&mResponseCache);
+#endif
     }
     ~AdvertiserMinMdns() override { ClearServices(); }
 
@@ -312,6 +316,9 @@ private:
     void ClearServices();
 
     ResponseSender mResponseSender;
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    ResponseCache<CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE> mResponseCache;
+#endif
     uint8_t mCommissionableInstanceName[sizeof(uint64_t)];
 
     bool mIsInitialized = false;
@@ -376,6 +383,9 @@ CHIP_ERROR AdvertiserMinMdns::Init(chip::Inet::EndPointManager<chip::Inet::UDPEn
     // GlobalMinimalMdnsServer (used for testing).
     mResponseSender.SetServer(&GlobalMinimalMdnsServer::Server());
 
+    // Interfaces (and their addresses) may have changed, so cached replies are stale.
+    mResponseSender.InvalidateResponseCache();
+
     ReturnErrorOnFailure(GlobalMinimalMdnsServer::Instance().StartServer(udpEndPointManager, kMdnsPort));
 
     ChipLogProgress(Discovery, "CHIP minimal mDNS started advertising.");
@@ -413,6 +423,8 @@ CHIP_ERROR AdvertiserMinMdns::RemoveServices()
 
 void AdvertiserMinMdns::ClearServices()
 {
+    mResponseSender.InvalidateResponseCache();
+
     while (mOperationalResponders.begin() != mOperationalResponders.end())
     {
         auto it = mOperationalResponders.begin();
@@ -477,6 +489,7 @@ OperationalQueryAllocator::Allocator * AdvertiserMinMdns::FindEmptyOperationalAl
 CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters & params)
 {
     VerifyOrReturnError(mIsInitialized, CHIP_ERROR_INCORRECT_STATE);
+    mResponseSender.InvalidateResponseCache();
 
     char nameBuffer[Operational::kInstanceNameMaxLength + 1] = "";
 
@@ -607,6 +620,7 @@ CHIP_ERROR AdvertiserMinMdns::UpdateCommissionableInstanceName()
 CHIP_ERROR AdvertiserMinMdns::Advertise(const CommissionAdvertisingParameters & params)
 {
     VerifyOrReturnError(mIsInitialized, CHIP_ERROR_INCORRECT_STATE);
+    mResponseSender.InvalidateResponseCache();
 
     if (params.GetCommissionAdvertiseMode() == CommssionAdvertiseMode::kCommissionableNode)
     {
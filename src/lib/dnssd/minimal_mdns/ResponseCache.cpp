@@ -0,0 +1,185 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "ResponseCache.h"
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+namespace mdns {
+namespace Minimal {
+
+bool ResponseCacheKey::Build(const QueryData & query, const chip::Inet::IPPacketInfo & source, bool sendUnicast,
+                             bool includeQuery)
+{
+    mType         = query.GetType();
+    mClass        = query.GetClass();
+    mSendUnicast  = sendUnicast;
+    mIncludeQuery = includeQuery;
+    mInterface    = source.Interface;
+    mNameLength   = 0;
+
+    // Names are stored as a sequence of <length><label> entries. Comparison is exact
+    // (i.e. case sensitive) since the query itself may be echoed back in the reply.
+    SerializedQNameIterator name = query.GetName();
+    while (name.Next())
+    {
+        const size_t labelLength = strlen(name.Value());
+        VerifyOrReturnValue(mNameLength + 1 + labelLength <= kMaxNameLength, false);
+
+        mName[mNameLength++] = static_cast<uint8_t>(labelLength);
+        memcpy(&mName[mNameLength], name.Value(), labelLength);
+        mNameLength += labelLength;
+    }
+
+    return name.IsValid();
+}
+
+bool ResponseCacheKey::operator==(const ResponseCacheKey & other) const
+{
+    return (mType == other.mType) && (mClass == other.mClass) && (mSendUnicast == other.mSendUnicast) &&
+        (mIncludeQuery == other.mIncludeQuery) && (mInterface == other.mInterface) && (mNameLength == other.mNameLength) &&
+        (memcmp(mName, other.mName, mNameLength) == 0);
+}
+
+ResponseCacheBase::Entry::~Entry()
+{
+    chip::Platform::MemoryFree(mData);
+}
+
+chip::ByteSpan ResponseCacheBase::Entry::GetPacket(size_t index) const
+{
+    VerifyOrReturnValue(index < mPacketCount, chip::ByteSpan());
+    return chip::ByteSpan(mData + mPacketOffsets[index], mPacketLengths[index]);
+}
+
+const ResponseCacheBase::Entry * ResponseCacheBase::Find(const ResponseCacheKey & key, chip::System::Clock::Timestamp now)
+{
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        Entry & entry = mEntries[i];
+        if (!entry.mValid || !(entry.mKey == key))
+        {
+            continue;
+        }
+
+        if (now - entry.mCreated > kMaxEntryAge)
+        {
+            entry.Invalidate();
+            break;
+        }
+
+        mHitCount++;
+        return &entry;
+    }
+
+    mMissCount++;
+    return nullptr;
+}
+
+ResponseCacheBase::Entry * ResponseCacheBase::StartFill(const ResponseCacheKey & key, chip::System::Clock::Timestamp now)
+{
+    VerifyOrReturnValue(mEntryCount > 0, nullptr);
+
+    // Prefer unused slots, otherwise replace the oldest reply
+    Entry * target = &mEntries[0];
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        Entry & entry = mEntries[i];
+        if (!entry.mValid)
+        {
+            target = &entry;
+            break;
+        }
+        if (entry.mCreated < target->mCreated)
+        {
+            target = &entry;
+        }
+    }
+
+    target->Invalidate();
+    target->mKey     = key;
+    target->mCreated = now;
+    target->mFilling = true;
+
+    return target;
+}
+
+void ResponseCacheBase::RecordAnswer(Entry * entry, Internal::QueryResponderInfo * info)
+{
+    VerifyOrReturn(entry->mFilling);
+
+    if (entry->mAnswerCount >= kMaxAnswersPerEntry)
+    {
+        entry->Invalidate();
+        return;
+    }
+
+    entry->mAnswers[entry->mAnswerCount++] = info;
+}
+
+void ResponseCacheBase::RecordPacket(Entry * entry, const chip::System::PacketBufferHandle & packet)
+{
+    VerifyOrReturn(entry->mFilling);
+
+    // Reply packets are built into a single buffer, chains are never expected here
+    if ((entry->mPacketCount >= kMaxPacketsPerEntry) || packet->HasChainedBuffer())
+    {
+        entry->Invalidate();
+        return;
+    }
+
+    const size_t length = packet->DataLength();
+    if (entry->mDataLength + length > entry->mDataCapacity)
+    {
+        uint8_t * data = static_cast<uint8_t *>(chip::Platform::MemoryRealloc(entry->mData, entry->mDataLength + length));
+        if (data == nullptr)
+        {
+            entry->Invalidate();
+            return;
+        }
+        entry->mData         = data;
+        entry->mDataCapacity = entry->mDataLength + length;
+    }
+
+    memcpy(entry->mData + entry->mDataLength, packet->Start(), length);
+    entry->mPacketOffsets[entry->mPacketCount] = entry->mDataLength;
+    entry->mPacketLengths[entry->mPacketCount] = static_cast<uint16_t>(length);
+    entry->mPacketCount++;
+    entry->mDataLength += length;
+}
+
+void ResponseCacheBase::CommitFill(Entry * entry)
+{
+    VerifyOrReturn(entry->mFilling);
+
+    entry->mFilling = false;
+    entry->mValid   = true;
+}
+
+void ResponseCacheBase::Invalidate()
+{
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        mEntries[i].Invalidate();
+    }
+}
+
+} // namespace Minimal
+} // namespace mdns
@@ -0,0 +1,185 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/dnssd/minimal_mdns/Parser.h>
+#include <lib/dnssd/minimal_mdns/responders/QueryResponder.h>
+#include <lib/support/Span.h>
+
+#include <inet/IPPacketInfo.h>
+#include <system/SystemClock.h>
+#include <system/SystemPacketBuffer.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace mdns {
+namespace Minimal {
+
+/// Identifies a reply that can be replayed from a ResponseCache.
+///
+/// Two queries with the same key are guaranteed to generate byte-identical
+/// replies (except for the message id) as long as the set of query responders
+/// is not changed.
+class ResponseCacheKey
+{
+public:
+    /// Maximum serialized size of a query name that can be cached. Longer
+    /// names are valid but are always answered without a cache lookup.
+    static constexpr size_t kMaxNameLength = 128;
+
+    /// Builds the key for the given query.
+    ///
+    /// Returns false if the query cannot be cached (e.g. name too long or invalid).
+    bool Build(const QueryData & query, const chip::Inet::IPPacketInfo & source, bool sendUnicast, bool includeQuery);
+
+    bool operator==(const ResponseCacheKey & other) const;
+
+private:
+    QType mType        = QType::ANY;
+    QClass mClass      = QClass::ANY;
+    bool mSendUnicast  = false;
+    bool mIncludeQuery = false;
+    chip::Inet::InterfaceId mInterface;
+    size_t mNameLength = 0;
+    uint8_t mName[kMaxNameLength];
+};
+
+/// Stores fully serialized mDNS replies, so that repeated queries can be answered
+/// by copying pre-built packets instead of re-running all responders and name
+/// compression.
+///
+/// Cached replies reference the query responder records they answered with
+/// (to maintain multicast throttling), so the cache MUST be invalidated whenever
+/// query responders or their records change.
+class ResponseCacheBase
+{
+public:
+    /// Maximum number of reply packets a single cached response may span.
+    static constexpr size_t kMaxPacketsPerEntry = 2;
+
+    /// Maximum number of answer records tracked for multicast throttling. Replies
+    /// with more answers than this are not cached.
+    static constexpr size_t kMaxAnswersPerEntry = 16;
+
+    /// Cached replies older than this are not used, which bounds staleness of
+    /// IP address records on interface changes that do not re-initialize
+    /// advertising.
+    static constexpr chip::System::Clock::Seconds16 kMaxEntryAge = chip::System::Clock::Seconds16(10);
+
+    class Entry
+    {
+    public:
+        Entry() {}
+        ~Entry();
+
+        Entry(const Entry &)             = delete;
+        Entry & operator=(const Entry &) = delete;
+
+        bool IsValid() const { return mValid; }
+
+        size_t GetPacketCount() const { return mPacketCount; }
+        chip::ByteSpan GetPacket(size_t index) const;
+
+        size_t GetAnswerCount() const { return mAnswerCount; }
+        Internal::QueryResponderInfo * GetAnswer(size_t index) const { return mAnswers[index]; }
+
+    private:
+        friend class ResponseCacheBase;
+
+        void Invalidate()
+        {
+            mValid       = false;
+            mFilling     = false;
+            mDataLength  = 0;
+            mPacketCount = 0;
+            mAnswerCount = 0;
+        }
+
+        ResponseCacheKey mKey;
+        chip::System::Clock::Timestamp mCreated = chip::System::Clock::kZero;
+        bool mValid                             = false;
+        bool mFilling                           = false;
+
+        // Packet storage, grown on demand and reused across invalidations so that
+        // refilling an entry generally does not allocate.
+        uint8_t * mData      = nullptr;
+        size_t mDataCapacity = 0;
+        size_t mDataLength   = 0;
+
+        size_t mPacketCount = 0;
+        size_t mPacketOffsets[kMaxPacketsPerEntry];
+        uint16_t mPacketLengths[kMaxPacketsPerEntry];
+
+        size_t mAnswerCount = 0;
+        Internal::QueryResponderInfo * mAnswers[kMaxAnswersPerEntry];
+    };
+
+    ResponseCacheBase(Entry * entries, size_t entryCount) : mEntries(entries), mEntryCount(entryCount) {}
+    virtual ~ResponseCacheBase() {}
+
+    /// Find a valid, non-expired cached reply for the given key.
+    ///
+    /// Returns nullptr if no such entry exists. Updates hit/miss statistics.
+    const Entry * Find(const ResponseCacheKey & key, chip::System::Clock::Timestamp now);
+
+    /// Starts recording a new reply for the given key, replacing the oldest entry.
+    ///
+    /// The returned entry is not visible to Find until CommitFill is called.
+    Entry * StartFill(const ResponseCacheKey & key, chip::System::Clock::Timestamp now);
+
+    /// Record that the reply being built answered with the given record.
+    /// Marks the fill as failed if too many answers are recorded.
+    void RecordAnswer(Entry * entry, Internal::QueryResponderInfo * info);
+
+    /// Record a packet that was sent as part of the reply being built.
+    /// Marks the fill as failed if the packet does not fit.
+    void RecordPacket(Entry * entry, const chip::System::PacketBufferHandle & packet);
+
+    /// Makes a completely recorded reply available for lookups.
+    void CommitFill(Entry * entry);
+
+    /// Abandons a reply that failed to be recorded.
+    void AbortFill(Entry * entry) { entry->Invalidate(); }
+
+    /// Drop all cached replies.
+    void Invalidate();
+
+    uint32_t GetHitCount() const { return mHitCount; }
+    uint32_t GetMissCount() const { return mMissCount; }
+
+private:
+    Entry * mEntries;
+    const size_t mEntryCount;
+
+    uint32_t mHitCount  = 0;
+    uint32_t mMissCount = 0;
+};
+
+template <size_t kEntryCount>
+class ResponseCache : public ResponseCacheBase
+{
+public:
+    ResponseCache() : ResponseCacheBase(mData, kEntryCount) {}
+
+private:
+    Entry mData[kEntryCount];
+};
+
+} // namespace Minimal
+} // namespace mdns
@@ -62,12 +62,14 @@ CHIP_ERROR ResponseSender::AddQueryResponder(QueryResponderBase * queryResponder
         if (responder == nullptr || responder == queryResponder)
         {
             responder = queryResponder;
+            InvalidateResponseCache();
             return CHIP_NO_ERROR;
         }
     }
 
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
     mResponders.push_back(queryResponder);
+    InvalidateResponseCache();
     return CHIP_NO_ERROR;
 #else
     return CHIP_ERROR_NO_MEMORY;
@@ -84,6 +86,7 @@ CHIP_ERROR ResponseSender::RemoveQueryResponder(QueryResponderBase * queryRespon
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
             mResponders.erase(it);
 #endif
+            InvalidateResponseCache();
             return CHIP_NO_ERROR;
         }
     }
@@ -107,6 +110,55 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
 {
     mSendState.Reset(messageId, query, querySource);
 
+    const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
+
+    // Announcements and TTL overrides are rare and are never cached: cached replies are only
+    // valid for the default response configuration.
+    ResponseCacheKey cacheKey;
+    if ((mResponseCache == nullptr) || query.IsAnnounceBroadcast() || configuration.GetTtlSecondsOverride().has_value() ||
+        !cacheKey.Build(query, *querySource, mSendState.SendUnicast(), mSendState.IncludeQuery()))
+    {
+        return BuildAndSendReply(query, querySource, configuration, kTimeNow);
+    }
+
+    const ResponseCacheBase::Entry * cached = mResponseCache->Find(cacheKey, kTimeNow);
+    if (cached != nullptr)
+    {
+        CHIP_ERROR err = SendCachedReply(*cached, kTimeNow);
+        VerifyOrReturnError(err == CHIP_ERROR_INCORRECT_STATE, err);
+
+        // Some answers are throttled, so the full reply cannot be replayed.
+        return BuildAndSendReply(query, querySource, configuration, kTimeNow);
+    }
+
+    // A reply built while some answers are throttled is partial and must not be cached.
+    if (!mSendState.SendUnicast() && HasThrottledAnswers(query, kTimeNow - chip::System::Clock::Seconds32(1)))
+    {
+        return BuildAndSendReply(query, querySource, configuration, kTimeNow);
+    }
+
+    mCacheFillEntry = mResponseCache->StartFill(cacheKey, kTimeNow);
+
+    CHIP_ERROR err = BuildAndSendReply(query, querySource, configuration, kTimeNow);
+    if (mCacheFillEntry != nullptr)
+    {
+        if (err == CHIP_NO_ERROR)
+        {
+            mResponseCache->CommitFill(mCacheFillEntry);
+        }
+        else
+        {
+            mResponseCache->AbortFill(mCacheFillEntry);
+        }
+        mCacheFillEntry = nullptr;
+    }
+
+    return err;
+}
+
+CHIP_ERROR ResponseSender::BuildAndSendReply(const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
+                                             const ResponseConfiguration & configuration, chip::System::Clock::Timestamp now)
+{
     if (query.IsAnnounceBroadcast())
     {
         // Deny listing large amount of data
@@ -128,8 +180,6 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
 
     // send all 'Answer' replies
     {
-        const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
-
         QueryReplyFilter queryReplyFilter(query);
         QueryResponderRecordFilter responseFilter;
 
@@ -141,7 +191,7 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
             //
             // TODO: the 'last sent' value does NOT track the interface we used to send, so this may cause
             //       broadcasts on one interface to throttle broadcasts on another interface.
-            responseFilter.SetIncludeOnlyMulticastBeforeMS(kTimeNow - chip::System::Clock::Seconds32(1));
+            responseFilter.SetIncludeOnlyMulticastBeforeMS(now - chip::System::Clock::Seconds32(1));
         }
         for (auto & responder : mResponders)
         {
@@ -156,9 +206,14 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
 
                 responder->MarkAdditionalRepliesFor(it);
 
+                if (mCacheFillEntry != nullptr)
+                {
+                    mResponseCache->RecordAnswer(mCacheFillEntry, it.GetInternal());
+                }
+
                 if (!mSendState.SendUnicast())
                 {
-                    it->lastMulticastTime = kTimeNow;
+                    it->lastMulticastTime = now;
                 }
             }
         }
@@ -204,26 +259,87 @@ CHIP_ERROR ResponseSender::FlushReply()
 
     if (mResponseBuilder.HasResponseRecords())
     {
-        char srcAddressString[chip::Inet::IPAddress::kMaxStringLength];
-        VerifyOrDie(mSendState.GetSourceAddress().ToString(srcAddressString) != nullptr);
+        chip::System::PacketBufferHandle packet = mResponseBuilder.ReleasePacket();
 
-        if (mSendState.SendUnicast())
+        if (mCacheFillEntry != nullptr)
         {
+            mResponseCache->RecordPacket(mCacheFillEntry, packet);
+        }
+
+        ReturnErrorOnFailure(SendReplyPacket(std::move(packet)));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ResponseSender::SendReplyPacket(chip::System::PacketBufferHandle && packet)
+{
+    char srcAddressString[chip::Inet::IPAddress::kMaxStringLength];
+    VerifyOrDie(mSendState.GetSourceAddress().ToString(srcAddressString) != nullptr);
+
+    if (mSendState.SendUnicast())
+    {
 #if CHIP_MINMDNS_HIGH_VERBOSITY
-            ChipLogDetail(Discovery, "Directly sending mDns reply to peer %s on port %d", srcAddressString,
-                          mSendState.GetSourcePort());
+        ChipLogDetail(Discovery, "Directly sending mDns reply to peer %s on port %d", srcAddressString, mSendState.GetSourcePort());
 #endif
-            ReturnErrorOnFailure(mServer->DirectSend(mResponseBuilder.ReleasePacket(), mSendState.GetSourceAddress(),
-                                                     mSendState.GetSourcePort(), mSendState.GetSourceInterfaceId()));
-        }
-        else
-        {
+        return mServer->DirectSend(std::move(packet), mSendState.GetSourceAddress(), mSendState.GetSourcePort(),
+                                   mSendState.GetSourceInterfaceId());
+    }
+
 #if CHIP_MINMDNS_HIGH_VERBOSITY
-            ChipLogDetail(Discovery, "Broadcasting mDns reply for query from %s", srcAddressString);
+    ChipLogDetail(Discovery, "Broadcasting mDns reply for query from %s", srcAddressString);
 #endif
-            ReturnErrorOnFailure(mServer->BroadcastSend(mResponseBuilder.ReleasePacket(), kMdnsStandardPort,
-                                                        mSendState.GetSourceInterfaceId(), mSendState.GetSourceAddress().Type()));
+    return mServer->BroadcastSend(std::move(packet), kMdnsStandardPort, mSendState.GetSourceInterfaceId(),
+                                  mSendState.GetSourceAddress().Type());
+}
+
+bool ResponseSender::HasThrottledAnswers(const QueryData & query, chip::System::Clock::Timestamp throttleTime)
+{
+    QueryReplyFilter queryReplyFilter(query);
+    QueryResponderRecordFilter responseFilter;
+    responseFilter.SetReplyFilter(&queryReplyFilter);
+
+    for (auto & responder : mResponders)
+    {
+        if (responder == nullptr)
+        {
+            continue;
         }
+        for (auto it = responder->begin(&responseFilter); it != responder->end(); it++)
+        {
+            if (it->lastMulticastTime >= throttleTime)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+CHIP_ERROR ResponseSender::SendCachedReply(const ResponseCacheBase::Entry & entry, chip::System::Clock::Timestamp now)
+{
+    if (!mSendState.SendUnicast())
+    {
+        // Same throttling as applied when building replies: multicast at most once per second
+        const chip::System::Clock::Timestamp throttleTime = now - chip::System::Clock::Seconds32(1);
+        for (size_t i = 0; i < entry.GetAnswerCount(); i++)
+        {
+            VerifyOrReturnError(entry.GetAnswer(i)->lastMulticastTime < throttleTime, CHIP_ERROR_INCORRECT_STATE);
+        }
+        for (size_t i = 0; i < entry.GetAnswerCount(); i++)
+        {
+            entry.GetAnswer(i)->lastMulticastTime = now;
+        }
+    }
+
+    for (size_t i = 0; i < entry.GetPacketCount(); i++)
+    {
+        chip::ByteSpan data                     = entry.GetPacket(i);
+        chip::System::PacketBufferHandle packet = chip::System::PacketBufferHandle::NewWithData(data.data(), data.size());
+        VerifyOrReturnError(!packet.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+        HeaderRef(packet->Start()).SetMessageId(mSendState.GetMessageId());
+        ReturnErrorOnFailure(SendReplyPacket(std::move(packet)));
     }
 
     return CHIP_NO_ERROR;
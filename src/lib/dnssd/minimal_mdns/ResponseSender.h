@@ -19,6 +19,7 @@
 
 #include "Parser.h"
 #include "ResponseBuilder.h"
+#include "ResponseCache.h"
 #include "Server.h"
 
 #include <lib/dnssd/minimal_mdns/responders/QueryResponder.h>
@@ -145,13 +146,44 @@ public:
 
     void SetServer(ServerBase * server) { mServer = server; }
 
+    /// Use the given cache to replay previously serialized replies for repeated
+    /// queries. A nullptr cache (the default) disables reply caching.
+    void SetResponseCache(ResponseCacheBase * cache)
+    {
+        mResponseCache = cache;
+        InvalidateResponseCache();
+    }
+
+    /// Drop any cached replies. MUST be called whenever records of any registered
+    /// query responder are added, removed or changed.
+    void InvalidateResponseCache()
+    {
+        if (mResponseCache != nullptr)
+        {
+            mResponseCache->Invalidate();
+        }
+    }
+
 private:
+    CHIP_ERROR BuildAndSendReply(const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
+                                 const ResponseConfiguration & configuration, chip::System::Clock::Timestamp now);
     CHIP_ERROR FlushReply();
     CHIP_ERROR PrepareNewReplyPacket();
+    CHIP_ERROR SendReplyPacket(chip::System::PacketBufferHandle && packet);
+
+    /// Checks if any answer to the given query is currently suppressed by multicast throttling.
+    bool HasThrottledAnswers(const QueryData & query, chip::System::Clock::Timestamp throttleTime);
+
+    /// Replays a cached reply. Returns CHIP_ERROR_INCORRECT_STATE without sending
+    /// anything if the cached reply cannot be used due to multicast throttling.
+    CHIP_ERROR SendCachedReply(const ResponseCacheBase::Entry & entry, chip::System::Clock::Timestamp now);
 
     ServerBase * mServer;
     QueryResponderPtrPool mResponders = {};
 
+    ResponseCacheBase * mResponseCache         = nullptr;
+    ResponseCacheBase::Entry * mCacheFillEntry = nullptr; // reply currently being recorded into the cache
+
     /// Current send state
     ResponseBuilder mResponseBuilder;          // packet being built
     Internal::ResponseSendingState mSendState; // sending state
@@ -228,6 +228,89 @@ TEST_F(TestResponseSender, PtrSrvTxtAnyResponseToServiceListing)
     EXPECT_TRUE(common.server.GetHeaderFound());
 }
 
+TEST_F(TestResponseSender, CachedReplyIsReplayed)
+{
+    CommonTestElements common("test");
+    ResponseCache<2> responseCache;
+    ResponseSender responseSender(&common.server);
+    responseSender.SetResponseCache(&responseCache);
+    EXPECT_EQ(responseSender.AddQueryResponder(&common.queryResponder), CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.ptrResponder).SetReportAdditional(common.instance);
+    common.queryResponder.AddResponder(&common.srvResponder);
+    common.queryResponder.AddResponder(&common.txtResponder);
+
+    // Build a query for the service name
+    common.recordWriter.WriteQName(common.service);
+
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, false, common.requestNameStart, common.requestBytesRange);
+
+    common.server.AddExpectedRecord(&common.ptrRecord);
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    EXPECT_EQ(responseSender.Respond(1, queryData, &common.packetInfo, ResponseConfiguration()), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+    EXPECT_EQ(responseCache.GetHitCount(), 0u);
+    EXPECT_EQ(responseCache.GetMissCount(), 1u);
+
+    // Same query again should be served from the cache with identical content.
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.ptrRecord);
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    EXPECT_EQ(responseSender.Respond(2, queryData, &common.packetInfo, ResponseConfiguration()), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+    EXPECT_EQ(responseCache.GetHitCount(), 1u);
+    EXPECT_EQ(responseCache.GetMissCount(), 1u);
+
+    // TTL overrides are never served from the cache
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.ptrRecord);
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    EXPECT_EQ(responseSender.Respond(3, queryData, &common.packetInfo, ResponseConfiguration().SetTtlSecondsOverride(0)),
+              CHIP_NO_ERROR);
+    EXPECT_TRUE(common.server.GetHeaderFound());
+    EXPECT_EQ(responseCache.GetHitCount(), 1u);
+    EXPECT_EQ(responseCache.GetMissCount(), 1u);
+}
+
+TEST_F(TestResponseSender, CachedReplyIsInvalidated)
+{
+    CommonTestElements common("test");
+    ResponseCache<2> responseCache;
+    ResponseSender responseSender(&common.server);
+    responseSender.SetResponseCache(&responseCache);
+    EXPECT_EQ(responseSender.AddQueryResponder(&common.queryResponder), CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.srvResponder);
+
+    // Build a query for the instance name
+    common.recordWriter.WriteQName(common.instance);
+
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, false, common.requestNameStart, common.requestBytesRange);
+
+    common.server.AddExpectedRecord(&common.srvRecord);
+    EXPECT_EQ(responseSender.Respond(1, queryData, &common.packetInfo, ResponseConfiguration()), CHIP_NO_ERROR);
+    EXPECT_TRUE(common.server.GetHeaderFound());
+
+    // Adding a record requires invalidation, after which the new record is part of the reply.
+    common.queryResponder.AddResponder(&common.txtResponder);
+    responseSender.InvalidateResponseCache();
+
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    EXPECT_EQ(responseSender.Respond(2, queryData, &common.packetInfo, ResponseConfiguration()), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+    EXPECT_EQ(responseCache.GetHitCount(), 0u);
+    EXPECT_EQ(responseCache.GetMissCount(), 2u);
+}
+
 TEST_F(TestResponseSender, NoQueryResponder)
 {
     CommonTestElements common("test");
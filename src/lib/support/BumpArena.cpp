@@ -0,0 +1,175 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "BumpArena.h"
+
+#include <lib/support/CHIPMem.h>
+
+#include <algorithm>
+
+namespace chip {
+
+void * BumpArena::Allocate(size_t size, size_t alignment)
+{
+    if (mCurrent != nullptr)
+    {
+        void * p = AllocateFrom(mCurrent, size, alignment);
+        if (p != nullptr)
+        {
+            return p;
+        }
+
+        // Move on to the chunks kept by Reset(), if any is large enough
+        while (mCurrent->next != nullptr)
+        {
+            mCurrent = mCurrent->next;
+            mOffset  = 0;
+            p        = AllocateFrom(mCurrent, size, alignment);
+            if (p != nullptr)
+            {
+                return p;
+            }
+        }
+    }
+
+    // Chunk data is aligned on max_align_t, so padding is less than alignment
+    if (size > SIZE_MAX - alignment)
+    {
+        return nullptr;
+    }
+    Chunk * chunk = NewChunk(std::max(mChunkSize, size + alignment - 1));
+    if (chunk == nullptr)
+    {
+        return nullptr;
+    }
+
+    AppendChunk(chunk);
+    return AllocateFrom(chunk, size, alignment);
+}
+
+bool BumpArena::Reserve(size_t size)
+{
+    // Only the current chunk is considered, the chunks kept by Reset() are used once it is full
+    if (size == 0 || (mCurrent != nullptr && size <= mCurrent->size - mOffset))
+    {
+        return true;
+    }
+
+    Chunk * chunk = NewChunk(size);
+    if (chunk == nullptr)
+    {
+        return false;
+    }
+
+    AppendChunk(chunk);
+    return true;
+}
+
+void BumpArena::AppendChunk(Chunk * chunk)
+{
+    // Insert after the current chunk, ahead of the chunks kept by Reset() if any
+    if (mCurrent == nullptr)
+    {
+        chunk->next = mFirst;
+        mFirst      = chunk;
+    }
+    else
+    {
+        chunk->next    = mCurrent->next;
+        mCurrent->next = chunk;
+    }
+    mCurrent = chunk;
+    mOffset  = 0;
+}
+
+void BumpArena::Reset()
+{
+    mCurrent   = mFirst;
+    mOffset    = 0;
+    mBytesUsed = 0;
+}
+
+void BumpArena::Release()
+{
+    Chunk * chunk = mFirst;
+    while (chunk != nullptr)
+    {
+        Chunk * next      = chunk->next;
+        const size_t size = kHeaderSize + chunk->size;
+        Platform::MemoryFree(chunk);
+        if (mBudget != nullptr)
+        {
+            mBudget->ReleaseArenaMemory(size);
+        }
+        chunk = next;
+    }
+
+    mFirst         = nullptr;
+    mCurrent       = nullptr;
+    mOffset        = 0;
+    mBytesUsed     = 0;
+    mBytesReserved = 0;
+}
+
+void * BumpArena::AllocateFrom(Chunk * chunk, size_t size, size_t alignment)
+{
+    const uintptr_t address = reinterpret_cast<uintptr_t>(Data(chunk)) + mOffset;
+    const size_t padding    = static_cast<size_t>((alignment - (address & (alignment - 1))) & (alignment - 1));
+    const size_t available  = chunk->size - mOffset;
+
+    if (padding > available || size > available - padding)
+    {
+        return nullptr;
+    }
+
+    void * p = Data(chunk) + mOffset + padding;
+    mOffset += padding + size;
+    mBytesUsed += padding + size;
+    return p;
+}
+
+BumpArena::Chunk * BumpArena::NewChunk(size_t size)
+{
+    if (size > SIZE_MAX - kHeaderSize)
+    {
+        return nullptr;
+    }
+
+    const size_t totalSize = kHeaderSize + size;
+    if (mBudget != nullptr && !mBudget->ReserveArenaMemory(totalSize))
+    {
+        return nullptr;
+    }
+
+    Chunk * chunk = static_cast<Chunk *>(Platform::MemoryAlloc(totalSize));
+    if (chunk == nullptr)
+    {
+        if (mBudget != nullptr)
+        {
+            mBudget->ReleaseArenaMemory(totalSize);
+        }
+        return nullptr;
+    }
+
+    chunk->next = nullptr;
+    chunk->size = size;
+    mBytesReserved += totalSize;
+    mChunkAllocations++;
+    return chunk;
+}
+
+} // namespace chip
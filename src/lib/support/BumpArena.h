@@ -0,0 +1,138 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace chip {
+
+/**
+ * Bump allocator for transient state that is released all at once.
+ *
+ * Memory is carved out of chunks allocated with Platform::MemoryAlloc. Objects
+ * cannot be freed individually: Reset() makes all the memory available again in
+ * constant time, keeping the chunks for reuse, and Release() frees the chunks.
+ * Only trivially destructible objects can be created, since their destructors
+ * are never run.
+ */
+class BumpArena
+{
+public:
+    static constexpr size_t kDefaultChunkSize = 512;
+
+    /**
+     * Accounts for the chunks of an arena, e.g. against a memory budget.
+     */
+    class Budget
+    {
+    public:
+        virtual ~Budget() = default;
+
+        /// Called before allocating a chunk of the given size. Return false to refuse it.
+        virtual bool ReserveArenaMemory(size_t bytes) = 0;
+
+        /// Called after freeing a chunk of the given size.
+        virtual void ReleaseArenaMemory(size_t bytes) = 0;
+    };
+
+    explicit BumpArena(size_t chunkSize = kDefaultChunkSize, Budget * budget = nullptr) :
+        mChunkSize(chunkSize), mBudget(budget)
+    {}
+    ~BumpArena() { Release(); }
+
+    BumpArena(const BumpArena &)             = delete;
+    BumpArena & operator=(const BumpArena &) = delete;
+
+    void SetBudget(Budget * budget) { mBudget = budget; }
+
+    /**
+     * Allocate size bytes aligned on alignment, which must be a power of two.
+     *
+     * @return nullptr if a new chunk was needed and could not be allocated.
+     */
+    void * Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * Create an object in the arena.
+     *
+     * @return nullptr if the memory could not be allocated.
+     */
+    template <typename T, typename... Args>
+    T * New(Args &&... args)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "Arena objects are never destroyed");
+        void * p = Allocate(sizeof(T), alignof(T));
+        return p == nullptr ? nullptr : new (p) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Make sure that size more bytes can be allocated without allocating another chunk, e.g. when the number of objects
+     * to create is known upfront. A chunk allocated for this is sized for exactly size bytes rather than the chunk size,
+     * so that arenas holding a few small objects do not hold a full chunk.
+     *
+     * Objects created after this call only fit in size bytes if their sizes are multiples of their alignments.
+     *
+     * @return false if a new chunk was needed and could not be allocated.
+     */
+    bool Reserve(size_t size);
+
+    /// Make all the memory available again, keeping the chunks allocated so far.
+    void Reset();
+
+    /// Free all the chunks.
+    void Release();
+
+    /// Bytes handed out since the last reset, including alignment padding.
+    size_t GetBytesUsed() const { return mBytesUsed; }
+
+    /// Bytes held in chunks, including their headers.
+    size_t GetBytesReserved() const { return mBytesReserved; }
+
+    /// Number of chunks allocated since construction.
+    size_t GetChunkAllocationCount() const { return mChunkAllocations; }
+
+private:
+    struct Chunk
+    {
+        Chunk * next;
+        size_t size; ///< Usable bytes after the header
+    };
+
+    static constexpr size_t kHeaderSize = (sizeof(Chunk) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+    static uint8_t * Data(Chunk * chunk) { return reinterpret_cast<uint8_t *>(chunk) + kHeaderSize; }
+
+    void * AllocateFrom(Chunk * chunk, size_t size, size_t alignment);
+    Chunk * NewChunk(size_t size);
+    void AppendChunk(Chunk * chunk);
+
+    const size_t mChunkSize;
+    Budget * mBudget         = nullptr;
+    Chunk * mFirst           = nullptr;
+    Chunk * mCurrent         = nullptr;
+    size_t mOffset           = 0; ///< Offset of the free space in mCurrent
+    size_t mBytesUsed        = 0;
+    size_t mBytesReserved    = 0;
+    size_t mChunkAllocations = 0;
+};
+
+} // namespace chip
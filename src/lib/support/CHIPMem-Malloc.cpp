@@ -29,6 +29,13 @@
 
 #include <stdlib.h>
 
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+#include <lib/support/MemoryAccounting.h>
+
+#include <cstddef>
+#include <stdint.h>
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
+
 #ifndef NDEBUG
 #include <atomic>
 #include <cstdio>
@@ -68,6 +75,44 @@ static void VerifyInitialized(const char * func)
 
 #endif
 
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+
+namespace {
+
+// Each allocation is prefixed with its size and tag, so that it is accounted
+// to the same tag when freed or reallocated.
+struct alignas(std::max_align_t) AllocationHeader
+{
+    size_t size;
+    MemoryTag tag;
+};
+
+void * ToUser(void * header)
+{
+    return static_cast<AllocationHeader *>(header) + 1;
+}
+
+AllocationHeader * ToHeader(void * p)
+{
+    return static_cast<AllocationHeader *>(p) - 1;
+}
+
+void * AccountAllocation(void * header, size_t size, MemoryTag tag)
+{
+    if (header == nullptr)
+    {
+        return nullptr;
+    }
+    static_cast<AllocationHeader *>(header)->size = size;
+    static_cast<AllocationHeader *>(header)->tag  = tag;
+    Internal::RecordAllocation(tag, size);
+    return ToUser(header);
+}
+
+} // namespace
+
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
+
 CHIP_ERROR MemoryAllocatorInit(void * buf, size_t bufSize)
 {
     // Logging can use Memory::Alloc, so we can't use logging with our
@@ -93,31 +138,82 @@ void MemoryAllocatorShutdown()
 void * MemoryAlloc(size_t size)
 {
     VERIFY_INITIALIZED();
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+    if (size > SIZE_MAX - sizeof(AllocationHeader))
+    {
+        return nullptr;
+    }
+    return AccountAllocation(malloc(sizeof(AllocationHeader) + size), size, GetCurrentMemoryTag());
+#else
     return malloc(size);
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
 }
 
 void * MemoryCalloc(size_t num, size_t size)
 {
     VERIFY_INITIALIZED();
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+    if (size != 0 && num > (SIZE_MAX - sizeof(AllocationHeader)) / size)
+    {
+        return nullptr;
+    }
+    return AccountAllocation(calloc(1, sizeof(AllocationHeader) + num * size), num * size, GetCurrentMemoryTag());
+#else
     return calloc(num, size);
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
 }
 
 void * MemoryRealloc(void * p, size_t size)
 {
     VERIFY_INITIALIZED();
     VERIFY_POINTER(p);
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+    if (p == nullptr)
+    {
+        return MemoryAlloc(size);
+    }
+    if (size > SIZE_MAX - sizeof(AllocationHeader))
+    {
+        return nullptr;
+    }
+
+    AllocationHeader header = *ToHeader(p);
+    void * reallocated      = realloc(ToHeader(p), sizeof(AllocationHeader) + size);
+    if (reallocated == nullptr)
+    {
+        return nullptr;
+    }
+    Internal::RecordFree(header.tag, header.size);
+    return AccountAllocation(reallocated, size, header.tag);
+#else
     return realloc(p, size);
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
 }
 
 void MemoryFree(void * p)
 {
     VERIFY_INITIALIZED();
     VERIFY_POINTER(p);
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+    if (p == nullptr)
+    {
+        return;
+    }
+    Internal::RecordFree(ToHeader(p)->tag, ToHeader(p)->size);
+    p = ToHeader(p);
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
     free(p);
 }
 
 bool MemoryInternalCheckPointer(const void * p, size_t min_size)
 {
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+    if (p != nullptr)
+    {
+        p        = static_cast<const AllocationHeader *>(p) - 1;
+        min_size = min_size + sizeof(AllocationHeader);
+    }
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
 #if CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
     return CanCastTo<int>(min_size) && (p != nullptr) &&
         (dmalloc_verify_pnt(__FILE__, __LINE__, __func__, p, 1, static_cast<int>(min_size)) == MALLOC_VERIFY_NOERROR);
@@ -0,0 +1,162 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/MemoryAccounting.h>
+
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+#include <atomic>
+#endif
+
+namespace chip {
+namespace Platform {
+
+namespace {
+
+const char * const sMemoryTagNames[] = {
+#define _CHIP_MEMORY_TAG_NAME(name, str) str,
+    CHIP_MEMORY_TAGS_ENUMERATE(_CHIP_MEMORY_TAG_NAME)
+#undef _CHIP_MEMORY_TAG_NAME
+};
+
+static_assert(sizeof(sMemoryTagNames) / sizeof(sMemoryTagNames[0]) == static_cast<size_t>(MemoryTag::kCount),
+              "Every memory tag needs a name");
+
+} // namespace
+
+const char * MemoryTagName(MemoryTag tag)
+{
+    if (tag >= MemoryTag::kCount)
+    {
+        return "unknown";
+    }
+    return sMemoryTagNames[static_cast<size_t>(tag)];
+}
+
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+
+namespace {
+
+// Counters are updated from whichever thread allocates, without locking: each
+// one is consistent on its own, a snapshot of several may be slightly skewed.
+struct TagCounters
+{
+    std::atomic<size_t> bytesInUse{ 0 };
+    std::atomic<size_t> peakBytes{ 0 };
+    std::atomic<size_t> allocationsInUse{ 0 };
+    std::atomic<size_t> peakAllocations{ 0 };
+    std::atomic<size_t> allocations{ 0 };
+    std::atomic<size_t> poolObjectsInUse{ 0 };
+    std::atomic<size_t> peakPoolObjects{ 0 };
+};
+
+TagCounters sTagCounters[static_cast<size_t>(MemoryTag::kCount)];
+
+thread_local MemoryTag sCurrentTag = MemoryTag::kUntagged;
+
+TagCounters & CountersFor(MemoryTag tag)
+{
+    return sTagCounters[tag < MemoryTag::kCount ? static_cast<size_t>(tag) : static_cast<size_t>(MemoryTag::kUntagged)];
+}
+
+void UpdatePeak(std::atomic<size_t> & peak, size_t value)
+{
+    size_t current = peak.load(std::memory_order_relaxed);
+    while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+void Increase(std::atomic<size_t> & inUse, std::atomic<size_t> & peak, size_t amount)
+{
+    UpdatePeak(peak, inUse.fetch_add(amount, std::memory_order_relaxed) + amount);
+}
+
+} // namespace
+
+ScopedMemoryTag::ScopedMemoryTag(MemoryTag tag) : mPrevious(sCurrentTag)
+{
+    sCurrentTag = tag;
+}
+
+ScopedMemoryTag::~ScopedMemoryTag()
+{
+    sCurrentTag = mPrevious;
+}
+
+MemoryTag GetCurrentMemoryTag()
+{
+    return sCurrentTag;
+}
+
+MemoryTagStats GetMemoryTagStats(MemoryTag tag)
+{
+    const TagCounters & counters = CountersFor(tag);
+
+    MemoryTagStats stats;
+    stats.bytesInUse       = counters.bytesInUse.load(std::memory_order_relaxed);
+    stats.peakBytes        = counters.peakBytes.load(std::memory_order_relaxed);
+    stats.allocationsInUse = counters.allocationsInUse.load(std::memory_order_relaxed);
+    stats.peakAllocations  = counters.peakAllocations.load(std::memory_order_relaxed);
+    stats.allocations      = counters.allocations.load(std::memory_order_relaxed);
+    stats.poolObjectsInUse = counters.poolObjectsInUse.load(std::memory_order_relaxed);
+    stats.peakPoolObjects  = counters.peakPoolObjects.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void ResetMemoryTagPeaks()
+{
+    for (TagCounters & counters : sTagCounters)
+    {
+        counters.peakBytes.store(counters.bytesInUse.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        counters.peakAllocations.store(counters.allocationsInUse.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        counters.peakPoolObjects.store(counters.poolObjectsInUse.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+namespace Internal {
+
+void RecordAllocation(MemoryTag tag, size_t size)
+{
+    TagCounters & counters = CountersFor(tag);
+    Increase(counters.bytesInUse, counters.peakBytes, size);
+    Increase(counters.allocationsInUse, counters.peakAllocations, 1);
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RecordFree(MemoryTag tag, size_t size)
+{
+    TagCounters & counters = CountersFor(tag);
+    counters.bytesInUse.fetch_sub(size, std::memory_order_relaxed);
+    counters.allocationsInUse.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void RecordPoolObjectCreated(MemoryTag tag)
+{
+    TagCounters & counters = CountersFor(tag);
+    Increase(counters.poolObjectsInUse, counters.peakPoolObjects, 1);
+}
+
+void RecordPoolObjectReleased(MemoryTag tag)
+{
+    CountersFor(tag).poolObjectsInUse.fetch_sub(1, std::memory_order_relaxed);
+}
+
+} // namespace Internal
+
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
+
+} // namespace Platform
+} // namespace chip
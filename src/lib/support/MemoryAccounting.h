@@ -0,0 +1,148 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the allocation accounting used when
+ *      CHIP_CONFIG_MEMORY_ACCOUNTING is enabled: heap allocations made through
+ *      chip::Platform and objects taken from object pools are attributed to
+ *      the subsystem tag that was current when they were made.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if CHIP_CONFIG_MEMORY_ACCOUNTING && !CHIP_CONFIG_MEMORY_MGMT_MALLOC
+#error "CHIP_CONFIG_MEMORY_ACCOUNTING requires CHIP_CONFIG_MEMORY_MGMT_MALLOC"
+#endif
+
+/**
+ * The subsystems allocations are attributed to, as X(Name, "name") entries.
+ */
+#define CHIP_MEMORY_TAGS_ENUMERATE(X)                                                                                              \
+    X(Untagged, "untagged")                                                                                                        \
+    X(PacketBuffer, "packet_buffer")                                                                                               \
+    X(Exchange, "exchange")                                                                                                        \
+    X(Session, "session")                                                                                                          \
+    X(ReadHandler, "read_handler")                                                                                                 \
+    X(WriteHandler, "write_handler")                                                                                               \
+    X(CommandHandler, "command_handler")                                                                                           \
+    X(ClusterStateCache, "cluster_state_cache")
+
+namespace chip {
+namespace Platform {
+
+enum class MemoryTag : uint8_t
+{
+#define _CHIP_MEMORY_TAG_ENUM(name, str) k##name,
+    CHIP_MEMORY_TAGS_ENUMERATE(_CHIP_MEMORY_TAG_ENUM)
+#undef _CHIP_MEMORY_TAG_ENUM
+        kCount
+};
+
+/// Name of a tag, as used in the tracing metric keys.
+const char * MemoryTagName(MemoryTag tag);
+
+struct MemoryTagStats
+{
+    size_t bytesInUse       = 0; ///< Heap bytes currently allocated
+    size_t peakBytes        = 0; ///< High-water mark of bytesInUse
+    size_t allocationsInUse = 0; ///< Heap allocations currently live
+    size_t peakAllocations  = 0; ///< High-water mark of allocationsInUse
+    size_t allocations      = 0; ///< Total number of heap allocations made
+    size_t poolObjectsInUse = 0; ///< Objects currently taken from tagged static object pools
+    size_t peakPoolObjects  = 0; ///< High-water mark of poolObjectsInUse
+};
+
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+
+/**
+ * Makes a tag current on the calling thread for the lifetime of the object.
+ * Allocations made meanwhile are attributed to it, and so are their frees,
+ * wherever those happen. Scopes nest, the outer tag is restored on exit.
+ *
+ * Use CHIP_MEMORY_TAG_SCOPE, which compiles to nothing when accounting is
+ * disabled.
+ */
+class ScopedMemoryTag
+{
+public:
+    explicit ScopedMemoryTag(MemoryTag tag);
+    ~ScopedMemoryTag();
+
+    ScopedMemoryTag(const ScopedMemoryTag &)             = delete;
+    ScopedMemoryTag & operator=(const ScopedMemoryTag &) = delete;
+
+private:
+    MemoryTag mPrevious;
+};
+
+/// Tag current on the calling thread.
+MemoryTag GetCurrentMemoryTag();
+
+/// Snapshot of the accounting of a tag.
+MemoryTagStats GetMemoryTagStats(MemoryTag tag);
+
+/// Restart the high-water marks of all tags from their current usage.
+void ResetMemoryTagPeaks();
+
+namespace Internal {
+
+// Hooks for the allocator and the object pools.
+void RecordAllocation(MemoryTag tag, size_t size);
+void RecordFree(MemoryTag tag, size_t size);
+void RecordPoolObjectCreated(MemoryTag tag);
+void RecordPoolObjectReleased(MemoryTag tag);
+
+} // namespace Internal
+
+#define _CHIP_MEMORY_TAG_SCOPE_NAME2(line) _chipMemoryTagScope##line
+#define _CHIP_MEMORY_TAG_SCOPE_NAME(line) _CHIP_MEMORY_TAG_SCOPE_NAME2(line)
+
+/**
+ * Attribute the allocations made until the end of the enclosing scope to a
+ * tag, e.g. CHIP_MEMORY_TAG_SCOPE(kExchange).
+ */
+#define CHIP_MEMORY_TAG_SCOPE(tag)                                                                                                 \
+    ::chip::Platform::ScopedMemoryTag _CHIP_MEMORY_TAG_SCOPE_NAME(__LINE__)(::chip::Platform::MemoryTag::tag)
+
+#else // CHIP_CONFIG_MEMORY_ACCOUNTING
+
+inline MemoryTag GetCurrentMemoryTag()
+{
+    return MemoryTag::kUntagged;
+}
+
+inline MemoryTagStats GetMemoryTagStats(MemoryTag)
+{
+    return MemoryTagStats();
+}
+
+inline void ResetMemoryTagPeaks() {}
+
+#define CHIP_MEMORY_TAG_SCOPE(tag)                                                                                                 \
+    do                                                                                                                             \
+    {                                                                                                                              \
+    } while (false)
+
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
+
+} // namespace Platform
+} // namespace chip
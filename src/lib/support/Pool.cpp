@@ -75,6 +75,9 @@ void * StaticAllocatorBitmap::Allocate()
                 if (usage.compare_exchange_strong(value, value | (kBit1 << offset)))
                 {
                     IncreaseUsage();
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+                    Platform::Internal::RecordPoolObjectCreated(mMemoryTag);
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
                     return At(word * kBitChunkSize + offset);
                 }
 
@@ -97,6 +100,9 @@ void StaticAllocatorBitmap::Deallocate(void * element)
     auto value = mUsage[word].fetch_and(~(kBit1 << offset));
     VerifyOrDie((value & (kBit1 << offset)) != 0); // assert fail when free an unused slot
     DecreaseUsage();
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+    Platform::Internal::RecordPoolObjectReleased(mMemoryTag);
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
 }
 
 size_t StaticAllocatorBitmap::IndexOf(void * element)
@@ -24,6 +24,7 @@
 
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/MemoryAccounting.h>
 #include <lib/support/ObjectDump.h>
 #include <system/SystemConfig.h>
 
@@ -58,9 +59,29 @@ public:
     }
     void DecreaseUsage() { --mAllocated; }
 
+    /**
+     * Attribute the objects of this pool to a memory accounting tag. This only
+     * has an effect when CHIP_CONFIG_MEMORY_ACCOUNTING is enabled, and should
+     * be called while the pool is empty.
+     *
+     * Objects of static pools are counted as pool objects of the tag. Objects
+     * of heap pools are heap allocations, and are counted as such only.
+     */
+    void SetMemoryTag(Platform::MemoryTag tag)
+    {
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+        mMemoryTag = tag;
+#else
+        (void) tag;
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
+    }
+
 protected:
     size_t mAllocated;
     size_t mHighWaterMark;
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+    Platform::MemoryTag mMemoryTag = Platform::MemoryTag::kUntagged;
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
 };
 
 class StaticAllocatorBase : public Statistics
@@ -495,6 +516,11 @@ public:
     template <typename... Args>
     T * CreateObject(Args &&... args)
     {
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+        // The objects are accounted as heap allocations, of the pool's tag if it has one
+        const bool tagged = mMemoryTag != Platform::MemoryTag::kUntagged;
+        Platform::ScopedMemoryTag memoryTag(tagged ? mMemoryTag : Platform::GetCurrentMemoryTag());
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
         T * object = Platform::New<T>(std::forward<Args>(args)...);
         if (object != nullptr)
         {
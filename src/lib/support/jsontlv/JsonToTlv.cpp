@@ -16,14 +16,17 @@
  */
 
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <algorithm>
 #include <charconv>
+#include <cmath>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <vector>
 
-#include <json/json.h>
 #include <lib/support/Base64.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/jsontlv/ElementTypes.h>
@@ -107,7 +110,8 @@ CHIP_ERROR JsonTypeStrToTlvType(const char * elementType, ElementTypeContext & t
 struct ElementContext
 {
     std::string jsonName;
-    TLV::Tag tag = TLV::AnonymousTag();
+    const char * value = nullptr;
+    TLV::Tag tag       = TLV::AnonymousTag();
     ElementTypeContext type;
     ElementTypeContext subType;
 };
@@ -200,15 +204,523 @@ CHIP_ERROR ParseJsonName(const std::string & name, ElementContext & elementCtx,
         }
     }
 
-    elementCtx.jsonName = name;
-    elementCtx.tag      = tag;
-    elementCtx.type     = type;
-    elementCtx.subType  = subType;
+    elementCtx.tag     = tag;
+    elementCtx.type    = type;
+    elementCtx.subType = subType;
 
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR EncodeTlvElement(const Json::Value & val, TLV::TLVWriter & writer, const ElementContext & elementCtx)
+/*
+ * A JSON number, classified the same way as Json::Reader does: integers that fit in 64 bits are kept
+ * as such, anything else is a floating point value.
+ */
+struct JsonNumber
+{
+    enum class Kind : uint8_t
+    {
+        kSigned,
+        kUnsigned,
+        kReal,
+    };
+
+    Kind kind              = Kind::kSigned;
+    int64_t signedValue    = 0;
+    uint64_t unsignedValue = 0;
+    double realValue       = 0;
+
+    static bool IsIntegral(double d)
+    {
+        double integralPart;
+        return std::modf(d, &integralPart) == 0.0;
+    }
+
+    bool IsUInt64() const
+    {
+        switch (kind)
+        {
+        case Kind::kSigned:
+            return signedValue >= 0;
+        case Kind::kUnsigned:
+            return true;
+        default:
+            return realValue >= 0 && realValue < 18446744073709551616.0 && IsIntegral(realValue);
+        }
+    }
+
+    bool IsInt64() const
+    {
+        switch (kind)
+        {
+        case Kind::kSigned:
+            return true;
+        case Kind::kUnsigned:
+            return unsignedValue <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+        default:
+            return realValue >= -9223372036854775808.0 && realValue < 9223372036854775808.0 && IsIntegral(realValue);
+        }
+    }
+
+    uint64_t AsUInt64() const
+    {
+        switch (kind)
+        {
+        case Kind::kSigned:
+            return static_cast<uint64_t>(signedValue);
+        case Kind::kUnsigned:
+            return unsignedValue;
+        default:
+            return static_cast<uint64_t>(realValue);
+        }
+    }
+
+    int64_t AsInt64() const
+    {
+        switch (kind)
+        {
+        case Kind::kSigned:
+            return signedValue;
+        case Kind::kUnsigned:
+            return static_cast<int64_t>(unsignedValue);
+        default:
+            return static_cast<int64_t>(realValue);
+        }
+    }
+
+    double AsDouble() const
+    {
+        switch (kind)
+        {
+        case Kind::kSigned:
+            return static_cast<double>(signedValue);
+        case Kind::kUnsigned:
+            return static_cast<double>(unsignedValue);
+        default:
+            return realValue;
+        }
+    }
+};
+
+/*
+ * Reads values directly from JSON text, so that they can be encoded as TLV while the text is parsed
+ * instead of first building a Json::Value document of the entire input.
+ *
+ * Standard JSON is accepted, along with the C and C++ style comments that Json::Reader allows. Syntax
+ * errors are reported as CHIP_ERROR_INTERNAL, which is what a failed Json::Reader::parse used to map to.
+ */
+class JsonTextReader
+{
+public:
+    JsonTextReader(const std::string & text) : mCurrent(text.data()), mEnd(text.data() + text.size()) {}
+
+    const char * GetPosition() const { return mCurrent; }
+    void SetPosition(const char * position) { mCurrent = position; }
+
+    /*
+     * Skips whitespace and comments, then returns the next character without consuming it ('\0' at
+     * the end of the input).
+     */
+    char Peek()
+    {
+        SkipWhitespace();
+        return (mCurrent < mEnd) ? *mCurrent : '\0';
+    }
+
+    bool Consume(char c)
+    {
+        VerifyOrReturnValue(Peek() == c, false);
+        mCurrent++;
+        return true;
+    }
+
+    bool IsAtNumber() { return Peek() == '-' || IsDigit(Peek()); }
+
+    CHIP_ERROR ReadLiteral(const char * literal)
+    {
+        size_t length = strlen(literal);
+        Peek();
+        VerifyOrReturnError(static_cast<size_t>(mEnd - mCurrent) >= length && memcmp(mCurrent, literal, length) == 0,
+                            CHIP_ERROR_INTERNAL);
+        mCurrent += length;
+        return CHIP_NO_ERROR;
+    }
+
+    /*
+     * Reads a string and decodes its escape sequences into value. When value is null the string is
+     * only validated.
+     */
+    CHIP_ERROR ReadString(std::string * value);
+
+    CHIP_ERROR ReadNumber(JsonNumber & value);
+
+    /*
+     * Within an object, moves to the value of the next member and returns its name in name. found is
+     * set to false once the closing brace has been consumed. first must be true on the first call for
+     * a given object, and is updated by this method.
+     */
+    CHIP_ERROR NextObjectMember(bool & first, bool & found, std::string * name);
+
+    /*
+     * Within an array, moves to the next element. found is set to false once the closing bracket has
+     * been consumed. first must be true on the first call for a given array, and is updated by this
+     * method.
+     */
+    CHIP_ERROR NextArrayElement(bool & first, bool & found);
+
+    /*
+     * Validates the value the reader is positioned on, and moves past it.
+     */
+    CHIP_ERROR SkipValue();
+
+private:
+    static bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+    void SkipSpaces();
+    // Skips spaces and comments.
+    void SkipWhitespace();
+    void SkipDigits()
+    {
+        while (mCurrent < mEnd && IsDigit(*mCurrent))
+        {
+            mCurrent++;
+        }
+    }
+
+    CHIP_ERROR ReadHexCodeUnit(uint32_t & codeUnit);
+
+    const char * mCurrent;
+    const char * mEnd;
+};
+
+void JsonTextReader::SkipSpaces()
+{
+    while (mCurrent < mEnd && (*mCurrent == ' ' || *mCurrent == '\t' || *mCurrent == '\r' || *mCurrent == '\n'))
+    {
+        mCurrent++;
+    }
+}
+
+void JsonTextReader::SkipWhitespace()
+{
+    while (true)
+    {
+        SkipSpaces();
+        VerifyOrReturn(mCurrent < mEnd);
+
+        char c = *mCurrent;
+        if (c == '/' && (mEnd - mCurrent) >= 2 && mCurrent[1] == '/')
+        {
+            const char * lineEnd = static_cast<const char *>(memchr(mCurrent, '\n', static_cast<size_t>(mEnd - mCurrent)));
+            mCurrent             = (lineEnd != nullptr) ? lineEnd + 1 : mEnd;
+        }
+        else if (c == '/' && (mEnd - mCurrent) >= 2 && mCurrent[1] == '*')
+        {
+            static constexpr char kCommentEnd[] = "*/";
+            const char * commentEnd             = std::search(mCurrent + 2, mEnd, kCommentEnd, kCommentEnd + 2);
+            if (commentEnd == mEnd)
+            {
+                // Leave the unterminated comment in place, it is not a valid token.
+                return;
+            }
+            mCurrent = commentEnd + 2;
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+CHIP_ERROR JsonTextReader::ReadHexCodeUnit(uint32_t & codeUnit)
+{
+    VerifyOrReturnError(mEnd - mCurrent >= 4, CHIP_ERROR_INTERNAL);
+
+    codeUnit = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        char c = *mCurrent++;
+        uint32_t digit;
+        if (c >= '0' && c <= '9')
+        {
+            digit = static_cast<uint32_t>(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            digit = static_cast<uint32_t>(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            digit = static_cast<uint32_t>(c - 'A' + 10);
+        }
+        else
+        {
+            return CHIP_ERROR_INTERNAL;
+        }
+        codeUnit = (codeUnit << 4) | digit;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR JsonTextReader::ReadString(std::string * value)
+{
+    VerifyOrReturnError(Consume('"'), CHIP_ERROR_INTERNAL);
+    if (value != nullptr)
+    {
+        value->clear();
+    }
+
+    while (mCurrent < mEnd)
+    {
+        // Copy runs of unescaped characters at once.
+        const char * run = mCurrent;
+        while (mCurrent < mEnd && *mCurrent != '"' && *mCurrent != '\\')
+        {
+            mCurrent++;
+        }
+        if (value != nullptr)
+        {
+            value->append(run, static_cast<size_t>(mCurrent - run));
+        }
+        VerifyOrReturnError(mCurrent < mEnd, CHIP_ERROR_INTERNAL);
+
+        if (*mCurrent++ == '"')
+        {
+            return CHIP_NO_ERROR;
+        }
+
+        VerifyOrReturnError(mCurrent < mEnd, CHIP_ERROR_INTERNAL);
+        char escaped = *mCurrent++;
+        char decoded;
+        switch (escaped)
+        {
+        case '"':
+        case '/':
+        case '\\':
+            decoded = escaped;
+            break;
+        case 'b':
+            decoded = '\b';
+            break;
+        case 'f':
+            decoded = '\f';
+            break;
+        case 'n':
+            decoded = '\n';
+            break;
+        case 'r':
+            decoded = '\r';
+            break;
+        case 't':
+            decoded = '\t';
+            break;
+        case 'u': {
+            uint32_t codePoint;
+            ReturnErrorOnFailure(ReadHexCodeUnit(codePoint));
+            if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+            {
+                // A high surrogate must be followed by a second escape sequence, combined as
+                // Json::Reader does.
+                uint32_t lowSurrogate;
+                VerifyOrReturnError(mEnd - mCurrent >= 2 && mCurrent[0] == '\\' && mCurrent[1] == 'u', CHIP_ERROR_INTERNAL);
+                mCurrent += 2;
+                ReturnErrorOnFailure(ReadHexCodeUnit(lowSurrogate));
+                codePoint = 0x10000 + ((codePoint & 0x3FF) << 10) + (lowSurrogate & 0x3FF);
+            }
+
+            if (value != nullptr)
+            {
+                if (codePoint < 0x80)
+                {
+                    value->push_back(static_cast<char>(codePoint));
+                }
+                else if (codePoint < 0x800)
+                {
+                    value->push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+                    value->push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+                }
+                else if (codePoint < 0x10000)
+                {
+                    value->push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+                    value->push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                    value->push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+                }
+                else
+                {
+                    value->push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+                    value->push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+                    value->push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                    value->push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+                }
+            }
+            continue;
+        }
+        default:
+            return CHIP_ERROR_INTERNAL;
+        }
+
+        if (value != nullptr)
+        {
+            value->push_back(decoded);
+        }
+    }
+
+    return CHIP_ERROR_INTERNAL;
+}
+
+CHIP_ERROR JsonTextReader::ReadNumber(JsonNumber & value)
+{
+    VerifyOrReturnError(IsAtNumber(), CHIP_ERROR_INTERNAL);
+
+    const char * start = mCurrent;
+    bool negative      = (*mCurrent == '-');
+    bool integral      = true;
+
+    if (negative)
+    {
+        mCurrent++;
+    }
+    SkipDigits();
+    if (mCurrent < mEnd && *mCurrent == '.')
+    {
+        integral = false;
+        mCurrent++;
+        SkipDigits();
+    }
+    if (mCurrent < mEnd && (*mCurrent == 'e' || *mCurrent == 'E'))
+    {
+        integral = false;
+        mCurrent++;
+        if (mCurrent < mEnd && (*mCurrent == '+' || *mCurrent == '-'))
+        {
+            mCurrent++;
+        }
+        SkipDigits();
+    }
+
+    if (integral)
+    {
+        uint64_t magnitude      = 0;
+        const char * digits     = start + (negative ? 1 : 0);
+        auto [lastConverted, e] = std::from_chars(digits, mCurrent, magnitude, 10);
+        VerifyOrReturnError(digits != mCurrent, CHIP_ERROR_INTERNAL);
+
+        // Integers that do not fit in 64 bits are read as floating point values below.
+        constexpr uint64_t kMinInt64Magnitude = static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1;
+        if (e == std::errc() && lastConverted == mCurrent && (!negative || magnitude <= kMinInt64Magnitude))
+        {
+            if (negative)
+            {
+                value.kind        = JsonNumber::Kind::kSigned;
+                value.signedValue = (magnitude == kMinInt64Magnitude) ? std::numeric_limits<int64_t>::min()
+                                                                      : -static_cast<int64_t>(magnitude);
+            }
+            else if (magnitude <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+            {
+                value.kind        = JsonNumber::Kind::kSigned;
+                value.signedValue = static_cast<int64_t>(magnitude);
+            }
+            else
+            {
+                value.kind          = JsonNumber::Kind::kUnsigned;
+                value.unsignedValue = magnitude;
+            }
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    // strtod needs a NUL terminated string, number tokens are short.
+    std::string token(start, static_cast<size_t>(mCurrent - start));
+    char * tokenEnd = nullptr;
+    value.kind      = JsonNumber::Kind::kReal;
+    value.realValue = strtod(token.c_str(), &tokenEnd);
+    VerifyOrReturnError(tokenEnd == token.c_str() + token.size() && !std::isinf(value.realValue), CHIP_ERROR_INTERNAL);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR JsonTextReader::NextObjectMember(bool & first, bool & found, std::string * name)
+{
+    found = false;
+    if (Consume('}'))
+    {
+        return CHIP_NO_ERROR;
+    }
+    VerifyOrReturnError(first || Consume(','), CHIP_ERROR_INTERNAL);
+    first = false;
+
+    ReturnErrorOnFailure(ReadString(name));
+    // Json::Reader does not allow comments between a member name and the colon.
+    SkipSpaces();
+    VerifyOrReturnError(mCurrent < mEnd && *mCurrent == ':', CHIP_ERROR_INTERNAL);
+    mCurrent++;
+    found = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR JsonTextReader::NextArrayElement(bool & first, bool & found)
+{
+    found = false;
+    if (first)
+    {
+        // As with Json::Reader, an array that only holds a comment is not empty.
+        SkipSpaces();
+        if (mCurrent < mEnd && *mCurrent == ']')
+        {
+            mCurrent++;
+            return CHIP_NO_ERROR;
+        }
+    }
+    else if (Consume(']'))
+    {
+        return CHIP_NO_ERROR;
+    }
+    VerifyOrReturnError(first || Consume(','), CHIP_ERROR_INTERNAL);
+    first = false;
+
+    found = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR JsonTextReader::SkipValue()
+{
+    bool first = true;
+    bool found = false;
+
+    switch (Peek())
+    {
+    case '{':
+        Consume('{');
+        ReturnErrorOnFailure(NextObjectMember(first, found, nullptr));
+        while (found)
+        {
+            ReturnErrorOnFailure(SkipValue());
+            ReturnErrorOnFailure(NextObjectMember(first, found, nullptr));
+        }
+        return CHIP_NO_ERROR;
+    case '[':
+        Consume('[');
+        ReturnErrorOnFailure(NextArrayElement(first, found));
+        while (found)
+        {
+            ReturnErrorOnFailure(SkipValue());
+            ReturnErrorOnFailure(NextArrayElement(first, found));
+        }
+        return CHIP_NO_ERROR;
+    case '"':
+        return ReadString(nullptr);
+    case 't':
+        return ReadLiteral("true");
+    case 'f':
+        return ReadLiteral("false");
+    case 'n':
+        return ReadLiteral("null");
+    default: {
+        JsonNumber number;
+        return ReadNumber(number);
+    }
+    }
+}
+
+CHIP_ERROR EncodeTlvElement(JsonTextReader & reader, TLV::TLVWriter & writer, const ElementContext & elementCtx)
 {
     TLV::Tag tag = elementCtx.tag;
 
@@ -216,13 +728,18 @@ CHIP_ERROR EncodeTlvElement(const Json::Value & val, TLV::TLVWriter & writer, co
     {
     case TLV::kTLVType_UnsignedInteger: {
         uint64_t v = 0;
-        if (val.isUInt64())
+        if (reader.IsAtNumber())
         {
-            v = val.asUInt64();
+            JsonNumber number;
+            ReturnErrorOnFailure(reader.ReadNumber(number));
+            VerifyOrReturnError(number.IsUInt64(), CHIP_ERROR_INVALID_ARGUMENT);
+            v = number.AsUInt64();
         }
-        else if (val.isString())
+        else if (reader.Peek() == '"')
         {
-            ReturnErrorOnFailure(ParseNumericalField(val.asString(), v));
+            std::string valAsString;
+            ReturnErrorOnFailure(reader.ReadString(&valAsString));
+            ReturnErrorOnFailure(ParseNumericalField(valAsString, v));
         }
         else
         {
@@ -234,13 +751,18 @@ CHIP_ERROR EncodeTlvElement(const Json::Value & val, TLV::TLVWriter & writer, co
 
     case TLV::kTLVType_SignedInteger: {
         int64_t v = 0;
-        if (val.isInt64())
+        if (reader.IsAtNumber())
         {
-            v = val.asInt64();
+            JsonNumber number;
+            ReturnErrorOnFailure(reader.ReadNumber(number));
+            VerifyOrReturnError(number.IsInt64(), CHIP_ERROR_INVALID_ARGUMENT);
+            v = number.AsInt64();
         }
-        else if (val.isString())
+        else if (reader.Peek() == '"')
         {
-            ReturnErrorOnFailure(ParseNumericalField(val.asString(), v));
+            std::string valAsString;
+            ReturnErrorOnFailure(reader.ReadString(&valAsString));
+            ReturnErrorOnFailure(ParseNumericalField(valAsString, v));
         }
         else
         {
@@ -251,28 +773,33 @@ CHIP_ERROR EncodeTlvElement(const Json::Value & val, TLV::TLVWriter & writer, co
     }
 
     case TLV::kTLVType_Boolean: {
-        VerifyOrReturnError(val.isBool(), CHIP_ERROR_INVALID_ARGUMENT);
-        ReturnErrorOnFailure(writer.Put(tag, val.asBool()));
+        char c = reader.Peek();
+        VerifyOrReturnError(c == 't' || c == 'f', CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(reader.ReadLiteral((c == 't') ? "true" : "false"));
+        ReturnErrorOnFailure(writer.Put(tag, c == 't'));
         break;
     }
 
     case TLV::kTLVType_FloatingPointNumber: {
-        if (val.isNumeric())
+        if (reader.IsAtNumber())
         {
+            JsonNumber number;
+            ReturnErrorOnFailure(reader.ReadNumber(number));
             if (elementCtx.type.isDouble)
             {
-                ReturnErrorOnFailure(writer.Put(tag, val.asDouble()));
+                ReturnErrorOnFailure(writer.Put(tag, number.AsDouble()));
             }
             else
             {
-                ReturnErrorOnFailure(writer.Put(tag, val.asFloat()));
+                ReturnErrorOnFailure(writer.Put(tag, static_cast<float>(number.AsDouble())));
             }
         }
-        else if (val.isString())
+        else if (reader.Peek() == '"')
         {
-            const std::string valAsString = val.asString();
-            bool isPositiveInfinity       = (valAsString == kFloatingPointPositiveInfinity);
-            bool isNegativeInfinity       = (valAsString == kFloatingPointNegativeInfinity);
+            std::string valAsString;
+            ReturnErrorOnFailure(reader.ReadString(&valAsString));
+            bool isPositiveInfinity = (valAsString == kFloatingPointPositiveInfinity);
+            bool isNegativeInfinity = (valAsString == kFloatingPointNegativeInfinity);
             VerifyOrReturnError(isPositiveInfinity || isNegativeInfinity, CHIP_ERROR_INVALID_ARGUMENT);
             if (elementCtx.type.isDouble)
             {
@@ -305,9 +832,10 @@ CHIP_ERROR EncodeTlvElement(const Json::Value & val, TLV::TLVWriter & writer, co
     }
 
     case TLV::kTLVType_ByteString: {
-        VerifyOrReturnError(val.isString(), CHIP_ERROR_INVALID_ARGUMENT);
-        const std::string valAsString = val.asString();
-        size_t encodedLen             = valAsString.length();
+        VerifyOrReturnError(reader.Peek() == '"', CHIP_ERROR_INVALID_ARGUMENT);
+        std::string valAsString;
+        ReturnErrorOnFailure(reader.ReadString(&valAsString));
+        size_t encodedLen = valAsString.length();
         VerifyOrReturnError(CanCastTo<uint16_t>(encodedLen), CHIP_ERROR_INVALID_ARGUMENT);
 
         // Check if the length is a multiple of 4 as strict padding is required.
@@ -324,64 +852,89 @@ CHIP_ERROR EncodeTlvElement(const Json::Value & val, TLV::TLVWriter & writer, co
     }
 
     case TLV::kTLVType_UTF8String: {
-        VerifyOrReturnError(val.isString(), CHIP_ERROR_INVALID_ARGUMENT);
-        const std::string valAsString = val.asString();
+        VerifyOrReturnError(reader.Peek() == '"', CHIP_ERROR_INVALID_ARGUMENT);
+        std::string valAsString;
+        ReturnErrorOnFailure(reader.ReadString(&valAsString));
         ReturnErrorOnFailure(writer.PutString(tag, valAsString.data(), static_cast<uint32_t>(valAsString.size())));
         break;
     }
 
     case TLV::kTLVType_Null: {
-        VerifyOrReturnError(val.isNull(), CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(reader.Peek() == 'n', CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(reader.ReadLiteral("null"));
         ReturnErrorOnFailure(writer.PutNull(tag));
         break;
     }
 
     case TLV::kTLVType_Structure: {
         TLV::TLVType containerType;
-        VerifyOrReturnError(val.isObject(), CHIP_ERROR_INVALID_ARGUMENT);
-        ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, containerType));
+        VerifyOrReturnError(reader.Consume('{'), CHIP_ERROR_INVALID_ARGUMENT);
 
-        std::vector<std::string> jsonNames = val.getMemberNames();
+        // TLV structure members are written sorted by tag, so all members of the object are located
+        // first. Only their names and positions are kept, values are encoded once sorted.
         std::vector<ElementContext> nestedElementsCtx;
+        bool first = true;
+        bool found = false;
 
-        for (size_t i = 0; i < jsonNames.size(); i++)
+        ElementContext memberCtx;
+        ReturnErrorOnFailure(reader.NextObjectMember(first, found, &memberCtx.jsonName));
+        while (found)
+        {
+            memberCtx.value = reader.GetPosition();
+            ReturnErrorOnFailure(reader.SkipValue());
+            nestedElementsCtx.push_back(std::move(memberCtx));
+
+            memberCtx = ElementContext();
+            ReturnErrorOnFailure(reader.NextObjectMember(first, found, &memberCtx.jsonName));
+        }
+        const char * structEnd = reader.GetPosition();
+
+        // As with Json::Value objects, only the last of several members with the same name is kept.
+        std::stable_sort(nestedElementsCtx.begin(), nestedElementsCtx.end(),
+                         [](const ElementContext & a, const ElementContext & b) { return a.jsonName < b.jsonName; });
+        auto duplicate = std::unique(nestedElementsCtx.rbegin(), nestedElementsCtx.rend(),
+                                     [](const ElementContext & a, const ElementContext & b) { return a.jsonName == b.jsonName; });
+        nestedElementsCtx.erase(nestedElementsCtx.begin(), duplicate.base());
+
+        for (auto & ctx : nestedElementsCtx)
         {
-            ElementContext ctx;
-            ReturnErrorOnFailure(ParseJsonName(jsonNames[i], ctx, writer.ImplicitProfileId));
-            nestedElementsCtx.push_back(ctx);
+            ReturnErrorOnFailure(ParseJsonName(ctx.jsonName, ctx, writer.ImplicitProfileId));
         }
 
         // Sort Json object elements by Tag number (low to high).
         // Note that all sorted Context Tags will appear first followed by all sorted Common Tags.
-        std::sort(nestedElementsCtx.begin(), nestedElementsCtx.end(), CompareByTag);
+        std::stable_sort(nestedElementsCtx.begin(), nestedElementsCtx.end(), CompareByTag);
 
+        ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, containerType));
         for (auto & ctx : nestedElementsCtx)
         {
-            ReturnErrorOnFailure(EncodeTlvElement(val[ctx.jsonName], writer, ctx));
+            reader.SetPosition(ctx.value);
+            ReturnErrorOnFailure(EncodeTlvElement(reader, writer, ctx));
         }
-
         ReturnErrorOnFailure(writer.EndContainer(containerType));
+
+        reader.SetPosition(structEnd);
         break;
     }
 
     case TLV::kTLVType_Array: {
         TLV::TLVType containerType;
-        VerifyOrReturnError(val.isArray(), CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(reader.Consume('['), CHIP_ERROR_INVALID_ARGUMENT);
         ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Array, containerType));
 
-        if (elementCtx.subType.tlvType == TLV::kTLVType_NotSpecified)
-        {
-            VerifyOrReturnError(val.size() == 0, CHIP_ERROR_INVALID_ARGUMENT);
-        }
-        else
+        ElementContext nestedElementCtx;
+        nestedElementCtx.tag  = TLV::AnonymousTag();
+        nestedElementCtx.type = elementCtx.subType;
+
+        // Array elements are encoded as they are read.
+        bool first = true;
+        bool found = false;
+        ReturnErrorOnFailure(reader.NextArrayElement(first, found));
+        while (found)
         {
-            ElementContext nestedElementCtx;
-            nestedElementCtx.tag  = TLV::AnonymousTag();
-            nestedElementCtx.type = elementCtx.subType;
-            for (Json::ArrayIndex i = 0; i < val.size(); i++)
-            {
-                ReturnErrorOnFailure(EncodeTlvElement(val[i], writer, nestedElementCtx));
-            }
+            VerifyOrReturnError(elementCtx.subType.tlvType != TLV::kTLVType_NotSpecified, CHIP_ERROR_INVALID_ARGUMENT);
+            ReturnErrorOnFailure(EncodeTlvElement(reader, writer, nestedElementCtx));
+            ReturnErrorOnFailure(reader.NextArrayElement(first, found));
         }
 
         ReturnErrorOnFailure(writer.EndContainer(containerType));
@@ -411,10 +964,13 @@ CHIP_ERROR JsonToTlv(const std::string & jsonString, MutableByteSpan & tlv)
 
 CHIP_ERROR JsonToTlv(const std::string & jsonString, TLV::TLVWriter & writer)
 {
-    Json::Reader reader;
-    Json::Value json;
-    bool result = reader.parse(jsonString, json);
-    VerifyOrReturnError(result, CHIP_ERROR_INTERNAL);
+    JsonTextReader reader(jsonString);
+    if (reader.Peek() != '{')
+    {
+        // Not an object: report syntax errors first, as they were when the whole input was parsed upfront.
+        ReturnErrorOnFailure(reader.SkipValue());
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
 
     ElementContext elementCtx;
     elementCtx.type = { TLV::kTLVType_Structure, false };
@@ -427,7 +983,7 @@ CHIP_ERROR JsonToTlv(const std::string & jsonString, TLV::TLVWriter & writer)
         writer.ImplicitProfileId = kTemporaryImplicitProfileId;
     }
 
-    return EncodeTlvElement(json, writer, elementCtx);
+    return EncodeTlvElement(reader, writer, elementCtx);
 }
 
 CHIP_ERROR ConvertTlvTag(uint32_t tagNumber, TLV::Tag & tag)
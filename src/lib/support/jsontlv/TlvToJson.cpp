@@ -24,6 +24,10 @@
 #include <lib/support/jsontlv/ElementTypes.h>
 #include <lib/support/jsontlv/TlvToJson.h>
 
+#include <algorithm>
+#include <string.h>
+#include <vector>
+
 namespace chip {
 
 namespace {
@@ -131,63 +135,104 @@ struct JsonObjectElementContext
 };
 
 /*
- * This templated function inserts a name/value pair into the Json object.
- * The value is templated to be of type T and accepts any of the following types:
- *
- *      bool, uint*_t, int*_t, char *, float, double, std::string, Json::Value
+ * Emits JSON text using exactly the same layout as Json::StyledWriter (3 space indentation, object members
+ * sorted by name, short arrays of simple values on a single line).
  *
- * This method uses the provided element context to generate Json name string.
+ * This allows the JSON output to be generated while walking the TLV payload instead of first building a
+ * Json::Value tree of the entire payload, which is expensive for large list attributes.
  */
-template <typename T>
-void InsertJsonElement(Json::Value & json, const JsonObjectElementContext & ctx, T val)
+class StyledJsonOutput
 {
-    if (json.isArray())
+public:
+    // Arrays that would be at least this wide are written one element per line.
+    static constexpr size_t kRightMargin = 74;
+
+    StyledJsonOutput(std::string & document) : mDocument(document) {}
+
+    void Append(const char * value) { mDocument += value; }
+    void Append(const std::string & value) { mDocument += value; }
+
+    void WriteIndent()
     {
-        json.append(val);
+        if (!mDocument.empty())
+        {
+            char last = mDocument.back();
+            if (last == ' ')
+            {
+                // already indented
+                return;
+            }
+            if (last != '\n')
+            {
+                mDocument += '\n';
+            }
+        }
+        mDocument += mIndent;
     }
-    else
+
+    template <typename T>
+    void WriteWithIndent(const T & value)
     {
-        json[ctx.GenerateJsonElementName()] = val;
+        WriteIndent();
+        Append(value);
     }
-}
 
-static CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj);
+    void Indent() { mIndent.append(kIndentSize, ' '); }
+    void Unindent() { mIndent.resize(mIndent.size() - kIndentSize); }
+
+private:
+    static constexpr size_t kIndentSize = 3;
+
+    std::string & mDocument;
+    std::string mIndent;
+};
 
 /*
- * Given a TLVReader positioned at TLV structure this function:
- *   - enters structure
- *   - converts all elements of a structure into JSON object representation
- *   - exits structure
+ * A member of a TLV structure, positioned so that it can be converted once all members of the
+ * structure are known and sorted by their JSON name.
  */
-CHIP_ERROR TlvStructToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
+struct StructMember
 {
-    CHIP_ERROR err;
-    TLV::TLVType containerType;
+    std::string name;
+    TLV::TLVReader reader;
+};
 
-    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+bool CompareByName(const StructMember & a, const StructMember & b)
+{
+    return a.name < b.name;
+}
 
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
-    {
-        TLV::Tag tag = reader.GetTag();
-        VerifyOrReturnError(TLV::IsContextTag(tag) || TLV::IsProfileTag(tag), CHIP_ERROR_INVALID_TLV_TAG);
+/*
+ * Given a TLVReader positioned at a TLV array, determines the type of the array elements from its first element.
+ */
+CHIP_ERROR GetArraySubType(const TLV::TLVReader & reader, ElementTypeContext & subType)
+{
+    TLV::TLVReader elementReader(reader);
+    TLV::TLVType containerType;
 
-        if (TLV::IsProfileTag(tag) && TLV::VendorIdFromTag(tag) == 0)
-        {
-            VerifyOrReturnError(TLV::TagNumFromTag(tag) > UINT8_MAX, CHIP_ERROR_INVALID_TLV_TAG);
-        }
+    ReturnErrorOnFailure(elementReader.EnterContainer(containerType));
 
-        // Recursively convert to JSON the item within the struct.
-        ReturnErrorOnFailure(TlvToJson(reader, jsonObj));
+    CHIP_ERROR err = elementReader.Next();
+    if (err == CHIP_END_OF_TLV)
+    {
+        subType = ElementTypeContext();
+        return CHIP_NO_ERROR;
     }
+    ReturnErrorOnFailure(err);
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    return reader.ExitContainer(containerType);
+    subType.tlvType = elementReader.GetType();
+    if (subType.tlvType == TLV::kTLVType_FloatingPointNumber)
+    {
+        subType.isDouble = elementReader.IsElementDouble();
+    }
+    return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
+/*
+ * Converts a non-container TLV element into its JSON text representation.
+ */
+CHIP_ERROR ScalarToJson(TLV::TLVReader & reader, std::string & value)
 {
-    JsonObjectElementContext context(reader);
-
     switch (reader.GetType())
     {
     case TLV::kTLVType_UnsignedInteger: {
@@ -195,11 +240,11 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
         ReturnErrorOnFailure(reader.Get(v));
         if (CanCastTo<uint32_t>(v))
         {
-            InsertJsonElement(jsonObj, context, v);
+            value = Json::valueToString(static_cast<Json::LargestUInt>(v));
         }
         else
         {
-            InsertJsonElement(jsonObj, context, std::to_string(v));
+            value = Json::valueToQuotedString(std::to_string(v).c_str());
         }
         break;
     }
@@ -209,11 +254,11 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
         ReturnErrorOnFailure(reader.Get(v));
         if (CanCastTo<int32_t>(v))
         {
-            InsertJsonElement(jsonObj, context, v);
+            value = Json::valueToString(static_cast<Json::LargestInt>(v));
         }
         else
         {
-            InsertJsonElement(jsonObj, context, std::to_string(v));
+            value = Json::valueToQuotedString(std::to_string(v).c_str());
         }
         break;
     }
@@ -221,7 +266,7 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
     case TLV::kTLVType_Boolean: {
         bool v;
         ReturnErrorOnFailure(reader.Get(v));
-        InsertJsonElement(jsonObj, context, v);
+        value = Json::valueToString(v);
         break;
     }
 
@@ -230,15 +275,15 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
         ReturnErrorOnFailure(reader.Get(v));
         if (v == std::numeric_limits<double>::infinity())
         {
-            InsertJsonElement(jsonObj, context, kFloatingPointPositiveInfinity);
+            value = Json::valueToQuotedString(kFloatingPointPositiveInfinity);
         }
         else if (v == -std::numeric_limits<double>::infinity())
         {
-            InsertJsonElement(jsonObj, context, kFloatingPointNegativeInfinity);
+            value = Json::valueToQuotedString(kFloatingPointNegativeInfinity);
         }
         else
         {
-            InsertJsonElement(jsonObj, context, v);
+            value = Json::valueToString(v);
         }
         break;
     }
@@ -254,7 +299,7 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
         auto encodedLen              = Base64Encode(span.data(), static_cast<uint16_t>(span.size()), byteString.Get());
         byteString.Get()[encodedLen] = '\0';
 
-        InsertJsonElement(jsonObj, context, byteString.Get());
+        value = Json::valueToQuotedString(byteString.Get());
         break;
     }
 
@@ -263,72 +308,265 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
         ReturnErrorOnFailure(reader.Get(span));
 
         std::string str(span.data(), span.size());
-        InsertJsonElement(jsonObj, context, str);
+        if (memchr(str.data(), '\0', str.size()) == nullptr)
+        {
+            value = Json::valueToQuotedString(str.c_str());
+        }
+        else
+        {
+            // valueToQuotedString stops at the first NUL, so let the writer escape such (rare) strings.
+            Json::StyledWriter writer;
+            value = writer.write(Json::Value(str));
+            value.pop_back(); // trailing newline
+        }
         break;
     }
 
     case TLV::kTLVType_Null: {
-        InsertJsonElement(jsonObj, context, Json::Value());
+        value = "null";
         break;
     }
 
-    case TLV::kTLVType_Structure: {
-        Json::Value jsonStruct(Json::objectValue);
-        ReturnErrorOnFailure(TlvStructToJson(reader, jsonStruct));
-        InsertJsonElement(jsonObj, context, jsonStruct);
+    default:
+        return CHIP_ERROR_INVALID_TLV_ELEMENT;
         break;
     }
 
-    case TLV::kTLVType_Array: {
-        CHIP_ERROR err;
-        Json::Value jsonArray(Json::arrayValue);
-        ElementTypeContext prevSubType;
-        ElementTypeContext nextSubType;
-        TLV::TLVType containerType;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TlvToJson(TLV::TLVReader & reader, StyledJsonOutput & output);
+
+/*
+ * Given a TLVReader positioned at TLV structure this function:
+ *   - enters structure
+ *   - converts all elements of a structure into JSON object representation
+ *   - exits structure
+ *
+ * Only the names of the structure members are kept in memory, member values are converted
+ * one at a time once the members are sorted.
+ */
+CHIP_ERROR TlvStructToJson(TLV::TLVReader & reader, StyledJsonOutput & output)
+{
+    CHIP_ERROR err;
+    TLV::TLVType containerType;
+    std::vector<StructMember> members;
+
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        TLV::Tag tag = reader.GetTag();
+        VerifyOrReturnError(TLV::IsContextTag(tag) || TLV::IsProfileTag(tag), CHIP_ERROR_INVALID_TLV_TAG);
 
-        ReturnErrorOnFailure(reader.EnterContainer(containerType));
+        if (TLV::IsProfileTag(tag) && TLV::VendorIdFromTag(tag) == 0)
+        {
+            VerifyOrReturnError(TLV::TagNumFromTag(tag) > UINT8_MAX, CHIP_ERROR_INVALID_TLV_TAG);
+        }
 
-        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        JsonObjectElementContext context(reader);
+        if (context.type.tlvType == TLV::kTLVType_Array)
         {
-            VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
-            VerifyOrReturnError(reader.GetType() != TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+            ReturnErrorOnFailure(GetArraySubType(reader, context.subType));
+        }
 
-            nextSubType.tlvType = reader.GetType();
-            if (nextSubType.tlvType == TLV::kTLVType_FloatingPointNumber)
-            {
-                nextSubType.isDouble = reader.IsElementDouble();
-            }
+        members.push_back({ context.GenerateJsonElementName(), reader });
+    }
 
-            if (jsonArray.empty())
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(reader.ExitContainer(containerType));
+
+    if (members.empty())
+    {
+        output.Append("{}");
+        return CHIP_NO_ERROR;
+    }
+
+    // JSON objects are emitted with their members sorted by name.
+    std::stable_sort(members.begin(), members.end(), CompareByName);
+
+    output.WriteWithIndent("{");
+    output.Indent();
+
+    bool first = true;
+    for (size_t i = 0; i < members.size(); i++)
+    {
+        // As with JSON object members, the last element of a duplicate name wins.
+        if (i + 1 < members.size() && members[i].name == members[i + 1].name)
+        {
+            continue;
+        }
+
+        if (!first)
+        {
+            output.Append(",");
+        }
+        first = false;
+
+        output.WriteWithIndent(Json::valueToQuotedString(members[i].name.c_str()));
+        output.Append(" : ");
+
+        // Recursively convert to JSON the item within the struct.
+        ReturnErrorOnFailure(TlvToJson(members[i].reader, output));
+    }
+
+    output.Unindent();
+    output.WriteWithIndent("}");
+    return CHIP_NO_ERROR;
+}
+
+/*
+ * Validates that the element a reader is positioned on is a valid entry of an array whose
+ * elements are of the given type.
+ */
+CHIP_ERROR ValidateArrayElement(TLV::TLVReader & reader, const ElementTypeContext & subType)
+{
+    VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+    VerifyOrReturnError(reader.GetType() != TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+    VerifyOrReturnError(reader.GetType() == subType.tlvType, CHIP_ERROR_INVALID_TLV_ELEMENT);
+    if (subType.tlvType == TLV::kTLVType_FloatingPointNumber)
+    {
+        VerifyOrReturnError(reader.IsElementDouble() == subType.isDouble, CHIP_ERROR_INVALID_TLV_ELEMENT);
+    }
+    return CHIP_NO_ERROR;
+}
+
+/*
+ * Given a TLVReader positioned at a TLV array, converts it into a JSON array.
+ *
+ * Arrays short enough to fit on a single line are the only ones for which element values
+ * are buffered, all other elements are written out as they are read.
+ */
+CHIP_ERROR TlvArrayToJson(TLV::TLVReader & reader, StyledJsonOutput & output)
+{
+    CHIP_ERROR err;
+    ElementTypeContext subType;
+    TLV::TLVType containerType;
+    size_t count = 0;
+
+    ReturnErrorOnFailure(GetArraySubType(reader, subType));
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+    const TLV::TLVReader elementsStart(reader);
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        count++;
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(reader.ExitContainer(containerType));
+
+    if (count == 0)
+    {
+        output.Append("[]");
+        return CHIP_NO_ERROR;
+    }
+
+    // Arrays of simple values (or empty structures) may be written on a single line.
+    std::vector<std::string> values;
+    bool multiLine = (count * 3 >= StyledJsonOutput::kRightMargin);
+    if (!multiLine)
+    {
+        TLV::TLVReader elementReader(elementsStart);
+        size_t lineLength = 4 + (count - 1) * 2; // '[ ' + ', '*n + ' ]'
+
+        while (!multiLine && (err = elementReader.Next()) == CHIP_NO_ERROR)
+        {
+            ReturnErrorOnFailure(ValidateArrayElement(elementReader, subType));
+
+            std::string value;
+            if (elementReader.GetType() == TLV::kTLVType_Structure)
             {
-                prevSubType = nextSubType;
+                TLV::TLVReader structReader(elementReader);
+                TLV::TLVType structType;
+                ReturnErrorOnFailure(structReader.EnterContainer(structType));
+                multiLine = (structReader.Next() != CHIP_END_OF_TLV);
+                value     = "{}";
             }
             else
             {
-                VerifyOrReturnError(prevSubType.tlvType == nextSubType.tlvType && prevSubType.isDouble == nextSubType.isDouble,
-                                    CHIP_ERROR_INVALID_TLV_ELEMENT);
+                ReturnErrorOnFailure(ScalarToJson(elementReader, value));
             }
 
-            // Recursively convert to JSON the encompassing item within the array.
-            ReturnErrorOnFailure(TlvToJson(reader, jsonArray));
+            lineLength += value.size();
+            values.push_back(std::move(value));
         }
+        VerifyOrReturnError(multiLine || err == CHIP_END_OF_TLV, err);
 
-        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-        ReturnErrorOnFailure(reader.ExitContainer(containerType));
+        if (!multiLine && lineLength < StyledJsonOutput::kRightMargin)
+        {
+            output.Append("[ ");
+            for (size_t i = 0; i < values.size(); i++)
+            {
+                if (i > 0)
+                {
+                    output.Append(", ");
+                }
+                output.Append(values[i]);
+            }
+            output.Append(" ]");
+            return CHIP_NO_ERROR;
+        }
+    }
 
-        context.subType = prevSubType;
-        InsertJsonElement(jsonObj, context, jsonArray);
-        break;
+    output.WriteWithIndent("[");
+    output.Indent();
+
+    if (!multiLine)
+    {
+        // All values were already converted, they are just too long for a single line.
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            if (i > 0)
+            {
+                output.Append(",");
+            }
+            output.WriteWithIndent(values[i]);
+        }
     }
+    else
+    {
+        TLV::TLVReader elementReader(elementsStart);
+        bool first = true;
 
-    default:
-        return CHIP_ERROR_INVALID_TLV_ELEMENT;
-        break;
+        while ((err = elementReader.Next()) == CHIP_NO_ERROR)
+        {
+            ReturnErrorOnFailure(ValidateArrayElement(elementReader, subType));
+
+            if (!first)
+            {
+                output.Append(",");
+            }
+            first = false;
+
+            // Recursively convert to JSON the encompassing item within the array.
+            output.WriteIndent();
+            ReturnErrorOnFailure(TlvToJson(elementReader, output));
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
     }
 
+    output.Unindent();
+    output.WriteWithIndent("]");
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TlvToJson(TLV::TLVReader & reader, StyledJsonOutput & output)
+{
+    switch (reader.GetType())
+    {
+    case TLV::kTLVType_Structure:
+        return TlvStructToJson(reader, output);
+    case TLV::kTLVType_Array:
+        return TlvArrayToJson(reader, output);
+    default: {
+        std::string value;
+        ReturnErrorOnFailure(ScalarToJson(reader, value));
+        output.Append(value);
+        return CHIP_NO_ERROR;
+    }
+    }
+}
+
 } // namespace
 
 CHIP_ERROR TlvToJson(const ByteSpan & tlv, std::string & jsonString)
@@ -350,11 +588,12 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, std::string & jsonString)
     // During json conversion, a implicit profile ID is required
     ImplicitProfileIdChange implicitProfileIdChange(reader, kTemporaryImplicitProfileId);
 
-    Json::Value jsonObject(Json::objectValue);
-    ReturnErrorOnFailure(TlvStructToJson(reader, jsonObject));
+    std::string document;
+    StyledJsonOutput output(document);
+    ReturnErrorOnFailure(TlvStructToJson(reader, output));
+    document += '\n';
 
-    Json::StyledWriter writer;
-    jsonString = writer.write(jsonObject);
+    jsonString = std::move(document);
     return CHIP_NO_ERROR;
 }
 } // namespace chip
@@ -67,7 +67,7 @@ void LogByteSpan(uint8_t module, uint8_t category, const ByteSpan & span);
 #define ChipInternalLogByteSpanImpl(MOD, CAT, DATA)                                                                                \
     do                                                                                                                             \
     {                                                                                                                              \
-        if (chip::Logging::IsCategoryEnabled(CAT))                                                                                 \
+        if (chip::Logging::IsCategoryEnabled(chip::Logging::kLogModule_##MOD, CAT))                                                \
         {                                                                                                                          \
             chip::Logging::LogByteSpan(chip::Logging::kLogModule_##MOD, CAT, DATA);                                                \
         }                                                                                                                          \
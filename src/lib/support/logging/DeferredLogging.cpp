@@ -0,0 +1,646 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "DeferredLogging.h"
+
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+
+namespace chip {
+namespace Logging {
+
+namespace {
+
+enum class ArgType : uint8_t
+{
+    kNone, ///< Not a supported conversion, the rest of the format string is logged as is
+    kInt,
+    kLong,
+    kLongLong,
+    kIntMax,
+    kSize,
+    kPtrDiff,
+    kDouble,
+    kLongDouble,
+    kPointer,
+    kString,
+    kCount, ///< %n, whose argument is skipped
+};
+
+struct Conversion
+{
+    const char * start; ///< The '%'
+    const char * end;   ///< Past the conversion specifier
+    bool widthStar;
+    bool precisionStar;
+    int precision; ///< Negative if not specified
+    ArgType type;
+};
+
+bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/*
+ * Find the next conversion in the format string, starting at the cursor, and
+ * move the cursor past it. "%%" is left in the literal text.
+ */
+bool NextConversion(const char *& cursor, Conversion & conversion)
+{
+    const char * p = cursor;
+    while (*p != '\0' && !(p[0] == '%' && p[1] != '%'))
+    {
+        p += (p[0] == '%') ? 2 : 1;
+    }
+    if (*p == '\0')
+    {
+        cursor = p;
+        return false;
+    }
+
+    conversion.start         = p++;
+    conversion.widthStar     = false;
+    conversion.precisionStar = false;
+    conversion.precision     = -1;
+
+    while (*p != '\0' && strchr("-+ #0'", *p) != nullptr)
+    {
+        p++;
+    }
+
+    if (*p == '*')
+    {
+        conversion.widthStar = true;
+        p++;
+    }
+    while (IsDigit(*p))
+    {
+        p++;
+    }
+
+    if (*p == '.')
+    {
+        p++;
+        conversion.precision = 0;
+        if (*p == '*')
+        {
+            conversion.precisionStar = true;
+            p++;
+        }
+        while (IsDigit(*p))
+        {
+            conversion.precision = conversion.precision * 10 + (*p++ - '0');
+        }
+    }
+
+    ArgType integer = ArgType::kInt;
+    bool longDouble = false;
+    switch (*p)
+    {
+    case 'h':
+        p += (p[1] == 'h') ? 2 : 1;
+        break;
+    case 'l':
+        integer = (p[1] == 'l') ? ArgType::kLongLong : ArgType::kLong;
+        p += (p[1] == 'l') ? 2 : 1;
+        break;
+    case 'j':
+        integer = ArgType::kIntMax;
+        p++;
+        break;
+    case 'z':
+        integer = ArgType::kSize;
+        p++;
+        break;
+    case 't':
+        integer = ArgType::kPtrDiff;
+        p++;
+        break;
+    case 'L':
+        longDouble = true;
+        p++;
+        break;
+    default:
+        break;
+    }
+
+    switch (*p)
+    {
+    case 'd':
+    case 'i':
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X':
+    case 'c':
+        conversion.type = integer;
+        break;
+    case 'e':
+    case 'E':
+    case 'f':
+    case 'F':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        conversion.type = longDouble ? ArgType::kLongDouble : ArgType::kDouble;
+        break;
+    case 's':
+        conversion.type = ArgType::kString;
+        break;
+    case 'p':
+        conversion.type = ArgType::kPointer;
+        break;
+    case 'n':
+        conversion.type = ArgType::kCount;
+        break;
+    default:
+        conversion.type = ArgType::kNone;
+        break;
+    }
+
+    conversion.end = (*p != '\0') ? p + 1 : p;
+    cursor         = conversion.end;
+    return true;
+}
+
+class ArgWriter
+{
+public:
+    ArgWriter(uint8_t * buffer, size_t size) : mBuffer(buffer), mSize(size) {}
+
+    template <typename T>
+    bool Put(T value)
+    {
+        if (mUsed + sizeof(T) > mSize)
+        {
+            return false;
+        }
+        memcpy(mBuffer + mUsed, &value, sizeof(T));
+        mUsed += sizeof(T);
+        return true;
+    }
+
+    // Stored as a length byte and the characters
+    bool PutString(const char * string, size_t maxLength)
+    {
+        const size_t length = strnlen(string, std::min(maxLength, mSize));
+        if (mUsed + 1 + length > mSize)
+        {
+            return false;
+        }
+        mBuffer[mUsed++] = static_cast<uint8_t>(length);
+        memcpy(mBuffer + mUsed, string, length);
+        mUsed += length;
+        return true;
+    }
+
+    size_t Used() const { return mUsed; }
+
+private:
+    uint8_t * mBuffer;
+    size_t mSize;
+    size_t mUsed = 0;
+};
+
+class ArgReader
+{
+public:
+    ArgReader(const uint8_t * buffer, size_t size) : mBuffer(buffer), mSize(size) {}
+
+    template <typename T>
+    bool Get(T & value)
+    {
+        if (mUsed + sizeof(T) > mSize)
+        {
+            return false;
+        }
+        memcpy(&value, mBuffer + mUsed, sizeof(T));
+        mUsed += sizeof(T);
+        return true;
+    }
+
+    // Copies the string into the provided buffer, which must be larger than the arguments
+    bool GetString(char * string)
+    {
+        uint8_t length;
+        if (!Get(length) || mUsed + length > mSize)
+        {
+            return false;
+        }
+        memcpy(string, mBuffer + mUsed, length);
+        string[length] = '\0';
+        mUsed += length;
+        return true;
+    }
+
+private:
+    const uint8_t * mBuffer;
+    size_t mSize;
+    size_t mUsed = 0;
+};
+
+/*
+ * Store the arguments the format string refers to. Returns false if they did
+ * not all fit.
+ */
+bool CaptureArgs(const char * format, va_list args, ArgWriter & writer)
+{
+    const char * cursor = format;
+    Conversion conversion;
+    while (NextConversion(cursor, conversion))
+    {
+        if (conversion.widthStar && !writer.Put(va_arg(args, int)))
+        {
+            return false;
+        }
+        if (conversion.precisionStar)
+        {
+            conversion.precision = va_arg(args, int);
+            if (!writer.Put(conversion.precision))
+            {
+                return false;
+            }
+        }
+
+        bool stored = true;
+        switch (conversion.type)
+        {
+        case ArgType::kNone:
+            return true;
+        case ArgType::kInt:
+            stored = writer.Put(va_arg(args, int));
+            break;
+        case ArgType::kLong:
+            stored = writer.Put(va_arg(args, long));
+            break;
+        case ArgType::kLongLong:
+            stored = writer.Put(va_arg(args, long long));
+            break;
+        case ArgType::kIntMax:
+            stored = writer.Put(va_arg(args, intmax_t));
+            break;
+        case ArgType::kSize:
+            stored = writer.Put(va_arg(args, size_t));
+            break;
+        case ArgType::kPtrDiff:
+            stored = writer.Put(va_arg(args, ptrdiff_t));
+            break;
+        case ArgType::kDouble:
+            stored = writer.Put(va_arg(args, double));
+            break;
+        case ArgType::kLongDouble:
+            stored = writer.Put(va_arg(args, long double));
+            break;
+        case ArgType::kPointer:
+            stored = writer.Put(va_arg(args, void *));
+            break;
+        case ArgType::kString: {
+            // "%.*s" is commonly used for strings that are not null-terminated
+            const char * string    = va_arg(args, const char *);
+            const size_t maxLength = (conversion.precision >= 0) ? static_cast<size_t>(conversion.precision) : SIZE_MAX;
+            stored                 = writer.PutString((string != nullptr) ? string : "(null)", maxLength);
+            break;
+        }
+        case ArgType::kCount:
+            (void) va_arg(args, void *);
+            break;
+        }
+
+        if (!stored)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+
+template <typename T>
+int FormatArg(char * output, size_t size, const char * spec, const int * stars, size_t starCount, T value)
+{
+    switch (starCount)
+    {
+    case 0:
+        return snprintf(output, size, spec, value);
+    case 1:
+        return snprintf(output, size, spec, stars[0], value);
+    default:
+        return snprintf(output, size, spec, stars[0], stars[1], value);
+    }
+}
+
+#pragma GCC diagnostic pop
+
+template <typename T>
+bool FormatStoredArg(ArgReader & reader, char * output, size_t size, const char * spec, const int * stars, size_t starCount,
+                     int & written)
+{
+    T value;
+    if (!reader.Get(value))
+    {
+        return false;
+    }
+    written = FormatArg(output, size, spec, stars, starCount, value);
+    return true;
+}
+
+class MessageWriter
+{
+public:
+    MessageWriter(char * message, size_t size) : mMessage(message), mSize(size) { mMessage[0] = '\0'; }
+
+    // Appends literal text, in which "%%" stands for '%'
+    void AppendLiteral(const char * text, const char * end)
+    {
+        for (const char * p = text; p < end; p++)
+        {
+            if (p[0] == '%' && p + 1 < end && p[1] == '%')
+            {
+                p++;
+            }
+            Append(*p);
+        }
+    }
+
+    void Append(char c)
+    {
+        if (mLength + 1 < mSize)
+        {
+            mMessage[mLength++] = c;
+            mMessage[mLength]   = '\0';
+        }
+    }
+
+    char * Cursor() { return mMessage + mLength; }
+    size_t Remaining() const { return mSize - mLength; }
+
+    void Advance(int written)
+    {
+        if (written > 0)
+        {
+            mLength = std::min(mLength + static_cast<size_t>(written), mSize - 1);
+        }
+    }
+
+private:
+    char * mMessage;
+    size_t mSize;
+    size_t mLength = 0;
+};
+
+bool FormatConversion(const Conversion & conversion, ArgReader & reader, MessageWriter & writer)
+{
+    char spec[16];
+    const size_t specLength = static_cast<size_t>(conversion.end - conversion.start);
+    if (specLength >= sizeof(spec))
+    {
+        return false;
+    }
+    memcpy(spec, conversion.start, specLength);
+    spec[specLength] = '\0';
+
+    int stars[2];
+    size_t starCount = 0;
+    if (conversion.widthStar && !reader.Get(stars[starCount++]))
+    {
+        return false;
+    }
+    if (conversion.precisionStar && !reader.Get(stars[starCount++]))
+    {
+        return false;
+    }
+
+    char * output = writer.Cursor();
+    size_t size   = writer.Remaining();
+    int written   = 0;
+    bool read     = true;
+    switch (conversion.type)
+    {
+    case ArgType::kNone:
+        return false;
+    case ArgType::kInt:
+        read = FormatStoredArg<int>(reader, output, size, spec, stars, starCount, written);
+        break;
+    case ArgType::kLong:
+        read = FormatStoredArg<long>(reader, output, size, spec, stars, starCount, written);
+        break;
+    case ArgType::kLongLong:
+        read = FormatStoredArg<long long>(reader, output, size, spec, stars, starCount, written);
+        break;
+    case ArgType::kIntMax:
+        read = FormatStoredArg<intmax_t>(reader, output, size, spec, stars, starCount, written);
+        break;
+    case ArgType::kSize:
+        read = FormatStoredArg<size_t>(reader, output, size, spec, stars, starCount, written);
+        break;
+    case ArgType::kPtrDiff:
+        read = FormatStoredArg<ptrdiff_t>(reader, output, size, spec, stars, starCount, written);
+        break;
+    case ArgType::kDouble:
+        read = FormatStoredArg<double>(reader, output, size, spec, stars, starCount, written);
+        break;
+    case ArgType::kLongDouble:
+        read = FormatStoredArg<long double>(reader, output, size, spec, stars, starCount, written);
+        break;
+    case ArgType::kPointer:
+        read = FormatStoredArg<void *>(reader, output, size, spec, stars, starCount, written);
+        break;
+    case ArgType::kString: {
+        char string[DeferredLogBuffer::kArgsSize + 1];
+        read = reader.GetString(string);
+        if (read)
+        {
+            written = FormatArg(output, size, spec, stars, starCount, static_cast<const char *>(string));
+        }
+        break;
+    }
+    case ArgType::kCount:
+        break;
+    }
+
+    writer.Advance(written);
+    return read;
+}
+
+} // namespace
+
+DeferredLogBuffer::DeferredLogBuffer()
+{
+    for (size_t i = 0; i < kEntryCount; i++)
+    {
+        mEntries[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+DeferredLogBuffer::CaptureResult DeferredLogBuffer::Capture(uint8_t module, uint8_t category, uint64_t timestamp,
+                                                           const char * format, va_list args)
+{
+    // Gathered before claiming an entry, which cannot be given back
+    uint8_t capturedArgs[kArgsSize];
+    ArgWriter writer(capturedArgs, sizeof(capturedArgs));
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    const bool fits = CaptureArgs(format, argsCopy, writer);
+    va_end(argsCopy);
+    if (!fits)
+    {
+        return CaptureResult::kTooLarge;
+    }
+
+    // Claim the entry at the write position. Each entry is free for the position it was last released for.
+    size_t position = mWritePosition.load(std::memory_order_relaxed);
+    Entry * entry;
+    for (;;)
+    {
+        entry                     = &mEntries[position & (kEntryCount - 1)];
+        const size_t sequence     = entry->sequence.load(std::memory_order_acquire);
+        const ptrdiff_t available = static_cast<ptrdiff_t>(sequence - position);
+        if (available == 0)
+        {
+            if (mWritePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (available < 0)
+        {
+            mDropped.fetch_add(1, std::memory_order_relaxed);
+            return CaptureResult::kDropped;
+        }
+        else
+        {
+            position = mWritePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    entry->format    = format;
+    entry->timestamp = timestamp;
+    entry->module    = module;
+    entry->category  = category;
+    entry->argsSize  = static_cast<uint8_t>(writer.Used());
+    memcpy(entry->args, capturedArgs, writer.Used());
+
+    // Publish the entry to the draining thread
+    entry->sequence.store(position + 1, std::memory_order_release);
+    return CaptureResult::kCaptured;
+}
+
+bool DeferredLogBuffer::Drain(DrainCallback callback, void * context, size_t maxMessages, size_t * drained)
+{
+    // Pairs with the fence below: the messages captured before trying to drain are drained either here or by the thread
+    // already draining
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (mDraining.test_and_set())
+    {
+        return false;
+    }
+
+    char message[CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE];
+    size_t count = 0;
+    for (;;)
+    {
+        while (count < maxMessages && DrainNext(callback, context, message, sizeof(message)))
+        {
+            count++;
+        }
+        mDraining.clear();
+
+        // A thread that found the ring being drained may have captured a message after the last one drained above, then tried
+        // to drain again. Either the message is visible here, or that thread sees the flag cleared and drains it itself.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (count == maxMessages || !HasPendingMessage() || mDraining.test_and_set())
+        {
+            break;
+        }
+    }
+
+    if (drained != nullptr)
+    {
+        *drained = count;
+    }
+    return true;
+}
+
+bool DeferredLogBuffer::DrainNext(DrainCallback callback, void * context, char * message, size_t size)
+{
+    const size_t position = mReadPosition.load(std::memory_order_relaxed);
+    Entry & entry         = mEntries[position & (kEntryCount - 1)];
+    if (entry.sequence.load(std::memory_order_acquire) != position + 1)
+    {
+        return false;
+    }
+
+    Format(entry, message, size);
+    const uint8_t module     = entry.module;
+    const uint8_t category   = entry.category;
+    const uint64_t timestamp = entry.timestamp;
+
+    // Released before the callback, which may log
+    entry.sequence.store(position + kEntryCount, std::memory_order_release);
+    mReadPosition.store(position + 1, std::memory_order_relaxed);
+
+    callback(module, category, timestamp, message, context);
+    return true;
+}
+
+bool DeferredLogBuffer::HasPendingMessage() const
+{
+    const size_t position = mReadPosition.load(std::memory_order_relaxed);
+    return mEntries[position & (kEntryCount - 1)].sequence.load(std::memory_order_acquire) == position + 1;
+}
+
+void DeferredLogBuffer::Format(const Entry & entry, char * message, size_t size)
+{
+    MessageWriter writer(message, size);
+    ArgReader reader(entry.args, entry.argsSize);
+
+    const char * cursor  = entry.format;
+    const char * literal = cursor;
+    bool complete        = true;
+    Conversion conversion;
+    while (NextConversion(cursor, conversion))
+    {
+        if (conversion.type == ArgType::kNone)
+        {
+            break;
+        }
+
+        writer.AppendLiteral(literal, conversion.start);
+        literal = conversion.end;
+        if (!FormatConversion(conversion, reader, writer))
+        {
+            complete = false;
+            break;
+        }
+    }
+
+    if (complete)
+    {
+        writer.AppendLiteral(literal, literal + strlen(literal));
+    }
+    else
+    {
+        writer.AppendLiteral("...", "..." + 3);
+    }
+}
+
+} // namespace Logging
+} // namespace chip
@@ -0,0 +1,160 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a buffer of log messages captured without being
+ *      formatted, used when deferred logging (CHIP_DEFERRED_LOGGING) is
+ *      enabled.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+
+#include <atomic>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Logging {
+
+/**
+ * Bounded lock-free ring of log messages, captured as the pointer to their
+ * format string and their raw arguments. Messages are only formatted when the
+ * ring is drained, e.g. from a low priority thread, so that logging on hot paths
+ * costs a scan of the format string and a copy of the arguments.
+ *
+ * Any thread can capture messages. A single thread drains them at a time, other
+ * threads trying to drain at the same time return right away, and the thread
+ * draining also drains the messages captured meanwhile. When the ring is full,
+ * new messages are dropped and counted.
+ *
+ * Format strings must outlive the messages, which is the case of the string
+ * literals used with the log macros. String arguments are copied. Messages
+ * whose arguments do not fit in an entry are not captured.
+ */
+class DeferredLogBuffer
+{
+public:
+    static constexpr size_t kEntryCount = CHIP_CONFIG_DEFERRED_LOGGING_ENTRIES;
+    static constexpr size_t kArgsSize   = CHIP_CONFIG_DEFERRED_LOGGING_ARGS_SIZE;
+
+    static_assert(kEntryCount >= 2 && (kEntryCount & (kEntryCount - 1)) == 0,
+                  "CHIP_CONFIG_DEFERRED_LOGGING_ENTRIES must be a power of two");
+    static_assert(kArgsSize <= UINT8_MAX, "CHIP_CONFIG_DEFERRED_LOGGING_ARGS_SIZE must fit in a byte");
+
+    enum class CaptureResult : uint8_t
+    {
+        kCaptured,
+        kDropped,  ///< The ring was full
+        kTooLarge, ///< The arguments do not fit in an entry
+    };
+
+    /// Receives each drained message, formatted and null-terminated, with the timestamp it was captured with.
+    using DrainCallback = void (*)(uint8_t module, uint8_t category, uint64_t timestamp, const char * message, void * context);
+
+    DeferredLogBuffer();
+
+    /// Capture a message without formatting it.
+    CaptureResult Capture(uint8_t module, uint8_t category, uint64_t timestamp, const char * format, va_list args);
+
+    /**
+     * Format the captured messages, oldest first, and pass them to the callback.
+     *
+     * Returns false right away if another thread is already draining, in which
+     * case that thread drains the messages captured up to the point it is done.
+     * Otherwise drains at most maxMessages messages, and returns their number in
+     * drained if not null.
+     */
+    bool Drain(DrainCallback callback, void * context, size_t maxMessages = SIZE_MAX, size_t * drained = nullptr);
+
+    /// Number of messages dropped because the ring was full.
+    uint32_t GetDroppedCount() const { return mDropped.load(std::memory_order_relaxed); }
+
+private:
+    struct Entry
+    {
+        std::atomic<size_t> sequence;
+        const char * format;
+        uint64_t timestamp;
+        uint8_t module;
+        uint8_t category;
+        uint8_t argsSize;
+        uint8_t args[kArgsSize];
+    };
+
+    bool DrainNext(DrainCallback callback, void * context, char * message, size_t size);
+    bool HasPendingMessage() const;
+    static void Format(const Entry & entry, char * message, size_t size);
+
+    Entry mEntries[kEntryCount];
+    std::atomic<size_t> mWritePosition{ 0 };
+    std::atomic<size_t> mReadPosition{ 0 }; ///< Only written by the thread that holds mDraining
+    std::atomic_flag mDraining = ATOMIC_FLAG_INIT;
+    std::atomic<uint32_t> mDropped{ 0 };
+};
+
+#if CHIP_DEFERRED_LOGGING
+
+/**
+ * Called when deferred messages are waiting to be drained, from the thread that
+ * logged them. Must not block. Returns false if it could not arrange for a
+ * drain, in which case the next message logged calls it again.
+ */
+using DeferredLogDrainRequestHandler = bool (*)();
+
+/// Current time, in microseconds, on any clock.
+using DeferredLogClock = uint64_t (*)();
+
+/**
+ * Format and log the messages captured so far, at most maxMessages of them.
+ * Messages dropped since the last drain are reported as an error.
+ *
+ * Error messages are not deferred, and drain the messages captured before them
+ * first. Other messages are only logged when this is called, which the drain
+ * request handler arranges for.
+ *
+ * Returns the number of messages logged.
+ */
+size_t DrainDeferredLogs(size_t maxMessages = SIZE_MAX);
+
+/**
+ * Set the handler called when there are messages to drain, which arranges for
+ * DrainDeferredLogs() to be called, e.g. by waking up a low priority thread.
+ * The platform manager sets one that drains on the CHIP event loop, from
+ * InitChipStack() to Shutdown().
+ *
+ * Without a handler, deferred messages are only logged along with the next
+ * error, or when the application calls DrainDeferredLogs().
+ */
+void SetDeferredLogDrainRequestHandler(DeferredLogDrainRequestHandler handler);
+
+/**
+ * Set the clock with which messages are timestamped when captured. Drained
+ * messages start with that time, in seconds, since they are only timestamped
+ * by the platform when drained. The platform manager sets the real time clock.
+ */
+void SetDeferredLogClock(DeferredLogClock clock);
+
+/// Number of deferred messages dropped because they were logged faster than drained.
+uint32_t GetDroppedDeferredLogCount();
+
+#endif // CHIP_DEFERRED_LOGGING
+
+} // namespace Logging
+} // namespace chip
@@ -24,11 +24,16 @@
 
 #include "TextOnlyLogging.h"
 
+#if CHIP_DEFERRED_LOGGING
+#include "DeferredLogging.h"
+#endif
+
 #include <lib/core/CHIPConfig.h>
 #include <lib/support/CHIPMem.h>
 
 #include <platform/logging/LogV.h>
 
+#include <inttypes.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
@@ -111,6 +116,99 @@ static const char ModuleNames[kLogModule_Max][kMaxModuleNameLen + 1] = {
     CHIP_LOGMODULES_ENUMERATE(_CHIP_LOGMODULE_NAME_INIT)
 };
 
+void LogVNow(uint8_t module, uint8_t category, const char * msg, va_list args)
+{
+    const char * moduleName        = GetModuleName(static_cast<LogModule>(module));
+    LogRedirectCallback_t redirect = sLogRedirectCallback.load();
+    if (redirect != nullptr)
+    {
+        redirect(moduleName, category, msg, args);
+    }
+    else
+    {
+        Platform::LogV(moduleName, category, msg, args);
+    }
+}
+
+#if CHIP_DEFERRED_LOGGING
+
+DeferredLogBuffer sDeferredLogs;
+std::atomic<DeferredLogDrainRequestHandler> sDeferredLogDrainRequestHandler{ nullptr };
+std::atomic<DeferredLogClock> sDeferredLogClock{ nullptr };
+std::atomic<bool> sDeferredLogDrainRequested{ false };
+std::atomic<uint32_t> sReportedDroppedDeferredLogs{ 0 };
+
+void LogNow(uint8_t module, uint8_t category, const char * msg, ...)
+{
+    va_list v;
+    va_start(v, msg);
+    LogVNow(module, category, msg, v);
+    va_end(v);
+}
+
+void LogDeferredMessage(uint8_t module, uint8_t category, uint64_t timestamp, const char * message, void * context)
+{
+    // Not timestamped without a clock
+    if (timestamp == 0)
+    {
+        LogNow(module, category, "%s", message);
+        return;
+    }
+    LogNow(module, category, "[%" PRIu64 ".%06" PRIu32 "] %s", timestamp / 1000000, static_cast<uint32_t>(timestamp % 1000000),
+           message);
+}
+
+void RequestDeferredLogDrain()
+{
+    // Requested once until the next drain starts
+    if (!sDeferredLogDrainRequested.exchange(true))
+    {
+        DeferredLogDrainRequestHandler handler = sDeferredLogDrainRequestHandler.load();
+        if (handler != nullptr && !handler())
+        {
+            sDeferredLogDrainRequested.store(false);
+        }
+    }
+}
+
+DeferredLogBuffer::CaptureResult CaptureDeferredLog(uint8_t module, uint8_t category, const char * msg, va_list args)
+{
+    DeferredLogClock clock = sDeferredLogClock.load();
+    auto result            = sDeferredLogs.Capture(module, category, (clock != nullptr) ? clock() : 0, msg, args);
+    if (result != DeferredLogBuffer::CaptureResult::kTooLarge)
+    {
+        // Also when the message was dropped, so that the ring makes room
+        RequestDeferredLogDrain();
+    }
+    return result;
+}
+
+bool TryDrainDeferredLogs(size_t maxMessages, size_t & drained)
+{
+    // Messages captured from now on request another drain
+    sDeferredLogDrainRequested.store(false);
+
+    drained = 0;
+    if (!sDeferredLogs.Drain(LogDeferredMessage, nullptr, maxMessages, &drained))
+    {
+        return false;
+    }
+    if (drained == maxMessages)
+    {
+        RequestDeferredLogDrain();
+    }
+
+    const uint32_t dropped  = sDeferredLogs.GetDroppedCount();
+    const uint32_t reported = sReportedDroppedDeferredLogs.exchange(dropped);
+    if (dropped != reported)
+    {
+        LogNow(kLogModule_Support, kLogCategory_Error, "%" PRIu32 " deferred log messages dropped", dropped - reported);
+    }
+    return true;
+}
+
+#endif // CHIP_DEFERRED_LOGGING
+
 } // namespace
 
 const char * GetModuleName(LogModule module)
@@ -156,21 +254,64 @@ void Log(uint8_t module, uint8_t category, const char * msg, ...)
 
 void LogV(uint8_t module, uint8_t category, const char * msg, va_list args)
 {
-    const char * moduleName        = GetModuleName(static_cast<LogModule>(module));
-    LogRedirectCallback_t redirect = sLogRedirectCallback.load();
-    if (redirect != nullptr)
+#if CHIP_DEFERRED_LOGGING
+    using CaptureResult = DeferredLogBuffer::CaptureResult;
+
+    // Errors, and messages whose arguments do not fit in the ring, are logged right away
+    if (category != kLogCategory_Error && CaptureDeferredLog(module, category, msg, args) != CaptureResult::kTooLarge)
     {
-        redirect(moduleName, category, msg, args);
+        return;
     }
-    else
+
+    // Keep the order of the messages: log the ones captured before this one first. If another thread is logging them, queue
+    // this one after them instead, unless the ring cannot take it.
+    size_t drained;
+    if (!TryDrainDeferredLogs(SIZE_MAX, drained) && CaptureDeferredLog(module, category, msg, args) == CaptureResult::kCaptured)
     {
-        Platform::LogV(moduleName, category, msg, args);
+        // Makes sure it is logged, should the other thread be done already
+        TryDrainDeferredLogs(SIZE_MAX, drained);
+        return;
     }
+#endif // CHIP_DEFERRED_LOGGING
+
+    LogVNow(module, category, msg, args);
 }
 
+#if CHIP_DEFERRED_LOGGING
+size_t DrainDeferredLogs(size_t maxMessages)
+{
+    size_t drained;
+    return TryDrainDeferredLogs(maxMessages, drained) ? drained : 0;
+}
+
+void SetDeferredLogDrainRequestHandler(DeferredLogDrainRequestHandler handler)
+{
+    sDeferredLogDrainRequestHandler.store(handler);
+
+    // Let the new handler know about the messages already waiting
+    if (handler != nullptr && sDeferredLogDrainRequested.exchange(false))
+    {
+        RequestDeferredLogDrain();
+    }
+}
+
+void SetDeferredLogClock(DeferredLogClock clock)
+{
+    sDeferredLogClock.store(clock);
+}
+
+uint32_t GetDroppedDeferredLogCount()
+{
+    return sDeferredLogs.GetDroppedCount();
+}
+#endif // CHIP_DEFERRED_LOGGING
+
 #if CHIP_LOG_FILTERING
 std::atomic<uint8_t> gLogFilter(kLogCategory_Max);
 
+// Stored as the number of categories filtered out, so that modules log every category by default
+std::atomic<uint8_t> gModuleLogFilteredOut[kLogModule_Max];
+
 uint8_t GetLogFilter()
 {
     return gLogFilter.load();
@@ -185,6 +326,30 @@ bool IsCategoryEnabled(uint8_t category)
 {
     return (category <= GetLogFilter());
 }
+
+uint8_t GetModuleLogFilter(uint8_t module)
+{
+    if (module >= kLogModule_Max)
+    {
+        return kLogCategory_Max;
+    }
+    return static_cast<uint8_t>(kLogCategory_Max - gModuleLogFilteredOut[module].load(std::memory_order_relaxed));
+}
+
+void SetModuleLogFilter(uint8_t module, uint8_t category)
+{
+    if (module >= kLogModule_Max)
+    {
+        return;
+    }
+    category = (category < kLogCategory_Max) ? category : static_cast<uint8_t>(kLogCategory_Max);
+    gModuleLogFilteredOut[module].store(static_cast<uint8_t>(kLogCategory_Max - category), std::memory_order_relaxed);
+}
+
+bool IsCategoryEnabled(uint8_t module, uint8_t category)
+{
+    return IsCategoryEnabled(category) && (category <= GetModuleLogFilter(module));
+}
 #endif // CHIP_LOG_FILTERING
 
 #endif // _CHIP_USE_LOGGING
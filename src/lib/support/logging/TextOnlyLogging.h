@@ -356,6 +356,11 @@ using LogRedirectCallback_t = void (*)(const char * module, uint8_t category, co
 DLL_EXPORT uint8_t GetLogFilter();
 DLL_EXPORT void SetLogFilter(uint8_t category);
 bool IsCategoryEnabled(uint8_t category);
+
+// Per-module filtering, applied on top of the global filter. Modules log every category by default.
+DLL_EXPORT uint8_t GetModuleLogFilter(uint8_t module);
+DLL_EXPORT void SetModuleLogFilter(uint8_t module, uint8_t category);
+bool IsCategoryEnabled(uint8_t module, uint8_t category);
 #else  // _CHIP_USE_LOGGING && CHIP_LOG_FILTERING
 inline uint8_t GetLogFilter()
 {
@@ -368,6 +373,18 @@ inline bool IsCategoryEnabled(uint8_t category)
 {
     return true;
 }
+
+inline uint8_t GetModuleLogFilter(uint8_t module)
+{
+    return kLogCategory_Max;
+}
+
+inline void SetModuleLogFilter(uint8_t module, uint8_t category) {}
+
+inline bool IsCategoryEnabled(uint8_t module, uint8_t category)
+{
+    return true;
+}
 #endif // _CHIP_USE_LOGGING && CHIP_LOG_FILTERING
 
 #if _CHIP_USE_LOGGING
@@ -453,7 +470,7 @@ void HandleTokenizedLog(uint32_t levels, pw_tokenizer_Token token, pw_tokenizer_
 #define ChipInternalLogImpl(MOD, CAT, MSG, ...)                                                                                    \
     do                                                                                                                             \
     {                                                                                                                              \
-        if (chip::Logging::IsCategoryEnabled(CAT))                                                                                 \
+        if (chip::Logging::IsCategoryEnabled(chip::Logging::kLogModule_##MOD, CAT))                                                \
         {                                                                                                                          \
             PW_TOKENIZE_FORMAT_STRING(PW_TOKENIZER_DEFAULT_DOMAIN, UINT32_MAX, MSG, __VA_ARGS__);                                  \
             ::chip::Logging::HandleTokenizedLog((uint32_t) ((CAT << 8) | chip::Logging::kLogModule_##MOD), _pw_tokenizer_token,    \
@@ -464,7 +481,7 @@ void HandleTokenizedLog(uint32_t levels, pw_tokenizer_Token token, pw_tokenizer_
 #define ChipInternalLogImpl(MOD, CAT, MSG, ...)                                                                                    \
     do                                                                                                                             \
     {                                                                                                                              \
-        if (chip::Logging::IsCategoryEnabled(CAT))                                                                                 \
+        if (chip::Logging::IsCategoryEnabled(chip::Logging::kLogModule_##MOD, CAT))                                                \
         {                                                                                                                          \
             chip::Logging::Log(chip::Logging::kLogModule_##MOD, CAT, MSG, ##__VA_ARGS__);                                          \
         }                                                                                                                          \
@@ -0,0 +1,189 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/BumpArena.h>
+
+#include <stdint.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+
+using namespace chip;
+
+namespace {
+
+class TestBumpArena : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+struct Node
+{
+    Node(uint32_t aValue, Node * aNext) : value(aValue), next(aNext) {}
+
+    uint32_t value;
+    Node * next;
+};
+
+class CountingBudget : public BumpArena::Budget
+{
+public:
+    explicit CountingBudget(size_t limit) : mLimit(limit) {}
+
+    bool ReserveArenaMemory(size_t bytes) override
+    {
+        if (mReserved + bytes > mLimit)
+        {
+            return false;
+        }
+        mReserved += bytes;
+        return true;
+    }
+
+    void ReleaseArenaMemory(size_t bytes) override { mReserved -= bytes; }
+
+    size_t mLimit;
+    size_t mReserved = 0;
+};
+
+TEST_F(TestBumpArena, TestAllocateAndAlign)
+{
+    BumpArena arena(128);
+
+    uint8_t * byte = static_cast<uint8_t *>(arena.Allocate(1, 1));
+    ASSERT_NE(byte, nullptr);
+
+    uint64_t * word = static_cast<uint64_t *>(arena.Allocate(sizeof(uint64_t), alignof(uint64_t)));
+    ASSERT_NE(word, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(word) % alignof(uint64_t), 0u);
+    EXPECT_EQ(arena.GetChunkAllocationCount(), 1u);
+    EXPECT_EQ(arena.GetBytesUsed(), alignof(uint64_t) + sizeof(uint64_t));
+
+    // Allocations larger than a chunk get their own chunk
+    EXPECT_NE(arena.Allocate(1000), nullptr);
+    EXPECT_EQ(arena.GetChunkAllocationCount(), 2u);
+    EXPECT_GE(arena.GetBytesReserved(), 128u + 1000u);
+
+    EXPECT_EQ(arena.Allocate(SIZE_MAX), nullptr);
+}
+
+TEST_F(TestBumpArena, TestResetReusesChunks)
+{
+    BumpArena arena(256);
+
+    Node * list = nullptr;
+    for (uint32_t i = 0; i < 50; i++)
+    {
+        list = arena.New<Node>(i, list);
+        ASSERT_NE(list, nullptr);
+    }
+
+    uint32_t expected = 50;
+    for (Node * node = list; node != nullptr; node = node->next)
+    {
+        EXPECT_EQ(node->value, --expected);
+    }
+
+    const size_t chunks   = arena.GetChunkAllocationCount();
+    const size_t reserved = arena.GetBytesReserved();
+    EXPECT_GT(chunks, 1u);
+
+    // The same allocations after a reset do not allocate new chunks
+    arena.Reset();
+    EXPECT_EQ(arena.GetBytesUsed(), 0u);
+    for (uint32_t i = 0; i < 50; i++)
+    {
+        ASSERT_NE(arena.New<Node>(i, nullptr), nullptr);
+    }
+    EXPECT_EQ(arena.GetChunkAllocationCount(), chunks);
+    EXPECT_EQ(arena.GetBytesReserved(), reserved);
+
+    arena.Release();
+    EXPECT_EQ(arena.GetBytesReserved(), 0u);
+    EXPECT_EQ(arena.GetBytesUsed(), 0u);
+}
+
+TEST_F(TestBumpArena, TestReserve)
+{
+    CountingBudget budget(1000);
+    BumpArena arena(512, &budget);
+
+    // Nothing to reserve
+    EXPECT_TRUE(arena.Reserve(0));
+    EXPECT_EQ(arena.GetChunkAllocationCount(), 0u);
+
+    // The chunk is sized for the reserved objects, not the chunk size
+    EXPECT_TRUE(arena.Reserve(3 * sizeof(Node)));
+    EXPECT_EQ(arena.GetChunkAllocationCount(), 1u);
+    EXPECT_LT(arena.GetBytesReserved(), 512u);
+    EXPECT_EQ(budget.mReserved, arena.GetBytesReserved());
+
+    Node * list = nullptr;
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        list = arena.New<Node>(i, list);
+        ASSERT_NE(list, nullptr);
+    }
+    EXPECT_EQ(arena.GetChunkAllocationCount(), 1u);
+    EXPECT_EQ(arena.GetBytesUsed(), 3 * sizeof(Node));
+
+    // Once the reservation is used up, chunks have the chunk size again
+    ASSERT_NE(arena.New<Node>(3u, list), nullptr);
+    EXPECT_EQ(arena.GetChunkAllocationCount(), 2u);
+    EXPECT_GE(arena.GetBytesReserved(), 512u + 3 * sizeof(Node));
+
+    // Space left in the current chunk is enough
+    EXPECT_TRUE(arena.Reserve(sizeof(Node)));
+    EXPECT_EQ(arena.GetChunkAllocationCount(), 2u);
+
+    // The budget still applies
+    EXPECT_FALSE(arena.Reserve(1000));
+    EXPECT_EQ(arena.GetChunkAllocationCount(), 2u);
+
+    arena.Release();
+    EXPECT_EQ(budget.mReserved, 0u);
+}
+
+TEST_F(TestBumpArena, TestBudget)
+{
+    CountingBudget budget(600);
+    {
+        BumpArena arena(256, &budget);
+
+        EXPECT_NE(arena.Allocate(200), nullptr);
+        EXPECT_NE(arena.Allocate(200), nullptr);
+        EXPECT_EQ(budget.mReserved, arena.GetBytesReserved());
+
+        // A third chunk would exceed the budget
+        EXPECT_EQ(arena.Allocate(200), nullptr);
+        EXPECT_EQ(arena.GetChunkAllocationCount(), 2u);
+        EXPECT_EQ(budget.mReserved, arena.GetBytesReserved());
+
+        // Reset keeps the chunks, and their reservation
+        arena.Reset();
+        EXPECT_NE(arena.Allocate(200), nullptr);
+        EXPECT_NE(arena.Allocate(200), nullptr);
+        EXPECT_EQ(arena.GetChunkAllocationCount(), 2u);
+    }
+    EXPECT_EQ(budget.mReserved, 0u);
+}
+
+} // namespace
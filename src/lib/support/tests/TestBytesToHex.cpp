@@ -28,6 +28,7 @@
 #include <lib/support/EnforceFormat.h>
 #include <lib/support/Span.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <lib/support/logging/DeferredLogging.h>
 
 namespace {
 
@@ -402,11 +403,18 @@ TEST(TestBytesToHex, TestLogBufferAsHex)
 
     for (auto testCase : kTestCases)
     {
+#if CHIP_DEFERRED_LOGGING
+        // Only accumulate the lines of the test case
+        chip::Logging::DrainDeferredLogs();
+#endif // CHIP_DEFERRED_LOGGING
         chip::Logging::SetLogRedirectCallback(&AccumulateLogLineCallback);
         gRedirectedLogLines.clear();
         {
             LogBufferAsHex(testCase.label, testCase.buffer);
         }
+#if CHIP_DEFERRED_LOGGING
+        chip::Logging::DrainDeferredLogs();
+#endif // CHIP_DEFERRED_LOGGING
         chip::Logging::SetLogRedirectCallback(nullptr);
         ValidateTextMatches(testCase.expectedText, testCase.numLines, gRedirectedLogLines);
     }
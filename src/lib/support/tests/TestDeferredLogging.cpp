@@ -0,0 +1,418 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/logging/DeferredLogging.h>
+
+#include <inttypes.h>
+#include <memory>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/EnforceFormat.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <lib/support/logging/Constants.h>
+
+using namespace chip::Logging;
+
+namespace {
+
+using CaptureResult = DeferredLogBuffer::CaptureResult;
+
+struct DrainedMessage
+{
+    uint8_t module;
+    uint8_t category;
+    uint64_t timestamp;
+    std::string message;
+};
+
+CaptureResult Capture(DeferredLogBuffer & buffer, const char * format, ...) ENFORCE_FORMAT(2, 3);
+CaptureResult CaptureAt(DeferredLogBuffer & buffer, uint64_t timestamp, const char * format, ...) ENFORCE_FORMAT(3, 4);
+
+CaptureResult Capture(DeferredLogBuffer & buffer, const char * format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    CaptureResult result = buffer.Capture(kLogModule_DataManagement, kLogCategory_Progress, 0, format, args);
+    va_end(args);
+    return result;
+}
+
+CaptureResult CaptureAt(DeferredLogBuffer & buffer, uint64_t timestamp, const char * format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    CaptureResult result = buffer.Capture(kLogModule_DataManagement, kLogCategory_Progress, timestamp, format, args);
+    va_end(args);
+    return result;
+}
+
+void CollectMessage(uint8_t module, uint8_t category, uint64_t timestamp, const char * message, void * context)
+{
+    static_cast<std::vector<DrainedMessage> *>(context)->push_back({ module, category, timestamp, message });
+}
+
+std::vector<DrainedMessage> DrainAll(DeferredLogBuffer & buffer)
+{
+    std::vector<DrainedMessage> messages;
+    EXPECT_TRUE(buffer.Drain(CollectMessage, &messages));
+    return messages;
+}
+
+std::vector<std::string> gRedirectedLogLines;
+
+ENFORCE_FORMAT(3, 0) void AccumulateLogLineCallback(const char * module, uint8_t category, const char * msg, va_list args)
+{
+    (void) module;
+    (void) category;
+
+    char line[256];
+    vsnprintf(line, sizeof(line), msg, args);
+    gRedirectedLogLines.push_back(line);
+}
+
+// Redirects the logs to gRedirectedLogLines for the lifetime of the object.
+class ScopedLogRedirect
+{
+public:
+    ScopedLogRedirect()
+    {
+#if CHIP_DEFERRED_LOGGING
+        // Do not mix up the messages deferred before the test with its own
+        DrainDeferredLogs();
+#endif // CHIP_DEFERRED_LOGGING
+        gRedirectedLogLines.clear();
+        SetLogRedirectCallback(&AccumulateLogLineCallback);
+    }
+    ~ScopedLogRedirect() { SetLogRedirectCallback(nullptr); }
+};
+
+TEST(TestDeferredLogging, TestFormatsOnDrain)
+{
+    auto buffer = std::make_unique<DeferredLogBuffer>();
+
+    char name[] = "light";
+    EXPECT_EQ(Capture(*buffer, "Endpoint %u cluster 0x%08" PRIx32 " %s", 1u, static_cast<uint32_t>(0x0006), name),
+              CaptureResult::kCaptured);
+    EXPECT_EQ(Capture(*buffer, "%d%% %c %ld %" PRIu64 " %" PRId64, -5, 'x', -7L, UINT64_MAX, INT64_MIN), CaptureResult::kCaptured);
+    EXPECT_EQ(Capture(*buffer, "[%.*s] [%-6s] [%5d] [%*d] [%.2f]", 3, "abcdef", "ab", 42, 4, 7, 1.5), CaptureResult::kCaptured);
+    EXPECT_EQ(Capture(*buffer, "null %s", static_cast<const char *>(nullptr)), CaptureResult::kCaptured);
+    EXPECT_EQ(Capture(*buffer, "%p", static_cast<void *>(nullptr)), CaptureResult::kCaptured);
+
+    // String arguments are copied when captured
+    strcpy(name, "fan");
+
+    std::vector<DrainedMessage> messages = DrainAll(*buffer);
+    ASSERT_EQ(messages.size(), 5u);
+    EXPECT_EQ(messages[0].module, kLogModule_DataManagement);
+    EXPECT_EQ(messages[0].category, kLogCategory_Progress);
+    EXPECT_EQ(messages[0].message, "Endpoint 1 cluster 0x00000006 light");
+    EXPECT_EQ(messages[1].message, "-5% x -7 18446744073709551615 -9223372036854775808");
+    EXPECT_EQ(messages[2].message, "[abc] [ab    ] [   42] [   7] [1.50]");
+    EXPECT_EQ(messages[3].message, "null (null)");
+
+    char expected[32];
+    snprintf(expected, sizeof(expected), "%p", static_cast<void *>(nullptr));
+    EXPECT_EQ(messages[4].message, expected);
+
+    EXPECT_TRUE(DrainAll(*buffer).empty());
+}
+
+TEST(TestDeferredLogging, TestTooLargeArguments)
+{
+    auto buffer = std::make_unique<DeferredLogBuffer>();
+
+    // Messages are not cut: the ones whose arguments do not fit are not captured
+    std::string longString(DeferredLogBuffer::kArgsSize, 'a');
+    EXPECT_EQ(Capture(*buffer, "%d %s %d", 1, longString.c_str(), 2), CaptureResult::kTooLarge);
+    EXPECT_TRUE(DrainAll(*buffer).empty());
+    EXPECT_EQ(buffer->GetDroppedCount(), 0u);
+
+    // Unless the precision bounds the string
+    EXPECT_EQ(Capture(*buffer, "%d %.3s %d", 1, longString.c_str(), 2), CaptureResult::kCaptured);
+    std::vector<DrainedMessage> messages = DrainAll(*buffer);
+    ASSERT_EQ(messages.size(), 1u);
+    EXPECT_EQ(messages[0].message, "1 aaa 2");
+}
+
+TEST(TestDeferredLogging, TestTimestamp)
+{
+    auto buffer = std::make_unique<DeferredLogBuffer>();
+
+    EXPECT_EQ(CaptureAt(*buffer, 1234, "first"), CaptureResult::kCaptured);
+    EXPECT_EQ(CaptureAt(*buffer, 5678, "second"), CaptureResult::kCaptured);
+
+    std::vector<DrainedMessage> messages = DrainAll(*buffer);
+    ASSERT_EQ(messages.size(), 2u);
+    EXPECT_EQ(messages[0].timestamp, 1234u);
+    EXPECT_EQ(messages[1].timestamp, 5678u);
+}
+
+struct NestedDrainContext
+{
+    DeferredLogBuffer * buffer;
+    std::vector<DrainedMessage> messages;
+    bool nestedDrainResult = true;
+};
+
+// Captures a message and tries to drain, while the buffer is being drained
+void CaptureWhileDraining(uint8_t module, uint8_t category, uint64_t timestamp, const char * message, void * context)
+{
+    auto * drainContext = static_cast<NestedDrainContext *>(context);
+    if (drainContext->messages.empty())
+    {
+        EXPECT_EQ(Capture(*drainContext->buffer, "logged while draining"), CaptureResult::kCaptured);
+        drainContext->nestedDrainResult = drainContext->buffer->Drain(CollectMessage, &drainContext->messages);
+    }
+    CollectMessage(module, category, timestamp, message, &drainContext->messages);
+}
+
+TEST(TestDeferredLogging, TestCaptureWhileDraining)
+{
+    auto buffer = std::make_unique<DeferredLogBuffer>();
+    EXPECT_EQ(Capture(*buffer, "first"), CaptureResult::kCaptured);
+    EXPECT_EQ(Capture(*buffer, "second"), CaptureResult::kCaptured);
+
+    // The drain already going on logs the new message, after the ones captured before it
+    NestedDrainContext context{ buffer.get() };
+    size_t drained = 0;
+    EXPECT_TRUE(buffer->Drain(CaptureWhileDraining, &context, SIZE_MAX, &drained));
+    EXPECT_FALSE(context.nestedDrainResult);
+    EXPECT_EQ(drained, 3u);
+    ASSERT_EQ(context.messages.size(), 3u);
+    EXPECT_EQ(context.messages[0].message, "first");
+    EXPECT_EQ(context.messages[1].message, "second");
+    EXPECT_EQ(context.messages[2].message, "logged while draining");
+}
+
+TEST(TestDeferredLogging, TestDropsWhenFull)
+{
+    auto buffer = std::make_unique<DeferredLogBuffer>();
+
+    for (size_t i = 0; i < DeferredLogBuffer::kEntryCount; i++)
+    {
+        EXPECT_EQ(Capture(*buffer, "message %u", static_cast<unsigned>(i)), CaptureResult::kCaptured);
+    }
+    EXPECT_EQ(Capture(*buffer, "dropped"), CaptureResult::kDropped);
+    EXPECT_EQ(buffer->GetDroppedCount(), 1u);
+
+    // Draining part of the ring makes room for new messages, which are drained after the older ones
+    std::vector<DrainedMessage> messages;
+    size_t drained = 0;
+    EXPECT_TRUE(buffer->Drain(CollectMessage, &messages, 2, &drained));
+    EXPECT_EQ(drained, 2u);
+    EXPECT_EQ(Capture(*buffer, "new message"), CaptureResult::kCaptured);
+
+    messages = DrainAll(*buffer);
+    ASSERT_EQ(messages.size(), DeferredLogBuffer::kEntryCount - 1);
+    EXPECT_EQ(messages[0].message, "message 2");
+    EXPECT_EQ(messages.back().message, "new message");
+    EXPECT_EQ(buffer->GetDroppedCount(), 1u);
+}
+
+#if CHIP_LOG_FILTERING && CHIP_ERROR_LOGGING && CHIP_PROGRESS_LOGGING
+TEST(TestDeferredLogging, TestModuleLogFilter)
+{
+    const uint8_t savedLogFilter = GetLogFilter();
+    SetLogFilter(kLogCategory_Max);
+
+    // Modules log every category by default
+    EXPECT_EQ(GetModuleLogFilter(kLogModule_DataManagement), kLogCategory_Max);
+    EXPECT_TRUE(IsCategoryEnabled(kLogModule_DataManagement, kLogCategory_Detail));
+
+    SetModuleLogFilter(kLogModule_DataManagement, kLogCategory_Error);
+    EXPECT_EQ(GetModuleLogFilter(kLogModule_DataManagement), kLogCategory_Error);
+    EXPECT_TRUE(IsCategoryEnabled(kLogModule_DataManagement, kLogCategory_Error));
+    EXPECT_FALSE(IsCategoryEnabled(kLogModule_DataManagement, kLogCategory_Progress));
+    EXPECT_TRUE(IsCategoryEnabled(kLogModule_InteractionModel, kLogCategory_Progress));
+
+    // The global filter still applies to every module
+    SetLogFilter(kLogCategory_Error);
+    EXPECT_FALSE(IsCategoryEnabled(kLogModule_InteractionModel, kLogCategory_Progress));
+    EXPECT_TRUE(IsCategoryEnabled(kLogModule_InteractionModel, kLogCategory_Error));
+    SetLogFilter(kLogCategory_Max);
+
+    // Categories above the maximum are clamped, invalid modules are ignored
+    SetModuleLogFilter(kLogModule_InteractionModel, static_cast<uint8_t>(kLogCategory_Max + 1));
+    EXPECT_EQ(GetModuleLogFilter(kLogModule_InteractionModel), kLogCategory_Max);
+    SetModuleLogFilter(kLogModule_Max, kLogCategory_None);
+    EXPECT_EQ(GetModuleLogFilter(kLogModule_Max), kLogCategory_Max);
+
+    // The logging macros honor the filter of their module
+    {
+        ScopedLogRedirect redirect;
+        ChipLogProgress(DataManagement, "filtered out");
+        ChipLogError(DataManagement, "logged %d", 1);
+        ChipLogProgress(InteractionModel, "logged %d", 2);
+#if CHIP_DEFERRED_LOGGING
+        DrainDeferredLogs();
+#endif // CHIP_DEFERRED_LOGGING
+
+        ASSERT_EQ(gRedirectedLogLines.size(), 2u);
+        EXPECT_EQ(gRedirectedLogLines[0], "logged 1");
+        EXPECT_EQ(gRedirectedLogLines[1], "logged 2");
+    }
+
+    SetModuleLogFilter(kLogModule_DataManagement, kLogCategory_Max);
+    EXPECT_TRUE(IsCategoryEnabled(kLogModule_DataManagement, kLogCategory_Progress));
+    SetLogFilter(savedLogFilter);
+}
+#endif // CHIP_LOG_FILTERING && CHIP_ERROR_LOGGING && CHIP_PROGRESS_LOGGING
+
+#if CHIP_DEFERRED_LOGGING && CHIP_ERROR_LOGGING && CHIP_PROGRESS_LOGGING
+TEST(TestDeferredLogging, TestErrorDrainsDeferredLogs)
+{
+    ScopedLogRedirect redirect;
+
+    // Messages below the error level are only captured
+    ChipLogProgress(DataManagement, "first %d", 1);
+    ChipLogProgress(InteractionModel, "second %s", "message");
+    EXPECT_TRUE(gRedirectedLogLines.empty());
+
+    // An error is logged right away, after the messages captured before it
+    ChipLogError(DataManagement, "error %d", 3);
+    ASSERT_EQ(gRedirectedLogLines.size(), 3u);
+    EXPECT_EQ(gRedirectedLogLines[0], "first 1");
+    EXPECT_EQ(gRedirectedLogLines[1], "second message");
+    EXPECT_EQ(gRedirectedLogLines[2], "error 3");
+
+    EXPECT_EQ(DrainDeferredLogs(), 0u);
+}
+
+ENFORCE_FORMAT(3, 0) void LogErrorOnFirstLineCallback(const char * module, uint8_t category, const char * msg, va_list args)
+{
+    AccumulateLogLineCallback(module, category, msg, args);
+    if (gRedirectedLogLines.size() == 1)
+    {
+        ChipLogError(DataManagement, "error while draining");
+    }
+}
+
+TEST(TestDeferredLogging, TestErrorWhileDraining)
+{
+    ScopedLogRedirect redirect;
+    SetLogRedirectCallback(&LogErrorOnFirstLineCallback);
+
+    ChipLogProgress(DataManagement, "first");
+    ChipLogProgress(DataManagement, "second");
+
+    // The error cannot drain the messages being drained already, it is logged after them
+    EXPECT_EQ(DrainDeferredLogs(), 3u);
+    ASSERT_EQ(gRedirectedLogLines.size(), 3u);
+    EXPECT_EQ(gRedirectedLogLines[0], "first");
+    EXPECT_EQ(gRedirectedLogLines[1], "second");
+    EXPECT_EQ(gRedirectedLogLines[2], "error while draining");
+}
+
+TEST(TestDeferredLogging, TestLongMessageNotCut)
+{
+    ScopedLogRedirect redirect;
+
+    // Logged right away, since it does not fit in the ring
+    std::string longString(DeferredLogBuffer::kArgsSize, 'a');
+    ChipLogProgress(DataManagement, "first");
+    ChipLogProgress(DataManagement, "long %s", longString.c_str());
+    ASSERT_EQ(gRedirectedLogLines.size(), 2u);
+    EXPECT_EQ(gRedirectedLogLines[0], "first");
+    EXPECT_EQ(gRedirectedLogLines[1], "long " + longString);
+}
+
+size_t gDrainRequests = 0;
+
+bool CountDrainRequest()
+{
+    gDrainRequests++;
+    return true;
+}
+
+TEST(TestDeferredLogging, TestDrainRequest)
+{
+    ScopedLogRedirect redirect;
+    gDrainRequests = 0;
+    SetDeferredLogDrainRequestHandler(CountDrainRequest);
+
+    // Requested once until drained
+    ChipLogProgress(DataManagement, "first");
+    ChipLogProgress(DataManagement, "second");
+    EXPECT_EQ(gDrainRequests, 1u);
+
+    EXPECT_EQ(DrainDeferredLogs(), 2u);
+    ChipLogProgress(DataManagement, "third");
+    EXPECT_EQ(gDrainRequests, 2u);
+
+    // Requested again when not everything was drained
+    EXPECT_EQ(DrainDeferredLogs(1), 1u);
+    EXPECT_EQ(gDrainRequests, 3u);
+
+    SetDeferredLogDrainRequestHandler(nullptr);
+    ChipLogProgress(DataManagement, "fourth");
+    EXPECT_EQ(DrainDeferredLogs(), 1u);
+    EXPECT_EQ(gDrainRequests, 3u);
+}
+
+TEST(TestDeferredLogging, TestDroppedMessagesReported)
+{
+    ScopedLogRedirect redirect;
+
+    for (size_t i = 0; i <= DeferredLogBuffer::kEntryCount; i++)
+    {
+        ChipLogProgress(DataManagement, "message %u", static_cast<unsigned>(i));
+    }
+    EXPECT_TRUE(gRedirectedLogLines.empty());
+
+    EXPECT_EQ(DrainDeferredLogs(), DeferredLogBuffer::kEntryCount);
+    ASSERT_EQ(gRedirectedLogLines.size(), DeferredLogBuffer::kEntryCount + 1);
+    EXPECT_EQ(gRedirectedLogLines.back(), "1 deferred log messages dropped");
+
+    // Only reported once
+    EXPECT_EQ(DrainDeferredLogs(), 0u);
+    EXPECT_EQ(gRedirectedLogLines.size(), DeferredLogBuffer::kEntryCount + 1);
+}
+
+uint64_t gDeferredLogTime = 0;
+
+uint64_t GetDeferredLogTime()
+{
+    return gDeferredLogTime;
+}
+
+TEST(TestDeferredLogging, TestCaptureTimestamp)
+{
+    ScopedLogRedirect redirect;
+    SetDeferredLogClock(GetDeferredLogTime);
+
+    // Messages show when they were logged, not when they were drained
+    gDeferredLogTime = 12000345;
+    ChipLogProgress(DataManagement, "first");
+    gDeferredLogTime = 13000000;
+    ChipLogProgress(DataManagement, "second");
+    gDeferredLogTime = 20000000;
+
+    EXPECT_EQ(DrainDeferredLogs(), 2u);
+    ASSERT_EQ(gRedirectedLogLines.size(), 2u);
+    EXPECT_EQ(gRedirectedLogLines[0], "[12.000345] first");
+    EXPECT_EQ(gRedirectedLogLines[1], "[13.000000] second");
+
+    SetDeferredLogClock(nullptr);
+}
+#endif // CHIP_DEFERRED_LOGGING && CHIP_ERROR_LOGGING && CHIP_PROGRESS_LOGGING
+
+} // namespace
@@ -15,6 +15,7 @@
  *    limitations under the License.
  */
 
+#include <limits>
 #include <string>
 
 #include <pw_unit_test/framework.h>
@@ -394,4 +395,49 @@ TEST_F(TestJsonToTlv, TestMEIConvert)
         EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
     }
 }
+
+TEST_F(TestJsonToTlv, TestTextSyntax)
+{
+    // Escape sequences, including surrogate pairs, are decoded to UTF-8.
+    ConvertJsonToTlvAndValidate(CharSpan::fromCharString("\xC3\xA9\xF0\x9F\x98\x80\n/\""),
+                                "{ \"1:STRING\" : \"\\u00e9\\ud83d\\ude00\\n\\/\\\"\" }");
+
+    // Numbers are accepted in any notation that represents a value of the element type.
+    ConvertJsonToTlvAndValidate(static_cast<uint64_t>(1000), "{ \"1:UINT\" : 1e3 }");
+    ConvertJsonToTlvAndValidate(std::numeric_limits<uint64_t>::max(), "{ \"1:UINT\" : 18446744073709551615 }");
+    ConvertJsonToTlvAndValidate(std::numeric_limits<int64_t>::min(), "{ \"1:INT\" : -9223372036854775808 }");
+    ConvertJsonToTlvAndValidate(static_cast<double>(-3), "{ \"1:DOUBLE\" : -3 }");
+
+    // Comments are skipped, members are sorted by tag and the last of duplicated members is kept.
+    {
+        TLV::TLVType container;
+
+        SetupWriters();
+        EXPECT_EQ(gWriter1.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, container), CHIP_NO_ERROR);
+        EXPECT_EQ(gWriter1.Put(TLV::ContextTag(1), static_cast<uint8_t>(3)), CHIP_NO_ERROR);
+        EXPECT_EQ(gWriter1.Put(TLV::ContextTag(2), static_cast<uint8_t>(2)), CHIP_NO_ERROR);
+        EXPECT_EQ(gWriter1.EndContainer(container), CHIP_NO_ERROR);
+        EXPECT_EQ(gWriter1.Finalize(), CHIP_NO_ERROR);
+
+        EXPECT_EQ(JsonToTlv("{ /* comment */ \"2:UINT\" : 2, // comment\n \"1:UINT\" : 1, \"1:UINT\" : 3 }", gWriter2),
+                  CHIP_NO_ERROR);
+        EXPECT_TRUE(MatchWriter1and2());
+    }
+
+    // Syntax errors are reported as internal errors, before any type mismatch.
+    uint8_t buf[64];
+    MutableByteSpan tlv(buf);
+    EXPECT_EQ(JsonToTlv("", tlv), CHIP_ERROR_INTERNAL);
+    EXPECT_EQ(JsonToTlv("{ \"1:UINT\" : 1, }", tlv), CHIP_ERROR_INTERNAL);
+    EXPECT_EQ(JsonToTlv("{ \"1:ARRAY-UINT\" : [ 1 }", tlv), CHIP_ERROR_INTERNAL);
+    EXPECT_EQ(JsonToTlv("{ \"1:STRING\" : \"\\x\" }", tlv), CHIP_ERROR_INTERNAL);
+    EXPECT_EQ(JsonToTlv("{ \"1:UINT\" : \"x\", \"2:UINT\" : }", tlv), CHIP_ERROR_INTERNAL);
+    EXPECT_EQ(JsonToTlv("{ \"1:DOUBLE\" : 1e400 }", tlv), CHIP_ERROR_INTERNAL);
+
+    EXPECT_EQ(JsonToTlv("[ 1 ]", tlv), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(JsonToTlv("{ \"1:UINT\" : -1 }", tlv), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(JsonToTlv("{ \"1:INT\" : 1.5 }", tlv), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(JsonToTlv("{ \"1:BOOL\" : null }", tlv), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(JsonToTlv("{ \"1:ARRAY-?\" : [ 1 ] }", tlv), CHIP_ERROR_INVALID_ARGUMENT);
+}
 } // namespace
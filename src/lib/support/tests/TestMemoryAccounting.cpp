@@ -0,0 +1,204 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/MemoryAccounting.h>
+
+#include <algorithm>
+#include <string.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Pool.h>
+
+using namespace chip::Platform;
+
+namespace {
+
+class TestMemoryAccounting : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+struct PooledObject
+{
+    uint32_t value;
+};
+
+TEST_F(TestMemoryAccounting, TestTagNames)
+{
+    EXPECT_STREQ(MemoryTagName(MemoryTag::kUntagged), "untagged");
+    EXPECT_STREQ(MemoryTagName(MemoryTag::kExchange), "exchange");
+    EXPECT_STREQ(MemoryTagName(MemoryTag::kClusterStateCache), "cluster_state_cache");
+    EXPECT_STREQ(MemoryTagName(MemoryTag::kCount), "unknown");
+}
+
+#if CHIP_CONFIG_MEMORY_ACCOUNTING
+
+TEST_F(TestMemoryAccounting, TestScopedTagAttribution)
+{
+    const MemoryTagStats before = GetMemoryTagStats(MemoryTag::kSession);
+
+    void * p = nullptr;
+    {
+        CHIP_MEMORY_TAG_SCOPE(kSession);
+        EXPECT_EQ(GetCurrentMemoryTag(), MemoryTag::kSession);
+        {
+            CHIP_MEMORY_TAG_SCOPE(kExchange);
+            EXPECT_EQ(GetCurrentMemoryTag(), MemoryTag::kExchange);
+        }
+        EXPECT_EQ(GetCurrentMemoryTag(), MemoryTag::kSession);
+        p = MemoryAlloc(100);
+        ASSERT_NE(p, nullptr);
+    }
+    EXPECT_EQ(GetCurrentMemoryTag(), MemoryTag::kUntagged);
+
+    MemoryTagStats stats = GetMemoryTagStats(MemoryTag::kSession);
+    EXPECT_EQ(stats.bytesInUse, before.bytesInUse + 100);
+    EXPECT_EQ(stats.allocationsInUse, before.allocationsInUse + 1);
+    EXPECT_EQ(stats.allocations, before.allocations + 1);
+
+    // Reallocating and freeing outside of the scope is accounted to the original tag
+    memset(p, 0x5a, 100);
+    p = MemoryRealloc(p, 300);
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(static_cast<uint8_t *>(p)[99], 0x5a);
+
+    stats = GetMemoryTagStats(MemoryTag::kSession);
+    EXPECT_EQ(stats.bytesInUse, before.bytesInUse + 300);
+    EXPECT_EQ(stats.allocationsInUse, before.allocationsInUse + 1);
+    EXPECT_GE(stats.peakBytes, before.bytesInUse + 300);
+
+    MemoryFree(p);
+    stats = GetMemoryTagStats(MemoryTag::kSession);
+    EXPECT_EQ(stats.bytesInUse, before.bytesInUse);
+    EXPECT_EQ(stats.allocationsInUse, before.allocationsInUse);
+    EXPECT_GE(stats.peakBytes, before.bytesInUse + 300);
+
+    ResetMemoryTagPeaks();
+    EXPECT_EQ(GetMemoryTagStats(MemoryTag::kSession).peakBytes, before.bytesInUse);
+}
+
+TEST_F(TestMemoryAccounting, TestCallocOverflow)
+{
+    CHIP_MEMORY_TAG_SCOPE(kWriteHandler);
+    const MemoryTagStats before = GetMemoryTagStats(MemoryTag::kWriteHandler);
+
+    EXPECT_EQ(MemoryCalloc(SIZE_MAX / 2, 4), nullptr);
+    EXPECT_EQ(MemoryAlloc(SIZE_MAX), nullptr);
+    EXPECT_EQ(GetMemoryTagStats(MemoryTag::kWriteHandler).allocations, before.allocations);
+
+    uint8_t * p = static_cast<uint8_t *>(MemoryCalloc(4, 8));
+    ASSERT_NE(p, nullptr);
+    for (size_t i = 0; i < 32; i++)
+    {
+        EXPECT_EQ(p[i], 0);
+    }
+    EXPECT_EQ(GetMemoryTagStats(MemoryTag::kWriteHandler).bytesInUse, before.bytesInUse + 32);
+    MemoryFree(p);
+}
+
+TEST_F(TestMemoryAccounting, TestPoolHighWaterMark)
+{
+    const MemoryTagStats before = GetMemoryTagStats(MemoryTag::kReadHandler);
+
+    chip::ObjectPool<PooledObject, 4, chip::ObjectPoolMem::kInline> pool;
+    pool.SetMemoryTag(MemoryTag::kReadHandler);
+
+    PooledObject * a = pool.CreateObject();
+    PooledObject * b = pool.CreateObject();
+    PooledObject * c = pool.CreateObject();
+    ASSERT_NE(c, nullptr);
+    pool.ReleaseObject(b);
+    pool.ReleaseObject(c);
+
+    MemoryTagStats stats = GetMemoryTagStats(MemoryTag::kReadHandler);
+    EXPECT_EQ(stats.poolObjectsInUse, before.poolObjectsInUse + 1);
+    EXPECT_EQ(stats.peakPoolObjects, std::max(before.peakPoolObjects, before.poolObjectsInUse + 3));
+    EXPECT_EQ(pool.HighWaterMark(), 3u);
+
+    pool.ReleaseObject(a);
+    EXPECT_EQ(GetMemoryTagStats(MemoryTag::kReadHandler).poolObjectsInUse, before.poolObjectsInUse);
+}
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+TEST_F(TestMemoryAccounting, TestHeapPoolCountedOnce)
+{
+    // Objects of a heap pool are only counted as heap allocations of the pool's tag, whatever tag is current
+    CHIP_MEMORY_TAG_SCOPE(kSession);
+    const MemoryTagStats beforeSession = GetMemoryTagStats(MemoryTag::kSession);
+    const MemoryTagStats before        = GetMemoryTagStats(MemoryTag::kReadHandler);
+
+    chip::ObjectPool<PooledObject, 4, chip::ObjectPoolMem::kHeap> pool;
+    pool.SetMemoryTag(MemoryTag::kReadHandler);
+
+    PooledObject * a = pool.CreateObject();
+    ASSERT_NE(a, nullptr);
+
+    MemoryTagStats stats = GetMemoryTagStats(MemoryTag::kReadHandler);
+    EXPECT_EQ(stats.poolObjectsInUse, before.poolObjectsInUse);
+    EXPECT_EQ(stats.peakPoolObjects, before.peakPoolObjects);
+    EXPECT_GT(stats.allocationsInUse, before.allocationsInUse);
+    EXPECT_GE(stats.bytesInUse, before.bytesInUse + sizeof(PooledObject));
+    EXPECT_EQ(GetMemoryTagStats(MemoryTag::kSession).allocationsInUse, beforeSession.allocationsInUse);
+
+    pool.ReleaseObject(a);
+    stats = GetMemoryTagStats(MemoryTag::kReadHandler);
+    EXPECT_EQ(stats.allocationsInUse, before.allocationsInUse);
+    EXPECT_EQ(stats.bytesInUse, before.bytesInUse);
+}
+
+TEST_F(TestMemoryAccounting, TestUntaggedHeapPool)
+{
+    // Without a tag of its own, a heap pool's objects go to the current tag
+    CHIP_MEMORY_TAG_SCOPE(kSession);
+    const MemoryTagStats before = GetMemoryTagStats(MemoryTag::kSession);
+
+    chip::ObjectPool<PooledObject, 4, chip::ObjectPoolMem::kHeap> pool;
+    PooledObject * a = pool.CreateObject();
+    ASSERT_NE(a, nullptr);
+    EXPECT_GT(GetMemoryTagStats(MemoryTag::kSession).allocationsInUse, before.allocationsInUse);
+
+    pool.ReleaseObject(a);
+    EXPECT_EQ(GetMemoryTagStats(MemoryTag::kSession).allocationsInUse, before.allocationsInUse);
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+#else // CHIP_CONFIG_MEMORY_ACCOUNTING
+
+TEST_F(TestMemoryAccounting, TestDisabled)
+{
+    CHIP_MEMORY_TAG_SCOPE(kSession);
+    EXPECT_EQ(GetCurrentMemoryTag(), MemoryTag::kUntagged);
+
+    void * p = MemoryAlloc(100);
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(GetMemoryTagStats(MemoryTag::kSession).bytesInUse, 0u);
+    MemoryFree(p);
+
+    chip::ObjectPool<PooledObject, 4, chip::ObjectPoolMem::kInline> pool;
+    pool.SetMemoryTag(MemoryTag::kReadHandler);
+    pool.ReleaseObject(pool.CreateObject());
+    EXPECT_EQ(GetMemoryTagStats(MemoryTag::kReadHandler).peakPoolObjects, 0u);
+}
+
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING
+
+} // namespace
@@ -245,4 +245,75 @@ TEST_F(TestTlvToJson, TestConverter)
     EncodeAndValidate(structList, jsonString);
 }
 
+TEST_F(TestTlvToJson, TestConverterLayout)
+{
+    // The converted output is expected to be byte-identical to what Json::StyledWriter generates:
+    // members sorted by name, short arrays of simple values on a single line, others one value per line.
+    uint8_t buf[512];
+    TLV::TLVWriter writer;
+    TLV::TLVType outer;
+    TLV::TLVType container;
+
+    writer.Init(buf);
+    ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Put(TLV::ContextTag(2), static_cast<uint8_t>(2)), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Put(TLV::ContextTag(10), static_cast<uint8_t>(10)), CHIP_NO_ERROR);
+
+    ASSERT_EQ(writer.StartContainer(TLV::ContextTag(3), TLV::kTLVType_Array, container), CHIP_NO_ERROR);
+    for (uint8_t i = 0; i < 30; i++)
+    {
+        ASSERT_EQ(writer.Put(TLV::AnonymousTag(), i), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(writer.EndContainer(container), CHIP_NO_ERROR);
+
+    ASSERT_EQ(writer.StartContainer(TLV::ContextTag(4), TLV::kTLVType_Array, container), CHIP_NO_ERROR);
+    for (int i = 0; i < 3; i++)
+    {
+        ASSERT_EQ(writer.PutString(TLV::AnonymousTag(), "a string long enough to wrap"), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(writer.EndContainer(container), CHIP_NO_ERROR);
+
+    ASSERT_EQ(writer.StartContainer(TLV::ContextTag(5), TLV::kTLVType_Array, container), CHIP_NO_ERROR);
+    for (int i = 0; i < 2; i++)
+    {
+        TLV::TLVType emptyStruct;
+        ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, emptyStruct), CHIP_NO_ERROR);
+        ASSERT_EQ(writer.EndContainer(emptyStruct), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(writer.EndContainer(container), CHIP_NO_ERROR);
+
+    ASSERT_EQ(writer.StartContainer(TLV::ContextTag(6), TLV::kTLVType_Array, container), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.EndContainer(container), CHIP_NO_ERROR);
+
+    ASSERT_EQ(writer.StartContainer(TLV::ContextTag(7), TLV::kTLVType_Structure, container), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.EndContainer(container), CHIP_NO_ERROR);
+
+    ASSERT_EQ(writer.EndContainer(outer), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    std::string expected = "{\n"
+                           "   \"10:UINT\" : 10,\n"
+                           "   \"2:UINT\" : 2,\n"
+                           "   \"3:ARRAY-UINT\" : [\n";
+    for (int i = 0; i < 30; i++)
+    {
+        expected += "      " + std::to_string(i) + ((i < 29) ? ",\n" : "\n");
+    }
+    expected += "   ],\n"
+                "   \"4:ARRAY-STRING\" : [\n"
+                "      \"a string long enough to wrap\",\n"
+                "      \"a string long enough to wrap\",\n"
+                "      \"a string long enough to wrap\"\n"
+                "   ],\n"
+                "   \"5:ARRAY-STRUCT\" : [ {}, {} ],\n"
+                "   \"6:ARRAY-?\" : [],\n"
+                "   \"7:STRUCT\" : {}\n"
+                "}\n";
+
+    std::string jsonString;
+    EXPECT_EQ(TlvToJson(ByteSpan(buf, writer.GetLengthWritten()), jsonString), CHIP_NO_ERROR);
+    EXPECT_EQ(jsonString, expected);
+    EXPECT_EQ(jsonString, PrettyPrintJsonString(jsonString));
+}
+
 } // namespace
@@ -0,0 +1,174 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Logging cost benchmark.
+ *
+ *      Times the log macros at their call site and, with deferred logging
+ *      (chip_deferred_logging), the drain that formats the messages later.
+ *      The messages are formatted as a platform backend would, then thrown
+ *      away. Prints one LOGGING_BENCHMARK line per case. See README.md for the
+ *      output format.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/EnforceFormat.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <lib/support/logging/DeferredLogging.h>
+
+#include <algorithm>
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Logging;
+
+constexpr uint32_t kDefaultMessages = 100000;
+
+// Messages logged between two drains, few enough for the ring to never be full
+#if CHIP_DEFERRED_LOGGING
+constexpr uint32_t kBatchSize = DeferredLogBuffer::kEntryCount / 2;
+#else
+constexpr uint32_t kBatchSize = 32;
+#endif // CHIP_DEFERRED_LOGGING
+
+uint32_t GetMessages()
+{
+    const char * value = getenv("CHIP_LOGGING_BENCHMARK_MESSAGES");
+    VerifyOrReturnValue(value != nullptr && *value != '\0', kDefaultMessages);
+    unsigned long parsed = strtoul(value, nullptr, 10);
+    return (parsed > 0 && parsed <= UINT32_MAX) ? static_cast<uint32_t>(parsed) : kDefaultMessages;
+}
+
+// Keeps the formatted messages alive so that the formatting is not optimized out.
+volatile uint32_t gSink;
+uint32_t gOutputMessages = 0;
+
+ENFORCE_FORMAT(3, 0) void FormatAndDiscard(const char * module, uint8_t category, const char * msg, va_list args)
+{
+    char line[CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE];
+    gSink = gSink + static_cast<uint32_t>(vsnprintf(line, sizeof(line), msg, args));
+    gOutputMessages++;
+}
+
+struct LogCost
+{
+    double callNs;
+    double drainNs;
+};
+
+template <typename LogCall>
+LogCost MeasureLogCost(uint32_t messages, LogCall && logCall)
+{
+    std::chrono::nanoseconds callTime(0);
+    std::chrono::nanoseconds drainTime(0);
+    for (uint32_t logged = 0; logged < messages;)
+    {
+        const uint32_t batch = std::min(kBatchSize, messages - logged);
+        const auto start     = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < batch; i++)
+        {
+            logCall(logged + i);
+        }
+        const auto called = std::chrono::steady_clock::now();
+#if CHIP_DEFERRED_LOGGING
+        DrainDeferredLogs();
+#endif // CHIP_DEFERRED_LOGGING
+        const auto drained = std::chrono::steady_clock::now();
+
+        callTime += std::chrono::duration_cast<std::chrono::nanoseconds>(called - start);
+        drainTime += std::chrono::duration_cast<std::chrono::nanoseconds>(drained - called);
+        logged += batch;
+    }
+    return { static_cast<double>(callTime.count()) / messages, static_cast<double>(drainTime.count()) / messages };
+}
+
+void Report(const char * name, uint32_t messages, const LogCost & cost)
+{
+    printf("LOGGING_BENCHMARK case=%s deferred=%d messages=%" PRIu32 " call_ns=%.1f drain_ns=%.1f\n", name, CHIP_DEFERRED_LOGGING,
+           messages, cost.callNs, cost.drainNs);
+}
+
+class LoggingBenchmark : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+#if CHIP_DEFERRED_LOGGING
+        DrainDeferredLogs();
+#endif // CHIP_DEFERRED_LOGGING
+        gOutputMessages = 0;
+        SetLogRedirectCallback(&FormatAndDiscard);
+    }
+
+    void TearDown() override { SetLogRedirectCallback(nullptr); }
+};
+
+#if CHIP_PROGRESS_LOGGING
+
+TEST_F(LoggingBenchmark, Integers)
+{
+    const uint32_t messages = GetMessages();
+
+    const LogCost cost = MeasureLogCost(messages, [](uint32_t i) {
+        ChipLogProgress(DataManagement, "Endpoint %u cluster 0x%08" PRIx32 " attribute 0x%08" PRIx32 " version %" PRIu32, i & 0xFF,
+                        static_cast<uint32_t>(0x0006), i, i);
+    });
+    Report("integers", messages, cost);
+    EXPECT_EQ(gOutputMessages, messages);
+}
+
+TEST_F(LoggingBenchmark, Strings)
+{
+    const uint32_t messages = GetMessages();
+
+    const LogCost cost = MeasureLogCost(messages, [](uint32_t i) {
+        ChipLogProgress(SecureChannel, "%s session %u established with peer %s", "CASE", i & 0xFFFF, "0000000000000001");
+    });
+    Report("strings", messages, cost);
+    EXPECT_EQ(gOutputMessages, messages);
+}
+
+#if CHIP_LOG_FILTERING
+TEST_F(LoggingBenchmark, FilteredOut)
+{
+    SetModuleLogFilter(kLogModule_DataManagement, kLogCategory_Error);
+
+    const uint32_t messages = GetMessages();
+
+    const LogCost cost = MeasureLogCost(messages, [](uint32_t i) {
+        ChipLogProgress(DataManagement, "Endpoint %u cluster 0x%08" PRIx32 " attribute 0x%08" PRIx32 " version %" PRIu32, i & 0xFF,
+                        static_cast<uint32_t>(0x0006), i, i);
+    });
+    Report("filtered_out", messages, cost);
+    EXPECT_EQ(gOutputMessages, 0u);
+
+    SetModuleLogFilter(kLogModule_DataManagement, kLogCategory_Max);
+}
+#endif // CHIP_LOG_FILTERING
+
+#endif // CHIP_PROGRESS_LOGGING
+
+} // namespace
@@ -54,6 +54,7 @@ namespace Messaging {
 ExchangeManager::ExchangeManager() : mReliableMessageMgr(mContextPool)
 {
     mState = State::kState_NotInitialized;
+    mContextPool.SetMemoryTag(Platform::MemoryTag::kExchange);
 }
 
 CHIP_ERROR ExchangeManager::Init(SessionManager * sessionManager)
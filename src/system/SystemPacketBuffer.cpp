@@ -56,6 +56,7 @@
 
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
 #include <lib/support/CHIPMem.h>
+#include <lib/support/MemoryAccounting.h>
 #endif
 
 namespace chip {
@@ -143,6 +144,7 @@ void PacketBufferHandle::InternalRightSize()
         return;
     }
 
+    CHIP_MEMORY_TAG_SCOPE(kPacketBuffer);
     const size_t blockSize   = usedSize + PacketBuffer::kStructureSize;
     PacketBuffer * newBuffer = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(blockSize));
     if (newBuffer == nullptr)
@@ -619,6 +621,7 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
     // sumOfSizes is essentially (kStructureSize + lAllocSize) which we already
     // checked to fit in a size_t.
     const size_t lBlockSize = static_cast<size_t>(sumOfSizes);
+    CHIP_MEMORY_TAG_SCOPE(kPacketBuffer);
     lPacket                 = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(lBlockSize));
 
 #else
@@ -0,0 +1,57 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <tracing/memory_metrics.h>
+
+#include <lib/support/MemoryAccounting.h>
+#include <tracing/metric_event.h>
+
+#include <algorithm>
+#include <stdint.h>
+
+namespace chip {
+namespace Tracing {
+
+#if CHIP_CONFIG_MEMORY_ACCOUNTING && MATTER_TRACING_ENABLED
+
+namespace {
+
+uint32_t ClampToMetric(size_t value)
+{
+    return static_cast<uint32_t>(std::min<size_t>(value, UINT32_MAX));
+}
+
+} // namespace
+
+void LogMemoryTagMetrics()
+{
+#define _CHIP_LOG_MEMORY_TAG_METRICS(name, str)                                                                                    \
+    {                                                                                                                              \
+        Platform::MemoryTagStats stats = Platform::GetMemoryTagStats(Platform::MemoryTag::k##name);                                \
+        MATTER_LOG_METRIC(kMetricMemory##name##PeakBytes, ClampToMetric(stats.peakBytes));                                         \
+        MATTER_LOG_METRIC(kMetricMemory##name##PeakPoolObjects, ClampToMetric(stats.peakPoolObjects));                             \
+    }
+    CHIP_MEMORY_TAGS_ENUMERATE(_CHIP_LOG_MEMORY_TAG_METRICS)
+#undef _CHIP_LOG_MEMORY_TAG_METRICS
+}
+
+#else
+
+void LogMemoryTagMetrics() {}
+
+#endif // CHIP_CONFIG_MEMORY_ACCOUNTING && MATTER_TRACING_ENABLED
+
+} // namespace Tracing
+} // namespace chip
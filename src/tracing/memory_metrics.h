@@ -0,0 +1,30 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+namespace chip {
+namespace Tracing {
+
+/// Logs the memory accounting high-water marks of every tag as metrics
+/// (kMetricMemory<Tag>PeakBytes and kMetricMemory<Tag>PeakPoolObjects).
+///
+/// Does nothing unless both CHIP_CONFIG_MEMORY_ACCOUNTING and tracing are
+/// enabled. Applications call this whenever they want to sample the marks,
+/// e.g. periodically or at the end of a test run.
+void LogMemoryTagMetrics();
+
+} // namespace Tracing
+} // namespace chip
@@ -16,6 +16,7 @@
  */
 #pragma once
 
+#include <lib/support/MemoryAccounting.h>
 #include <matter/tracing/build_config.h>
 
 namespace chip {
@@ -78,5 +79,32 @@ constexpr MetricKey kMetricDeviceRMPRetryCount = "core_dev_rmp_retry_count";
 // Subscription setup
 constexpr MetricKey kMetricDeviceSubscriptionSetup = "core_dev_subscription_setup";
 
+// Overall Server::Init
+constexpr MetricKey kMetricServerInit = "core_server_init";
+
+// Server::Init phases
+constexpr MetricKey kMetricServerInitStorage          = "core_server_init_storage";
+constexpr MetricKey kMetricServerInitFabrics          = "core_server_init_fabrics";
+constexpr MetricKey kMetricServerInitAccessControl    = "core_server_init_access_control";
+constexpr MetricKey kMetricServerInitTransports       = "core_server_init_transports";
+constexpr MetricKey kMetricServerInitSessions         = "core_server_init_sessions";
+constexpr MetricKey kMetricServerInitEventLogging     = "core_server_init_event_logging";
+constexpr MetricKey kMetricServerInitDataModel        = "core_server_init_data_model";
+constexpr MetricKey kMetricServerInitDnssd            = "core_server_init_dnssd";
+constexpr MetricKey kMetricServerInitCASE             = "core_server_init_case";
+constexpr MetricKey kMetricServerInitInteractionModel = "core_server_init_interaction_model";
+constexpr MetricKey kMetricServerInitICD              = "core_server_init_icd";
+constexpr MetricKey kMetricServerInitCompletion       = "core_server_init_completion";
+
+// Time from the start of Server::Init until the server is ready, in milliseconds
+constexpr MetricKey kMetricServerReady = "core_server_ready";
+
+// Memory accounting high-water marks, per tag (e.g. kMetricMemoryExchangePeakBytes), see memory_metrics.h
+#define _CHIP_MEMORY_TAG_METRIC_KEYS(name, str)                                                                                    \
+    constexpr MetricKey kMetricMemory##name##PeakBytes       = "core_mem_" str "_peak_bytes";                                      \
+    constexpr MetricKey kMetricMemory##name##PeakPoolObjects = "core_mem_" str "_peak_pool_objects";
+CHIP_MEMORY_TAGS_ENUMERATE(_CHIP_MEMORY_TAG_METRIC_KEYS)
+#undef _CHIP_MEMORY_TAG_METRIC_KEYS
+
 } // namespace Tracing
 } // namespace chip
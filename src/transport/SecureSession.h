@@ -232,6 +232,7 @@ public:
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
         SetFabricIndex(fabricIndex);
+        OnPeerChanged();
         return CHIP_NO_ERROR;
     }
 
@@ -327,7 +328,11 @@ private:
     const char * StateToString(State state) const;
     void MoveToState(State targetState);
 
+    // Lets the owning table re-index this session after its peer (node or fabric) changed.
+    void OnPeerChanged();
+
     friend class SecureSessionDeleter;
+    friend class SecureSessionTable;
     friend class TestSecureSessionTable;
 
     SecureSessionTable & mTable;
@@ -351,6 +356,15 @@ private:
     SessionParameters mRemoteSessionParams;
     CryptoContext mCryptoContext;
     SessionMessageCounter mSessionMessageCounter;
+
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+    // Intrusive links for the per-peer index of SecureSessionTable. mIndexedPeer is
+    // the key this session was indexed under, which may lag behind GetPeer() until
+    // OnPeerChanged() is called.
+    SecureSession * mNextInPeerIndex = nullptr;
+    ScopedNodeId mIndexedPeer;
+    bool mIsPeerIndexed = false;
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
 };
 
 } // namespace Transport
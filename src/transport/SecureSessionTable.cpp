@@ -22,6 +22,8 @@
 #include <transport/SecureSession.h>
 #include <transport/SecureSessionTable.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Transport {
 
@@ -54,6 +56,13 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
 
     SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
                                                    peerSessionId, fabricIndex, config);
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+    if (result != nullptr)
+    {
+        AddToIndex(result);
+        AddToPeerIndex(result);
+    }
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -82,6 +91,10 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
 
     VerifyOrReturnValue(allocated != nullptr, Optional<SessionHandle>::Missing());
 
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+    AddToIndex(allocated);
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+
     rv             = MakeOptional<SessionHandle>(*allocated);
     mNextSessionId = sessionId.Value() == kMaxSessionID ? static_cast<uint16_t>(kUnsecuredSessionId + 1)
                                                         : static_cast<uint16_t>(sessionId.Value() + 1);
@@ -129,7 +142,14 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
     // (#19967): Investigate doing linear search instead.
     //
     //
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+    // Indexed tables are meant to be large, so keep the candidate list off the stack.
+    Platform::ScopedMemoryBuffer<SortableSession> sortableSessionBuffer;
+    VerifyOrReturnValue(sortableSessionBuffer.Alloc(mEntries.Allocated()), nullptr);
+    SortableSession * sortableSessions = sortableSessionBuffer.Get();
+#else
     SortableSession sortableSessions[CHIP_CONFIG_SECURE_SESSION_POOL_SIZE];
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
 
     unsigned int index = 0;
 
@@ -139,6 +159,68 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
     //
     // This will be used by the session eviction algorithm later.
     //
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+    ForEachSession([&index, sortableSessions](auto * session) {
+        sortableSessions[index].mSession             = session;
+        sortableSessions[index].mNumMatchingOnFabric = 0;
+        sortableSessions[index].mNumMatchingOnPeer   = 0;
+        index++;
+        return Loop::Continue;
+    });
+
+    //
+    // Rather than comparing every pair of sessions, order the candidates by (fabric, peer node) and
+    // count the length of each run.
+    //
+    Platform::ScopedMemoryBuffer<size_t> peerOrder;
+    VerifyOrReturnValue(peerOrder.Alloc(index), nullptr);
+    for (size_t i = 0; i < index; i++)
+    {
+        peerOrder[i] = i;
+    }
+
+    std::sort(peerOrder.Get(), peerOrder.Get() + index, [sortableSessions](size_t a, size_t b) {
+        const SecureSession * sessionA = sortableSessions[a].mSession;
+        const SecureSession * sessionB = sortableSessions[b].mSession;
+        if (sessionA->GetFabricIndex() != sessionB->GetFabricIndex())
+        {
+            return sessionA->GetFabricIndex() < sessionB->GetFabricIndex();
+        }
+        return sessionA->GetPeerNodeId() < sessionB->GetPeerNodeId();
+    });
+
+    for (unsigned int fabricStart = 0; fabricStart < index;)
+    {
+        const FabricIndex fabricIndex = sortableSessions[peerOrder[fabricStart]].mSession->GetFabricIndex();
+        unsigned int fabricEnd        = fabricStart;
+
+        while (fabricEnd < index && sortableSessions[peerOrder[fabricEnd]].mSession->GetFabricIndex() == fabricIndex)
+        {
+            const NodeId peerNodeId = sortableSessions[peerOrder[fabricEnd]].mSession->GetPeerNodeId();
+            unsigned int peerEnd    = fabricEnd;
+
+            while (peerEnd < index && sortableSessions[peerOrder[peerEnd]].mSession->GetFabricIndex() == fabricIndex &&
+                   sortableSessions[peerOrder[peerEnd]].mSession->GetPeerNodeId() == peerNodeId)
+            {
+                peerEnd++;
+            }
+
+            for (unsigned int i = fabricEnd; i < peerEnd; i++)
+            {
+                sortableSessions[peerOrder[i]].mNumMatchingOnPeer = static_cast<uint16_t>(peerEnd - fabricEnd - 1);
+            }
+
+            fabricEnd = peerEnd;
+        }
+
+        for (unsigned int i = fabricStart; i < fabricEnd; i++)
+        {
+            sortableSessions[peerOrder[i]].mNumMatchingOnFabric = static_cast<uint16_t>(fabricEnd - fabricStart - 1);
+        }
+
+        fabricStart = fabricEnd;
+    }
+#else
     ForEachSession([&index, &sortableSessions, this](auto * session) {
         sortableSessions[index].mSession             = session;
         sortableSessions[index].mNumMatchingOnFabric = 0;
@@ -164,6 +246,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         index++;
         return Loop::Continue;
     });
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
 
     auto sortableSessionSpan = Span<SortableSession>(sortableSessions, mEntries.Allocated());
     EvictionPolicyContext policyContext(sortableSessionSpan, sessionEvictionHint);
@@ -340,6 +423,9 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
     SecureSession * result = nullptr;
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+    result = FindInIndex(localSessionId);
+#else
     mEntries.ForEachActiveObject([&](auto session) {
         if (session->GetLocalSessionId() == localSessionId)
         {
@@ -348,9 +434,184 @@ Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t
         }
         return Loop::Continue;
     });
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+
+namespace {
+
+// Index of the lowest set bit, mask must not be zero.
+uint16_t LowestSetBit(uint64_t mask)
+{
+    uint16_t bit = 0;
+    while ((mask & 1) == 0)
+    {
+        mask >>= 1;
+        ++bit;
+    }
+    return bit;
+}
+
+} // namespace
+
+SecureSession * SecureSessionTable::FindInIndex(uint16_t localSessionId) const
+{
+    for (size_t slot = LocalSessionIdBucket(localSessionId); mLocalSessionIdIndex[slot] != nullptr;
+         slot = (slot + 1) & (kIndexCapacity - 1))
+    {
+        if (mLocalSessionIdIndex[slot]->GetLocalSessionId() == localSessionId)
+        {
+            return mLocalSessionIdIndex[slot];
+        }
+    }
+    return nullptr;
+}
+
+void SecureSessionTable::AddToIndex(SecureSession * session)
+{
+    size_t slot = LocalSessionIdBucket(session->GetLocalSessionId());
+    for (size_t probes = 0; mLocalSessionIdIndex[slot] != nullptr; probes++)
+    {
+        // Cannot happen with the table bounded by CHIP_CONFIG_SECURE_SESSION_POOL_SIZE.
+        VerifyOrDie(probes < kIndexCapacity);
+        slot = (slot + 1) & (kIndexCapacity - 1);
+    }
+
+    mLocalSessionIdIndex[slot] = session;
+    SetSessionIdUsed(session->GetLocalSessionId(), true);
+}
+
+void SecureSessionTable::RemoveFromIndex(SecureSession * session)
+{
+    RemoveFromPeerIndex(session);
+
+    size_t hole = LocalSessionIdBucket(session->GetLocalSessionId());
+    while (mLocalSessionIdIndex[hole] != session)
+    {
+        // Sessions are always indexed when allocated.
+        VerifyOrDie(mLocalSessionIdIndex[hole] != nullptr);
+        hole = (hole + 1) & (kIndexCapacity - 1);
+    }
+
+    // Backward-shift deletion: move later entries of the probe sequence into the hole, so that
+    // lookups never need tombstones.
+    for (size_t next = (hole + 1) & (kIndexCapacity - 1); mLocalSessionIdIndex[next] != nullptr;
+         next = (next + 1) & (kIndexCapacity - 1))
+    {
+        size_t home = LocalSessionIdBucket(mLocalSessionIdIndex[next]->GetLocalSessionId());
+        if (((next - home) & (kIndexCapacity - 1)) >= ((next - hole) & (kIndexCapacity - 1)))
+        {
+            mLocalSessionIdIndex[hole] = mLocalSessionIdIndex[next];
+            hole                       = next;
+        }
+    }
+    mLocalSessionIdIndex[hole] = nullptr;
+
+    // Test sessions may share local session IDs, only free the ID once no session uses it.
+    if (FindInIndex(session->GetLocalSessionId()) == nullptr)
+    {
+        SetSessionIdUsed(session->GetLocalSessionId(), false);
+    }
+}
+
+void SecureSessionTable::AddToPeerIndex(SecureSession * session)
+{
+    SecureSession *& bucket = mPeerIndex[PeerIndexBucket(session->GetPeer())];
+
+    session->mIndexedPeer     = session->GetPeer();
+    session->mNextInPeerIndex = bucket;
+    session->mIsPeerIndexed   = true;
+    bucket                    = session;
+}
+
+void SecureSessionTable::RemoveFromPeerIndex(SecureSession * session)
+{
+    VerifyOrReturn(session->mIsPeerIndexed);
+
+    SecureSession ** link = &mPeerIndex[PeerIndexBucket(session->mIndexedPeer)];
+    while (*link != session)
+    {
+        link = &(*link)->mNextInPeerIndex;
+    }
+
+    *link                     = session->mNextInPeerIndex;
+    session->mNextInPeerIndex = nullptr;
+    session->mIsPeerIndexed   = false;
+}
+
+void SecureSessionTable::SetSessionIdUsed(uint16_t localSessionId, bool used)
+{
+    const size_t word  = localSessionId / 64;
+    const uint64_t bit = 1ULL << (localSessionId % 64);
+
+    if (used)
+    {
+        mUsedSessionIds[word] |= bit;
+    }
+    else
+    {
+        mUsedSessionIds[word] &= ~bit;
+    }
+
+    // kUnsecuredSessionId is never available, so it counts as used for the summary.
+    const uint64_t wordValue = mUsedSessionIds[word] | (word == 0 ? 1ULL : 0);
+    if (wordValue == UINT64_MAX)
+    {
+        mFullSessionIdWords[word / 64] |= (1ULL << (word % 64));
+    }
+    else
+    {
+        mFullSessionIdWords[word / 64] &= ~(1ULL << (word % 64));
+    }
+}
+
+Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
+{
+    static_assert(kUnsecuredSessionId == 0, "The bitmap assumes the unsecured session ID is 0");
+
+    auto availableIn = [this](size_t word) -> uint64_t { return ~(mUsedSessionIds[word] | (word == 0 ? 1ULL : 0)); };
+    auto idFor       = [](size_t word, uint64_t available) {
+        return MakeOptional<uint16_t>(static_cast<uint16_t>(word * 64 + LowestSetBit(available)));
+    };
+
+    // Same search order as the linear implementation: from mNextSessionId upwards, wrapping around.
+    const size_t startWord = mNextSessionId / 64;
+    uint64_t available     = availableIn(startWord) & (UINT64_MAX << (mNextSessionId % 64));
+    if (available != 0)
+    {
+        return idFor(startWord, available);
+    }
+
+    // Use the summary bitmap to skip over full words, ending back at the low IDs of startWord.
+    size_t position       = startWord + 1;
+    const size_t lastWord = startWord + kSessionIdWords;
+    while (position <= lastWord)
+    {
+        const size_t word      = position % kSessionIdWords;
+        const uint64_t notFull = ~mFullSessionIdWords[word / 64] & (UINT64_MAX << (word % 64));
+        if (notFull == 0)
+        {
+            position += 64 - (word % 64);
+            continue;
+        }
+
+        position += LowestSetBit(notFull) - (word % 64);
+        if (position > lastWord)
+        {
+            break;
+        }
+
+        const size_t candidateWord = position % kSessionIdWords;
+        return idFor(candidateWord, availableIn(candidateWord));
+    }
+
+    return NullOptional;
+}
+
+#else
+
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
     uint16_t candidate_base = 0;
@@ -403,5 +664,7 @@ Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
     return NullOptional;
 }
 
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+
 } // namespace Transport
 } // namespace chip
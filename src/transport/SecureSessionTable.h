@@ -23,12 +23,21 @@
 #include <system/TimeSource.h>
 #include <transport/SecureSession.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Transport {
 
 inline constexpr uint16_t kMaxSessionID       = UINT16_MAX;
 inline constexpr uint16_t kUnsecuredSessionId = 0;
 
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+constexpr size_t RoundUpToPowerOfTwo(size_t value, size_t result = 1)
+{
+    return result >= value ? result : RoundUpToPowerOfTwo(value, result * 2);
+}
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+
 /**
  * Handles a set of sessions.
  *
@@ -39,6 +48,7 @@ inline constexpr uint16_t kUnsecuredSessionId = 0;
 class SecureSessionTable
 {
 public:
+    SecureSessionTable() { mEntries.SetMemoryTag(Platform::MemoryTag::kSession); }
     ~SecureSessionTable() { mEntries.ReleaseAll(); }
 
     void Init() { mNextSessionId = chip::Crypto::GetRandU16(); }
@@ -76,7 +86,13 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session)
+    {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+        RemoveFromIndex(session);
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+        mEntries.ReleaseObject(session);
+    }
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -84,6 +100,45 @@ public:
         return mEntries.ForEachActiveObject(std::forward<Function>(function));
     }
 
+    /**
+     * Iterate over the sessions whose peer is the given node.
+     *
+     * Sessions that were never activated are not guaranteed to be visited. The function may release the session it is
+     * called with, but must not release any other session.
+     */
+    template <typename Function>
+    Loop ForEachSessionWithPeer(const ScopedNodeId & peer, Function && function)
+    {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+        SecureSession * session = mPeerIndex[PeerIndexBucket(peer)];
+        while (session != nullptr)
+        {
+            SecureSession * next = session->mNextInPeerIndex;
+            if (session->mIndexedPeer == peer && function(session) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+            session = next;
+        }
+        return Loop::Finish;
+#else
+        return mEntries.ForEachActiveObject([&](SecureSession * session) {
+            return session->GetPeer() == peer ? function(session) : Loop::Continue;
+        });
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+    }
+
+    /**
+     * Called by a session once its peer node or fabric changed, so that per-peer lookups keep finding it.
+     */
+    void OnSessionPeerChanged(SecureSession * session)
+    {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+        RemoveFromPeerIndex(session);
+        AddToPeerIndex(session);
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+    }
+
     /**
      * Get a secure session given its session ID.
      *
@@ -100,7 +155,7 @@ public:
     void NewerSessionAvailable(SecureSession * session)
     {
         VerifyOrDie(session->GetSecureSessionType() == SecureSession::Type::kCASE);
-        mEntries.ForEachActiveObject([&](SecureSession * oldSession) {
+        ForEachSessionWithPeer(session->GetPeer(), [&](SecureSession * oldSession) {
             if (session == oldSession)
                 return Loop::Continue;
 
@@ -183,7 +238,12 @@ private:
         template <typename CompareFunc>
         void Sort(CompareFunc func)
         {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+            // Large tables: keep the ordering of the insertion sort (stable) without its quadratic cost.
+            std::stable_sort(mSessionList.begin(), mSessionList.end(), func);
+#else
             Sorting::InsertionSort(mSessionList.begin(), mSessionList.size(), func);
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
         }
 
         const ScopedNodeId & GetSessionEvictionHint() const { return mSessionEvictionHint; }
@@ -251,6 +311,9 @@ private:
      * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
      * achieved with a sorted session table or additional storage.
      *
+     * With CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED, a bitmap of used session IDs is
+     * searched instead, whose cost does not depend on the number of sessions.
+     *
      * @return an unused session ID if any is found, else NullOptional
      */
     CHECK_RETURN_VALUE
@@ -274,6 +337,42 @@ private:
 #endif
 
     uint16_t mNextSessionId = 0;
+
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
+    // Hash tables are kept at most half full.
+    static constexpr size_t kIndexCapacity = RoundUpToPowerOfTwo(2 * CHIP_CONFIG_SECURE_SESSION_POOL_SIZE);
+
+    static constexpr size_t kSessionIdWords        = (static_cast<size_t>(kMaxSessionID) + 1) / 64;
+    static constexpr size_t kSessionIdSummaryWords = kSessionIdWords / 64;
+
+    static size_t LocalSessionIdBucket(uint16_t localSessionId)
+    {
+        return (static_cast<uint32_t>(localSessionId) * 0x9E3779B1u >> 16) & (kIndexCapacity - 1);
+    }
+
+    static size_t PeerIndexBucket(const ScopedNodeId & peer)
+    {
+        uint64_t hash = (peer.GetNodeId() ^ (static_cast<uint64_t>(peer.GetFabricIndex()) << 56)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(hash >> 32) & (kIndexCapacity - 1);
+    }
+
+    SecureSession * FindInIndex(uint16_t localSessionId) const;
+    void AddToIndex(SecureSession * session);
+    void RemoveFromIndex(SecureSession * session);
+    void AddToPeerIndex(SecureSession * session);
+    void RemoveFromPeerIndex(SecureSession * session);
+    void SetSessionIdUsed(uint16_t localSessionId, bool used);
+
+    // Linear-probing hash of local session ID to session.
+    SecureSession * mLocalSessionIdIndex[kIndexCapacity] = {};
+
+    // Chained hash of peer to sessions, linked through SecureSession::mNextInPeerIndex.
+    SecureSession * mPeerIndex[kIndexCapacity] = {};
+
+    // One bit per local session ID in use, and one bit per completely used word of mUsedSessionIds.
+    uint64_t mUsedSessionIds[kSessionIdWords]            = {};
+    uint64_t mFullSessionIdWords[kSessionIdSummaryWords] = {};
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED
 };
 
 } // namespace Transport
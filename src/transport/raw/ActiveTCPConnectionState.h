@@ -46,6 +46,8 @@ enum class TCPState
 };
 
 struct AppTCPConnectionCallbackCtxt;
+class TCPBase;
+
 /**
  *  State for each active TCP connection
  */
@@ -54,10 +56,12 @@ struct ActiveTCPConnectionState
 
     void Init(Inet::TCPEndPoint * endPoint, const PeerAddress & peerAddr)
     {
-        mEndPoint = endPoint;
-        mPeerAddr = peerAddr;
-        mReceived = nullptr;
-        mAppState = nullptr;
+        mEndPoint       = endPoint;
+        mPeerAddr       = peerAddr;
+        mReceived       = nullptr;
+        mReassembly     = nullptr;
+        mReassemblySize = 0;
+        mAppState       = nullptr;
     }
 
     void Free()
@@ -66,10 +70,12 @@ struct ActiveTCPConnectionState
         {
             mEndPoint->Free();
         }
-        mPeerAddr = PeerAddress::Uninitialized();
-        mEndPoint = nullptr;
-        mReceived = nullptr;
-        mAppState = nullptr;
+        mPeerAddr       = PeerAddress::Uninitialized();
+        mEndPoint       = nullptr;
+        mReceived       = nullptr;
+        mReassembly     = nullptr;
+        mReassemblySize = 0;
+        mAppState       = nullptr;
     }
 
     bool InUse() const { return mEndPoint != nullptr; }
@@ -87,6 +93,14 @@ struct ActiveTCPConnectionState
     // Buffers received but not yet consumed.
     System::PacketBufferHandle mReceived;
 
+    // Message being received, allocated at its full size once its length is known. Received data is copied into it as it
+    // arrives, so that the buffers holding it can be released right away.
+    System::PacketBufferHandle mReassembly;
+    size_t mReassemblySize = 0;
+
+    // Transport owning the connection. The endpoint of the connection points back to this state through its app state.
+    TCPBase * mTransport = nullptr;
+
     // Current state of the connection
     TCPState mConnectionState;
 
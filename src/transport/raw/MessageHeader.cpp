@@ -27,10 +27,11 @@
 #include <limits.h>
 #include <stdint.h>
 
+#include <array>
 #include <type_traits>
 
+#include <lib/core/CHIPEncoding.h>
 #include <lib/core/CHIPError.h>
-#include <lib/support/BufferReader.h>
 #include <lib/support/CodeUtils.h>
 
 /**********************************************
@@ -87,6 +88,83 @@ constexpr uint8_t kMsgFlagsMask = 0x07;
 /// Shift to convert to/from a masked version 8bit value to a 4bit version.
 constexpr int kVersionShift = 4;
 
+/// size of the exchange flags, message type and exchange id at the start of the encrypted header
+constexpr size_t kExchangeHeaderPrefixSizeBytes = 4;
+
+/// Mask of the exchange flags that select a payload header layout.
+constexpr uint8_t kExFlagsLayoutMask = 0x1F;
+
+/// Position of the variable fields of a packet header, which only depends on
+/// the S and DSIZ message flags.
+struct PacketHeaderLayout
+{
+    uint8_t destinationOffset; ///< Offset of the destination id, also the end of the source node id
+    uint8_t length;            ///< Header size, excluding message extensions
+};
+
+constexpr PacketHeaderLayout MakePacketHeaderLayout(uint8_t msgFlags)
+{
+    size_t destinationOffset = kFixedUnencryptedHeaderSizeBytes;
+    if (msgFlags & to_underlying(Header::MsgFlagValues::kSourceNodeIdPresent))
+    {
+        destinationOffset += kNodeIdSizeBytes;
+    }
+
+    // DSIZ 3 is reserved and rejected by Decode; the node id takes precedence
+    // everywhere else.
+    size_t length = destinationOffset;
+    if (msgFlags & to_underlying(Header::MsgFlagValues::kDestinationNodeIdPresent))
+    {
+        length += kNodeIdSizeBytes;
+    }
+    else if (msgFlags & to_underlying(Header::MsgFlagValues::kDestinationGroupIdPresent))
+    {
+        length += kGroupIdSizeBytes;
+    }
+
+    return { static_cast<uint8_t>(destinationOffset), static_cast<uint8_t>(length) };
+}
+
+/// Position of the variable fields of a payload header, which only depends on
+/// the V and A exchange flags.
+struct PayloadHeaderLayout
+{
+    uint8_t protocolIdOffset; ///< Offset of the protocol id, the ack counter follows it
+    uint8_t length;           ///< Header size, excluding secured extensions
+};
+
+constexpr PayloadHeaderLayout MakePayloadHeaderLayout(uint8_t exFlags)
+{
+    const size_t protocolIdOffset = kExchangeHeaderPrefixSizeBytes +
+        ((exFlags & to_underlying(Header::ExFlagValues::kExchangeFlag_VendorIdPresent)) ? kVendorIdSizeBytes : 0);
+    const size_t ackCounterSize =
+        (exFlags & to_underlying(Header::ExFlagValues::kExchangeFlag_AckMsg)) ? kAckMessageCounterSizeBytes : 0;
+    return { static_cast<uint8_t>(protocolIdOffset), static_cast<uint8_t>(protocolIdOffset + sizeof(uint16_t) + ackCounterSize) };
+}
+
+// Decoding looks the layout up from the flag byte instead of testing each flag
+// as it goes.
+constexpr auto kPacketHeaderLayouts = [] {
+    std::array<PacketHeaderLayout, kMsgFlagsMask + 1> layouts{};
+    for (size_t i = 0; i < layouts.size(); i++)
+    {
+        layouts[i] = MakePacketHeaderLayout(static_cast<uint8_t>(i));
+    }
+    return layouts;
+}();
+
+constexpr auto kPayloadHeaderLayouts = [] {
+    std::array<PayloadHeaderLayout, kExFlagsLayoutMask + 1> layouts{};
+    for (size_t i = 0; i < layouts.size(); i++)
+    {
+        layouts[i] = MakePayloadHeaderLayout(static_cast<uint8_t>(i));
+    }
+    return layouts;
+}();
+
+static_assert(kPacketHeaderLayouts[0].length == kFixedUnencryptedHeaderSizeBytes, "Unexpected minimal packet header size");
+static_assert(kPayloadHeaderLayouts[0].length == kEncryptedHeaderSizeBytes, "Unexpected minimal payload header size");
+
 } // namespace
 
 uint16_t PacketHeader::EncodeSizeBytes() const
@@ -131,112 +209,87 @@ uint16_t PayloadHeader::EncodeSizeBytes() const
     return static_cast<uint16_t>(size);
 }
 
-CHIP_ERROR PacketHeader::DecodeFixedCommon(Encoding::LittleEndian::Reader & reader)
+CHIP_ERROR PacketHeader::DecodeFixed(const uint8_t * const data, size_t size)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    int version;
-
-    uint8_t msgFlags;
-    SuccessOrExit(err = reader.Read8(&msgFlags).StatusCode());
-    version = ((msgFlags & kVersionMask) >> kVersionShift);
-    VerifyOrExit(version == kMsgHeaderVersion, err = CHIP_ERROR_VERSION_MISMATCH);
-    SetMessageFlags(msgFlags);
-
-    SuccessOrExit(err = reader.Read16(&mSessionId).StatusCode());
-
-    uint8_t securityFlags;
-    SuccessOrExit(err = reader.Read8(&securityFlags).StatusCode());
-    SetSecurityFlags(securityFlags);
-
-exit:
-
-    return err;
+    VerifyOrReturnError(size >= 1, CHIP_ERROR_BUFFER_TOO_SMALL);
+    VerifyOrReturnError(((data[0] & kVersionMask) >> kVersionShift) == kMsgHeaderVersion, CHIP_ERROR_VERSION_MISMATCH);
+    VerifyOrReturnError(size >= kPrivacyHeaderOffset, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    const uint32_t prefix = LittleEndian::Get32(data);
+    SetMessageFlags(static_cast<uint8_t>(prefix));
+    mSessionId = static_cast<uint16_t>(prefix >> 8);
+    SetSecurityFlags(static_cast<uint8_t>(prefix >> 24));
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR PacketHeader::DecodeFixed(const System::PacketBufferHandle & buf)
 {
-    const uint8_t * const data = buf->Start();
-    size_t size                = buf->DataLength();
-    LittleEndian::Reader reader(data, size);
-    return DecodeFixedCommon(reader);
+    return DecodeFixed(buf->Start(), buf->DataLength());
 }
 
 CHIP_ERROR PacketHeader::Decode(const uint8_t * const data, size_t size, uint16_t * decode_len)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    LittleEndian::Reader reader(data, size);
-    // TODO: De-uint16-ify everything related to this library
-    uint16_t octets_read;
-
-    SuccessOrExit(err = DecodeFixedCommon(reader));
-
-    SuccessOrExit(err = reader.Read32(&mMessageCounter).StatusCode());
-
-    if (mMsgFlags.Has(Header::MsgFlagValues::kSourceNodeIdPresent))
+    // Same checks as DecodeFixed, but the whole fixed header is read at once.
+    VerifyOrReturnError(size >= 1, CHIP_ERROR_BUFFER_TOO_SMALL);
+    VerifyOrReturnError(((data[0] & kVersionMask) >> kVersionShift) == kMsgHeaderVersion, CHIP_ERROR_VERSION_MISMATCH);
+    VerifyOrReturnError(size >= kFixedUnencryptedHeaderSizeBytes, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    const uint64_t prefix = LittleEndian::Get64(data);
+    SetMessageFlags(static_cast<uint8_t>(prefix));
+    mSessionId = static_cast<uint16_t>(prefix >> 8);
+    SetSecurityFlags(static_cast<uint8_t>(prefix >> 24));
+    mMessageCounter = static_cast<uint32_t>(prefix >> 32);
+
+    const PacketHeaderLayout & layout = kPacketHeaderLayouts[mMsgFlags.Raw() & kMsgFlagsMask];
+
+    // The checks below report the same errors, in the same order, as reading
+    // the fields one at a time would: a truncated source node id first, then
+    // the invalid flag combinations, then any other truncated field.
+    VerifyOrReturnError(size >= layout.destinationOffset, CHIP_ERROR_BUFFER_TOO_SMALL);
+    VerifyOrReturnError(IsSessionTypeValid(), CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(!mMsgFlags.HasAll(Header::MsgFlagValues::kDestinationNodeIdPresent,
+                                          Header::MsgFlagValues::kDestinationGroupIdPresent),
+                        CHIP_ERROR_INTERNAL);
+    // No need to check if session is Unicast for a destination node ID because
+    // for MCSP one is present with a group session ID. Spec 4.9.2.4
+    VerifyOrReturnError(!HasDestinationGroupId() || IsGroupSession(), CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(size >= layout.length, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    if (HasSourceNodeId())
     {
-        uint64_t sourceNodeId;
-        SuccessOrExit(err = reader.Read64(&sourceNodeId).StatusCode());
-        mSourceNodeId.SetValue(sourceNodeId);
+        mSourceNodeId.SetValue(LittleEndian::Get64(data + kFixedUnencryptedHeaderSizeBytes));
     }
     else
     {
         mSourceNodeId.ClearValue();
     }
 
-    if (!IsSessionTypeValid())
-    {
-        // Reserved.
-        SuccessOrExit(err = CHIP_ERROR_INTERNAL);
-    }
-
-    if (mMsgFlags.HasAll(Header::MsgFlagValues::kDestinationNodeIdPresent, Header::MsgFlagValues::kDestinationGroupIdPresent))
-    {
-        // Reserved.
-        SuccessOrExit(err = CHIP_ERROR_INTERNAL);
-    }
-    else if (mMsgFlags.Has(Header::MsgFlagValues::kDestinationNodeIdPresent))
-    {
-        // No need to check if session is Unicast because for MCSP
-        // a destination node ID is present with a group session ID.
-        // Spec 4.9.2.4
-        uint64_t destinationNodeId;
-        SuccessOrExit(err = reader.Read64(&destinationNodeId).StatusCode());
-        mDestinationNodeId.SetValue(destinationNodeId);
-        mDestinationGroupId.ClearValue();
-    }
-    else if (mMsgFlags.Has(Header::MsgFlagValues::kDestinationGroupIdPresent))
+    mDestinationNodeId.ClearValue();
+    mDestinationGroupId.ClearValue();
+    if (HasDestinationNodeId())
     {
-        if (mSessionType != Header::SessionType::kGroupSession)
-        {
-            SuccessOrExit(err = CHIP_ERROR_INTERNAL);
-        }
-        uint16_t destinationGroupId;
-        SuccessOrExit(err = reader.Read16(&destinationGroupId).StatusCode());
-        mDestinationGroupId.SetValue(destinationGroupId);
-        mDestinationNodeId.ClearValue();
+        mDestinationNodeId.SetValue(LittleEndian::Get64(data + layout.destinationOffset));
     }
-    else
+    else if (HasDestinationGroupId())
     {
-        mDestinationNodeId.ClearValue();
-        mDestinationGroupId.ClearValue();
+        mDestinationGroupId.SetValue(LittleEndian::Get16(data + layout.destinationOffset));
     }
 
+    size_t octetsRead = layout.length;
     if (mSecFlags.Has(Header::SecFlagValues::kMsgExtensionFlag))
     {
         // If present, skip over Message Extension block.
         // Spec 4.4.1.8. Message Extensions (variable)
-        uint16_t mxLength;
-        SuccessOrExit(err = reader.Read16(&mxLength).StatusCode());
-        VerifyOrExit(mxLength <= reader.Remaining(), err = CHIP_ERROR_INTERNAL);
-        reader.Skip(mxLength);
+        VerifyOrReturnError(size - octetsRead >= sizeof(uint16_t), CHIP_ERROR_BUFFER_TOO_SMALL);
+        const uint16_t mxLength = LittleEndian::Get16(data + octetsRead);
+        octetsRead += sizeof(uint16_t);
+        VerifyOrReturnError(mxLength <= size - octetsRead, CHIP_ERROR_INTERNAL);
+        octetsRead += mxLength;
     }
 
-    octets_read = static_cast<uint16_t>(reader.OctetsRead());
-    *decode_len = octets_read;
-
-exit:
-
-    return err;
+    // TODO: De-uint16-ify everything related to this library
+    *decode_len = static_cast<uint16_t>(octetsRead);
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR PacketHeader::DecodeAndConsume(const System::PacketBufferHandle & buf)
@@ -247,61 +300,53 @@ CHIP_ERROR PacketHeader::DecodeAndConsume(const System::PacketBufferHandle & buf
     return CHIP_NO_ERROR;
 }
 
+size_t PacketHeader::PrivacyHeaderLength() const
+{
+    // The privacy header runs from the message counter to the end of the
+    // destination id.
+    return static_cast<size_t>(kPacketHeaderLayouts[mMsgFlags.Raw() & kMsgFlagsMask].length - kPrivacyHeaderOffset);
+}
+
 CHIP_ERROR PayloadHeader::Decode(const uint8_t * const data, size_t size, uint16_t * decode_len)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    LittleEndian::Reader reader(data, size);
-    uint8_t header;
-    uint16_t octets_read;
+    VerifyOrReturnError(size >= kEncryptedHeaderSizeBytes, CHIP_ERROR_BUFFER_TOO_SMALL);
 
-    SuccessOrExit(err = reader.Read8(&header).Read8(&mMessageType).Read16(&mExchangeID).StatusCode());
+    const uint8_t header              = data[0];
+    const PayloadHeaderLayout & layout = kPayloadHeaderLayouts[header & kExFlagsLayoutMask];
+    VerifyOrReturnError(size >= layout.length, CHIP_ERROR_BUFFER_TOO_SMALL);
 
+    const uint32_t prefix = LittleEndian::Get32(data);
     mExchangeFlags.SetRaw(header);
+    mMessageType = static_cast<uint8_t>(prefix >> 8);
+    mExchangeID  = static_cast<uint16_t>(prefix >> 16);
 
-    VendorId vendor_id;
-    if (HaveVendorId())
-    {
-        uint16_t vendor_id_raw;
-        SuccessOrExit(err = reader.Read16(&vendor_id_raw).StatusCode());
-        vendor_id = static_cast<VendorId>(vendor_id_raw);
-    }
-    else
-    {
-        vendor_id = VendorId::Common;
-    }
-
-    uint16_t protocol_id;
-    SuccessOrExit(err = reader.Read16(&protocol_id).StatusCode());
-
-    mProtocolID = Protocols::Id(vendor_id, protocol_id);
+    const VendorId vendor_id =
+        HaveVendorId() ? static_cast<VendorId>(LittleEndian::Get16(data + kExchangeHeaderPrefixSizeBytes)) : VendorId::Common;
+    mProtocolID = Protocols::Id(vendor_id, LittleEndian::Get16(data + layout.protocolIdOffset));
 
     if (mExchangeFlags.Has(Header::ExFlagValues::kExchangeFlag_AckMsg))
     {
-        uint32_t ack_message_counter;
-        SuccessOrExit(err = reader.Read32(&ack_message_counter).StatusCode());
-        mAckMessageCounter.SetValue(ack_message_counter);
+        mAckMessageCounter.SetValue(LittleEndian::Get32(data + layout.protocolIdOffset + sizeof(uint16_t)));
     }
     else
     {
         mAckMessageCounter.ClearValue();
     }
 
+    size_t octetsRead = layout.length;
     if (mExchangeFlags.Has(Header::ExFlagValues::kExchangeFlag_SecuredExtension))
     {
         // If present, skip over Secured Extension block.
         // Spec 4.4.3.7. Secured Extensions (variable)
-        uint16_t sxLength;
-        SuccessOrExit(err = reader.Read16(&sxLength).StatusCode());
-        VerifyOrExit(sxLength <= reader.Remaining(), err = CHIP_ERROR_INTERNAL);
-        reader.Skip(sxLength);
+        VerifyOrReturnError(size - octetsRead >= sizeof(uint16_t), CHIP_ERROR_BUFFER_TOO_SMALL);
+        const uint16_t sxLength = LittleEndian::Get16(data + octetsRead);
+        octetsRead += sizeof(uint16_t);
+        VerifyOrReturnError(sxLength <= size - octetsRead, CHIP_ERROR_INTERNAL);
+        octetsRead += sxLength;
     }
 
-    octets_read = static_cast<uint16_t>(reader.OctetsRead());
-    *decode_len = octets_read;
-
-exit:
-
-    return err;
+    *decode_len = static_cast<uint16_t>(octetsRead);
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR PayloadHeader::DecodeAndConsume(const System::PacketBufferHandle & buf)
@@ -314,39 +359,36 @@ CHIP_ERROR PayloadHeader::DecodeAndConsume(const System::PacketBufferHandle & bu
 
 CHIP_ERROR PacketHeader::Encode(uint8_t * data, size_t size, uint16_t * encode_size) const
 {
-    VerifyOrReturnError(size >= EncodeSizeBytes(), CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrReturnError(!(mDestinationNodeId.HasValue() && mDestinationGroupId.HasValue()), CHIP_ERROR_INTERNAL);
-    VerifyOrReturnError(encode_size != nullptr, CHIP_ERROR_INTERNAL);
-    VerifyOrReturnError(IsSessionTypeValid(), CHIP_ERROR_INTERNAL);
-
     Header::MsgFlags messageFlags = mMsgFlags;
     messageFlags.Set(Header::MsgFlagValues::kSourceNodeIdPresent, mSourceNodeId.HasValue())
         .Set(Header::MsgFlagValues::kDestinationNodeIdPresent, mDestinationNodeId.HasValue())
         .Set(Header::MsgFlagValues::kDestinationGroupIdPresent, mDestinationGroupId.HasValue());
 
-    uint8_t msgFlags = (kMsgHeaderVersion << kVersionShift) | (messageFlags.Raw() & kMsgFlagsMask);
+    const PacketHeaderLayout & layout = kPacketHeaderLayouts[messageFlags.Raw() & kMsgFlagsMask];
+    VerifyOrReturnError(size >= layout.length, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!(mDestinationNodeId.HasValue() && mDestinationGroupId.HasValue()), CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(encode_size != nullptr, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(IsSessionTypeValid(), CHIP_ERROR_INTERNAL);
 
-    uint8_t * p = data;
-    Write8(p, msgFlags);
-    LittleEndian::Write16(p, mSessionId);
-    Write8(p, mSecFlags.Raw());
-    LittleEndian::Write32(p, mMessageCounter);
+    const uint8_t msgFlags = (kMsgHeaderVersion << kVersionShift) | (messageFlags.Raw() & kMsgFlagsMask);
+    LittleEndian::Put64(data,
+                        static_cast<uint64_t>(msgFlags) | static_cast<uint64_t>(mSessionId) << 8 |
+                            static_cast<uint64_t>(mSecFlags.Raw()) << 24 | static_cast<uint64_t>(mMessageCounter) << 32);
     if (mSourceNodeId.HasValue())
     {
-        LittleEndian::Write64(p, mSourceNodeId.Value());
+        LittleEndian::Put64(data + kFixedUnencryptedHeaderSizeBytes, mSourceNodeId.Value());
     }
     if (mDestinationNodeId.HasValue())
     {
-        LittleEndian::Write64(p, mDestinationNodeId.Value());
+        LittleEndian::Put64(data + layout.destinationOffset, mDestinationNodeId.Value());
     }
     else if (mDestinationGroupId.HasValue())
     {
-        LittleEndian::Write16(p, mDestinationGroupId.Value());
+        LittleEndian::Put16(data + layout.destinationOffset, mDestinationGroupId.Value());
     }
 
     // Written data size provided to caller on success
-    VerifyOrReturnError(p - data == EncodeSizeBytes(), CHIP_ERROR_INTERNAL);
-    *encode_size = static_cast<uint16_t>(p - data);
+    *encode_size = layout.length;
 
     return CHIP_NO_ERROR;
 }
@@ -366,27 +408,27 @@ CHIP_ERROR PacketHeader::EncodeBeforeData(const System::PacketBufferHandle & buf
 
 CHIP_ERROR PayloadHeader::Encode(uint8_t * data, size_t size, uint16_t * encode_size) const
 {
-    VerifyOrReturnError(size >= EncodeSizeBytes(), CHIP_ERROR_INVALID_ARGUMENT);
+    const uint16_t length = EncodeSizeBytes();
+    VerifyOrReturnError(size >= length, CHIP_ERROR_INVALID_ARGUMENT);
 
-    uint8_t * p          = data;
-    const uint8_t header = mExchangeFlags.Raw();
+    const uint8_t header               = mExchangeFlags.Raw();
+    const PayloadHeaderLayout & layout = kPayloadHeaderLayouts[header & kExFlagsLayoutMask];
 
-    Write8(p, header);
-    Write8(p, mMessageType);
-    LittleEndian::Write16(p, mExchangeID);
+    LittleEndian::Put32(data,
+                        static_cast<uint32_t>(header) | static_cast<uint32_t>(mMessageType) << 8 |
+                            static_cast<uint32_t>(mExchangeID) << 16);
     if (HaveVendorId())
     {
-        LittleEndian::Write16(p, to_underlying(mProtocolID.GetVendorId()));
+        LittleEndian::Put16(data + kExchangeHeaderPrefixSizeBytes, to_underlying(mProtocolID.GetVendorId()));
     }
-    LittleEndian::Write16(p, mProtocolID.GetProtocolId());
+    LittleEndian::Put16(data + layout.protocolIdOffset, mProtocolID.GetProtocolId());
     if (mAckMessageCounter.HasValue())
     {
-        LittleEndian::Write32(p, mAckMessageCounter.Value());
+        LittleEndian::Put32(data + layout.protocolIdOffset + sizeof(uint16_t), mAckMessageCounter.Value());
     }
 
     // Written data size provided to caller on success
-    VerifyOrReturnError(p - data == EncodeSizeBytes(), CHIP_ERROR_INTERNAL);
-    *encode_size = static_cast<uint16_t>(p - data);
+    *encode_size = length;
 
     return CHIP_NO_ERROR;
 }
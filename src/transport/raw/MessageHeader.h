@@ -368,23 +368,11 @@ public:
      */
     uint8_t * PrivacyHeader(uint8_t * msgBuf) const { return msgBuf + PacketHeader::kPrivacyHeaderOffset; }
 
-    size_t PrivacyHeaderLength() const
-    {
-        size_t length = kPrivacyHeaderMinLength;
-        if (mMsgFlags.Has(Header::MsgFlagValues::kSourceNodeIdPresent))
-        {
-            length += sizeof(NodeId);
-        }
-        if (mMsgFlags.Has(Header::MsgFlagValues::kDestinationNodeIdPresent))
-        {
-            length += sizeof(NodeId);
-        }
-        else if (mMsgFlags.Has(Header::MsgFlagValues::kDestinationGroupIdPresent))
-        {
-            length += sizeof(GroupId);
-        }
-        return length;
-    }
+    /**
+     * Length of the privacy header, from the message counter to the end of the
+     * destination id, as given by the message flags.
+     */
+    size_t PrivacyHeaderLength() const;
 
     size_t PayloadOffset() const
     {
@@ -413,6 +401,14 @@ public:
      */
     CHIP_ERROR DecodeFixed(const System::PacketBufferHandle & buf);
 
+    /**
+     * A version of DecodeFixed that decodes from the given buffer.
+     *
+     * @param data - the buffer to read from
+     * @param size - bytes available in the buffer
+     */
+    CHIP_ERROR DecodeFixed(const uint8_t * data, size_t size);
+
     /**
      * Decodes a header from the given buffer.
      *
@@ -486,18 +482,6 @@ public:
     }
 
 private:
-    /**
-     * Decodes the fixed portion of the header fields from the stream reader.
-     * The fixed header includes: message flags, session id, and security flags.
-     *
-     * @return CHIP_NO_ERROR on success.
-     *
-     * Possible failures:
-     *    CHIP_ERROR_INVALID_ARGUMENT on insufficient buffer size
-     *    CHIP_ERROR_VERSION_MISMATCH if header version is not supported.
-     */
-    CHIP_ERROR DecodeFixedCommon(Encoding::LittleEndian::Reader & reader);
-
     /// Represents the current encode/decode header version (4 bits)
     static constexpr uint8_t kMsgHeaderVersion = 0x00;
 
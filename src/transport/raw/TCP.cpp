@@ -30,6 +30,7 @@
 #include <lib/support/logging/CHIPLogging.h>
 #include <transport/raw/MessageHeader.h>
 
+#include <algorithm>
 #include <inttypes.h>
 #include <limits>
 
@@ -170,14 +171,8 @@ ActiveTCPConnectionState * TCPBase::FindActiveConnection(const PeerAddress & add
 // Find the ActiveTCPConnectionState for a given TCPEndPoint
 ActiveTCPConnectionState * TCPBase::FindActiveConnection(const Inet::TCPEndPoint * endPoint)
 {
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
-    {
-        if (mActiveConnections[i].mEndPoint == endPoint && mActiveConnections[i].IsConnected())
-        {
-            return &mActiveConnections[i];
-        }
-    }
-    return nullptr;
+    ActiveTCPConnectionState * connection = FindInUseConnection(endPoint);
+    return (connection != nullptr && connection->IsConnected()) ? connection : nullptr;
 }
 
 ActiveTCPConnectionState * TCPBase::FindInUseConnection(const Inet::TCPEndPoint * endPoint)
@@ -187,14 +182,15 @@ ActiveTCPConnectionState * TCPBase::FindInUseConnection(const Inet::TCPEndPoint
         return nullptr;
     }
 
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    // Connection endpoints hold their connection in their app state. Check that it is one of ours before using it, as other
+    // endpoints, like the listening one, hold something else.
+    auto * connection = static_cast<ActiveTCPConnectionState *>(endPoint->mAppState);
+    if (connection < mActiveConnections || connection >= mActiveConnections + mActiveConnectionsSize)
     {
-        if (mActiveConnections[i].mEndPoint == endPoint)
-        {
-            return &mActiveConnections[i];
-        }
+        return nullptr;
     }
-    return nullptr;
+
+    return (connection->mEndPoint == endPoint) ? connection : nullptr;
 }
 
 CHIP_ERROR TCPBase::SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf)
@@ -240,13 +236,14 @@ CHIP_ERROR TCPBase::StartConnect(const PeerAddress & addr, Transport::AppTCPConn
     auto EndPointDeletor = [](Inet::TCPEndPoint * e) { e->Free(); };
     std::unique_ptr<Inet::TCPEndPoint, decltype(EndPointDeletor)> endPointHolder(endPoint, EndPointDeletor);
 
-    endPoint->mAppState         = reinterpret_cast<void *>(this);
     endPoint->OnConnectComplete = HandleTCPEndPointConnectComplete;
     endPoint->SetConnectTimeout(mConnectTimeout);
 
     activeConnection = AllocateConnection();
     VerifyOrReturnError(activeConnection != nullptr, CHIP_ERROR_NO_MEMORY);
     activeConnection->Init(endPoint, addr);
+    activeConnection->mTransport       = this;
+    endPoint->mAppState                = activeConnection;
     activeConnection->mAppState        = appState;
     activeConnection->mConnectionState = TCPState::kConnecting;
     // Set the return value of the peer connection state to the allocated
@@ -316,6 +313,12 @@ CHIP_ERROR TCPBase::ProcessReceivedBuffer(Inet::TCPEndPoint * endPoint, const Pe
 
     while (!state->mReceived.IsNull())
     {
+        if (!state->mReassembly.IsNull())
+        {
+            ReturnErrorOnFailure(ReassembleMessage(peerAddress, state));
+            continue;
+        }
+
         uint8_t messageSizeBuf[kPacketSizeBytes];
         CHIP_ERROR err = state->mReceived->Read(messageSizeBuf);
         if (err == CHIP_ERROR_BUFFER_TOO_SMALL)
@@ -337,10 +340,24 @@ CHIP_ERROR TCPBase::ProcessReceivedBuffer(Inet::TCPEndPoint * endPoint, const Pe
             return CHIP_ERROR_MESSAGE_TOO_LONG;
         }
         // The subtraction will not underflow because we successfully read kPacketSizeBytes.
-        if (messageSize > (state->mReceived->TotalLength() - kPacketSizeBytes))
+        size_t available = state->mReceived->TotalLength() - kPacketSizeBytes;
+        if (messageSize > available)
         {
             // We have not yet received the complete message.
-            return CHIP_NO_ERROR;
+            if (available == 0)
+            {
+                // Wait for the start of the message, which may arrive in a buffer of its own that can be passed upstream as is.
+                return CHIP_NO_ERROR;
+            }
+
+            // Reassemble the message as it arrives, rather than holding every received buffer until the message is complete.
+            // The length prefix comes from the peer: the reassembly buffer only grows with the data actually received.
+            state->mReassembly = System::PacketBufferHandle::New(
+                std::min<size_t>(messageSize, std::max<size_t>(available, System::PacketBuffer::kMaxSizeWithoutReserve)), 0);
+            VerifyOrReturnError(!state->mReassembly.IsNull(), CHIP_ERROR_NO_MEMORY);
+            state->mReassemblySize = messageSize;
+            state->mReceived.Consume(kPacketSizeBytes);
+            continue;
         }
 
         state->mReceived.Consume(kPacketSizeBytes);
@@ -394,6 +411,43 @@ CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, Active
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TCPBase::ReassembleMessage(const PeerAddress & peerAddress, ActiveTCPConnectionState * state)
+{
+    System::PacketBufferHandle & message = state->mReassembly;
+    const size_t remaining               = state->mReassemblySize - message->DataLength();
+    const size_t length                  = std::min(remaining, state->mReceived->TotalLength());
+
+    if (message->AvailableDataLength() < length)
+    {
+        // Double the buffer, up to the message size, so that the data is copied a bounded number of times overall.
+        const size_t received = message->DataLength();
+        System::PacketBufferHandle grown =
+            System::PacketBufferHandle::New(std::min(state->mReassemblySize, std::max(received + length, 2 * received)), 0);
+        VerifyOrReturnError(!grown.IsNull(), CHIP_ERROR_NO_MEMORY);
+        memcpy(grown->Start(), message->Start(), received);
+        grown->SetDataLength(received);
+        message = std::move(grown);
+    }
+
+    CHIP_ERROR err = state->mReceived->Read(message->Start() + message->DataLength(), length);
+    state->mReceived.Consume(length);
+    ReturnErrorOnFailure(err);
+    message->SetDataLength(message->DataLength() + length);
+
+    if (length == remaining)
+    {
+        // Take the message out of the connection state before passing it upstream: the receiver may not take ownership of it,
+        // and the next message must start from an empty reassembly buffer.
+        System::PacketBufferHandle completeMessage = std::move(state->mReassembly);
+        MessageTransportContext msgContext;
+        msgContext.conn        = state;
+        state->mReassemblySize = 0;
+        HandleMessageReceived(peerAddress, std::move(completeMessage), &msgContext);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 void TCPBase::CloseConnectionInternal(ActiveTCPConnectionState * connection, CHIP_ERROR err, SuppressCallback suppressCallback)
 {
     TCPState prevState;
@@ -450,7 +504,7 @@ CHIP_ERROR TCPBase::HandleTCPEndPointDataReceived(Inet::TCPEndPoint * endPoint,
     endPoint->GetInterfaceId(&interfaceId);
     PeerAddress peerAddress = PeerAddress::TCP(ipAddress, port, interfaceId);
 
-    TCPBase * tcp  = reinterpret_cast<TCPBase *>(endPoint->mAppState);
+    TCPBase * tcp  = static_cast<ActiveTCPConnectionState *>(endPoint->mAppState)->mTransport;
     CHIP_ERROR err = tcp->ProcessReceivedBuffer(endPoint, peerAddress, std::move(buffer));
 
     if (err != CHIP_NO_ERROR)
@@ -466,7 +520,7 @@ void TCPBase::HandleTCPEndPointConnectComplete(Inet::TCPEndPoint * endPoint, CHI
 {
     CHIP_ERROR err          = CHIP_NO_ERROR;
     bool foundPendingPacket = false;
-    TCPBase * tcp           = reinterpret_cast<TCPBase *>(endPoint->mAppState);
+    TCPBase * tcp           = static_cast<ActiveTCPConnectionState *>(endPoint->mAppState)->mTransport;
     Inet::IPAddress ipAddress;
     uint16_t port;
     Inet::InterfaceId interfaceId;
@@ -537,15 +591,16 @@ void TCPBase::HandleTCPEndPointConnectComplete(Inet::TCPEndPoint * endPoint, CHI
 
 void TCPBase::HandleTCPEndPointConnectionClosed(Inet::TCPEndPoint * endPoint, CHIP_ERROR err)
 {
-    TCPBase * tcp                               = reinterpret_cast<TCPBase *>(endPoint->mAppState);
-    ActiveTCPConnectionState * activeConnection = tcp->FindInUseConnection(endPoint);
+    ActiveTCPConnectionState * activeConnection = static_cast<ActiveTCPConnectionState *>(endPoint->mAppState);
 
-    if (activeConnection == nullptr)
+    if (activeConnection == nullptr || activeConnection->mEndPoint != endPoint)
     {
         endPoint->Free();
         return;
     }
 
+    TCPBase * tcp = activeConnection->mTransport;
+
     if (err == CHIP_NO_ERROR && activeConnection->IsConnected())
     {
         err = CHIP_ERROR_CONNECTION_CLOSED_UNEXPECTEDLY;
@@ -572,7 +627,7 @@ void TCPBase::HandleIncomingConnection(Inet::TCPEndPoint * listenEndPoint, Inet:
     {
         activeConnection = tcp->AllocateConnection();
 
-        endPoint->mAppState          = listenEndPoint->mAppState;
+        endPoint->mAppState          = activeConnection;
         endPoint->OnDataReceived     = HandleTCPEndPointDataReceived;
         endPoint->OnDataSent         = nullptr;
         endPoint->OnConnectionClosed = HandleTCPEndPointConnectionClosed;
@@ -582,6 +637,7 @@ void TCPBase::HandleIncomingConnection(Inet::TCPEndPoint * listenEndPoint, Inet:
 
         // Update state for the active connection
         activeConnection->Init(endPoint, addr);
+        activeConnection->mTransport = tcp;
         tcp->mUsedEndPointCount++;
         activeConnection->mConnectionState = TCPState::kConnected;
 
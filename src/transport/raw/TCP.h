@@ -269,6 +269,15 @@ private:
      */
     CHIP_ERROR ProcessSingleMessage(const PeerAddress & peerAddress, ActiveTCPConnectionState * state, size_t messageSize);
 
+    /**
+     * Copy received data into the message being reassembled, and pass the message upstream once complete.
+     *
+     * @param[in]     peerAddress   The peer the data is coming from.
+     * @param[in,out] state         The connection state, with a message being reassembled. On exit, the received data that
+     *                              belongs to the message has been consumed.
+     */
+    CHIP_ERROR ReassembleMessage(const PeerAddress & peerAddress, ActiveTCPConnectionState * state);
+
     /**
      * Initiate a connection to the given peer. On connection completion,
      * HandleTCPConnectComplete callback would be called.
@@ -0,0 +1,84 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lib/support/CodeUtils.h>
+#include <transport/raw/MessageHeader.h>
+#include <transport/raw/tests/MessageHeaderReference.h>
+
+namespace {
+
+using namespace chip;
+
+void CheckPacketHeader(const uint8_t * data, size_t len)
+{
+    // Partial decode, as done on reception before deciding how to process the message.
+    PacketHeader partialHeader;
+    Test::ReferencePacketHeader referencePartialHeader;
+    CHIP_ERROR err = partialHeader.DecodeFixed(data, len);
+    VerifyOrDie(err == Test::ReferenceDecodeFixed(data, len, referencePartialHeader));
+    if (err == CHIP_NO_ERROR)
+    {
+        VerifyOrDie(partialHeader.GetMessageFlags() == referencePartialHeader.messageFlags);
+        VerifyOrDie(partialHeader.GetSessionId() == referencePartialHeader.sessionId);
+        VerifyOrDie(partialHeader.GetSecurityFlags() == referencePartialHeader.securityFlags);
+
+        // The privacy header is located from the partial decode.
+        VerifyOrDie(partialHeader.PrivacyHeaderLength() == Test::ReferencePrivacyHeaderLength(referencePartialHeader));
+    }
+
+    PacketHeader header;
+    Test::ReferencePacketHeader referenceHeader;
+    uint16_t decodeLen          = 0;
+    uint16_t referenceDecodeLen = 0;
+    err                         = header.Decode(data, len, &decodeLen);
+    VerifyOrDie(err == Test::ReferenceDecode(data, len, referenceHeader, &referenceDecodeLen));
+    if (err == CHIP_NO_ERROR)
+    {
+        VerifyOrDie(decodeLen == referenceDecodeLen);
+        VerifyOrDie(Test::Matches(header, referenceHeader));
+    }
+}
+
+void CheckPayloadHeader(const uint8_t * data, size_t len)
+{
+    PayloadHeader header;
+    Test::ReferencePayloadHeader referenceHeader;
+    uint16_t decodeLen          = 0;
+    uint16_t referenceDecodeLen = 0;
+    CHIP_ERROR err              = header.Decode(data, len, &decodeLen);
+    VerifyOrDie(err == Test::ReferenceDecode(data, len, referenceHeader, &referenceDecodeLen));
+    if (err == CHIP_NO_ERROR)
+    {
+        VerifyOrDie(decodeLen == referenceDecodeLen);
+        VerifyOrDie(Test::Matches(header, referenceHeader));
+    }
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t * data, size_t len)
+{
+    // Every input must be decoded identically, or rejected with the same error,
+    // by the table-driven decoders and the field-by-field ones.
+    CheckPacketHeader(data, len);
+    CheckPayloadHeader(data, len);
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "MessageHeaderReference.h"
+
+#include <lib/support/BufferReader.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace Test {
+
+using namespace chip::Encoding;
+
+namespace {
+
+constexpr uint8_t kVersionMask     = 0xF0;
+constexpr int kVersionShift        = 4;
+constexpr uint8_t kSessionTypeMask = 0x03;
+
+bool HasFlag(uint8_t flags, Header::MsgFlagValues flag)
+{
+    return (flags & to_underlying(flag)) != 0;
+}
+
+bool HasFlag(uint8_t flags, Header::SecFlagValues flag)
+{
+    return (flags & to_underlying(flag)) != 0;
+}
+
+bool HasFlag(uint8_t flags, Header::ExFlagValues flag)
+{
+    return (flags & to_underlying(flag)) != 0;
+}
+
+CHIP_ERROR DecodeFixedCommon(LittleEndian::Reader & reader, ReferencePacketHeader & header)
+{
+    uint8_t msgFlags;
+    ReturnErrorOnFailure(reader.Read8(&msgFlags).StatusCode());
+    VerifyOrReturnError(((msgFlags & kVersionMask) >> kVersionShift) == 0, CHIP_ERROR_VERSION_MISMATCH);
+    header.messageFlags = msgFlags;
+
+    ReturnErrorOnFailure(reader.Read16(&header.sessionId).StatusCode());
+    return reader.Read8(&header.securityFlags).StatusCode();
+}
+
+} // namespace
+
+CHIP_ERROR ReferenceDecodeFixed(const uint8_t * data, size_t size, ReferencePacketHeader & header)
+{
+    LittleEndian::Reader reader(data, size);
+    return DecodeFixedCommon(reader, header);
+}
+
+CHIP_ERROR ReferenceDecode(const uint8_t * data, size_t size, ReferencePacketHeader & header, uint16_t * decode_size)
+{
+    LittleEndian::Reader reader(data, size);
+
+    ReturnErrorOnFailure(DecodeFixedCommon(reader, header));
+    ReturnErrorOnFailure(reader.Read32(&header.messageCounter).StatusCode());
+
+    header.sourceNodeId.ClearValue();
+    header.destinationNodeId.ClearValue();
+    header.destinationGroupId.ClearValue();
+
+    if (HasFlag(header.messageFlags, Header::MsgFlagValues::kSourceNodeIdPresent))
+    {
+        uint64_t sourceNodeId;
+        ReturnErrorOnFailure(reader.Read64(&sourceNodeId).StatusCode());
+        header.sourceNodeId.SetValue(sourceNodeId);
+    }
+
+    const uint8_t sessionType = header.securityFlags & kSessionTypeMask;
+    VerifyOrReturnError(sessionType == to_underlying(Header::SessionType::kUnicastSession) ||
+                            sessionType == to_underlying(Header::SessionType::kGroupSession),
+                        CHIP_ERROR_INTERNAL);
+
+    if (HasFlag(header.messageFlags, Header::MsgFlagValues::kDestinationNodeIdPresent) &&
+        HasFlag(header.messageFlags, Header::MsgFlagValues::kDestinationGroupIdPresent))
+    {
+        return CHIP_ERROR_INTERNAL;
+    }
+    if (HasFlag(header.messageFlags, Header::MsgFlagValues::kDestinationNodeIdPresent))
+    {
+        uint64_t destinationNodeId;
+        ReturnErrorOnFailure(reader.Read64(&destinationNodeId).StatusCode());
+        header.destinationNodeId.SetValue(destinationNodeId);
+    }
+    else if (HasFlag(header.messageFlags, Header::MsgFlagValues::kDestinationGroupIdPresent))
+    {
+        VerifyOrReturnError(sessionType == to_underlying(Header::SessionType::kGroupSession), CHIP_ERROR_INTERNAL);
+        uint16_t destinationGroupId;
+        ReturnErrorOnFailure(reader.Read16(&destinationGroupId).StatusCode());
+        header.destinationGroupId.SetValue(destinationGroupId);
+    }
+
+    if (HasFlag(header.securityFlags, Header::SecFlagValues::kMsgExtensionFlag))
+    {
+        uint16_t mxLength;
+        ReturnErrorOnFailure(reader.Read16(&mxLength).StatusCode());
+        VerifyOrReturnError(mxLength <= reader.Remaining(), CHIP_ERROR_INTERNAL);
+        reader.Skip(mxLength);
+    }
+
+    *decode_size = static_cast<uint16_t>(reader.OctetsRead());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ReferenceDecode(const uint8_t * data, size_t size, ReferencePayloadHeader & header, uint16_t * decode_size)
+{
+    LittleEndian::Reader reader(data, size);
+
+    ReturnErrorOnFailure(reader.Read8(&header.exchangeFlags).Read8(&header.messageType).Read16(&header.exchangeId).StatusCode());
+
+    header.vendorId = to_underlying(VendorId::Common);
+    if (HasFlag(header.exchangeFlags, Header::ExFlagValues::kExchangeFlag_VendorIdPresent))
+    {
+        ReturnErrorOnFailure(reader.Read16(&header.vendorId).StatusCode());
+    }
+    ReturnErrorOnFailure(reader.Read16(&header.protocolId).StatusCode());
+
+    header.ackMessageCounter.ClearValue();
+    if (HasFlag(header.exchangeFlags, Header::ExFlagValues::kExchangeFlag_AckMsg))
+    {
+        uint32_t ackMessageCounter;
+        ReturnErrorOnFailure(reader.Read32(&ackMessageCounter).StatusCode());
+        header.ackMessageCounter.SetValue(ackMessageCounter);
+    }
+
+    if (HasFlag(header.exchangeFlags, Header::ExFlagValues::kExchangeFlag_SecuredExtension))
+    {
+        uint16_t sxLength;
+        ReturnErrorOnFailure(reader.Read16(&sxLength).StatusCode());
+        VerifyOrReturnError(sxLength <= reader.Remaining(), CHIP_ERROR_INTERNAL);
+        reader.Skip(sxLength);
+    }
+
+    *decode_size = static_cast<uint16_t>(reader.OctetsRead());
+    return CHIP_NO_ERROR;
+}
+
+size_t ReferencePrivacyHeaderLength(const ReferencePacketHeader & header)
+{
+    size_t length = PacketHeader::kPrivacyHeaderMinLength;
+    if (HasFlag(header.messageFlags, Header::MsgFlagValues::kSourceNodeIdPresent))
+    {
+        length += sizeof(NodeId);
+    }
+    if (HasFlag(header.messageFlags, Header::MsgFlagValues::kDestinationNodeIdPresent))
+    {
+        length += sizeof(NodeId);
+    }
+    else if (HasFlag(header.messageFlags, Header::MsgFlagValues::kDestinationGroupIdPresent))
+    {
+        length += sizeof(GroupId);
+    }
+    return length;
+}
+
+bool Matches(const PacketHeader & header, const ReferencePacketHeader & reference)
+{
+    return header.GetMessageFlags() == reference.messageFlags && header.GetSessionId() == reference.sessionId &&
+        header.GetSecurityFlags() == reference.securityFlags && header.GetMessageCounter() == reference.messageCounter &&
+        header.GetSourceNodeId() == reference.sourceNodeId && header.GetDestinationNodeId() == reference.destinationNodeId &&
+        header.GetDestinationGroupId() == reference.destinationGroupId;
+}
+
+bool Matches(const PayloadHeader & header, const ReferencePayloadHeader & reference)
+{
+    return header.GetExchangeFlags() == reference.exchangeFlags && header.GetMessageType() == reference.messageType &&
+        header.GetExchangeID() == reference.exchangeId &&
+        header.GetProtocolID() == Protocols::Id(static_cast<VendorId>(reference.vendorId), reference.protocolId) &&
+        header.GetAckMessageCounter() == reference.ackMessageCounter;
+}
+
+} // namespace Test
+} // namespace chip
@@ -0,0 +1,79 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Field-by-field message header decoders, kept as a reference for the
+ *      table-driven ones in MessageHeader.cpp: the fuzzer checks that both
+ *      agree and the benchmark compares their speed.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/GroupId.h>
+#include <lib/core/NodeId.h>
+#include <lib/core/Optional.h>
+#include <transport/raw/MessageHeader.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace Test {
+
+struct ReferencePacketHeader
+{
+    uint8_t messageFlags    = 0;
+    uint16_t sessionId      = 0;
+    uint8_t securityFlags   = 0;
+    uint32_t messageCounter = 0;
+    Optional<NodeId> sourceNodeId;
+    Optional<NodeId> destinationNodeId;
+    Optional<GroupId> destinationGroupId;
+};
+
+struct ReferencePayloadHeader
+{
+    uint8_t exchangeFlags = 0;
+    uint8_t messageType   = 0;
+    uint16_t exchangeId   = 0;
+    uint16_t vendorId     = 0;
+    uint16_t protocolId   = 0;
+    Optional<uint32_t> ackMessageCounter;
+};
+
+/// Decodes the message flags, session id and security flags, like PacketHeader::DecodeFixed.
+CHIP_ERROR ReferenceDecodeFixed(const uint8_t * data, size_t size, ReferencePacketHeader & header);
+
+/// Decodes a packet header, like PacketHeader::Decode.
+CHIP_ERROR ReferenceDecode(const uint8_t * data, size_t size, ReferencePacketHeader & header, uint16_t * decode_size);
+
+/// Decodes a payload header, like PayloadHeader::Decode.
+CHIP_ERROR ReferenceDecode(const uint8_t * data, size_t size, ReferencePayloadHeader & header, uint16_t * decode_size);
+
+/// Length of the privacy header of a packet header, like PacketHeader::PrivacyHeaderLength.
+size_t ReferencePrivacyHeaderLength(const ReferencePacketHeader & header);
+
+/// Whether a header decoded by PacketHeader matches the reference one.
+bool Matches(const PacketHeader & header, const ReferencePacketHeader & reference);
+
+/// Whether a header decoded by PayloadHeader matches the reference one.
+bool Matches(const PayloadHeader & header, const ReferencePayloadHeader & reference);
+
+} // namespace Test
+} // namespace chip
@@ -38,6 +38,13 @@ public:
         return tcp.FindActiveConnection(peerAddress);
     }
     static Inet::TCPEndPoint * GetEndpoint(void * state) { return static_cast<ActiveTCPConnectionState *>(state)->mEndPoint; }
+    static bool HasReceivedData(void * state) { return !static_cast<ActiveTCPConnectionState *>(state)->mReceived.IsNull(); }
+    static bool IsReassembling(void * state) { return !static_cast<ActiveTCPConnectionState *>(state)->mReassembly.IsNull(); }
+    static size_t GetReassemblyCapacity(void * state)
+    {
+        const auto & reassembly = static_cast<ActiveTCPConnectionState *>(state)->mReassembly;
+        return reassembly.IsNull() ? 0 : reassembly->DataLength() + reassembly->AvailableDataLength();
+    }
 
     static CHIP_ERROR ProcessReceivedBuffer(TCPImpl & tcp, Inet::TCPEndPoint * endPoint, const PeerAddress & peerAddress,
                                             System::PacketBufferHandle && buffer)
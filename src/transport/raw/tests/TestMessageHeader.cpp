@@ -31,6 +31,7 @@
 #include <lib/support/CodeUtils.h>
 #include <protocols/Protocols.h>
 #include <transport/raw/MessageHeader.h>
+#include <transport/raw/tests/MessageHeaderReference.h>
 
 namespace {
 
@@ -534,4 +535,92 @@ TEST(TestMessageHeader, TestMsgExtensionsDecode)
     chip::Platform::MemoryShutdown();
 }
 
+TEST(TestMessageHeader, TestEncodeBeforeData)
+{
+    ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+
+    const uint8_t appData[] = { 0xAA, 0xBB };
+    System::PacketBufferHandle msg = System::PacketBufferHandle::NewWithData(appData, sizeof(appData));
+    ASSERT_FALSE(msg.IsNull());
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(Protocols::Id(VendorId::TestVendor1, 0x1234), 5).SetExchangeID(42).SetAckMessageCounter(7);
+    EXPECT_EQ(payloadHeader.EncodeBeforeData(msg), CHIP_NO_ERROR);
+
+    PacketHeader packetHeader;
+    packetHeader.SetMessageCounter(123).SetSourceNodeId(1);
+    EXPECT_EQ(packetHeader.EncodeBeforeData(msg), CHIP_NO_ERROR);
+    EXPECT_EQ(msg->DataLength(), packetHeader.EncodeSizeBytes() + payloadHeader.EncodeSizeBytes() + sizeof(appData));
+
+    PacketHeader decodedPacketHeader;
+    PayloadHeader decodedPayloadHeader;
+    EXPECT_EQ(decodedPacketHeader.DecodeAndConsume(msg), CHIP_NO_ERROR);
+    EXPECT_EQ(decodedPacketHeader.GetMessageCounter(), 123u);
+    EXPECT_EQ(decodedPacketHeader.GetSourceNodeId(), Optional<NodeId>::Value(1));
+    EXPECT_EQ(decodedPayloadHeader.DecodeAndConsume(msg), CHIP_NO_ERROR);
+    EXPECT_TRUE(decodedPayloadHeader.HasProtocol(Protocols::Id(VendorId::TestVendor1, 0x1234)));
+    EXPECT_EQ(decodedPayloadHeader.GetMessageType(), 5);
+    EXPECT_EQ(decodedPayloadHeader.GetExchangeID(), 42);
+    EXPECT_EQ(decodedPayloadHeader.GetAckMessageCounter(), Optional<uint32_t>::Value(7));
+    ASSERT_EQ(msg->DataLength(), sizeof(appData));
+    EXPECT_EQ(memcmp(msg->Start(), appData, sizeof(appData)), 0);
+
+    msg = nullptr;
+    chip::Platform::MemoryShutdown();
+}
+
+TEST(TestMessageHeader, TestDecodeMatchesReference)
+{
+    // Every combination of flag bytes, over filler that makes extensions either
+    // empty or 257 bytes long, at lengths that truncate each field.
+    uint8_t buffer[320];
+    const size_t lengths[] = {
+        0, 1, 3, 4, 5, 7, 8, 9, 10, 11, 12, 16, 17, 18, 19, 20, 24, 25, 26, 27, 28, 40, 300, sizeof(buffer),
+    };
+
+    for (uint8_t filler : { uint8_t(0x00), uint8_t(0x01) })
+    {
+        memset(buffer, filler, sizeof(buffer));
+        for (unsigned first = 0; first <= UINT8_MAX; first++)
+        {
+            for (unsigned securityFlags = 0; securityFlags <= UINT8_MAX; securityFlags++)
+            {
+                buffer[0] = static_cast<uint8_t>(first);
+                buffer[3] = static_cast<uint8_t>(securityFlags);
+                for (size_t length : lengths)
+                {
+                    PacketHeader header;
+                    chip::Test::ReferencePacketHeader referenceHeader;
+                    uint16_t decodeLen          = 0;
+                    uint16_t referenceDecodeLen = 0;
+                    CHIP_ERROR err              = header.Decode(buffer, length, &decodeLen);
+                    ASSERT_EQ(err, chip::Test::ReferenceDecode(buffer, length, referenceHeader, &referenceDecodeLen));
+                    if (err == CHIP_NO_ERROR)
+                    {
+                        EXPECT_EQ(decodeLen, referenceDecodeLen);
+                        EXPECT_TRUE(chip::Test::Matches(header, referenceHeader));
+                        EXPECT_EQ(header.PrivacyHeaderLength(), chip::Test::ReferencePrivacyHeaderLength(referenceHeader));
+                    }
+                }
+            }
+
+            // The first byte holds the exchange flags of a payload header.
+            for (size_t length : lengths)
+            {
+                PayloadHeader header;
+                chip::Test::ReferencePayloadHeader referenceHeader;
+                uint16_t decodeLen          = 0;
+                uint16_t referenceDecodeLen = 0;
+                CHIP_ERROR err              = header.Decode(buffer, length, &decodeLen);
+                ASSERT_EQ(err, chip::Test::ReferenceDecode(buffer, length, referenceHeader, &referenceDecodeLen));
+                if (err == CHIP_NO_ERROR)
+                {
+                    EXPECT_EQ(decodeLen, referenceDecodeLen);
+                    EXPECT_TRUE(chip::Test::Matches(header, referenceHeader));
+                }
+            }
+        }
+    }
+}
+
 } // namespace
@@ -742,6 +742,32 @@ TEST_F(TestTCP, CheckProcessReceivedBuffer)
     EXPECT_EQ(err, CHIP_NO_ERROR);
     EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 1);
 
+    // Test a large message received one buffer at a time. Each buffer is released once copied into the reassembled message.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    constexpr size_t kSegmentCount                     = 40;
+    uint32_t segmentSizes[kSegmentCount + 1]           = {};
+    for (size_t i = 0; i < kSegmentCount; i++)
+    {
+        segmentSizes[i] = 1000;
+    }
+    EXPECT_TRUE(testData[0].Init(segmentSizes));
+    for (size_t i = 0; i < kSegmentCount; i++)
+    {
+        EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 0);
+        err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, testData[0].mHandle.PopHead());
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        EXPECT_FALSE(TestAccess::HasReceivedData(state));
+
+        // The reassembly buffer grows with the received data rather than being allocated at the announced message size.
+        const size_t received = (i + 1) * 1000;
+        if (i + 1 < kSegmentCount)
+        {
+            EXPECT_LE(TestAccess::GetReassemblyCapacity(state),
+                      std::max<size_t>(2 * received, System::PacketBuffer::kMaxSizeWithoutReserve) + kPacketSizeBytes);
+        }
+    }
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 1);
+
     // Test a message that is too large to coalesce into a single packet buffer.
     gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
     gMockTransportMgrDelegate.SetCallback(TestDataCallbackCheck, &testData[1]);
@@ -757,4 +783,48 @@ TEST_F(TestTCP, CheckProcessReceivedBuffer)
     EXPECT_EQ(TestAccess::GetEndpoint(state), nullptr);
 }
 
+TEST_F(TestTCP, CheckReassemblyNotTakenByReceiver)
+{
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    uint16_t port = GetRandomPort();
+    MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+    gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr, port);
+    gMockTransportMgrDelegate.SingleMessageTest(tcp, addr, port);
+
+    Transport::PeerAddress lPeerAddress = Transport::PeerAddress::TCP(addr, port);
+    void * state                        = TestAccess::FindActiveConnection(tcp, lPeerAddress);
+    ASSERT_NE(state, nullptr);
+    TCPEndPoint * lEndPoint = TestAccess::GetEndpoint(state);
+    ASSERT_NE(lEndPoint, nullptr);
+
+    TestData testData[1];
+    gMockTransportMgrDelegate.SetCallback(TestDataCallbackCheck, testData);
+
+    // MockTransportMgrDelegate does not take ownership of the messages it receives, like SessionManager when a header fails
+    // to decode. Each reassembled message must still leave the connection ready for the next one.
+    constexpr size_t kSegmentCount           = 20;
+    uint32_t segmentSizes[kSegmentCount + 1] = {};
+    for (size_t i = 0; i < kSegmentCount; i++)
+    {
+        segmentSizes[i] = 1000;
+    }
+    for (int message = 0; message < 2; message++)
+    {
+        gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+        EXPECT_TRUE(testData[0].Init(segmentSizes));
+        for (size_t i = 0; i < kSegmentCount; i++)
+        {
+            CHIP_ERROR err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, testData[0].mHandle.PopHead());
+            EXPECT_EQ(err, CHIP_NO_ERROR);
+        }
+        EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 1);
+        EXPECT_FALSE(TestAccess::IsReassembling(state));
+        EXPECT_FALSE(TestAccess::HasReceivedData(state));
+    }
+}
+
 } // namespace
@@ -0,0 +1,185 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Message header decoding microbenchmark.
+ *
+ *      Decodes typical packet and payload headers with the table-driven
+ *      decoders of MessageHeader.cpp and with the field-by-field reference
+ *      ones, and prints one HEADER_BENCHMARK line per header. See README.md
+ *      for the output format.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <transport/raw/MessageHeader.h>
+#include <transport/raw/tests/MessageHeaderReference.h>
+
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace {
+
+using namespace chip;
+
+constexpr uint32_t kDefaultIterations = 1000000;
+
+uint32_t GetIterations()
+{
+    const char * value = getenv("CHIP_HEADER_BENCHMARK_ITERATIONS");
+    VerifyOrReturnValue(value != nullptr && *value != '\0', kDefaultIterations);
+    unsigned long parsed = strtoul(value, nullptr, 10);
+    return (parsed > 0 && parsed <= UINT32_MAX) ? static_cast<uint32_t>(parsed) : kDefaultIterations;
+}
+
+// Keeps the decoded values alive so that the loops are not optimized out.
+volatile uint32_t gSink;
+
+template <typename Decode>
+double NanosecondsPerDecode(uint32_t iterations, Decode && decode)
+{
+    uint32_t sink    = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        sink += decode();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    gSink          = sink;
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / iterations;
+}
+
+void Report(const char * name, uint32_t iterations, double referenceNs, double fastNs)
+{
+    printf("HEADER_BENCHMARK case=%s iterations=%" PRIu32 " reference_ns=%.1f fast_ns=%.1f speedup=%.2f\n", name, iterations,
+           referenceNs, fastNs, fastNs > 0 ? referenceNs / fastNs : 0);
+}
+
+void BenchmarkPacketHeader(const char * name, const uint8_t * data, size_t size)
+{
+    const uint32_t iterations = GetIterations();
+
+    PacketHeader header;
+    uint16_t decodeSize = 0;
+    ASSERT_EQ(header.Decode(data, size, &decodeSize), CHIP_NO_ERROR);
+
+    const double referenceNs = NanosecondsPerDecode(iterations, [&] {
+        chip::Test::ReferencePacketHeader referenceHeader;
+        uint16_t len = 0;
+        VerifyOrDie(chip::Test::ReferenceDecode(data, size, referenceHeader, &len) == CHIP_NO_ERROR);
+        return referenceHeader.messageCounter + len;
+    });
+    const double fastNs = NanosecondsPerDecode(iterations, [&] {
+        uint16_t len = 0;
+        VerifyOrDie(header.Decode(data, size, &len) == CHIP_NO_ERROR);
+        return header.GetMessageCounter() + len;
+    });
+    Report(name, iterations, referenceNs, fastNs);
+}
+
+void BenchmarkPayloadHeader(const char * name, const uint8_t * data, size_t size)
+{
+    const uint32_t iterations = GetIterations();
+
+    PayloadHeader header;
+    uint16_t decodeSize = 0;
+    ASSERT_EQ(header.Decode(data, size, &decodeSize), CHIP_NO_ERROR);
+
+    const double referenceNs = NanosecondsPerDecode(iterations, [&] {
+        chip::Test::ReferencePayloadHeader referenceHeader;
+        uint16_t len = 0;
+        VerifyOrDie(chip::Test::ReferenceDecode(data, size, referenceHeader, &len) == CHIP_NO_ERROR);
+        return referenceHeader.exchangeId + len;
+    });
+    const double fastNs = NanosecondsPerDecode(iterations, [&] {
+        uint16_t len = 0;
+        VerifyOrDie(header.Decode(data, size, &len) == CHIP_NO_ERROR);
+        return header.GetExchangeID() + len;
+    });
+    Report(name, iterations, referenceNs, fastNs);
+}
+
+// Flags, session id 0x1234, message counter 0x0C0B0A09, then the ids that the flags announce.
+const uint8_t kUnicastPacketHeader[] = { 0x00, 0x34, 0x12, 0x00, 0x09, 0x0A, 0x0B, 0x0C };
+const uint8_t kUnsecuredPacketHeader[] = {
+    0x04, 0x00, 0x00, 0x00, 0x09, 0x0A, 0x0B, 0x0C, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+};
+const uint8_t kGroupPacketHeader[] = {
+    0x06, 0x34, 0x12, 0x01, 0x09, 0x0A, 0x0B, 0x0C, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22,
+};
+const uint8_t kExtensionPacketHeader[] = {
+    0x00, 0x34, 0x12, 0x20, 0x09, 0x0A, 0x0B, 0x0C, 0x04, 0x00, 0xE4, 0xE3, 0xE2, 0xE1,
+};
+
+// Exchange flags, message type, exchange id, then the vendor id, protocol id and ack counter.
+const uint8_t kPayloadHeader[]    = { 0x05, 0x02, 0x34, 0x12, 0x01, 0x00 };
+const uint8_t kAckPayloadHeader[] = { 0x07, 0x05, 0x34, 0x12, 0x01, 0x00, 0x09, 0x0A, 0x0B, 0x0C };
+const uint8_t kVendorPayloadHeader[] = {
+    0x17, 0x05, 0x34, 0x12, 0xF1, 0xFF, 0x01, 0x00, 0x09, 0x0A, 0x0B, 0x0C,
+};
+
+TEST(MessageHeaderBenchmark, PacketHeader)
+{
+    BenchmarkPacketHeader("unicast", kUnicastPacketHeader, sizeof(kUnicastPacketHeader));
+    BenchmarkPacketHeader("unsecured", kUnsecuredPacketHeader, sizeof(kUnsecuredPacketHeader));
+    BenchmarkPacketHeader("group", kGroupPacketHeader, sizeof(kGroupPacketHeader));
+    BenchmarkPacketHeader("message_extension", kExtensionPacketHeader, sizeof(kExtensionPacketHeader));
+}
+
+TEST(MessageHeaderBenchmark, PayloadHeader)
+{
+    BenchmarkPayloadHeader("payload", kPayloadHeader, sizeof(kPayloadHeader));
+    BenchmarkPayloadHeader("payload_ack", kAckPayloadHeader, sizeof(kAckPayloadHeader));
+    BenchmarkPayloadHeader("payload_vendor", kVendorPayloadHeader, sizeof(kVendorPayloadHeader));
+}
+
+// What a group message with privacy goes through: a partial decode to locate
+// the privacy header, then the full decode once it is deobfuscated.
+TEST(MessageHeaderBenchmark, PrivacyHeader)
+{
+    const uint32_t iterations = GetIterations();
+    const uint8_t * data      = kGroupPacketHeader;
+    const size_t size         = sizeof(kGroupPacketHeader);
+
+    const double referenceNs = NanosecondsPerDecode(iterations, [&] {
+        chip::Test::ReferencePacketHeader partialHeader;
+        chip::Test::ReferencePacketHeader referenceHeader;
+        uint16_t len = 0;
+        VerifyOrDie(chip::Test::ReferenceDecodeFixed(data, size, partialHeader) == CHIP_NO_ERROR);
+        const size_t privacyLength = chip::Test::ReferencePrivacyHeaderLength(partialHeader);
+        VerifyOrDie(chip::Test::ReferenceDecode(data, size, referenceHeader, &len) == CHIP_NO_ERROR);
+        return static_cast<uint32_t>(privacyLength) + len;
+    });
+
+    PacketHeader partialHeader;
+    PacketHeader header;
+    const double fastNs = NanosecondsPerDecode(iterations, [&] {
+        uint16_t len = 0;
+        VerifyOrDie(partialHeader.DecodeFixed(data, size) == CHIP_NO_ERROR);
+        const size_t privacyLength = partialHeader.PrivacyHeaderLength();
+        VerifyOrDie(header.Decode(data, size, &len) == CHIP_NO_ERROR);
+        return static_cast<uint32_t>(privacyLength) + len;
+    });
+    Report("group_privacy", iterations, referenceNs, fastNs);
+}
+
+} // namespace
@@ -43,6 +43,7 @@ public:
     static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
 
     void ValidateSessionSorting();
+    void ValidateSessionLookups();
 
 private:
     struct SessionParameters
@@ -461,5 +462,95 @@ TEST_F(TestSecureSessionTable, ValidateSessionSorting)
     ValidateSessionSorting();
 }
 
+void TestSecureSessionTable::ValidateSessionLookups()
+{
+    const ReliableMessageProtocolConfig config(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                               System::Clock::Milliseconds16(0));
+
+    constexpr size_t kSessionCount = 12;
+    SecureSession * sessions[kSessionCount];
+    uint16_t localSessionIds[kSessionCount];
+
+    mSessionTable = Platform::MakeUnique<SecureSessionTable>();
+    ASSERT_NE(mSessionTable.get(), nullptr);
+
+    mSessionTable->Init();
+    mSessionTable->mNextSessionId = kMaxSessionID;
+
+    for (size_t i = 0; i < kSessionCount; i++)
+    {
+        auto session = mSessionTable->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+        ASSERT_TRUE(session.HasValue());
+
+        sessions[i]        = session.Value()->AsSecureSession();
+        localSessionIds[i] = sessions[i]->GetLocalSessionId();
+        sessions[i]->Activate(ScopedNodeId(1, kFabric1), ScopedNodeId(static_cast<NodeId>(2 + i % 3), kFabric1), CATValues(),
+                              static_cast<uint16_t>(i), config);
+    }
+
+    // Session IDs wrap around, skipping the unsecured session ID.
+    EXPECT_EQ(localSessionIds[0], kMaxSessionID);
+    EXPECT_EQ(localSessionIds[1], 1);
+    EXPECT_EQ(localSessionIds[kSessionCount - 1], kSessionCount - 1);
+
+    for (size_t i = 0; i < kSessionCount; i++)
+    {
+        auto found = mSessionTable->FindSecureSessionByLocalKey(localSessionIds[i]);
+        ASSERT_TRUE(found.HasValue());
+        EXPECT_EQ(found.Value()->AsSecureSession(), sessions[i]);
+    }
+
+    auto countSessionsWithPeer = [this](const ScopedNodeId & peer) {
+        size_t count = 0;
+        mSessionTable->ForEachSessionWithPeer(peer, [&](SecureSession * session) {
+            EXPECT_EQ(session->GetPeer(), peer);
+            count++;
+            return Loop::Continue;
+        });
+        return count;
+    };
+
+    EXPECT_EQ(countSessionsWithPeer(ScopedNodeId(3, kFabric1)), 4u);
+    EXPECT_EQ(countSessionsWithPeer(ScopedNodeId(3, kFabric2)), 0u);
+
+    // Release every other session, the remaining ones must still be found.
+    for (size_t i = 0; i < kSessionCount; i += 2)
+    {
+        sessions[i]->MarkForEviction();
+    }
+
+    for (size_t i = 0; i < kSessionCount; i++)
+    {
+        EXPECT_EQ(mSessionTable->FindSecureSessionByLocalKey(localSessionIds[i]).HasValue(), (i % 2) == 1);
+    }
+
+    EXPECT_EQ(countSessionsWithPeer(ScopedNodeId(3, kFabric1)), 2u);
+
+    // Released session IDs become available again.
+    mSessionTable->mNextSessionId = kMaxSessionID;
+
+    auto reused = mSessionTable->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    ASSERT_TRUE(reused.HasValue());
+    EXPECT_EQ(reused.Value()->AsSecureSession()->GetLocalSessionId(), kMaxSessionID);
+
+    reused = mSessionTable->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    ASSERT_TRUE(reused.HasValue());
+    EXPECT_EQ(reused.Value()->AsSecureSession()->GetLocalSessionId(), 2);
+
+    // PASE sessions become reachable through their new peer once they adopt a fabric.
+    auto pase = mSessionTable->CreateNewSecureSession(SecureSession::Type::kPASE, ScopedNodeId());
+    ASSERT_TRUE(pase.HasValue());
+    pase.Value()->AsSecureSession()->Activate(ScopedNodeId(), ScopedNodeId(), CATValues(), 0, config);
+
+    EXPECT_EQ(countSessionsWithPeer(ScopedNodeId(kUndefinedNodeId, kFabric2)), 0u);
+    EXPECT_EQ(pase.Value()->AsSecureSession()->AdoptFabricIndex(kFabric2), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessionsWithPeer(ScopedNodeId(kUndefinedNodeId, kFabric2)), 1u);
+}
+
+TEST_F(TestSecureSessionTable, ValidateSessionLookups)
+{
+    ValidateSessionLookups();
+}
+
 } // namespace Transport
 } // namespace chip
@@ -0,0 +1,166 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Secure session table microbenchmark.
+ *
+ *      Fills a SecureSessionTable up to CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
+ *      and times session lookups and allocations with eviction, printing one
+ *      SESSION_TABLE_BENCHMARK line per case. Build it once with and once
+ *      without CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED to compare both
+ *      tables. See README.md for the output format.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <transport/SecureSessionTable.h>
+
+#include <algorithm>
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Transport;
+
+constexpr uint32_t kDefaultIterations = 100000;
+
+// Allocations evict a session each time, which is much slower than a lookup.
+constexpr uint32_t kAllocationIterationsDivider = 100;
+
+constexpr size_t kSessionCount         = CHIP_CONFIG_SECURE_SESSION_POOL_SIZE;
+constexpr FabricIndex kFabricCount     = 4;
+constexpr size_t kSessionsPerPeer      = 2;
+constexpr NodeId kLocalNodeId          = 1;
+constexpr NodeId kFirstPeerNodeId      = 0x1000;
+constexpr uint16_t kFirstPeerSessionId = 1;
+
+uint32_t GetIterations()
+{
+    const char * value = getenv("CHIP_SESSION_TABLE_BENCHMARK_ITERATIONS");
+    VerifyOrReturnValue(value != nullptr && *value != '\0', kDefaultIterations);
+    unsigned long parsed = strtoul(value, nullptr, 10);
+    return (parsed > 0 && parsed <= UINT32_MAX) ? static_cast<uint32_t>(parsed) : kDefaultIterations;
+}
+
+// Keeps the results alive so that the loops are not optimized out.
+volatile uint32_t gSink;
+
+template <typename Operation>
+double NanosecondsPerOperation(uint32_t iterations, Operation && operation)
+{
+    uint32_t sink    = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        sink += operation(i);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    gSink          = sink;
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / iterations;
+}
+
+void Report(const char * name, uint32_t iterations, double ns)
+{
+    printf("SESSION_TABLE_BENCHMARK case=%s indexed=%d sessions=%u iterations=%" PRIu32 " ns=%.1f\n", name,
+           CHIP_CONFIG_SECURE_SESSION_TABLE_INDEXED, static_cast<unsigned>(kSessionCount), iterations, ns);
+}
+
+// Sessions are spread over kFabricCount fabrics, with kSessionsPerPeer sessions per peer node.
+ScopedNodeId PeerForSession(size_t sessionIndex)
+{
+    return ScopedNodeId(kFirstPeerNodeId + sessionIndex / kSessionsPerPeer,
+                        static_cast<FabricIndex>(1 + (sessionIndex / kSessionsPerPeer) % kFabricCount));
+}
+
+SecureSession * AllocateSession(SecureSessionTable & table, size_t sessionIndex)
+{
+    const ReliableMessageProtocolConfig config(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                               System::Clock::Milliseconds16(0));
+
+    auto handle = table.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    VerifyOrDie(handle.HasValue());
+
+    const ScopedNodeId peer      = PeerForSession(sessionIndex);
+    const uint16_t peerSessionId = static_cast<uint16_t>(kFirstPeerSessionId + sessionIndex % kMaxSessionID);
+    SecureSession * session      = handle.Value()->AsSecureSession();
+    session->Activate(ScopedNodeId(kLocalNodeId, peer.GetFabricIndex()), peer, CATValues(), peerSessionId, config);
+    return session;
+}
+
+class SecureSessionTableBenchmark : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        mTable.Init();
+        for (size_t i = 0; i < kSessionCount; i++)
+        {
+            mLocalSessionIds[i] = AllocateSession(mTable, i)->GetLocalSessionId();
+        }
+    }
+
+protected:
+    SecureSessionTable mTable;
+    uint16_t mLocalSessionIds[kSessionCount];
+};
+
+// What every incoming secured message goes through.
+TEST_F(SecureSessionTableBenchmark, FindByLocalSessionId)
+{
+    const uint32_t iterations = GetIterations();
+    const double ns           = NanosecondsPerOperation(iterations, [&](uint32_t i) -> uint32_t {
+        return mTable.FindSecureSessionByLocalKey(mLocalSessionIds[i % kSessionCount]).HasValue() ? 1 : 0;
+    });
+    Report("find_by_local_id", iterations, ns);
+}
+
+// What finding a session to a node, or marking its sessions defunct, goes through.
+TEST_F(SecureSessionTableBenchmark, FindByPeer)
+{
+    const uint32_t iterations = GetIterations();
+    const double ns           = NanosecondsPerOperation(iterations, [&](uint32_t i) -> uint32_t {
+        uint32_t count = 0;
+        mTable.ForEachSessionWithPeer(PeerForSession(i % kSessionCount), [&count](SecureSession *) {
+            count++;
+            return Loop::Continue;
+        });
+        return count;
+    });
+    Report("find_by_peer", iterations, ns);
+}
+
+// With a full table, each allocation picks an unused session ID and evicts a session.
+TEST_F(SecureSessionTableBenchmark, AllocateWithEviction)
+{
+    const uint32_t iterations = std::max<uint32_t>(GetIterations() / kAllocationIterationsDivider, 1);
+    const double ns           = NanosecondsPerOperation(iterations, [&](uint32_t i) -> uint32_t {
+        return AllocateSession(mTable, kSessionCount + i)->GetLocalSessionId();
+    });
+    Report("allocate_evict", iterations, ns);
+}
+
+} // namespace